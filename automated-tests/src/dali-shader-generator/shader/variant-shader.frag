@@ -0,0 +1,10 @@
+uniform lowp vec4 uColor;
+
+void main()
+{
+#ifdef IS_REQUIRED_OPAQUE
+  gl_FragColor = vec4(uColor.rgb, 1.0);
+#else
+  gl_FragColor = uColor;
+#endif
+}
@@ -0,0 +1,13 @@
+attribute mediump vec2 aPosition;
+uniform highp mat4 uMvpMatrix;
+uniform highp vec3 uSize;
+
+void main()
+{
+  // The comments are stripped from the variants
+#ifdef IS_REQUIRED_SCALE
+  gl_Position = uMvpMatrix * vec4(aPosition * uSize.xy * 2.0, 0.0, 1.0);
+#else
+  gl_Position = uMvpMatrix * vec4(aPosition * uSize.xy, 0.0, 1.0);
+#endif
+}
@@ -1384,3 +1384,107 @@ int UtcDaliWebViewAccessible(void)
 
   END_TEST;
 }
+
+int UtcDaliAccessibilityLazyAccessibleCreation(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the accessible objects are created only once the bridge is up, when the creation is lazy");
+
+  DALI_TEST_EQUALS(DevelControl::IsLazyAccessibleCreationEnabled(), false, TEST_LOCATION);
+  DevelControl::EnableLazyAccessibleCreation(true);
+  DALI_TEST_EQUALS(DevelControl::IsLazyAccessibleCreationEnabled(), true, TEST_LOCATION);
+
+  auto control     = Control::New();
+  auto destination = Control::New();
+  application.GetScene().Add(control);
+  application.GetScene().Add(destination);
+
+  control.SetProperty(Actor::Property::VISIBLE, false);
+  control.SetProperty(Actor::Property::VISIBLE, true);
+  DevelControl::GetAccessibilityStates(control);
+  DevelControl::NotifyAccessibilityStateChange(control, Dali::Accessibility::States{}, false);
+  DALI_TEST_EQUALS(DevelControl::IsAccessibleCreated(control), false, TEST_LOCATION);
+  DALI_TEST_CHECK(DevelControl::GetAccessibilityTreeSnapshot(control).Empty());
+
+  tet_infoline("The target of a relation is created as the relation keeps it");
+  DevelControl::AppendAccessibilityRelation(control, destination, Accessibility::RelationType::FLOWS_TO);
+  DALI_TEST_EQUALS(DevelControl::IsAccessibleCreated(destination), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::IsAccessibleCreated(control), false, TEST_LOCATION);
+
+  Dali::Accessibility::TestEnableSC(true);
+
+  auto accessible = dynamic_cast<DevelControl::ControlAccessible*>(Dali::Accessibility::Accessible::Get(control));
+  DALI_TEST_CHECK(accessible);
+  DALI_TEST_EQUALS(DevelControl::IsAccessibleCreated(control), true, TEST_LOCATION);
+
+  auto relations = DevelControl::GetAccessibilityRelations(control);
+  DALI_TEST_EQUALS(relations.size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(relations[0].mTargets[0], Dali::Accessibility::Accessible::Get(destination), TEST_LOCATION);
+
+  Dali::Accessibility::TestEnableSC(false);
+  DevelControl::EnableLazyAccessibleCreation(false);
+
+  END_TEST;
+}
+
+int UtcDaliAccessibilityTreeSnapshot(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the snapshot of the accessibility tree has a node for each descendant");
+
+  Dali::Accessibility::TestEnableSC(true);
+
+  auto parent = Control::New();
+  parent.SetProperty(DevelControl::Property::ACCESSIBILITY_NAME, "parent");
+  parent.SetProperty(DevelControl::Property::ACCESSIBILITY_DESCRIPTION, "description");
+  parent.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 50.0f));
+  DevelControl::AppendAccessibilityAttribute(parent, "key", "value");
+
+  auto child1 = PushButton::New();
+  child1.SetProperty(DevelControl::Property::ACCESSIBILITY_NAME, "child1");
+  auto child2 = Control::New();
+  child2.SetProperty(DevelControl::Property::ACCESSIBILITY_NAME, "child2");
+  auto grandChild = Control::New();
+  grandChild.SetProperty(DevelControl::Property::ACCESSIBILITY_NAME, "grandChild");
+
+  parent.Add(child1);
+  parent.Add(child2);
+  child2.Add(grandChild);
+  application.GetScene().Add(parent);
+
+  application.SendNotification();
+  application.Render();
+
+  Property::Map snapshot = DevelControl::GetAccessibilityTreeSnapshot(parent);
+  DALI_TEST_EQUALS(snapshot.Find("name")->Get<std::string>(), "parent", TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.Find("description")->Get<std::string>(), "description", TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.Find("role")->Get<std::string>(), Dali::Accessibility::Accessible::Get(parent)->GetRoleName(), TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.Find("attributes")->GetMap()->Find("key")->Get<std::string>(), "value", TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.Find("extents")->Get<Vector4>().z, 100.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.Find("extents")->Get<Vector4>().w, 50.0f, TEST_LOCATION);
+
+  auto* states = snapshot.Find("states")->GetArray();
+  DALI_TEST_CHECK(states);
+  bool visible = false;
+  for(std::size_t i = 0; i < states->Count(); ++i)
+  {
+    visible |= ((*states)[i].Get<int>() == static_cast<int>(Dali::Accessibility::State::VISIBLE));
+  }
+  DALI_TEST_CHECK(visible);
+
+  auto* children = snapshot.Find("children")->GetArray();
+  DALI_TEST_CHECK(children);
+  DALI_TEST_EQUALS(children->Count(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS((*children)[0].GetMap()->Find("name")->Get<std::string>(), "child1", TEST_LOCATION);
+  DALI_TEST_EQUALS((*children)[0].GetMap()->Find("role")->Get<std::string>(), "push button", TEST_LOCATION);
+  DALI_TEST_EQUALS((*children)[1].GetMap()->Find("name")->Get<std::string>(), "child2", TEST_LOCATION);
+
+  auto* grandChildren = (*children)[1].GetMap()->Find("children")->GetArray();
+  DALI_TEST_EQUALS(grandChildren->Count(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS((*grandChildren)[0].GetMap()->Find("name")->Get<std::string>(), "grandChild", TEST_LOCATION);
+  DALI_TEST_EQUALS((*grandChildren)[0].GetMap()->Find("children")->GetArray()->Count(), 0u, TEST_LOCATION);
+
+  Dali::Accessibility::TestEnableSC(false);
+
+  END_TEST;
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-event-thread-callback.h>
+
+#include <dali-toolkit/devel-api/image-loader/atlas-upload-observer.h>
+#include <dali-toolkit/internal/image-loader/atlas-packer.h>
+#include <dali-toolkit/internal/image-loader/image-atlas-impl.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_internal_atlas_packer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_internal_atlas_packer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* TEST_IMAGE_34_FILE_NAME = TEST_RESOURCE_DIR "/icon-edit.png";
+const char* TEST_IMAGE_50_FILE_NAME = TEST_RESOURCE_DIR "/icon-delete.png";
+
+struct Block
+{
+  AtlasPacker::SizeType x;
+  AtlasPacker::SizeType y;
+  AtlasPacker::SizeType width;
+  AtlasPacker::SizeType height;
+};
+
+bool IsOverlap(const Block& lhs, const Block& rhs)
+{
+  return lhs.x < rhs.x + rhs.width && rhs.x < lhs.x + lhs.width && lhs.y < rhs.y + rhs.height && rhs.y < lhs.y + lhs.height;
+}
+
+bool IsOverlap(const std::vector<Block>& blocks)
+{
+  for(std::size_t i = 0; i < blocks.size(); ++i)
+  {
+    for(std::size_t j = i + 1; j < blocks.size(); ++j)
+    {
+      if(IsOverlap(blocks[i], blocks[j]))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * Packs blocks of pseudo random sizes until the atlas is full, removes every other block,
+ * and packs again. Returns the occupancy rate of the atlas after packing again.
+ */
+float PackAndRepack(AtlasPacker::Algorithm algorithm, uint32_t& packCount)
+{
+  const AtlasPacker::SizeType atlasSize = 512u;
+  AtlasPacker                 packer(atlasSize, atlasSize, algorithm);
+  std::vector<Block>          blocks;
+  uint32_t                    seed = 7u;
+
+  auto nextSize = [&seed]() {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<AtlasPacker::SizeType>(8u + (seed >> 16) % 56u);
+  };
+
+  for(uint32_t round = 0u; round < 4u; ++round)
+  {
+    uint32_t failCount = 0u;
+    while(failCount < 16u)
+    {
+      Block block{0u, 0u, nextSize(), nextSize()};
+      if(packer.Pack(block.width, block.height, block.x, block.y))
+      {
+        blocks.push_back(block);
+        ++packCount;
+      }
+      else
+      {
+        ++failCount;
+      }
+    }
+
+    std::vector<Block> keptBlocks;
+    for(std::size_t i = 0; i < blocks.size(); ++i)
+    {
+      if(i % 2u)
+      {
+        packer.DeleteBlock(blocks[i].x, blocks[i].y, blocks[i].width, blocks[i].height);
+      }
+      else
+      {
+        keptBlocks.push_back(blocks[i]);
+      }
+    }
+    blocks.swap(keptBlocks);
+  }
+
+  DALI_TEST_CHECK(!IsOverlap(blocks));
+
+  return 1.0f - static_cast<float>(packer.GetAvailableArea()) / static_cast<float>(atlasSize * atlasSize);
+}
+
+class TestUploadObserver : public Dali::Toolkit::AtlasUploadObserver
+{
+public:
+  void UploadCompleted() override
+  {
+    ++mUploadCount;
+  }
+
+  void TextureRectChanged(const Dali::Vector4& textureRect) override
+  {
+    mTextureRect = textureRect;
+    ++mChangeCount;
+  }
+
+  uint32_t      mUploadCount{0u};
+  uint32_t      mChangeCount{0u};
+  Dali::Vector4 mTextureRect;
+};
+
+} // namespace
+
+int UtcDaliAtlasPackerMaxRects(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliAtlasPackerMaxRects");
+
+  AtlasPacker packer(64u, 64u, AtlasPacker::Algorithm::MAX_RECTS);
+  DALI_TEST_CHECK(packer.GetAlgorithm() == AtlasPacker::Algorithm::MAX_RECTS);
+  DALI_TEST_EQUALS(packer.GetAvailableArea(), 64u * 64u, TEST_LOCATION);
+
+  std::vector<Block> blocks;
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    Block block{0u, 0u, 32u, 32u};
+    DALI_TEST_CHECK(packer.Pack(block.width, block.height, block.x, block.y));
+    blocks.push_back(block);
+  }
+  DALI_TEST_CHECK(!IsOverlap(blocks));
+  DALI_TEST_EQUALS(packer.GetAvailableArea(), 0u, TEST_LOCATION);
+
+  AtlasPacker::SizeType x, y;
+  DALI_TEST_CHECK(!packer.Pack(1u, 1u, x, y));
+
+  tet_infoline("The space of two diagonal blocks can't fit a wide block, the space of two adjacent blocks can.");
+  packer.DeleteBlock(blocks[0].x, blocks[0].y, 32u, 32u);
+  packer.DeleteBlock(blocks[3].x, blocks[3].y, 32u, 32u);
+  DALI_TEST_EQUALS(packer.GetAvailableArea(), 2u * 32u * 32u, TEST_LOCATION);
+  DALI_TEST_CHECK(!packer.Pack(64u, 32u, x, y));
+
+  DALI_TEST_CHECK(packer.Pack(32u, 32u, blocks[0].x, blocks[0].y));
+  DALI_TEST_CHECK(packer.Pack(32u, 32u, blocks[3].x, blocks[3].y));
+  DALI_TEST_CHECK(!IsOverlap(blocks));
+
+  packer.DeleteBlock(0u, 0u, 32u, 32u);
+  packer.DeleteBlock(32u, 0u, 32u, 32u);
+  DALI_TEST_CHECK(packer.Pack(64u, 32u, x, y));
+  DALI_TEST_EQUALS(y, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliAtlasPackerBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliAtlasPackerBenchmark");
+  tet_infoline("Packs blocks until the atlas is full, removes half of them and packs again.");
+
+  for(auto algorithm : {AtlasPacker::Algorithm::BINARY_TREE, AtlasPacker::Algorithm::MAX_RECTS})
+  {
+    uint32_t packCount = 0u;
+    auto     start     = std::chrono::steady_clock::now();
+    float    occupancy = PackAndRepack(algorithm, packCount);
+    auto     duration  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    tet_printf("%s : %u blocks packed, occupancy rate %f, %lld us\n", algorithm == AtlasPacker::Algorithm::MAX_RECTS ? "MAX_RECTS" : "BINARY_TREE", packCount, occupancy, static_cast<long long>(duration));
+    DALI_TEST_CHECK(occupancy > 0.5f);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliImageAtlasDefragment(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageAtlasDefragment");
+
+  IntrusivePtr<ImageAtlas> atlas = ImageAtlas::New(100u, 100u, Pixel::RGBA8888, AtlasPacker::Algorithm::MAX_RECTS);
+  atlas->SetDefragmentationEnabled(true);
+  TextureSet textureSet = atlas->GetTextureSet();
+  Texture    texture    = atlas->GetAtlas();
+  DALI_TEST_CHECK(textureSet.GetTexture(0u) == texture);
+
+  TestUploadObserver observer1, observer2, observer3;
+  Vector4            textureRect1, textureRect2, textureRect3;
+  DALI_TEST_CHECK(atlas->Upload(textureRect1, VisualUrl(TEST_IMAGE_50_FILE_NAME), ImageDimensions(50, 50), FittingMode::DEFAULT, true, &observer1));
+  DALI_TEST_CHECK(atlas->Upload(textureRect2, VisualUrl(TEST_IMAGE_50_FILE_NAME), ImageDimensions(50, 50), FittingMode::DEFAULT, true, &observer2));
+  DALI_TEST_CHECK(atlas->Upload(textureRect3, VisualUrl(TEST_IMAGE_34_FILE_NAME), ImageDimensions(34, 34), FittingMode::DEFAULT, true, &observer3));
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(3), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer1.mUploadCount + observer2.mUploadCount + observer3.mUploadCount, 3u, TEST_LOCATION);
+
+  tet_infoline("The atlas can't be defragmented while the images don't fit together.");
+  DALI_TEST_CHECK(!atlas->Defragment(ImageDimensions(100, 50)));
+
+  tet_infoline("Removing an image leaves a hole which is joined by the defragmentation.");
+  atlas->Remove(textureRect2);
+  DALI_TEST_CHECK(atlas->Defragment(ImageDimensions(100, 50)));
+  DALI_TEST_CHECK(atlas->IsDefragmenting());
+  DALI_TEST_CHECK(!atlas->Defragment(ImageDimensions(100, 50)));
+
+  tet_infoline("The pixel data can't be uploaded while the images are moved.");
+  Vector4   textureRect4;
+  PixelData pixelData = PixelData::New(new uint8_t[16 * 16 * 4], 16 * 16 * 4, 16, 16, Pixel::RGBA8888, PixelData::DELETE_ARRAY);
+  DALI_TEST_CHECK(!atlas->Upload(textureRect4, pixelData));
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(2), true, TEST_LOCATION);
+  DALI_TEST_CHECK(!atlas->IsDefragmenting());
+  DALI_TEST_EQUALS(atlas->GetDefragmentationCount(), 1u, TEST_LOCATION);
+
+  tet_infoline("The texture of the texture set is replaced, and the observers are notified.");
+  DALI_TEST_CHECK(atlas->GetAtlas() != texture);
+  DALI_TEST_CHECK(textureSet.GetTexture(0u) == atlas->GetAtlas());
+  DALI_TEST_EQUALS(observer1.mChangeCount + observer3.mChangeCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mChangeCount, 0u, TEST_LOCATION);
+
+  tet_infoline("The moved images can be removed with their new texture rect.");
+  atlas->Remove(observer1.mTextureRect);
+  atlas->Remove(observer3.mTextureRect);
+  DALI_TEST_EQUALS(atlas->GetOccupancyRate(), 0.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliImageAtlasDefragmentPinned(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageAtlasDefragmentPinned");
+  tet_infoline("The images uploaded from pixel data can't be loaded again, so they pin the atlas.");
+
+  IntrusivePtr<ImageAtlas> atlas = ImageAtlas::New(100u, 100u, Pixel::RGBA8888, AtlasPacker::Algorithm::MAX_RECTS);
+  atlas->SetDefragmentationEnabled(true);
+
+  Vector4   textureRect;
+  PixelData pixelData = PixelData::New(new uint8_t[16 * 16 * 4], 16 * 16 * 4, 16, 16, Pixel::RGBA8888, PixelData::DELETE_ARRAY);
+  DALI_TEST_CHECK(atlas->Upload(textureRect, pixelData));
+  DALI_TEST_CHECK(!atlas->Defragment(ImageDimensions(50, 50)));
+  DALI_TEST_CHECK(!atlas->IsDefragmenting());
+
+  tet_infoline("The atlas can't be defragmented if it is not enabled.");
+  IntrusivePtr<ImageAtlas> disabledAtlas = ImageAtlas::New(100u, 100u, Pixel::RGBA8888);
+  TestUploadObserver       observer;
+  DALI_TEST_CHECK(disabledAtlas->Upload(textureRect, VisualUrl(TEST_IMAGE_34_FILE_NAME), ImageDimensions(34, 34), FittingMode::DEFAULT, true, &observer));
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_CHECK(!disabledAtlas->Defragment(ImageDimensions(50, 50)));
+
+  END_TEST;
+}
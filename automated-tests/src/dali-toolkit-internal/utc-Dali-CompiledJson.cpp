@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+
+#include <dali-toolkit/devel-api/builder/builder.h>
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <dali-toolkit/internal/builder/builder-impl.h>
+#include <dali-toolkit/internal/builder/compiled-json.h>
+#include <dali-toolkit/internal/builder/json-parser-impl.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_internal_compiled_json_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_internal_compiled_json_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* JSON_THEME =
+  "{\n"
+  "  \"constants\": { \"IMAGE_DIR\": \"/images/\" },\n"
+  "  \"styles\":\n"
+  "  {\n"
+  "    \"TextLabel\": { \"pointSize\": 18, \"textColor\": [0.5, 0.25, 1.0, 1.0], \"enableMarkup\": true, \"text\": \"label\" },\n"
+  "    \"PushButton\": { \"size\": [100, 50, 0], \"image\": \"{IMAGE_DIR}button.png\", \"text\": \"label\", \"background\": null }\n"
+  "  }\n"
+  "}\n";
+
+const char* JSON_OVERRIDE =
+  "{\n"
+  "  \"styles\":\n"
+  "  {\n"
+  "    \"TextLabel\": { \"pointSize\": 20.5, \"states\": { \"NORMAL\": { \"textColor\": [1, 1, 1, 1] } } },\n"
+  "    \"ImageView\": { \"image\": \"{IMAGE_DIR}image.png\" }\n"
+  "  }\n"
+  "}\n";
+
+std::string WriteTree(const Toolkit::JsonParser& parser)
+{
+  std::ostringstream stream;
+  parser.Write(stream, 2);
+  return stream.str();
+}
+
+std::vector<char> Compile(const std::string& json)
+{
+  Toolkit::JsonParser parser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(parser.Parse(json));
+
+  std::vector<char> compiled;
+  CompiledJson::Compile(*parser.GetRoot(), static_cast<uint32_t>(json.size()), CompiledJson::CalculateSourceHash(json.data(), json.size()), compiled);
+  return compiled;
+}
+
+} // namespace
+
+int UtcDaliCompiledJsonParse(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that a compiled json is parsed to the tree of the json");
+
+  std::vector<char> compiled = Compile(JSON_THEME);
+
+  const CompiledJson::Header* header = CompiledJson::GetHeader(compiled.data(), compiled.size());
+  DALI_TEST_CHECK(header);
+  DALI_TEST_EQUALS(header->sourceSize, static_cast<uint32_t>(strlen(JSON_THEME)), TEST_LOCATION);
+  DALI_TEST_EQUALS(header->sourceHash, CompiledJson::CalculateSourceHash(JSON_THEME, strlen(JSON_THEME)), TEST_LOCATION);
+
+  tet_infoline("Test that a JSON edited without changing its size has another hash");
+  std::string editedTheme(JSON_THEME);
+  editedTheme[editedTheme.find("100")] = '2';
+  DALI_TEST_EQUALS(editedTheme.size(), strlen(JSON_THEME), TEST_LOCATION);
+  DALI_TEST_CHECK(CompiledJson::CalculateSourceHash(editedTheme.data(), editedTheme.size()) != header->sourceHash);
+
+  Toolkit::JsonParser jsonParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(jsonParser.Parse(JSON_THEME));
+
+  Toolkit::JsonParser compiledParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(GetImplementation(compiledParser).ParseCompiled(compiled.data(), compiled.size()));
+  DALI_TEST_CHECK(!compiledParser.ParseError());
+  DALI_TEST_EQUALS(WriteTree(compiledParser), WriteTree(jsonParser), TEST_LOCATION);
+
+  const TreeNode* image = compiledParser.GetRoot()->Find("image");
+  DALI_TEST_CHECK(image);
+  DALI_TEST_EQUALS(std::string(image->GetString()), std::string("{IMAGE_DIR}button.png"), TEST_LOCATION);
+  DALI_TEST_EQUALS(image->HasSubstitution(), jsonParser.GetRoot()->Find("image")->HasSubstitution(), TEST_LOCATION);
+
+  tet_infoline("Test that the repeated strings are stored once");
+  const TreeNode* labelText  = compiledParser.GetRoot()->GetChild("styles")->GetChild("TextLabel")->GetChild("text");
+  const TreeNode* buttonText = compiledParser.GetRoot()->GetChild("styles")->GetChild("PushButton")->GetChild("text");
+  DALI_TEST_CHECK(labelText->GetString() == buttonText->GetString());
+
+  tet_infoline("Test that the strings still live after the tree is packed");
+  compiledParser.Pack();
+  DALI_TEST_EQUALS(WriteTree(compiledParser), WriteTree(jsonParser), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliCompiledJsonMerge(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that a compiled json is merged as the json is merged");
+
+  std::vector<char> compiledTheme    = Compile(JSON_THEME);
+  std::vector<char> compiledOverride = Compile(JSON_OVERRIDE);
+
+  Toolkit::JsonParser jsonParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(jsonParser.Parse(JSON_THEME));
+  DALI_TEST_CHECK(jsonParser.Parse(JSON_OVERRIDE));
+
+  Toolkit::JsonParser compiledParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(GetImplementation(compiledParser).ParseCompiled(compiledTheme.data(), compiledTheme.size()));
+  DALI_TEST_CHECK(GetImplementation(compiledParser).ParseCompiled(compiledOverride.data(), compiledOverride.size()));
+  DALI_TEST_EQUALS(WriteTree(compiledParser), WriteTree(jsonParser), TEST_LOCATION);
+
+  tet_infoline("Test that a json can be merged to a compiled json");
+  Toolkit::JsonParser mixedParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(GetImplementation(mixedParser).ParseCompiled(compiledTheme.data(), compiledTheme.size()));
+  DALI_TEST_CHECK(mixedParser.Parse(JSON_OVERRIDE));
+  DALI_TEST_EQUALS(WriteTree(mixedParser), WriteTree(jsonParser), TEST_LOCATION);
+
+  const TreeNode* pointSize = compiledParser.GetRoot()->GetChild("styles")->GetChild("TextLabel")->GetChild("pointSize");
+  DALI_TEST_EQUALS(pointSize->GetType(), TreeNode::FLOAT, TEST_LOCATION);
+  DALI_TEST_EQUALS(pointSize->GetFloat(), 20.5f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliCompiledJsonInvalid(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that an invalid compiled json is rejected, and the tree is kept");
+
+  std::vector<char> compiled = Compile(JSON_THEME);
+
+  DALI_TEST_CHECK(!CompiledJson::GetHeader(nullptr, 0u));
+  DALI_TEST_CHECK(!CompiledJson::GetHeader(JSON_THEME, strlen(JSON_THEME)));
+  DALI_TEST_CHECK(!CompiledJson::GetHeader(compiled.data(), compiled.size() - 1u));
+
+  std::vector<char> otherVersion(compiled);
+  reinterpret_cast<CompiledJson::Header*>(otherVersion.data())->version = CompiledJson::VERSION + 1u;
+  DALI_TEST_CHECK(!CompiledJson::GetHeader(otherVersion.data(), otherVersion.size()));
+
+  Toolkit::JsonParser parser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(parser.Parse(JSON_THEME));
+  const std::string tree = WriteTree(parser);
+
+  DALI_TEST_CHECK(!GetImplementation(parser).ParseCompiled(otherVersion.data(), otherVersion.size()));
+  DALI_TEST_CHECK(parser.ParseError());
+  DALI_TEST_CHECK(parser.GetRoot());
+  DALI_TEST_EQUALS(WriteTree(parser), tree, TEST_LOCATION);
+
+  tet_infoline("Test that a node which overruns its object is rejected");
+  std::vector<char>   overrun(compiled);
+  CompiledJson::Node* root = reinterpret_cast<CompiledJson::Node*>(overrun.data() + sizeof(CompiledJson::Header));
+  root->childCount += 1u;
+
+  Toolkit::JsonParser overrunParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(!GetImplementation(overrunParser).ParseCompiled(overrun.data(), overrun.size()));
+  DALI_TEST_CHECK(overrunParser.ParseError());
+
+  END_TEST;
+}
+
+int UtcDaliCompiledJsonBuilder(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the builder loads a compiled json as it loads the json");
+
+  std::vector<char> compiled = Compile(JSON_THEME);
+
+  Toolkit::Builder builder = Toolkit::Builder::New();
+  DALI_TEST_CHECK(GetImpl(builder).LoadFromCompiled(compiled.data(), compiled.size()));
+
+  DALI_TEST_CHECK(GetImpl(builder).LookupStyleName("textlabel"));
+  DALI_TEST_CHECK(GetImpl(builder).LookupStyleName("PushButton"));
+  DALI_TEST_CHECK(!GetImpl(builder).LookupStyleName("ImageView"));
+
+  const Property::Value* imageDir = builder.GetConstants().Find("IMAGE_DIR");
+  DALI_TEST_CHECK(imageDir);
+  DALI_TEST_EQUALS(imageDir->Get<std::string>(), std::string("/images/"), TEST_LOCATION);
+
+  tet_infoline("Test that a style of a compiled json is applied");
+  Actor actor = Actor::New();
+  DALI_TEST_CHECK(builder.ApplyStyle("PushButton", actor));
+  DALI_TEST_EQUALS(actor.GetProperty<Vector3>(Actor::Property::SIZE), Vector3(100.0f, 50.0f, 0.0f), TEST_LOCATION);
+
+  tet_infoline("Test that a compiled json merges the styles");
+  std::vector<char> compiledOverride = Compile(JSON_OVERRIDE);
+  DALI_TEST_CHECK(GetImpl(builder).LoadFromCompiled(compiledOverride.data(), compiledOverride.size()));
+  DALI_TEST_CHECK(GetImpl(builder).LookupStyleName("ImageView"));
+  DALI_TEST_CHECK(GetImpl(builder).LookupStyleName("PushButton"));
+
+  tet_infoline("Test that an invalid compiled json is not loaded");
+  DALI_TEST_CHECK(!GetImpl(builder).LoadFromCompiled(JSON_THEME, strlen(JSON_THEME)));
+  DALI_TEST_CHECK(GetImpl(builder).LookupStyleName("ImageView"));
+
+  END_TEST;
+}
@@ -15,10 +15,15 @@
  *
  */
 
+#include <chrono>
 #include <iostream>
 
 #include <stdlib.h>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-utils.h>
@@ -26,6 +31,7 @@
 #include <../dali-toolkit/dali-toolkit-test-utils/dummy-control.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
+#include <dali-toolkit/internal/controls/control/control-data-impl.h>
 #include <dali-toolkit/internal/controls/control/control-debug.h>
 
 
@@ -92,3 +98,205 @@ int UtcDaliControlDebugHierarchy(void)
 
   END_TEST;
 }
+
+namespace
+{
+Toolkit::Internal::Control::Impl& GetControlDataImpl(Toolkit::Control control)
+{
+  return Toolkit::Internal::Control::Impl::Get(Toolkit::Internal::GetImplementation(control));
+}
+
+std::size_t GetAllocatedHeapSize()
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+  return mallinfo2().uordblks;
+#else
+  return 0u;
+#endif
+}
+
+} // namespace
+
+int UtcDaliControlImplLazyData(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the accessibility, gesture and focus data of a control are only allocated when used");
+
+  Control                           control     = Control::New();
+  Toolkit::Internal::Control::Impl& controlImpl = GetControlDataImpl(control);
+  application.GetScene().Add(control);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(!controlImpl.mAccessibilityData);
+  DALI_TEST_CHECK(!controlImpl.mGestureData);
+  DALI_TEST_CHECK(!controlImpl.mFocusData);
+
+  tet_infoline("Reading the properties gives the defaults without allocating");
+  DALI_TEST_EQUALS(control.GetProperty<int>(DevelControl::Property::LEFT_FOCUSABLE_ACTOR_ID), -1, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(DevelControl::Property::ACCESSIBILITY_NAME), std::string(), TEST_LOCATION);
+  DALI_TEST_CHECK(control.GetProperty(DevelControl::Property::ACCESSIBILITY_ATTRIBUTES).GetMap()->Empty());
+  DALI_TEST_CHECK(!Toolkit::Internal::GetImplementation(control).GetTapGestureDetector());
+  DALI_TEST_CHECK(DevelControl::GetAccessibilityRelations(control).empty());
+  DALI_TEST_CHECK(!controlImpl.mAccessibilityData);
+  DALI_TEST_CHECK(!controlImpl.mFocusData);
+  DALI_TEST_CHECK(!controlImpl.mGestureData);
+
+  control.SetProperty(DevelControl::Property::ACCESSIBILITY_NAME, "name");
+  DALI_TEST_CHECK(controlImpl.mAccessibilityData);
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(DevelControl::Property::ACCESSIBILITY_NAME), std::string("name"), TEST_LOCATION);
+
+  Toolkit::Internal::GetImplementation(control).EnableGestureDetection(GestureType::TAP);
+  DALI_TEST_CHECK(controlImpl.mGestureData);
+  DALI_TEST_CHECK(Toolkit::Internal::GetImplementation(control).GetTapGestureDetector());
+  DALI_TEST_CHECK(!Toolkit::Internal::GetImplementation(control).GetPanGestureDetector());
+
+  control.SetProperty(DevelControl::Property::LEFT_FOCUSABLE_ACTOR_ID, 7);
+  DALI_TEST_CHECK(controlImpl.mFocusData);
+  DALI_TEST_EQUALS(control.GetProperty<int>(DevelControl::Property::LEFT_FOCUSABLE_ACTOR_ID), 7, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<int>(DevelControl::Property::RIGHT_FOCUSABLE_ACTOR_ID), -1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliControlImplMemoryBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Report the memory a control uses before and after its rarely used data is allocated when used");
+
+  using ControlImpl = Toolkit::Internal::Control::Impl;
+
+  const std::size_t sizeOfBefore = sizeof(ControlImpl) + sizeof(ControlImpl::AccessibilityData) + sizeof(ControlImpl::GestureData) + sizeof(ControlImpl::FocusData);
+  tet_printf("sizeof(Control::Impl) before : %zu, after : %zu\n", sizeOfBefore, sizeof(ControlImpl));
+  tet_printf("sizeof(Control::Impl::AccessibilityData) : %zu (allocated when used)\n", sizeof(ControlImpl::AccessibilityData));
+  tet_printf("sizeof(Control::Impl::GestureData) : %zu (allocated when used)\n", sizeof(ControlImpl::GestureData));
+  tet_printf("sizeof(Control::Impl::FocusData) : %zu (allocated when used)\n", sizeof(ControlImpl::FocusData));
+
+  const int            CONTROL_COUNT = 5000;
+  std::vector<Control> controls;
+  Actor                parent = Actor::New();
+  application.GetScene().Add(parent);
+  controls.reserve(CONTROL_COUNT);
+
+  const std::size_t heapBefore = GetAllocatedHeapSize();
+  auto              start      = std::chrono::steady_clock::now();
+  for(int i = 0; i < CONTROL_COUNT; ++i)
+  {
+    Control control = Control::New();
+    control.SetProperty(Control::Property::BACKGROUND, Color::RED);
+    parent.Add(control);
+    controls.push_back(control);
+  }
+  auto              end       = std::chrono::steady_clock::now();
+  const std::size_t heapAfter = GetAllocatedHeapSize();
+
+  application.SendNotification();
+  application.Render();
+
+  tet_printf("Created %d controls in %lld us\n", CONTROL_COUNT, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+
+  int allocatedCount = 0;
+  for(auto& control : controls)
+  {
+    ControlImpl& controlImpl = GetControlDataImpl(control);
+    if(controlImpl.mAccessibilityData || controlImpl.mGestureData || controlImpl.mFocusData)
+    {
+      ++allocatedCount;
+    }
+  }
+  DALI_TEST_EQUALS(allocatedCount, 0, TEST_LOCATION);
+
+  // Every control had the data before it was allocated when used, so allocating it for every control measures the memory before.
+  // This counts a heap block per structure more than when the data was a part of Control::Impl.
+  const std::size_t heapRendered = GetAllocatedHeapSize();
+  for(auto& control : controls)
+  {
+    ControlImpl& controlImpl = GetControlDataImpl(control);
+    controlImpl.EnsureAccessibilityData();
+    controlImpl.EnsureGestureData();
+    controlImpl.EnsureFocusData();
+  }
+  const std::size_t heapAllocated = GetAllocatedHeapSize();
+
+  if(heapAfter > heapBefore && heapAllocated >= heapRendered)
+  {
+    tet_printf("Heap per control before (data of every control allocated) : %zu bytes\n", (heapAfter - heapBefore + heapAllocated - heapRendered) / CONTROL_COUNT);
+    tet_printf("Heap per control after (data allocated when used) : %zu bytes\n", (heapAfter - heapBefore) / CONTROL_COUNT);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliControlImplVisualLookup(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Register many visuals and check that they are found by index and the control is ready once they all are");
+
+  const int VISUAL_COUNT = 12;
+
+  DummyControl        dummyControl = DummyControl::New(true);
+  Impl::DummyControl& dummyImpl    = static_cast<Impl::DummyControl&>(dummyControl.GetImplementation());
+  dummyControl.SetProperty(Actor::Property::SIZE, Vector2(200.f, 200.f));
+
+  VisualFactory                      factory = VisualFactory::Get();
+  std::vector<Toolkit::Visual::Base> visuals;
+  for(int i = 0; i < VISUAL_COUNT; ++i)
+  {
+    Property::Map map;
+    map[Visual::Property::TYPE]           = Visual::COLOR;
+    map[ColorVisual::Property::MIX_COLOR] = Color::RED;
+    visuals.push_back(factory.CreateVisual(map));
+
+    // Register in the reverse order of the indices
+    dummyImpl.RegisterVisual(DummyControl::Property::TEST_VISUAL + VISUAL_COUNT - i, visuals.back());
+  }
+
+  for(int i = 0; i < VISUAL_COUNT; ++i)
+  {
+    DALI_TEST_CHECK(dummyImpl.GetVisual(DummyControl::Property::TEST_VISUAL + VISUAL_COUNT - i) == visuals[i]);
+  }
+  DALI_TEST_CHECK(!dummyImpl.GetVisual(DummyControl::Property::TEST_VISUAL));
+
+  tet_infoline("The color visuals are not ready before the control is on the scene");
+  DALI_TEST_EQUALS(dummyControl.IsResourceReady(), false, TEST_LOCATION);
+
+  for(int i = 0; i < VISUAL_COUNT; ++i)
+  {
+    dummyImpl.EnableVisual(DummyControl::Property::TEST_VISUAL + VISUAL_COUNT - i, false);
+  }
+  DALI_TEST_EQUALS(dummyControl.IsResourceReady(), true, TEST_LOCATION);
+
+  for(int i = 0; i < VISUAL_COUNT; ++i)
+  {
+    dummyImpl.EnableVisual(DummyControl::Property::TEST_VISUAL + VISUAL_COUNT - i, true);
+  }
+  DALI_TEST_EQUALS(dummyControl.IsResourceReady(), false, TEST_LOCATION);
+
+  application.GetScene().Add(dummyControl);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(dummyControl.IsResourceReady(), true, TEST_LOCATION);
+
+  tet_infoline("Unregister some of the visuals and replace one of them");
+  dummyImpl.UnregisterVisual(DummyControl::Property::TEST_VISUAL + 1);
+  dummyImpl.UnregisterVisual(DummyControl::Property::TEST_VISUAL + 5);
+
+  Property::Map map;
+  map[Visual::Property::TYPE]           = Visual::COLOR;
+  map[ColorVisual::Property::MIX_COLOR] = Color::BLUE;
+  Toolkit::Visual::Base replacement     = factory.CreateVisual(map);
+  dummyImpl.RegisterVisual(DummyControl::Property::TEST_VISUAL + 3, replacement);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(!dummyImpl.GetVisual(DummyControl::Property::TEST_VISUAL + 1));
+  DALI_TEST_CHECK(!dummyImpl.GetVisual(DummyControl::Property::TEST_VISUAL + 5));
+  DALI_TEST_CHECK(dummyImpl.GetVisual(DummyControl::Property::TEST_VISUAL + 3) == replacement);
+  DALI_TEST_CHECK(dummyImpl.GetVisual(DummyControl::Property::TEST_VISUAL + 2) == visuals[VISUAL_COUNT - 2]);
+  DALI_TEST_EQUALS(dummyControl.IsResourceReady(), true, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
+#include <dali-toolkit/internal/filters/dual-kawase-blur-filter.h>
+#include <dali-toolkit/public-api/controls/control.h>
+#include <dali/public-api/render-tasks/render-task-list.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_internal_dual_kawase_blur_filter_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_internal_dual_kawase_blur_filter_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+FrameBuffer CreateFrameBuffer(uint32_t width, uint32_t height)
+{
+  FrameBuffer frameBuffer = FrameBuffer::New(width, height, FrameBuffer::Attachment::NONE);
+  frameBuffer.AttachColorTexture(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height));
+  return frameBuffer;
+}
+
+/**
+ * Estimates the texture samples of a frame: the pixels of the frame buffer of each blur pass, times the samples the
+ * shader of the pass takes for each pixel.
+ */
+uint64_t EstimateBlurSamples(RenderTaskList taskList)
+{
+  uint64_t samples = 0u;
+  for(uint32_t i = 0u; i < taskList.GetTaskCount(); ++i)
+  {
+    RenderTask  task        = taskList.GetTask(i);
+    FrameBuffer frameBuffer = task.GetFrameBuffer();
+    Actor       actor       = task.GetSourceActor();
+    if(!frameBuffer || !actor || actor.GetRendererCount() == 0u)
+    {
+      continue;
+    }
+
+    Texture        output = frameBuffer.GetColorTexture();
+    const uint64_t pixels = uint64_t(output.GetWidth()) * output.GetHeight();
+
+    uint32_t sampleCount = 0u;
+    if(actor.GetPropertyIndex(std::string("uOffset")) != Property::INVALID_INDEX)
+    {
+      // The downsampling pass takes 5 samples, the upsampling pass 8.
+      Texture input = actor.GetRendererAt(0).GetTextures().GetTexture(0);
+      sampleCount   = input.GetWidth() > output.GetWidth() ? 5u : 8u;
+    }
+    else
+    {
+      // Each weight of the gaussian kernel takes a pair of samples.
+      std::ostringstream name;
+      while(true)
+      {
+        name.str("");
+        name << "uSampleWeights[" << sampleCount / 2u << "]";
+        if(actor.GetPropertyIndex(name.str()) == Property::INVALID_INDEX)
+        {
+          break;
+        }
+        sampleCount += 2u;
+      }
+    }
+    samples += pixels * sampleCount;
+  }
+  return samples;
+}
+
+} // namespace
+
+int UtcDaliDualKawaseBlurFilterIterationCount(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliDualKawaseBlurFilterIterationCount");
+
+  const Vector2 size(1000.0f, 1000.0f);
+  DALI_TEST_EQUALS(DualKawaseBlurFilter::CalculateIterationCount(0.0f, size), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(DualKawaseBlurFilter::CalculateIterationCount(5.0f, size), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(DualKawaseBlurFilter::CalculateIterationCount(8.0f, size), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(DualKawaseBlurFilter::CalculateIterationCount(100.0f, size), 5u, TEST_LOCATION);
+
+  tet_infoline("The smallest level keeps a few pixels.");
+  DALI_TEST_EQUALS(DualKawaseBlurFilter::CalculateIterationCount(100.0f, Vector2(20.0f, 400.0f)), 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(DualKawaseBlurFilter::CalculateIterationCount(100.0f, Vector2(1.0f, 1.0f)), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDualKawaseBlurFilterEnableDisable(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliDualKawaseBlurFilterEnableDisable");
+
+  RenderTaskList taskList  = application.GetScene().GetRenderTaskList();
+  Actor          rootActor = Actor::New();
+  application.GetScene().Add(rootActor);
+
+  FrameBuffer output = CreateFrameBuffer(200u, 100u);
+
+  DualKawaseBlurFilter filter;
+  filter.SetRootActor(rootActor);
+  filter.SetSize(Vector2(200.0f, 100.0f));
+  filter.SetRadius(20.0f);
+  filter.SetInputTexture(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 400u, 200u));
+  filter.SetOutputFrameBuffer(output);
+  filter.Enable();
+
+  tet_infoline("3 downsampling passes, then 3 upsampling passes into the output.");
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 7u, TEST_LOCATION);
+  DALI_TEST_CHECK(filter.GetOutputRenderTask() == taskList.GetTask(6u));
+  DALI_TEST_CHECK(filter.GetOutputRenderTask().GetFrameBuffer() == output);
+  DALI_TEST_EQUALS(taskList.GetTask(1u).GetFrameBuffer().GetColorTexture().GetWidth(), 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(taskList.GetTask(3u).GetFrameBuffer().GetColorTexture().GetWidth(), 25u, TEST_LOCATION);
+  DALI_TEST_CHECK(taskList.GetTask(4u).GetFrameBuffer() == taskList.GetTask(2u).GetFrameBuffer());
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("The shaders are cached, so they are not created again when the filter is enabled again.");
+  Shader downsampleShader = taskList.GetTask(1u).GetSourceActor().GetRendererAt(0).GetShader();
+  Shader upsampleShader   = taskList.GetTask(6u).GetSourceActor().GetRendererAt(0).GetShader();
+  DALI_TEST_CHECK(downsampleShader != upsampleShader);
+  DALI_TEST_CHECK(taskList.GetTask(2u).GetSourceActor().GetRendererAt(0).GetShader() == downsampleShader);
+
+  filter.Disable();
+  filter.Enable();
+  DALI_TEST_CHECK(taskList.GetTask(1u).GetSourceActor().GetRendererAt(0).GetShader() == downsampleShader);
+  DALI_TEST_CHECK(taskList.GetTask(6u).GetSourceActor().GetRendererAt(0).GetShader() == upsampleShader);
+
+  filter.Disable();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rootActor.GetChildCount(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(!filter.GetOutputRenderTask());
+
+  END_TEST;
+}
+
+int UtcDaliDualKawaseBlurBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliDualKawaseBlurBenchmark");
+  tet_infoline("Compares the gaussian and the dual Kawase background blurs of the whole window, offscreen.");
+
+  const uint32_t RADII[]      = {5u, 10u, 20u, 50u, 100u};
+  const uint32_t RADIUS_COUNT = sizeof(RADII) / sizeof(RADII[0]);
+  const uint32_t FRAME_COUNT  = 10u;
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+  TraceCallStack&    drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  uint64_t samples[2][RADIUS_COUNT];
+  for(uint32_t algorithm = 0u; algorithm < 2u; ++algorithm)
+  {
+    for(uint32_t i = 0u; i < RADIUS_COUNT; ++i)
+    {
+      Control control = Control::New();
+      control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+      control.SetProperty(Actor::Property::SIZE, scene.GetSize());
+      scene.Add(control);
+      control.SetRenderEffect(DevelBackgroundBlurEffect::New(0.4f, RADII[i], static_cast<BlurAlgorithm::Type>(algorithm)));
+
+      application.SendNotification();
+      application.Render();
+      drawTrace.Reset();
+
+      const auto start = std::chrono::steady_clock::now();
+      for(uint32_t frame = 0u; frame < FRAME_COUNT; ++frame)
+      {
+        application.SendNotification();
+        application.Render();
+      }
+      const auto end = std::chrono::steady_clock::now();
+
+      samples[algorithm][i] = EstimateBlurSamples(taskList);
+      tet_printf("%s radius %3u: %2u tasks, %3d draws per frame, %9llu samples per frame, %6lld us per frame\n",
+                 algorithm == BlurAlgorithm::GAUSSIAN ? "GAUSSIAN   " : "DUAL_KAWASE",
+                 RADII[i],
+                 taskList.GetTaskCount(),
+                 drawTrace.CountMethod("DrawArrays") / static_cast<int>(FRAME_COUNT),
+                 static_cast<unsigned long long>(samples[algorithm][i]),
+                 static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / FRAME_COUNT));
+
+      control.ClearRenderEffect();
+      control.Unparent();
+    }
+  }
+
+  tet_infoline("The cost of the gaussian blur grows with the radius, the cost of the dual Kawase blur stays roughly the same.");
+  DALI_TEST_CHECK(samples[BlurAlgorithm::GAUSSIAN][RADIUS_COUNT - 1u] > samples[BlurAlgorithm::GAUSSIAN][0u] * 10u);
+  DALI_TEST_CHECK(samples[BlurAlgorithm::DUAL_KAWASE][RADIUS_COUNT - 1u] < samples[BlurAlgorithm::DUAL_KAWASE][0u] * 2u);
+  DALI_TEST_CHECK(samples[BlurAlgorithm::DUAL_KAWASE][RADIUS_COUNT - 1u] < samples[BlurAlgorithm::GAUSSIAN][RADIUS_COUNT - 1u]);
+
+  END_TEST;
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-environment-variable.h>
+#include <toolkit-event-thread-callback.h>
+
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
+#include <dali-toolkit/internal/image-loader/image-disk-cache.h>
+#include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_internal_image_disk_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_internal_image_disk_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* TEST_IMAGE_FILE_NAME   = TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+const char* TEST_IMAGE_2_FILE_NAME = TEST_RESOURCE_DIR "/icon-edit.png";
+
+/**
+ * The cache directory of this test process, in the temporary directory of the system.
+ */
+const std::string& GetTestCachePath()
+{
+  static const std::string path = (std::filesystem::temp_directory_path() / ("dali-toolkit-image-disk-cache-test-" + std::to_string(getpid()))).string();
+  return path;
+}
+
+void ResetCacheDirectory()
+{
+  std::error_code errorCode;
+  std::filesystem::remove_all(GetTestCachePath(), errorCode);
+  std::filesystem::create_directories(GetTestCachePath(), errorCode);
+}
+
+Devel::PixelBuffer CreatePixelBuffer(uint32_t width, uint32_t height)
+{
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New(width, height, Pixel::RGBA8888);
+  uint8_t*           buffer      = pixelBuffer.GetBuffer();
+  for(uint32_t index = 0u; index < width * height * 4u; ++index)
+  {
+    buffer[index] = static_cast<uint8_t>(index);
+  }
+  return pixelBuffer;
+}
+
+class TestObserver : public Dali::Toolkit::TextureUploadObserver
+{
+public:
+  void LoadComplete(bool loadSuccess, TextureInformation textureInformation) override
+  {
+    mLoaded = loadSuccess;
+  }
+
+  bool mLoaded{false};
+};
+
+} // namespace
+
+int UtcDaliImageDiskCacheSaveAndLoad(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageDiskCacheSaveAndLoad");
+
+  ResetCacheDirectory();
+  ImageDiskCache diskCache(GetTestCachePath(), 1024u * 1024u);
+  DALI_TEST_CHECK(diskCache.IsEnabled());
+
+  VisualUrl       url(TEST_IMAGE_FILE_NAME);
+  ImageDimensions dimensions(16u, 8u);
+
+  DALI_TEST_CHECK(!diskCache.Load(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  Devel::PixelBuffer savedPixelBuffer = CreatePixelBuffer(16u, 8u);
+  diskCache.Save(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, savedPixelBuffer);
+
+  tet_infoline("The image is copied when it is queued, so changing it before it is written doesn't matter.");
+  savedPixelBuffer.GetBuffer()[100] = 0u;
+  diskCache.Flush();
+  DALI_TEST_CHECK(diskCache.GetSize() > 16u * 8u * 4u);
+
+  Devel::PixelBuffer pixelBuffer = diskCache.Load(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), 16u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), 8u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixelBuffer.GetBuffer()[100]), 100u, TEST_LOCATION);
+
+  tet_infoline("Other loading parameters are not stored.");
+  DALI_TEST_CHECK(!diskCache.Load(url, ImageDimensions(16u, 16u), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+  DALI_TEST_CHECK(!diskCache.Load(url, dimensions, FittingMode::FIT_WIDTH, SamplingMode::BOX_THEN_LINEAR, true));
+  DALI_TEST_CHECK(!diskCache.Load(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::NEAREST, true));
+  DALI_TEST_CHECK(!diskCache.Load(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, false));
+
+  tet_infoline("The stored files are found by a new cache, i.e. in the next run.");
+  ImageDiskCache nextDiskCache(GetTestCachePath(), 1024u * 1024u);
+  DALI_TEST_CHECK(nextDiskCache.Load(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheTrimAndClear(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageDiskCacheTrimAndClear");
+
+  ResetCacheDirectory();
+
+  // Room for a single image.
+  ImageDiskCache diskCache(GetTestCachePath(), 16u * 16u * 4u + 512u);
+
+  VisualUrl       url1(TEST_IMAGE_FILE_NAME);
+  VisualUrl       url2(TEST_IMAGE_2_FILE_NAME);
+  ImageDimensions dimensions(16u, 16u);
+
+  diskCache.Save(url1, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, CreatePixelBuffer(16u, 16u));
+  diskCache.Flush();
+  DALI_TEST_CHECK(diskCache.Load(url1, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  tet_infoline("The least recently used image is removed.");
+  diskCache.Save(url2, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, CreatePixelBuffer(16u, 16u));
+  diskCache.Flush();
+  DALI_TEST_CHECK(!diskCache.Load(url1, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+  DALI_TEST_CHECK(diskCache.Load(url2, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  tet_infoline("An image bigger than the cache is not stored.");
+  diskCache.Save(url1, ImageDimensions(64u, 64u), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, CreatePixelBuffer(64u, 64u));
+  diskCache.Flush();
+  DALI_TEST_CHECK(!diskCache.Load(url1, ImageDimensions(64u, 64u), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+  DALI_TEST_CHECK(diskCache.Load(url2, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  diskCache.Clear();
+  DALI_TEST_EQUALS(diskCache.GetSize(), static_cast<uint64_t>(0u), TEST_LOCATION);
+  DALI_TEST_CHECK(!diskCache.Load(url2, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+  DALI_TEST_CHECK(std::filesystem::is_empty(GetTestCachePath()));
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheDisabled(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageDiskCacheDisabled");
+
+  ImageDiskCache diskCache("", 1024u * 1024u);
+  DALI_TEST_CHECK(!diskCache.IsEnabled());
+
+  VisualUrl url(TEST_IMAGE_FILE_NAME);
+  diskCache.Save(url, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, CreatePixelBuffer(4u, 4u));
+  DALI_TEST_CHECK(!diskCache.Load(url, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  ImageDiskCache missingDirectoryCache(GetTestCachePath() + "-missing-directory", 1024u * 1024u);
+  DALI_TEST_CHECK(!missingDirectoryCache.IsEnabled());
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheTextureManager(void)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_IMAGE_DISK_CACHE_PATH", GetTestCachePath().c_str());
+  ResetCacheDirectory();
+
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageDiskCacheTextureManager");
+  tet_infoline("The image decoded by the texture manager is stored, and removed by the devel API.");
+
+  TextureManager textureManager;
+  TestObserver   observer;
+  auto           preMultiply = TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD;
+  textureManager.RequestLoad(TEST_IMAGE_FILE_NAME, ImageDimensions(32u, 32u), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer.mLoaded, true, TEST_LOCATION);
+
+  ImageDiskCache& diskCache = ImageDiskCache::Get();
+  DALI_TEST_CHECK(diskCache.IsEnabled());
+  diskCache.Flush();
+  DALI_TEST_CHECK(diskCache.GetSize() > 0u);
+  DALI_TEST_CHECK(diskCache.Load(VisualUrl(TEST_IMAGE_FILE_NAME), ImageDimensions(32u, 32u), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  Dali::Toolkit::TextureManager::ClearImageDiskCache();
+  DALI_TEST_EQUALS(diskCache.GetSize(), static_cast<uint64_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheTemporaryFiles(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageDiskCacheTemporaryFiles");
+  tet_infoline("Only the temporary files left by a stopped process are removed, not the ones other processes are writing.");
+
+  ResetCacheDirectory();
+
+  const std::filesystem::path stalePath   = std::filesystem::path(GetTestCachePath()) / "0000000000000000.dimg.1.1.tmp";
+  const std::filesystem::path writingPath = std::filesystem::path(GetTestCachePath()) / "0000000000000001.dimg.2.1.tmp";
+  std::ofstream(stalePath) << "stale";
+  std::ofstream(writingPath) << "writing";
+  std::filesystem::last_write_time(stalePath, std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+
+  ImageDiskCache diskCache(GetTestCachePath(), 1024u * 1024u);
+  DALI_TEST_EQUALS(diskCache.GetSize(), static_cast<uint64_t>(0u), TEST_LOCATION);
+  DALI_TEST_CHECK(!std::filesystem::exists(stalePath));
+  DALI_TEST_CHECK(std::filesystem::exists(writingPath));
+
+  END_TEST;
+}
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-environment-variable.h>
+#include <toolkit-event-thread-callback.h>
+
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
+#include <dali-toolkit/internal/image-loader/etc2-encoder.h>
+#include <dali-toolkit/internal/image-loader/image-disk-cache.h>
+#include <dali-toolkit/internal/image-loader/image-transcoder.h>
+#include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_internal_image_transcoder_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_internal_image_transcoder_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* TEST_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/icon-edit.png"; ///< 34x34 RGBA
+const char* TEST_CACHE_PATH      = "/tmp/dali-toolkit-image-transcoder-test";
+
+using Quality = Dali::Toolkit::TextureManager::TextureCompressionQuality::Type;
+
+void ResetCacheDirectory()
+{
+  std::error_code errorCode;
+  std::filesystem::remove_all(TEST_CACHE_PATH, errorCode);
+  std::filesystem::create_directories(TEST_CACHE_PATH, errorCode);
+}
+
+Devel::PixelBuffer CreatePixelBuffer(uint32_t width, uint32_t height, Pixel::Format pixelFormat, bool translucent)
+{
+  Devel::PixelBuffer pixelBuffer   = Devel::PixelBuffer::New(width, height, pixelFormat);
+  const uint32_t     bytesPerPixel = Pixel::GetBytesPerPixel(pixelFormat);
+  uint8_t*           buffer        = pixelBuffer.GetBuffer();
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      uint8_t* pixel = buffer + (y * width + x) * bytesPerPixel;
+      for(uint32_t channel = 0u; channel < bytesPerPixel; ++channel)
+      {
+        pixel[channel] = static_cast<uint8_t>(x * 4u + y * channel);
+      }
+      if(bytesPerPixel == 4u)
+      {
+        pixel[3] = translucent ? static_cast<uint8_t>(x * 8u) : 255u;
+      }
+    }
+  }
+  return pixelBuffer;
+}
+
+uint64_t ReadBigEndian(const uint8_t* data)
+{
+  uint64_t bits = 0u;
+  for(uint32_t i = 0u; i < 8u; ++i)
+  {
+    bits = (bits << 8u) | data[i];
+  }
+  return bits;
+}
+
+int32_t ClampColor(int32_t value)
+{
+  return std::min(std::max(value, 0), 255);
+}
+
+/**
+ * Decodes the color of an ETC1 compatible block of ETC2 into RGBA pixels in rows.
+ */
+void DecodeColorBlock(const uint8_t* data, uint8_t* pixels)
+{
+  static const int32_t MODIFIERS[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+
+  const uint64_t bits         = ReadBigEndian(data);
+  const bool     differential = (bits >> 33u) & 1u;
+  const bool     flip         = (bits >> 32u) & 1u;
+  int32_t        colors[2][3];
+  for(uint32_t channel = 0u; channel < 3u; ++channel)
+  {
+    if(differential)
+    {
+      const int32_t first      = (bits >> (59u - channel * 8u)) & 0x1f;
+      int32_t       difference = (bits >> (56u - channel * 8u)) & 0x7;
+      difference               = difference >= 4 ? difference - 8 : difference;
+      const int32_t second     = first + difference;
+      DALI_TEST_CHECK(second >= 0 && second <= 31);
+      colors[0][channel] = (first << 3) | (first >> 2);
+      colors[1][channel] = (second << 3) | (second >> 2);
+    }
+    else
+    {
+      colors[0][channel] = ((bits >> (60u - channel * 8u)) & 0xf) * 17;
+      colors[1][channel] = ((bits >> (56u - channel * 8u)) & 0xf) * 17;
+    }
+  }
+  const uint32_t tables[2] = {static_cast<uint32_t>((bits >> 37u) & 0x7), static_cast<uint32_t>((bits >> 34u) & 0x7)};
+
+  for(uint32_t x = 0u; x < 4u; ++x)
+  {
+    for(uint32_t y = 0u; y < 4u; ++y)
+    {
+      const uint32_t position = x * 4u + y;
+      const uint32_t selector = (((bits >> (16u + position)) & 1u) << 1u) | ((bits >> position) & 1u);
+      const uint32_t half     = flip ? (y >> 1u) : (x >> 1u);
+      const int32_t  modifier = (selector & 1u ? MODIFIERS[tables[half]][1] : MODIFIERS[tables[half]][0]) * (selector & 2u ? -1 : 1);
+      for(uint32_t channel = 0u; channel < 3u; ++channel)
+      {
+        pixels[(y * 4u + x) * 4u + channel] = static_cast<uint8_t>(ClampColor(colors[half][channel] + modifier));
+      }
+    }
+  }
+}
+
+/**
+ * Decodes the alpha of an EAC block into RGBA pixels in rows.
+ */
+void DecodeAlphaBlock(const uint8_t* data, uint8_t* pixels)
+{
+  static const int32_t MODIFIERS[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8}};
+
+  const uint64_t bits       = ReadBigEndian(data);
+  const int32_t  base       = static_cast<int32_t>(bits >> 56u);
+  const int32_t  multiplier = static_cast<int32_t>((bits >> 52u) & 0xf);
+  const uint32_t table      = static_cast<uint32_t>((bits >> 48u) & 0xf);
+  for(uint32_t x = 0u; x < 4u; ++x)
+  {
+    for(uint32_t y = 0u; y < 4u; ++y)
+    {
+      const uint32_t index            = (bits >> (45u - (x * 4u + y) * 3u)) & 0x7;
+      pixels[(y * 4u + x) * 4u + 3u] = static_cast<uint8_t>(ClampColor(base + MODIFIERS[table][index] * multiplier));
+    }
+  }
+}
+
+/**
+ * Encodes a block and returns the largest difference of the decoded channels.
+ */
+int32_t EncodeAndDecodeBlock(const uint8_t* pixels, Etc2Encoder::Quality quality)
+{
+  uint8_t encoded[Etc2Encoder::ALPHA_BLOCK_SIZE + Etc2Encoder::COLOR_BLOCK_SIZE];
+  Etc2Encoder::EncodeAlphaBlock(pixels, quality, encoded);
+  Etc2Encoder::EncodeColorBlock(pixels, quality, encoded + Etc2Encoder::ALPHA_BLOCK_SIZE);
+
+  uint8_t decoded[64];
+  DecodeAlphaBlock(encoded, decoded);
+  DecodeColorBlock(encoded + Etc2Encoder::ALPHA_BLOCK_SIZE, decoded);
+
+  int32_t maximumDifference = 0;
+  for(uint32_t i = 0u; i < 64u; ++i)
+  {
+    maximumDifference = std::max(maximumDifference, std::abs(static_cast<int32_t>(decoded[i]) - pixels[i]));
+  }
+  return maximumDifference;
+}
+
+class TestObserver : public Dali::Toolkit::TextureUploadObserver
+{
+public:
+  void LoadComplete(bool loadSuccess, TextureInformation textureInformation) override
+  {
+    mLoaded = loadSuccess;
+  }
+
+  bool mLoaded{false};
+};
+
+} // namespace
+
+int UtcDaliEtc2EncoderBlock(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliEtc2EncoderBlock");
+
+  uint8_t pixels[64];
+
+  tet_infoline("A flat block is encoded almost exactly.");
+  for(uint32_t i = 0u; i < 16u; ++i)
+  {
+    pixels[i * 4u]      = 200u;
+    pixels[i * 4u + 1u] = 100u;
+    pixels[i * 4u + 2u] = 50u;
+    pixels[i * 4u + 3u] = 128u;
+  }
+  DALI_TEST_CHECK(EncodeAndDecodeBlock(pixels, Etc2Encoder::Quality::FAST) <= 4);
+  DALI_TEST_CHECK(EncodeAndDecodeBlock(pixels, Etc2Encoder::Quality::HIGH) <= 4);
+
+  tet_infoline("The halves of a block have their own colors.");
+  for(uint32_t y = 0u; y < 4u; ++y)
+  {
+    for(uint32_t x = 0u; x < 4u; ++x)
+    {
+      uint8_t* pixel = pixels + (y * 4u + x) * 4u;
+      pixel[0]       = y < 2u ? 255u : 0u;
+      pixel[1]       = y < 2u ? 0u : 255u;
+      pixel[2]       = 64u;
+      pixel[3]       = x < 2u ? 0u : 255u;
+    }
+  }
+  DALI_TEST_CHECK(EncodeAndDecodeBlock(pixels, Etc2Encoder::Quality::FAST) <= 8);
+
+  tet_infoline("A gradient is encoded closely.");
+  for(uint32_t y = 0u; y < 4u; ++y)
+  {
+    for(uint32_t x = 0u; x < 4u; ++x)
+    {
+      uint8_t* pixel = pixels + (y * 4u + x) * 4u;
+      pixel[0]       = static_cast<uint8_t>(100u + x * 8u);
+      pixel[1]       = static_cast<uint8_t>(100u + y * 8u);
+      pixel[2]       = static_cast<uint8_t>(100u + (x + y) * 4u);
+      pixel[3]       = static_cast<uint8_t>(x * 60u + y);
+    }
+  }
+  const int32_t fastDifference = EncodeAndDecodeBlock(pixels, Etc2Encoder::Quality::FAST);
+  const int32_t highDifference = EncodeAndDecodeBlock(pixels, Etc2Encoder::Quality::HIGH);
+  tet_printf("The largest difference of the gradient: FAST %d, HIGH %d\n", fastDifference, highDifference);
+  DALI_TEST_CHECK(fastDifference <= 24);
+  DALI_TEST_CHECK(highDifference <= 24);
+
+  DALI_TEST_EQUALS(Etc2Encoder::GetEncodedSize(34u, 34u, false), 9u * 9u * 8u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Etc2Encoder::GetEncodedSize(34u, 34u, true), 9u * 9u * 16u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliImageTranscoderEligibility(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageTranscoderEligibility");
+
+  ImageTranscoder transcoder(Quality::NONE, 16u);
+  DALI_TEST_CHECK(!transcoder.IsEnabled());
+  DALI_TEST_CHECK(!transcoder.IsEligible(CreatePixelBuffer(32u, 32u, Pixel::RGBA8888, false)));
+
+  transcoder.SetQuality(Quality::FAST);
+  DALI_TEST_CHECK(transcoder.IsEnabled());
+  DALI_TEST_EQUALS(transcoder.GetQuality(), Quality::FAST, TEST_LOCATION);
+  DALI_TEST_CHECK(transcoder.IsEligible(CreatePixelBuffer(32u, 32u, Pixel::RGBA8888, false)));
+  DALI_TEST_CHECK(transcoder.IsEligible(CreatePixelBuffer(32u, 16u, Pixel::RGB888, false)));
+
+  tet_infoline("The small images and the other formats are not transcoded.");
+  DALI_TEST_CHECK(!transcoder.IsEligible(CreatePixelBuffer(32u, 8u, Pixel::RGBA8888, false)));
+  DALI_TEST_CHECK(!transcoder.IsEligible(CreatePixelBuffer(32u, 32u, Pixel::L8, false)));
+  transcoder.SetMinimumSize(64u);
+  DALI_TEST_CHECK(!transcoder.IsEligible(CreatePixelBuffer(32u, 32u, Pixel::RGBA8888, false)));
+
+  tet_infoline("The pre-multiplied images are not transcoded.");
+  transcoder.SetMinimumSize(16u);
+  Devel::PixelBuffer preMultiplied = CreatePixelBuffer(32u, 32u, Pixel::RGBA8888, true);
+  preMultiplied.MultiplyColorByAlpha();
+  DALI_TEST_CHECK(!transcoder.IsEligible(preMultiplied));
+
+  END_TEST;
+}
+
+int UtcDaliImageTranscoderTranscode(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageTranscoderTranscode");
+
+  ImageTranscoder transcoder(Quality::FAST, 16u);
+
+  tet_infoline("The opaque images are transcoded without alpha.");
+  Dali::Vector<uint8_t> encodedData;
+  Devel::PixelBuffer    compressed = transcoder.Transcode(CreatePixelBuffer(34u, 20u, Pixel::RGBA8888, false), encodedData);
+  DALI_TEST_CHECK(compressed);
+  DALI_TEST_EQUALS(compressed.GetPixelFormat(), Pixel::COMPRESSED_RGB8_ETC2, TEST_LOCATION);
+  DALI_TEST_EQUALS(compressed.GetWidth(), 34u, TEST_LOCATION);
+  DALI_TEST_EQUALS(compressed.GetHeight(), 20u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(encodedData.Count()), 68u + 9u * 5u * 8u, TEST_LOCATION);
+
+  tet_infoline("The translucent images are transcoded with alpha.");
+  compressed = transcoder.Transcode(CreatePixelBuffer(32u, 32u, Pixel::RGBA8888, true), encodedData);
+  DALI_TEST_CHECK(compressed);
+  DALI_TEST_EQUALS(compressed.GetPixelFormat(), Pixel::COMPRESSED_RGBA8_ETC2_EAC, TEST_LOCATION);
+  DALI_TEST_CHECK(!compressed.IsAlphaPreMultiplied());
+
+  ImageTranscoder::Statistics statistics = transcoder.GetStatistics();
+  DALI_TEST_EQUALS(statistics.imageCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.decodedSize, static_cast<uint64_t>(34u * 20u * 3u + 32u * 32u * 4u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.compressedSize, static_cast<uint64_t>(9u * 5u * 8u + 8u * 8u * 16u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliImageTranscoderDiskCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageTranscoderDiskCache");
+
+  ResetCacheDirectory();
+  ImageDiskCache  diskCache(TEST_CACHE_PATH, 1024u * 1024u);
+  ImageTranscoder transcoder(Quality::FAST, 16u);
+
+  VisualUrl       url(TEST_IMAGE_FILE_NAME);
+  ImageDimensions dimensions(32u, 32u);
+
+  Dali::Vector<uint8_t> encodedData;
+  Devel::PixelBuffer    compressed = transcoder.Transcode(CreatePixelBuffer(32u, 32u, Pixel::RGB888, false), encodedData);
+  diskCache.SaveEncoded(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, transcoder.GetFormatName(), compressed.GetPixelFormat(), 32u, 32u, encodedData);
+
+  tet_infoline("The compressed texture is loaded without the decoded image.");
+  DALI_TEST_CHECK(!diskCache.Load(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+  Devel::PixelBuffer loaded = diskCache.LoadEncoded(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, transcoder.GetFormatName());
+  DALI_TEST_CHECK(loaded);
+  DALI_TEST_EQUALS(loaded.GetPixelFormat(), Pixel::COMPRESSED_RGB8_ETC2, TEST_LOCATION);
+  DALI_TEST_EQUALS(loaded.GetWidth(), 32u, TEST_LOCATION);
+
+  tet_infoline("The images transcoded with another quality are not used.");
+  transcoder.SetQuality(Quality::HIGH);
+  DALI_TEST_CHECK(!diskCache.LoadEncoded(url, dimensions, FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, transcoder.GetFormatName()));
+
+  END_TEST;
+}
+
+int UtcDaliImageTranscoderTextureManager(void)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_IMAGE_DISK_CACHE_PATH", TEST_CACHE_PATH);
+  ResetCacheDirectory();
+
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliImageTranscoderTextureManager");
+  tet_infoline("The image loaded by the texture manager is uploaded as a compressed texture, and stored in the disk cache.");
+
+  Dali::Toolkit::TextureManager::SetTextureCompression(Quality::FAST, 16u);
+  DALI_TEST_EQUALS(Dali::Toolkit::TextureManager::GetTextureCompressionQuality(), Quality::FAST, TEST_LOCATION);
+
+  TextureManager textureManager;
+  TestObserver   observer;
+  auto           preMultiply = TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD;
+  auto           textureId   = textureManager.RequestLoad(TEST_IMAGE_FILE_NAME, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer.mLoaded, true, TEST_LOCATION);
+
+  TextureSet textureSet = textureManager.GetTextureSet(textureId);
+  DALI_TEST_CHECK(textureSet);
+  DALI_TEST_EQUALS(textureSet.GetTexture(0u).GetWidth(), 34u, TEST_LOCATION);
+
+  Dali::Toolkit::TextureManager::TextureCompressionStatistics statistics = Dali::Toolkit::TextureManager::GetTextureCompressionStatistics();
+  tet_printf("%u images: %llu bytes decoded, %llu bytes compressed\n", statistics.imageCount, static_cast<unsigned long long>(statistics.decodedSize), static_cast<unsigned long long>(statistics.compressedSize));
+  DALI_TEST_EQUALS(statistics.imageCount, 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(statistics.compressedSize * 3u <= statistics.decodedSize);
+
+  ImageDiskCache& diskCache = ImageDiskCache::Get();
+  DALI_TEST_CHECK(diskCache.LoadEncoded(VisualUrl(TEST_IMAGE_FILE_NAME), ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, ImageTranscoder::Get().GetFormatName()));
+  DALI_TEST_CHECK(!diskCache.Load(VisualUrl(TEST_IMAGE_FILE_NAME), ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true));
+
+  Dali::Toolkit::TextureManager::SetTextureCompression(Quality::NONE, 16u);
+
+  END_TEST;
+}
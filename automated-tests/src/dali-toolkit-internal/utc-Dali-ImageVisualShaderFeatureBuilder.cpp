@@ -23,7 +23,10 @@
 #include <toolkit-event-thread-callback.h>
 #include <toolkit-text-utils.h>
 
+#include <dali-toolkit/internal/graphics/builtin-shader-extern-gen.h>
 #include <dali-toolkit/internal/visuals/image/image-visual-shader-feature-builder.h>
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali/devel-api/scripting/scripting.h>
 
 #include <../dali-toolkit/dali-toolkit-test-utils/dummy-control.h>
 #include <dummy-visual.h>
@@ -122,3 +125,59 @@ int UtcImageVisualShaderFeatureBuilderSetGetProperty02(void)
   DALI_TEST_EQUALS(fragmentPrefixList, fragmentPrefixListResult, TEST_LOCATION);
   END_TEST;
 }
+
+int UtcImageVisualShaderFeatureBuilderShaderVariants(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check the generated variants of the image shader have the defines of the feature builder");
+
+  auto CheckVariant = [](Dali::Toolkit::Internal::ImageVisualShaderFeatureBuilder& featureBuilder) {
+    std::string vertexPrefixList;
+    std::string fragmentPrefixList;
+    featureBuilder.GetVertexShaderPrefixList(vertexPrefixList);
+    featureBuilder.GetFragmentShaderPrefixList(fragmentPrefixList);
+
+    const auto  shaderType = featureBuilder.GetShaderType();
+    const auto& variant    = SHADER_IMAGE_VISUAL_SHADER_VARIANTS[shaderType - Dali::Toolkit::Internal::VisualFactoryCache::IMAGE_SHADER];
+
+    tet_printf("Check variant %s\n", std::string(variant.name).c_str());
+    DALI_TEST_EQUALS(std::string(variant.name), std::string(Scripting::GetLinearEnumerationName<Dali::Toolkit::Internal::VisualFactoryCache::ShaderType>(shaderType, Dali::Toolkit::Internal::VISUAL_SHADER_TYPE_TABLE, Dali::Toolkit::Internal::VISUAL_SHADER_TYPE_TABLE_COUNT)), TEST_LOCATION);
+    DALI_TEST_EQUALS(std::string(variant.vertexPrefix), vertexPrefixList, TEST_LOCATION);
+    DALI_TEST_EQUALS(std::string(variant.fragmentPrefix), fragmentPrefixList, TEST_LOCATION);
+    DALI_TEST_EQUALS(std::string(variant.vertexShader), vertexPrefixList + std::string(SHADER_IMAGE_VISUAL_SHADER_VERT), TEST_LOCATION);
+    DALI_TEST_EQUALS(std::string(variant.fragmentShader), fragmentPrefixList + std::string(SHADER_IMAGE_VISUAL_SHADER_FRAG), TEST_LOCATION);
+  };
+
+  for(auto defaultWrap : {true, false})
+  {
+    auto featureBuilder = Dali::Toolkit::Internal::ImageVisualShaderFeatureBuilder()
+                            .EnableTextureAtlas(true)
+                            .ApplyDefaultTextureWrapMode(defaultWrap);
+    CheckVariant(featureBuilder);
+  }
+
+  for(auto roundedCorner : {false, true})
+  {
+    for(auto borderline : {false, true})
+    {
+      for(auto colorConversion : {0, 1, 2, 3})
+      {
+        auto featureBuilder = Dali::Toolkit::Internal::ImageVisualShaderFeatureBuilder()
+                                .EnableRoundedCorner(roundedCorner)
+                                .EnableBorderline(borderline)
+                                .EnableAlphaMaskingOnRendering(colorConversion == 1)
+                                .EnableYuvToRgb(colorConversion == 2, colorConversion == 3);
+        CheckVariant(featureBuilder);
+      }
+    }
+  }
+
+  uint32_t precompiledCount = 0u;
+  for(const auto& variant : SHADER_IMAGE_VISUAL_SHADER_VARIANTS)
+  {
+    precompiledCount += variant.precompile ? 1u : 0u;
+  }
+  DALI_TEST_EQUALS(precompiledCount, 6u, TEST_LOCATION);
+
+  END_TEST;
+}
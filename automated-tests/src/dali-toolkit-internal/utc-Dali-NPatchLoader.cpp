@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+
+#include <dali-toolkit/internal/visuals/npatch/npatch-loader.h>
+#include <dali-toolkit/internal/visuals/npatch/npatch-loading-task.h>
+#include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_internal_npatch_loader_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_internal_npatch_loader_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* TEST_NPATCH_FILE_NAME  = TEST_RESOURCE_DIR "/heartsframe.9.png"; ///< 249x169 image with the border pixels
+const char* TEST_INVALID_FILE_NAME = TEST_RESOURCE_DIR "/invalid.9.png";
+
+} // namespace
+
+int UtcDaliNPatchLoadingTaskParseBorders(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliNPatchLoadingTaskParseBorders");
+
+  NPatchLoadingTaskPtr task = new NPatchLoadingTask(1, VisualUrl(TEST_NPATCH_FILE_NAME), EncodedImageBuffer(), Rect<int>(0, 0, 0, 0), DevelAsyncImageLoader::PreMultiplyOnLoad::ON, nullptr);
+  task->Process();
+
+  tet_infoline("The border pixels are parsed and cropped off in the task.");
+  Devel::PixelBuffer pixelBuffer = task->GetPixelBuffer();
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), 247u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), 167u, TEST_LOCATION);
+  DALI_TEST_CHECK(task->HasParsedBorders());
+  DALI_TEST_CHECK(task->GetStretchPixelsX().Size() > 0u);
+  DALI_TEST_CHECK(task->GetStretchPixelsY().Size() > 0u);
+  DALI_TEST_CHECK(task->IsPreMultiplied());
+
+  tet_infoline("The stretch regions of the previous load skip the parsing, the image is still cropped.");
+  NPatchLoadingTaskPtr cachedTask = new NPatchLoadingTask(2, VisualUrl(TEST_NPATCH_FILE_NAME), EncodedImageBuffer(), Rect<int>(0, 0, 0, 0), DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, nullptr);
+  cachedTask->SetStretchPixels(task->GetStretchPixelsX(), task->GetStretchPixelsY());
+  cachedTask->Process();
+
+  DALI_TEST_CHECK(cachedTask->GetPixelBuffer());
+  DALI_TEST_EQUALS(cachedTask->GetPixelBuffer().GetWidth(), 247u, TEST_LOCATION);
+  DALI_TEST_EQUALS(cachedTask->GetPixelBuffer().GetHeight(), 167u, TEST_LOCATION);
+  DALI_TEST_CHECK(!cachedTask->HasParsedBorders());
+  DALI_TEST_CHECK(!cachedTask->IsPreMultiplied());
+  DALI_TEST_EQUALS(cachedTask->GetStretchPixelsX().Size(), task->GetStretchPixelsX().Size(), TEST_LOCATION);
+  DALI_TEST_EQUALS(cachedTask->GetStretchPixelsX()[0], task->GetStretchPixelsX()[0], TEST_LOCATION);
+  DALI_TEST_EQUALS(cachedTask->GetStretchPixelsY()[0], task->GetStretchPixelsY()[0], TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliNPatchLoadingTaskBorder(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliNPatchLoadingTaskBorder");
+
+  NPatchLoadingTaskPtr task = new NPatchLoadingTask(1, VisualUrl(TEST_NPATCH_FILE_NAME), EncodedImageBuffer(), Rect<int>(10, 20, 30, 40), DevelAsyncImageLoader::PreMultiplyOnLoad::ON, nullptr);
+  task->Process();
+
+  tet_infoline("The given border makes a single stretch region, and the image is not cropped.");
+  DALI_TEST_CHECK(task->GetPixelBuffer());
+  DALI_TEST_EQUALS(task->GetPixelBuffer().GetWidth(), 249u, TEST_LOCATION);
+  DALI_TEST_EQUALS(task->GetPixelBuffer().GetHeight(), 169u, TEST_LOCATION);
+  DALI_TEST_CHECK(!task->HasParsedBorders());
+  DALI_TEST_EQUALS(task->GetStretchPixelsX().Size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(task->GetStretchPixelsY().Size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(task->GetStretchPixelsX()[0], Uint16Pair(10, 249 - 20), TEST_LOCATION);
+  DALI_TEST_EQUALS(task->GetStretchPixelsY()[0], Uint16Pair(40, 169 - 30), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliNPatchLoadingTaskInvalidUrl(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliNPatchLoadingTaskInvalidUrl");
+
+  NPatchLoadingTaskPtr task = new NPatchLoadingTask(1, VisualUrl(TEST_INVALID_FILE_NAME), EncodedImageBuffer(), Rect<int>(0, 0, 0, 0), DevelAsyncImageLoader::PreMultiplyOnLoad::ON, nullptr);
+  task->Process();
+
+  DALI_TEST_CHECK(!task->GetPixelBuffer());
+  DALI_TEST_CHECK(!task->HasParsedBorders());
+  DALI_TEST_CHECK(!task->IsPreMultiplied());
+
+  END_TEST;
+}
+
+int UtcDaliNPatchGeometryCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliNPatchGeometryCache");
+
+  VisualFactoryCache* factoryCache = new VisualFactoryCache(false);
+
+  tet_infoline("The n-patch images of the same layout share the geometry.");
+  Geometry geometry = factoryCache->GetNPatchGeometry(Uint16Pair(5, 7), false);
+  DALI_TEST_CHECK(geometry);
+  DALI_TEST_CHECK(geometry == factoryCache->GetNPatchGeometry(Uint16Pair(5, 7), false));
+  DALI_TEST_CHECK(geometry != factoryCache->GetNPatchGeometry(Uint16Pair(7, 5), false));
+  DALI_TEST_CHECK(geometry != factoryCache->GetNPatchGeometry(Uint16Pair(5, 7), true));
+
+  tet_infoline("The 3x3 layouts use the nine-patch geometries.");
+  Geometry ninePatch = factoryCache->GetNPatchGeometry(Uint16Pair(3, 3), false);
+  DALI_TEST_CHECK(ninePatch == factoryCache->GetGeometry(VisualFactoryCache::NINE_PATCH_GEOMETRY));
+  Geometry ninePatchBorder = factoryCache->GetNPatchGeometry(Uint16Pair(3, 3), true);
+  DALI_TEST_CHECK(ninePatchBorder == factoryCache->GetGeometry(VisualFactoryCache::NINE_PATCH_BORDER_GEOMETRY));
+
+  delete factoryCache;
+
+  END_TEST;
+}
+
+int UtcDaliNPatchLoaderStretchPixelsCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliNPatchLoaderStretchPixelsCache");
+  tet_infoline("The stretch regions are kept after the data of the url is removed, and dropped when the file is changed.");
+
+  const std::string fileName = (std::filesystem::temp_directory_path() / ("dali-toolkit-npatch-loader-test-" + std::to_string(getpid()) + ".9.png")).string();
+  std::filesystem::copy_file(TEST_NPATCH_FILE_NAME, fileName, std::filesystem::copy_options::overwrite_existing);
+
+  VisualFactoryCache* factoryCache = new VisualFactoryCache(false);
+  NPatchLoader&       loader       = factoryCache->GetNPatchLoader();
+  VisualUrl           url(fileName);
+  bool                preMultiplyOnLoad = true;
+
+  NPatchData::NPatchDataId id = loader.Load(factoryCache->GetTextureManager(), nullptr, url, Rect<int>(0, 0, 0, 0), preMultiplyOnLoad, true);
+  DALI_TEST_EQUALS(loader.GetStretchPixelsCacheCount(), 1u, TEST_LOCATION);
+
+  loader.RequestRemove(id, nullptr);
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(loader.GetStretchPixelsCacheCount(), 1u, TEST_LOCATION);
+
+  tet_infoline("The file is changed to a broken image. Its load fails, and the stretch regions are dropped.");
+  std::ofstream(fileName, std::ios::out | std::ios::trunc) << "broken";
+
+  preMultiplyOnLoad = true;
+  loader.Load(factoryCache->GetTextureManager(), nullptr, url, Rect<int>(0, 0, 0, 0), preMultiplyOnLoad, true);
+  DALI_TEST_EQUALS(loader.GetStretchPixelsCacheCount(), 0u, TEST_LOCATION);
+
+  delete factoryCache;
+
+  std::error_code errorCode;
+  std::filesystem::remove(fileName, errorCode);
+
+  END_TEST;
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/internal/builder/property-batch.h>
+
+using namespace Dali;
+using namespace Toolkit;
+
+int UtcDaliPropertyBatchAddFind(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that adding an index twice overwrites its value");
+
+  Internal::PropertyBatch batch;
+  DALI_TEST_CHECK(batch.Empty());
+
+  batch.Add(Actor::Property::OPACITY, 0.5f);
+  batch.Add(Actor::Property::NAME, "first");
+  batch.Add(Actor::Property::OPACITY, 0.25f);
+
+  DALI_TEST_EQUALS(batch.Count(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.GetIndex(0), static_cast<Property::Index>(Actor::Property::OPACITY), TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.GetIndex(1), static_cast<Property::Index>(Actor::Property::NAME), TEST_LOCATION);
+
+  const Property::Value* value = batch.Find(Actor::Property::OPACITY);
+  DALI_TEST_CHECK(value);
+  DALI_TEST_EQUALS(value->Get<float>(), 0.25f, TEST_LOCATION);
+  DALI_TEST_CHECK(!batch.Find(Actor::Property::SENSITIVE));
+
+  batch.Clear();
+  DALI_TEST_CHECK(batch.Empty());
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBatchAddMap(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the string keys of a map are resolved with the handle");
+
+  Control control = Control::New();
+
+  Property::Map properties;
+  properties["name"]                   = "control";
+  properties[Actor::Property::OPACITY] = 0.5f;
+  properties["styleName"]              = "style";
+  properties["notAProperty"]           = 1.0f;
+
+  Internal::PropertyBatch batch;
+  DALI_TEST_EQUALS(batch.Add(control, properties), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.Count(), 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.GetIndex(0), static_cast<Property::Index>(Actor::Property::NAME), TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.GetIndex(1), static_cast<Property::Index>(Actor::Property::OPACITY), TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.GetIndex(2), static_cast<Property::Index>(Control::Property::STYLE_NAME), TEST_LOCATION);
+
+  batch.Apply(control);
+
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(Actor::Property::NAME), std::string("control"), TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(Control::Property::STYLE_NAME), std::string("style"), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBatchCustomProperties(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the unresolved keys are registered as custom properties when the batch is applied");
+
+  Control control = Control::New();
+
+  Property::Map properties;
+  properties["name"]         = "control";
+  properties["firstCustom"]  = 1.0f;
+  properties["opacity"]      = 0.5f;
+  properties["secondCustom"] = Vector2(1.0f, 2.0f);
+
+  Internal::PropertyIndexCache cache;
+  Internal::PropertyBatch      batch;
+  batch.Add(control, properties, cache);
+  batch.AddCustomProperty("firstCustom", 4.0f);
+
+  DALI_TEST_EQUALS(batch.Count(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.GetCustomPropertyCount(), 2u, TEST_LOCATION);
+  DALI_TEST_CHECK(!batch.Empty());
+
+  batch.Apply(control);
+
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(Actor::Property::NAME), std::string("control"), TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<float>(control.GetPropertyIndex("firstCustom")), 4.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<Vector2>(control.GetPropertyIndex("secondCustom")), Vector2(1.0f, 2.0f), TEST_LOCATION);
+
+  batch.Clear();
+  DALI_TEST_CHECK(batch.Empty());
+  DALI_TEST_EQUALS(batch.GetCustomPropertyCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBatchIndexCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the cache resolves the default properties by type and does not keep custom indices");
+
+  Control first  = Control::New();
+  Control second = Control::New();
+  first.RegisterProperty("custom", 1.0f);
+
+  Internal::PropertyIndexCache cache;
+  Property::Type               type = Property::NONE;
+
+  DALI_TEST_EQUALS(cache.GetPropertyIndex(first, "opacity", type), static_cast<Property::Index>(Actor::Property::OPACITY), TEST_LOCATION);
+  DALI_TEST_EQUALS(type, Property::FLOAT, TEST_LOCATION);
+
+  type = Property::NONE;
+  DALI_TEST_EQUALS(cache.GetPropertyIndex(second, "opacity", type), static_cast<Property::Index>(Actor::Property::OPACITY), TEST_LOCATION);
+  DALI_TEST_EQUALS(type, Property::FLOAT, TEST_LOCATION);
+
+  DALI_TEST_CHECK(cache.GetPropertyIndex(first, "custom", type) != Property::INVALID_INDEX);
+  DALI_TEST_EQUALS(cache.GetPropertyIndex(second, "custom", type), Property::INVALID_INDEX, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBatchApplyBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Compare applying the same properties to many controls from a map keyed by index, as the styles did, and from a batch");
+
+  Property::Map properties;
+  properties["name"]              = "styled";
+  properties["opacity"]           = 0.5f;
+  properties["color"]             = Color::RED;
+  properties["sensitive"]         = false;
+  properties["parentOrigin"]      = ParentOrigin::CENTER;
+  properties["anchorPoint"]       = AnchorPoint::CENTER;
+  properties["position"]          = Vector3(10.0f, 20.0f, 0.0f);
+  properties["keyInputFocus"]     = false;
+  properties["widthResizePolicy"] = "FILL_TO_PARENT";
+
+  const int            CONTROL_COUNT = 2000;
+  std::vector<Control> mapControls;
+  std::vector<Control> batchControls;
+  for(int i = 0; i < CONTROL_COUNT; ++i)
+  {
+    mapControls.push_back(Control::New());
+    batchControls.push_back(Control::New());
+  }
+
+  // The styles recorded the properties in a map keyed by index, of which each pair was copied for every control
+  Property::Map indexProperties;
+  for(Property::Map::SizeType i = 0; i < properties.Count(); ++i)
+  {
+    KeyValuePair keyValue = properties.GetKeyValue(i);
+    indexProperties.Insert(mapControls[0].GetPropertyIndex(keyValue.first.stringKey), keyValue.second);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for(auto& control : mapControls)
+  {
+    for(Property::Map::SizeType i = 0; i < indexProperties.Count(); ++i)
+    {
+      KeyValuePair keyValue = indexProperties.GetKeyValue(i);
+      if(keyValue.first.type == Property::Key::INDEX)
+      {
+        control.SetProperty(keyValue.first.indexKey, keyValue.second);
+      }
+    }
+  }
+  auto mapTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  // The keys are resolved once, as when the style is recorded
+  Internal::PropertyBatch batch;
+  batch.Add(batchControls[0], properties);
+
+  start = std::chrono::steady_clock::now();
+  for(auto& control : batchControls)
+  {
+    batch.Apply(control);
+  }
+  auto batchTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  tet_printf("Applied %d properties to %d controls : map %lld us, batch %lld us\n", static_cast<int>(properties.Count()), CONTROL_COUNT, static_cast<long long>(mapTime), static_cast<long long>(batchTime));
+
+  for(int i = 0; i < CONTROL_COUNT; i += CONTROL_COUNT / 4)
+  {
+    DALI_TEST_EQUALS(batchControls[i].GetProperty<std::string>(Actor::Property::NAME), mapControls[i].GetProperty<std::string>(Actor::Property::NAME), TEST_LOCATION);
+    DALI_TEST_EQUALS(batchControls[i].GetProperty<float>(Actor::Property::OPACITY), mapControls[i].GetProperty<float>(Actor::Property::OPACITY), TEST_LOCATION);
+    DALI_TEST_EQUALS(batchControls[i].GetProperty<Vector3>(Actor::Property::POSITION), Vector3(10.0f, 20.0f, 0.0f), TEST_LOCATION);
+    DALI_TEST_EQUALS(batchControls[i].GetProperty<bool>(Actor::Property::SENSITIVE), false, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBatchSetPropertiesBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Compare setting a map on many controls key by key, as each caller did, and with DevelControl::SetProperties");
+
+  Property::Map properties;
+  properties["name"]              = "bulk";
+  properties["opacity"]           = 0.5f;
+  properties["color"]             = Color::RED;
+  properties["sensitive"]         = false;
+  properties["position"]          = Vector3(10.0f, 20.0f, 0.0f);
+  properties["widthResizePolicy"] = "FILL_TO_PARENT";
+  properties["firstCustom"]       = 1.0f;
+  properties["secondCustom"]      = Vector2(1.0f, 2.0f);
+  properties["thirdCustom"]       = "custom";
+
+  const int            CONTROL_COUNT = 2000;
+  std::vector<Control> keyControls;
+  std::vector<Control> bulkControls;
+  for(int i = 0; i < CONTROL_COUNT; ++i)
+  {
+    keyControls.push_back(Control::New());
+    bulkControls.push_back(Control::New());
+  }
+
+  // Each key is looked up by name on every control, and registered when the control does not have it
+  auto start = std::chrono::steady_clock::now();
+  for(auto& control : keyControls)
+  {
+    for(Property::Map::SizeType i = 0; i < properties.Count(); ++i)
+    {
+      KeyValuePair    keyValue = properties.GetKeyValue(i);
+      Property::Index index    = control.GetPropertyIndex(keyValue.first.stringKey);
+      if(index != Property::INVALID_INDEX)
+      {
+        control.SetProperty(index, keyValue.second);
+      }
+      else
+      {
+        control.RegisterProperty(keyValue.first.stringKey, keyValue.second);
+      }
+    }
+  }
+  auto keyTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for(auto& control : bulkControls)
+  {
+    DevelControl::SetProperties(control, properties);
+  }
+  auto bulkTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  tet_printf("Set %d properties on %d controls : key by key %lld us, SetProperties %lld us\n", static_cast<int>(properties.Count()), CONTROL_COUNT, static_cast<long long>(keyTime), static_cast<long long>(bulkTime));
+
+  for(int i = 0; i < CONTROL_COUNT; i += CONTROL_COUNT / 4)
+  {
+    DALI_TEST_EQUALS(bulkControls[i].GetProperty<std::string>(Actor::Property::NAME), keyControls[i].GetProperty<std::string>(Actor::Property::NAME), TEST_LOCATION);
+    DALI_TEST_EQUALS(bulkControls[i].GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+    DALI_TEST_EQUALS(bulkControls[i].GetProperty<float>(bulkControls[i].GetPropertyIndex("firstCustom")), 1.0f, TEST_LOCATION);
+    DALI_TEST_EQUALS(bulkControls[i].GetProperty<std::string>(bulkControls[i].GetPropertyIndex("thirdCustom")), std::string("custom"), TEST_LOCATION);
+  }
+
+  END_TEST;
+}
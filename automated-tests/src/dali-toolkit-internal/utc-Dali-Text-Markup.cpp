@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <iostream>
 
 #include <stdlib.h>
+#include <chrono>
 #include <limits>
 
 #include <dali-toolkit-test-suite-utils.h>
@@ -470,3 +471,51 @@ int UtcDaliTextXHTMLEntityToUTF8(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextMarkupProcessingThroughput(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMarkupProcessingThroughput - process a 100 KB marked-up document");
+
+  const std::string markupFragment(
+    "<color value='red'>Hello</color> <b>bold</b> <i>italic</i> <u>under</u> <s>strike</s> "
+    "<SPAN font-family='DejaVu Sans' font-size='20' text-color='green' u-color='blue' s-height='2.0' char-space-value='1.0'>span</SPAN> "
+    "<font family='DejaVuSerif' size='18'>font</font> <background color='yellow'>bg</background> "
+    "&amp; &lt; &gt; &copy; &Dagger; &hearts;\n");
+  const std::string plainFragment("Hello bold italic under strike span font bg & < > \xc2\xa9 \xe2\x80\xa1 \xe2\x99\xa5\n");
+
+  std::string markupString;
+  std::string expectedString;
+  while(markupString.size() < 100u * 1024u)
+  {
+    markupString += markupFragment;
+    expectedString += plainFragment;
+  }
+
+  Vector<ColorRun>                     colorRuns;
+  Vector<FontDescriptionRun>           fontRuns;
+  Vector<EmbeddedItem>                 items;
+  Vector<Anchor>                       anchors;
+  Vector<UnderlinedCharacterRun>       underlinedCharacterRuns;
+  Vector<ColorRun>                     backgroundColorRuns;
+  Vector<StrikethroughCharacterRun>    strikethroughCharacterRuns;
+  Vector<BoundedParagraphRun>          boundedParagraphRuns;
+  Vector<CharacterSpacingCharacterRun> characterSpacingCharacterRuns;
+  MarkupProcessData                    markupProcessData(colorRuns, fontRuns, items, anchors, underlinedCharacterRuns, backgroundColorRuns, strikethroughCharacterRuns, boundedParagraphRuns, characterSpacingCharacterRuns);
+  MarkupPropertyData                   markupPropertyData(Color::MEDIUM_BLUE, Color::DARK_MAGENTA);
+
+  const auto start = std::chrono::steady_clock::now();
+  ProcessMarkupString(markupString, markupPropertyData, markupProcessData);
+  const auto end = std::chrono::steady_clock::now();
+
+  const long long elapsedUs = static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+  tet_printf(" Processed %zu bytes of mark-up in %lld us\n", markupString.size(), elapsedUs);
+
+  DALI_TEST_EQUALS(markupProcessData.markupProcessedText, expectedString, TEST_LOCATION);
+
+  const std::size_t fragmentCount = markupString.size() / markupFragment.size();
+  DALI_TEST_EQUALS(static_cast<std::size_t>(colorRuns.Count()), fragmentCount * 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<std::size_t>(strikethroughCharacterRuns.Count()), fragmentCount * 2u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  *
  */
 
+#include <fstream>
 #include <iostream>
 #include <stdlib.h>
 #include <unistd.h>
@@ -1915,4 +1916,165 @@ int UtcDaliTextMultiLanguageLocaleChange(void)
   DALI_TEST_EQUALS(newLocale.data(), GetImplementation(multilanguageSupport).GetLocale(), TEST_LOCATION);
 
   END_TEST;
-}
\ No newline at end of file
+}
+namespace
+{
+Vector<FontRun> ValidateFontsWithDefaultFont(const std::string& text, const std::string& defaultFont)
+{
+  MultilanguageSupport        multilanguageSupport = MultilanguageSupport::Get();
+  TextAbstraction::FontClient fontClient           = TextAbstraction::FontClient::Get();
+
+  Vector<Character> utf32;
+  utf32.Resize(text.size());
+
+  const uint32_t numberOfCharacters = Utf8ToUtf32(reinterpret_cast<const uint8_t* const>(text.c_str()), text.size(), &utf32[0u]);
+  utf32.Resize(numberOfCharacters);
+
+  Vector<ScriptRun> scripts;
+  multilanguageSupport.SetScripts(utf32, 0u, numberOfCharacters, scripts);
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  const FontId defaultFontId = fontClient.GetFontId(pathName + DEFAULT_FONT_DIR + defaultFont);
+  TextAbstraction::FontDescription defaultFontDescription;
+  fontClient.GetDescription(defaultFontId, defaultFontDescription);
+
+  Vector<FontDescriptionRun> fontDescriptions;
+  Vector<FontRun>            fontRuns;
+  multilanguageSupport.ValidateFonts(utf32, scripts, fontDescriptions, defaultFontDescription, fontClient.GetPointSize(defaultFontId), 1.f, 0u, numberOfCharacters, fontRuns);
+
+  return fontRuns;
+}
+
+void CheckFontRuns(const Vector<FontRun>& fontRuns, const Vector<FontRun>& expectedFontRuns, const char* location)
+{
+  DALI_TEST_EQUALS(fontRuns.Count(), expectedFontRuns.Count(), location);
+  for(uint32_t index = 0u; (index < fontRuns.Count()) && (index < expectedFontRuns.Count()); ++index)
+  {
+    DALI_TEST_EQUALS(fontRuns[index].characterRun.characterIndex, expectedFontRuns[index].characterRun.characterIndex, location);
+    DALI_TEST_EQUALS(fontRuns[index].characterRun.numberOfCharacters, expectedFontRuns[index].characterRun.numberOfCharacters, location);
+    DALI_TEST_EQUALS(fontRuns[index].fontId, expectedFontRuns[index].fontId, location);
+  }
+}
+} // namespace
+
+int UtcDaliTextMultiLanguageFallbackFontCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMultiLanguageFallbackFontCache");
+
+  MultilanguageSupport                    multilanguageSupport = MultilanguageSupport::Get();
+  const Internal::FallbackFonts&          fallbackFonts        = GetImplementation(multilanguageSupport).GetFallbackFonts();
+  Dali::Adaptor::LocaleChangedSignalType& localeChangedSignal  = application.GetAdaptor().LocaleChangedSignal();
+
+  // The latin font doesn't support the hebrew characters so a fall-back font is needed.
+  const std::string text("Hello world, שלום עולם, hello world, שלום עולם");
+  const std::string defaultFont("/tizen/TizenSansRegular.ttf");
+
+  // The first validation queries the font client.
+  uint32_t              numberOfHits     = fallbackFonts.mNumberOfHits;
+  uint32_t              numberOfMisses   = fallbackFonts.mNumberOfMisses;
+  const Vector<FontRun> expectedFontRuns = ValidateFontsWithDefaultFont(text, defaultFont);
+  DALI_TEST_CHECK(expectedFontRuns.Count() > 0u);
+  DALI_TEST_CHECK(fallbackFonts.mNumberOfMisses > numberOfMisses);
+
+  // The fall-back fonts are kept when the locale changes, so they are found in the cache.
+  localeChangedSignal.Emit("fallback_TEST");
+  numberOfHits   = fallbackFonts.mNumberOfHits;
+  numberOfMisses = fallbackFonts.mNumberOfMisses;
+  CheckFontRuns(ValidateFontsWithDefaultFont(text, defaultFont), expectedFontRuns, TEST_LOCATION);
+  DALI_TEST_CHECK(fallbackFonts.mNumberOfHits > numberOfHits);
+  DALI_TEST_EQUALS(fallbackFonts.mNumberOfMisses, numberOfMisses, TEST_LOCATION);
+
+  // Save and load the fall-back fonts. The loaded fonts are found in the cache.
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string cachePath   = std::string(pathNamePtr) + "/fallback-font-cache.txt";
+  free(pathNamePtr);
+
+  DALI_TEST_CHECK(GetImplementation(multilanguageSupport).SaveFallbackFontCache(cachePath));
+  localeChangedSignal.Emit("fallback_TEST_2");
+  DALI_TEST_CHECK(GetImplementation(multilanguageSupport).LoadFallbackFontCache(cachePath));
+  numberOfHits   = fallbackFonts.mNumberOfHits;
+  numberOfMisses = fallbackFonts.mNumberOfMisses;
+  CheckFontRuns(ValidateFontsWithDefaultFont(text, defaultFont), expectedFontRuns, TEST_LOCATION);
+  DALI_TEST_CHECK(fallbackFonts.mNumberOfHits > numberOfHits);
+  DALI_TEST_EQUALS(fallbackFonts.mNumberOfMisses, numberOfMisses, TEST_LOCATION);
+
+  // A file which is not a fall-back font cache is not loaded, and the cache is empty.
+  {
+    std::ofstream file(cachePath, std::ios::trunc);
+    file << "This is not a fall-back font cache\n";
+  }
+  DALI_TEST_CHECK(!GetImplementation(multilanguageSupport).LoadFallbackFontCache(cachePath));
+  unlink(cachePath.c_str());
+
+  localeChangedSignal.Emit("fallback_TEST_3");
+  numberOfHits   = fallbackFonts.mNumberOfHits;
+  numberOfMisses = fallbackFonts.mNumberOfMisses;
+  CheckFontRuns(ValidateFontsWithDefaultFont(text, defaultFont), expectedFontRuns, TEST_LOCATION);
+  DALI_TEST_EQUALS(fallbackFonts.mNumberOfHits, numberOfHits, TEST_LOCATION);
+  DALI_TEST_CHECK(fallbackFonts.mNumberOfMisses > numberOfMisses);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextMultiLanguageFallbackFontCacheLeastRecentlyUsed(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMultiLanguageFallbackFontCacheLeastRecentlyUsed");
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  const FontId                     fontId = fontClient.GetFontId(pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf");
+  TextAbstraction::FontDescription description;
+  fontClient.GetDescription(fontId, description);
+  const TextAbstraction::PointSize26Dot6 pointSize = fontClient.GetPointSize(fontId);
+
+  // Fill the cache with one character per block. The latin 'A' is in the first block.
+  const Character         CHARACTER_A = 0x0041;
+  const uint32_t          BLOCK_SIZE  = Internal::FallbackFonts::BLOCK_SIZE;
+  Internal::FallbackFonts fallbackFonts;
+  std::vector<Character>  characters;
+  for(Character character = CHARACTER_A; fallbackFonts.mBlocks.size() < 512u; character += BLOCK_SIZE)
+  {
+    fallbackFonts.Cache(fontClient, character, TextAbstraction::LATIN, description, pointSize, fontId);
+    characters.push_back(character);
+  }
+  const std::size_t numberOfBlocks = fallbackFonts.mBlocks.size();
+
+  // Use the first block, then add a new one. The cache is not emptied, only the least recently used block is removed.
+  DALI_TEST_EQUALS(fallbackFonts.FindFont(fontClient, CHARACTER_A, description, pointSize), fontId, TEST_LOCATION);
+  fallbackFonts.Cache(fontClient, characters.back() + BLOCK_SIZE, TextAbstraction::LATIN, description, pointSize, fontId);
+  DALI_TEST_EQUALS(fallbackFonts.mBlocks.size(), numberOfBlocks, TEST_LOCATION);
+  DALI_TEST_EQUALS(fallbackFonts.mLruBlocks.size(), numberOfBlocks, TEST_LOCATION);
+
+  const uint32_t numberOfMisses = fallbackFonts.mNumberOfMisses;
+  DALI_TEST_EQUALS(fallbackFonts.FindFont(fontClient, CHARACTER_A, description, pointSize), fontId, TEST_LOCATION);
+  DALI_TEST_EQUALS(fallbackFonts.mNumberOfMisses, numberOfMisses, TEST_LOCATION);
+
+  // The second block was the least recently used one.
+  DALI_TEST_EQUALS(fallbackFonts.FindFont(fontClient, characters[1u], description, pointSize), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(fallbackFonts.mNumberOfMisses, numberOfMisses + 1u, TEST_LOCATION);
+
+  // The same font with another point size is a different font item.
+  fallbackFonts.Cache(fontClient, CHARACTER_A + 1u, TextAbstraction::LATIN, description, pointSize * 2u, fontId);
+  DALI_TEST_EQUALS(fallbackFonts.mFonts.size(), 2u, TEST_LOCATION);
+
+  // A block is locale dependent if any of its characters is, not only the first one.
+  const Character CJK_CHARACTER = 0x4E00;
+  fallbackFonts.Cache(fontClient, CJK_CHARACTER, TextAbstraction::LATIN, description, pointSize, fontId);
+  fallbackFonts.Cache(fontClient, CJK_CHARACTER + 1u, TextAbstraction::CJK, description, pointSize, fontId);
+  fallbackFonts.ClearLocaleDependentFonts();
+  DALI_TEST_EQUALS(fallbackFonts.FindFont(fontClient, CJK_CHARACTER, description, pointSize), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(fallbackFonts.mBlocks.size(), fallbackFonts.mLruBlocks.size(), TEST_LOCATION);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
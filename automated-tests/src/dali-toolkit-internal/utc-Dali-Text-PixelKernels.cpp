@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/text/rendering/pixel-kernels.h>
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Text;
+
+// Tests the vectorized pixel kernels give exactly the same result as the scalar ones.
+
+namespace
+{
+constexpr uint32_t MAX_NUMBER_OF_PIXELS = 67u; // Covers several vector iterations plus every length of the scalar tail.
+
+/**
+ * @brief Creates pre-multiplied RGBA pixels. A quarter of them are transparent and another quarter opaque.
+ */
+std::vector<uint32_t> CreatePremultipliedPixels(std::mt19937& generator, uint32_t numberOfPixels)
+{
+  std::vector<uint32_t> pixels(numberOfPixels);
+  for(auto& pixel : pixels)
+  {
+    const uint32_t kind  = generator() % 4u;
+    const uint32_t alpha = (kind == 0u) ? 0u : ((kind == 1u) ? 255u : generator() % 256u);
+
+    pixel = alpha << 24u;
+    for(uint32_t channel = 0u; channel < 3u; ++channel)
+    {
+      pixel |= (generator() % (alpha + 1u)) << (channel * 8u);
+    }
+  }
+  return pixels;
+}
+
+std::vector<uint32_t> CreatePixels(std::mt19937& generator, uint32_t numberOfPixels)
+{
+  std::vector<uint32_t> pixels(numberOfPixels);
+  for(auto& pixel : pixels)
+  {
+    pixel = generator();
+  }
+  return pixels;
+}
+
+/**
+ * @brief Creates alpha values. A third of them are transparent.
+ */
+std::vector<uint8_t> CreateAlphas(std::mt19937& generator, uint32_t numberOfAlphas)
+{
+  std::vector<uint8_t> alphas(numberOfAlphas);
+  for(auto& alpha : alphas)
+  {
+    alpha = (generator() % 3u == 0u) ? 0u : static_cast<uint8_t>(generator() % 256u);
+  }
+  return alphas;
+}
+
+} // namespace
+
+int UtcDaliTextPixelKernelsSelection(void)
+{
+  tet_infoline(" UtcDaliTextPixelKernelsSelection");
+
+  const PixelKernels& kernels = GetPixelKernels();
+  tet_printf("Pixel kernels : %s\n", kernels.name);
+
+  // The selection is done once.
+  DALI_TEST_CHECK(&kernels == &GetPixelKernels());
+  DALI_TEST_EQUALS(std::string(GetScalarPixelKernels().name), std::string("scalar"), TEST_LOCATION);
+
+  DALI_TEST_CHECK(kernels.combine);
+  DALI_TEST_CHECK(kernels.mask);
+  DALI_TEST_CHECK(kernels.blitGlyph);
+  DALI_TEST_CHECK(kernels.blitGlyphAlpha);
+  DALI_TEST_CHECK(kernels.expandAlpha);
+  DALI_TEST_CHECK(kernels.expandAlphaMultiplied);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextPixelKernelsCombine(void)
+{
+  tet_infoline(" UtcDaliTextPixelKernelsCombine");
+
+  const PixelKernels& kernels = GetPixelKernels();
+  const PixelKernels& scalar  = GetScalarPixelKernels();
+
+  // Checks the scalar blend first.
+  {
+    const uint32_t top[]    = {0x00000000u, 0xff102030u, 0x80402010u};
+    const uint32_t bottom[] = {0xff0000ffu, 0xffffffffu, 0xff0000ffu};
+    uint32_t       output[3u];
+
+    scalar.combine(top, bottom, output, 3u);
+    DALI_TEST_EQUALS(output[0u], 0xff0000ffu, TEST_LOCATION); // Transparent top.
+    DALI_TEST_EQUALS(output[1u], 0xff102030u, TEST_LOCATION); // Opaque top.
+    DALI_TEST_EQUALS(output[2u], 0xff40208fu, TEST_LOCATION); // 0x80 + 0xff * 0x7f / 255 = 0xff and 0x10 + 0xff * 0x7f / 255 = 0x8f.
+  }
+
+  std::mt19937 generator(1u);
+  for(uint32_t numberOfPixels = 0u; numberOfPixels <= MAX_NUMBER_OF_PIXELS; ++numberOfPixels)
+  {
+    const std::vector<uint32_t> top    = CreatePremultipliedPixels(generator, numberOfPixels);
+    const std::vector<uint32_t> bottom = CreatePixels(generator, numberOfPixels);
+
+    std::vector<uint32_t> expected(numberOfPixels);
+    std::vector<uint32_t> result(numberOfPixels);
+
+    scalar.combine(top.data(), bottom.data(), expected.data(), numberOfPixels);
+    kernels.combine(top.data(), bottom.data(), result.data(), numberOfPixels);
+    DALI_TEST_CHECK(expected == result);
+
+    // The result may be stored into the top or the bottom buffer.
+    result = top;
+    kernels.combine(result.data(), bottom.data(), result.data(), numberOfPixels);
+    DALI_TEST_CHECK(expected == result);
+
+    result = bottom;
+    kernels.combine(top.data(), result.data(), result.data(), numberOfPixels);
+    DALI_TEST_CHECK(expected == result);
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextPixelKernelsMask(void)
+{
+  tet_infoline(" UtcDaliTextPixelKernelsMask");
+
+  const PixelKernels& kernels = GetPixelKernels();
+  const PixelKernels& scalar  = GetScalarPixelKernels();
+
+  std::mt19937 generator(2u);
+  for(uint32_t numberOfPixels = 0u; numberOfPixels <= MAX_NUMBER_OF_PIXELS; ++numberOfPixels)
+  {
+    const std::vector<uint32_t> top    = CreatePremultipliedPixels(generator, numberOfPixels);
+    const std::vector<uint32_t> bottom = CreatePixels(generator, numberOfPixels);
+
+    for(const uint8_t originAlpha : {0u, 127u, 255u, static_cast<unsigned int>(generator() % 256u)})
+    {
+      std::vector<uint32_t> expected = bottom;
+      std::vector<uint32_t> result   = bottom;
+
+      scalar.mask(top.data(), expected.data(), originAlpha, numberOfPixels);
+      kernels.mask(top.data(), result.data(), originAlpha, numberOfPixels);
+      DALI_TEST_CHECK(expected == result);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextPixelKernelsBlitGlyph(void)
+{
+  tet_infoline(" UtcDaliTextPixelKernelsBlitGlyph");
+
+  const PixelKernels& kernels = GetPixelKernels();
+  const PixelKernels& scalar  = GetScalarPixelKernels();
+
+  std::mt19937 generator(3u);
+  for(uint32_t numberOfPixels = 0u; numberOfPixels <= MAX_NUMBER_OF_PIXELS; ++numberOfPixels)
+  {
+    // L8 and BGRA8888 glyphs.
+    for(const uint32_t glyphPixelSize : {1u, 4u})
+    {
+      const std::vector<uint8_t>  glyph       = CreateAlphas(generator, numberOfPixels * glyphPixelSize);
+      const std::vector<uint32_t> output      = CreatePremultipliedPixels(generator, numberOfPixels);
+      const uint32_t              packedColor = CreatePremultipliedPixels(generator, 1u)[0u];
+
+      std::vector<uint32_t> expected = output;
+      std::vector<uint32_t> result   = output;
+
+      scalar.blitGlyph(glyph.data(), glyphPixelSize, packedColor, expected.data(), numberOfPixels);
+      kernels.blitGlyph(glyph.data(), glyphPixelSize, packedColor, result.data(), numberOfPixels);
+      DALI_TEST_CHECK(expected == result);
+
+      std::vector<uint8_t> expectedAlpha = CreateAlphas(generator, numberOfPixels);
+      std::vector<uint8_t> resultAlpha   = expectedAlpha;
+
+      scalar.blitGlyphAlpha(glyph.data(), glyphPixelSize, expectedAlpha.data(), numberOfPixels);
+      kernels.blitGlyphAlpha(glyph.data(), glyphPixelSize, resultAlpha.data(), numberOfPixels);
+      DALI_TEST_CHECK(expectedAlpha == resultAlpha);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextPixelKernelsExpandAlpha(void)
+{
+  tet_infoline(" UtcDaliTextPixelKernelsExpandAlpha");
+
+  const PixelKernels& kernels = GetPixelKernels();
+  const PixelKernels& scalar  = GetScalarPixelKernels();
+
+  std::mt19937                          generator(4u);
+  std::uniform_real_distribution<float> distribution(0.f, 1.f);
+  for(uint32_t numberOfPixels = 0u; numberOfPixels <= MAX_NUMBER_OF_PIXELS; ++numberOfPixels)
+  {
+    const std::vector<uint8_t> alphas = CreateAlphas(generator, numberOfPixels);
+
+    std::vector<uint32_t> expected(numberOfPixels);
+    std::vector<uint32_t> result(numberOfPixels);
+
+    const uint32_t packedColor = generator() & 0x00ffffffu;
+    scalar.expandAlpha(alphas.data(), packedColor, expected.data(), numberOfPixels);
+    kernels.expandAlpha(alphas.data(), packedColor, result.data(), numberOfPixels);
+    DALI_TEST_CHECK(expected == result);
+
+    const float color[4u] = {distribution(generator), distribution(generator), distribution(generator), 1.f};
+    scalar.expandAlphaMultiplied(alphas.data(), color, expected.data(), numberOfPixels);
+    kernels.expandAlphaMultiplied(alphas.data(), color, result.data(), numberOfPixels);
+    DALI_TEST_CHECK(expected == result);
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextPixelKernelsPerformance(void)
+{
+  tet_infoline(" UtcDaliTextPixelKernelsPerformance");
+
+  const PixelKernels& kernels = GetPixelKernels();
+  const PixelKernels& scalar  = GetScalarPixelKernels();
+
+  // A 1024x256 text layer.
+  constexpr uint32_t NUMBER_OF_PIXELS = 1024u * 256u;
+  constexpr uint32_t NUMBER_OF_LOOPS  = 10u;
+
+  std::mt19937                generator(5u);
+  const std::vector<uint32_t> top    = CreatePremultipliedPixels(generator, NUMBER_OF_PIXELS);
+  const std::vector<uint32_t> bottom = CreatePixels(generator, NUMBER_OF_PIXELS);
+  const std::vector<uint8_t>  alphas = CreateAlphas(generator, NUMBER_OF_PIXELS);
+
+  std::vector<uint32_t> expected(NUMBER_OF_PIXELS);
+  std::vector<uint32_t> result(NUMBER_OF_PIXELS);
+
+  for(const PixelKernels* implementation : {&scalar, &kernels})
+  {
+    std::vector<uint32_t>& output = (implementation == &scalar) ? expected : result;
+
+    const auto combineStart = std::chrono::steady_clock::now();
+    for(uint32_t loop = 0u; loop < NUMBER_OF_LOOPS; ++loop)
+    {
+      implementation->combine(top.data(), bottom.data(), output.data(), NUMBER_OF_PIXELS);
+    }
+    const auto blitStart = std::chrono::steady_clock::now();
+    for(uint32_t loop = 0u; loop < NUMBER_OF_LOOPS; ++loop)
+    {
+      implementation->blitGlyph(alphas.data(), 1u, 0xff2040a0u, output.data(), NUMBER_OF_PIXELS);
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    tet_printf("%s : combine %lld us, blitGlyph %lld us\n", implementation->name, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(blitStart - combineStart).count()), static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - blitStart).count()));
+  }
+
+  // Both implementations did the same operations.
+  DALI_TEST_CHECK(expected == result);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
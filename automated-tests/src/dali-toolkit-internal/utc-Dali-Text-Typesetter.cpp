@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <iostream>
 
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <limits>
 
@@ -462,3 +463,134 @@ int UtcDaliTextTypesetterBitmapFont(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextTypesetterRenderStylesReuseLayerBuffers(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterRenderStylesReuseLayerBuffers");
+  ToolkitTestApplication application;
+
+  // Load some fonts.
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  fontClient.GetFontId(pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf");
+
+  // Creates a text controller.
+  ControllerPtr controller = Controller::New();
+
+  // Configures the text controller similarly to the text-label.
+  ConfigureTextLabel(controller);
+
+  // Sets the text and all the styles rendered in the same pass over the glyphs.
+  controller->SetMarkupProcessorEnabled(true);
+  controller->SetText("<font family='TizenSansRegular'>Hello <u>world</u> <s>Hello</s> world</font>");
+  controller->SetOutlineWidth(2u);
+  controller->SetOutlineColor(Color::BLUE);
+  controller->SetShadowOffset(Vector2(2.f, 2.f));
+  controller->SetShadowColor(Color::BLACK);
+  controller->SetBackgroundEnabled(true);
+  controller->SetBackgroundColor(Color::YELLOW);
+  controller->SetUnderlineEnabled(true);
+  controller->SetUnderlineColor(Color::RED);
+  controller->SetStrikethroughEnabled(true);
+  controller->SetStrikethroughColor(Color::GREEN);
+
+  // Creates the text's model and relais-out the text.
+  const Size relayoutSize(120.f, 60.f);
+  controller->Relayout(relayoutSize);
+
+  TypesetterPtr renderingController = Typesetter::New(controller->GetTextModel());
+  DALI_TEST_CHECK(renderingController);
+
+  const size_t bufferSize = 120u * 60u * sizeof(uint32_t);
+
+  const Typesetter::RenderBehaviour behaviours[] = {Typesetter::RENDER_TEXT_AND_STYLES, Typesetter::RENDER_NO_TEXT, Typesetter::RENDER_OVERLAY_STYLE};
+  for(const auto behaviour : behaviours)
+  {
+    // Rendering again must give the same result.
+    Devel::PixelBuffer first  = renderingController->RenderWithPixelBuffer(relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT, behaviour);
+    Devel::PixelBuffer second = renderingController->RenderWithPixelBuffer(relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT, behaviour);
+    DALI_TEST_CHECK(first);
+    DALI_TEST_CHECK(second);
+
+    DALI_TEST_EQUALS(120u, second.GetWidth(), TEST_LOCATION);
+    DALI_TEST_EQUALS(60u, second.GetHeight(), TEST_LOCATION);
+    DALI_TEST_EQUALS(Pixel::RGBA8888, second.GetPixelFormat(), TEST_LOCATION);
+
+    // The layer buffers are not returned, the result is a buffer of its own.
+    DALI_TEST_CHECK(first.GetBuffer() != second.GetBuffer());
+    DALI_TEST_EQUALS(0, memcmp(first.GetBuffer(), second.GetBuffer(), bufferSize), TEST_LOCATION);
+
+    // The layer buffers are kept for the next render, within the bound of the pool.
+    DALI_TEST_CHECK(Typesetter::GetNumberOfPooledLayerBuffers() > 0u);
+    DALI_TEST_CHECK(Typesetter::GetSizeOfPooledLayerBuffers() <= 4u * 1024u * 1024u);
+  }
+
+  // Resizing renders buffers of the new size, the pooled buffers of the previous size are not used.
+  const Size newRelayoutSize(80.f, 40.f);
+  controller->Relayout(newRelayoutSize);
+
+  Devel::PixelBuffer resized = renderingController->RenderWithPixelBuffer(newRelayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT);
+  DALI_TEST_EQUALS(80u, resized.GetWidth(), TEST_LOCATION);
+  DALI_TEST_EQUALS(40u, resized.GetHeight(), TEST_LOCATION);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextTypesetterLayerBuffersSharedByRenders(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterLayerBuffersSharedByRenders");
+  ToolkitTestApplication application;
+
+  // Load some fonts.
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  fontClient.GetFontId(pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf");
+
+  // Many labels with every style layer, as on a screen full of text.
+  const uint32_t             NUMBER_OF_LABELS = 20u;
+  const Size                 relayoutSize(120.f, 60.f);
+  std::vector<ControllerPtr> controllers;
+  std::vector<TypesetterPtr> typesetters;
+  for(uint32_t index = 0u; index < NUMBER_OF_LABELS; ++index)
+  {
+    ControllerPtr controller = Controller::New();
+    ConfigureTextLabel(controller);
+    controller->SetMarkupProcessorEnabled(true);
+    controller->SetText("<font family='TizenSansRegular'>Hello <u>world</u> <s>Hello</s> world</font>");
+    controller->SetOutlineWidth(2u);
+    controller->SetShadowOffset(Vector2(2.f, 2.f));
+    controller->SetBackgroundEnabled(true);
+    controller->SetUnderlineEnabled(true);
+    controller->SetStrikethroughEnabled(true);
+    controller->Relayout(relayoutSize);
+
+    controllers.push_back(controller);
+    typesetters.push_back(Typesetter::New(controller->GetTextModel()));
+  }
+
+  for(auto& typesetter : typesetters)
+  {
+    Devel::PixelBuffer buffer = typesetter->RenderWithPixelBuffer(relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT, Typesetter::RENDER_TEXT_AND_STYLES);
+    DALI_TEST_CHECK(buffer);
+    buffer = typesetter->RenderWithPixelBuffer(relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT, Typesetter::RENDER_OVERLAY_STYLE);
+    DALI_TEST_CHECK(buffer);
+  }
+
+  // The renders reuse the buffers released by the previous ones, so the pool holds at most the buffers of a render.
+  // The memory held doesn't grow with the number of labels nor of renders.
+  DALI_TEST_CHECK(Typesetter::GetNumberOfPooledLayerBuffers() > 0u);
+  DALI_TEST_CHECK(Typesetter::GetNumberOfPooledLayerBuffers() <= 4u);
+  DALI_TEST_CHECK(Typesetter::GetSizeOfPooledLayerBuffers() <= 4u * 120u * 60u * sizeof(uint32_t));
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -15,6 +15,7 @@
  *
  */
 
+#include <cstring>
 #include <iostream>
 
 #include <stdlib.h>
@@ -24,6 +25,7 @@
 #include <toolkit-event-thread-callback.h>
 #include <toolkit-timer.h>
 
+#include <dali-toolkit/internal/image-loader/loading-task.h>
 #include <dali-toolkit/internal/texture-manager/texture-async-loading-helper.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 #include <dali-toolkit/internal/texture-manager/texture-upload-observer.h>
@@ -31,7 +33,9 @@
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h> ///< For VisualFactory's member TextureManager.
 #include <dali-toolkit/public-api/image-loader/image-url.h>
 #include <dali-toolkit/public-api/image-loader/image.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/devel-api/threading/conditional-wait.h>
 
 #include <test-encoded-image-buffer.h>
 
@@ -65,6 +69,7 @@ const char* TEST_MASK_FILE_NAME    = TEST_RESOURCE_DIR "/mask.png";
 
 const char* TEST_SVG_FILE_NAME                   = TEST_RESOURCE_DIR "/svg1.svg";
 const char* TEST_ANIMATED_VECTOR_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/insta_camera.json";
+const char* TEST_ANIMATED_IMAGE_FILE_NAME        = TEST_RESOURCE_DIR "/anim.gif";
 
 class TestObserver : public Dali::Toolkit::TextureUploadObserver
 {
@@ -192,6 +197,79 @@ public:
   bool                                    mKeepSignal;
 };
 
+class TestPriorityObserver : public TestObserver
+{
+public:
+  TestPriorityObserver(bool prioritized, std::vector<TestPriorityObserver*>& completedObservers)
+  : TestObserver(),
+    mPrioritized(prioritized),
+    mCompletedObservers(completedObservers)
+  {
+  }
+
+  virtual void LoadComplete(bool loadSuccess, TextureInformation textureInformation) override
+  {
+    TestObserver::LoadComplete(loadSuccess, textureInformation);
+    mCompletedObservers.push_back(this);
+  }
+
+  virtual bool IsLoadPrioritized() const override
+  {
+    return mPrioritized;
+  }
+
+  bool                                mPrioritized;
+  std::vector<TestPriorityObserver*>& mCompletedObservers;
+};
+
+void OnBlockingTaskCompleted(AsyncTaskPtr task)
+{
+}
+
+/**
+ * @brief A task which keeps a worker thread busy until it is released.
+ */
+class BlockingTask : public AsyncTask
+{
+public:
+  BlockingTask()
+  : AsyncTask(MakeCallback(&OnBlockingTaskCompleted)),
+    mReleased(false)
+  {
+  }
+
+  void Process() override
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    while(!mReleased)
+    {
+      mConditionalWait.Wait(lock);
+    }
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  std::string_view GetTaskName() const override
+  {
+    return "BlockingTask";
+  }
+
+  void Release()
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    mReleased = true;
+    mConditionalWait.Notify(lock);
+  }
+
+private:
+  ConditionalWait mConditionalWait;
+  bool            mReleased;
+};
+using BlockingTaskPtr = IntrusivePtr<BlockingTask>;
+
 } // namespace
 
 int UtcTextureManagerRequestLoad(void)
@@ -2413,3 +2491,249 @@ int UtcTextureManagerCachingForDifferentMultiplyOnLoad(void)
 
   END_TEST;
 }
+
+int UtcTextureManagerDerivedTextureFromDecodedImage(void)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_ASYNC_MANAGER_THREAD_POOL_SIZE", "1");
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE", "1");
+
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerDerivedTextureFromDecodedImage");
+  tet_infoline("Load the whole image first, then smaller textures of the same image are derived from it.");
+
+  TextureManager textureManager; // Create new texture manager
+  textureManager.SetDecodedImageCacheSize(1024u * 1024u);
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+  auto        preMultiply = TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD;
+
+  TestObserver observer1;
+  textureManager.RequestLoad(filename, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer1, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer1.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().derivedHitCount, 0u, TEST_LOCATION);
+
+  tet_infoline("Request a smaller texture. It should be derived from the decoded image.");
+  TestObserver observer2;
+  textureManager.RequestLoad(filename, ImageDimensions(32, 32), FittingMode::SCALE_TO_FILL, SamplingMode::LANCZOS, &observer2, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_CHECK(observer2.mTextureSet);
+  DALI_TEST_EQUALS(observer2.mTextureSet.GetTexture(0).GetWidth(), 32u, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mTextureSet.GetTexture(0).GetHeight(), 32u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().derivedHitCount, 1u, TEST_LOCATION);
+
+  tet_infoline("Request a texture with other aspect ratio. The center of the decoded image is cropped.");
+  TestObserver observer3;
+  textureManager.RequestLoad(filename, ImageDimensions(48, 24), FittingMode::SCALE_TO_FILL, SamplingMode::LANCZOS, &observer3, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer3.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer3.mTextureSet.GetTexture(0).GetWidth(), 48u, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer3.mTextureSet.GetTexture(0).GetHeight(), 24u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().derivedHitCount, 2u, TEST_LOCATION);
+
+  tet_infoline("Request the same smaller texture again. It is an exact hit.");
+  TestObserver observer4;
+  textureManager.RequestLoad(filename, ImageDimensions(32, 32), FittingMode::SCALE_TO_FILL, SamplingMode::LANCZOS, &observer4, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(observer4.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().exactHitCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().derivedHitCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 3u, TEST_LOCATION);
+
+  tet_infoline("Request a smaller texture with other sampling mode. It is decoded, as its filter differs from the one of the derived image.");
+  TestObserver observer9;
+  textureManager.RequestLoad(filename, ImageDimensions(24, 24), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer9, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer9.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().derivedHitCount, 2u, TEST_LOCATION);
+
+  tet_infoline("Without decoded image cache, the smaller texture is decoded again.");
+  TextureManager textureManager2;
+  textureManager2.SetDecodedImageCacheSize(0u);
+
+  TestObserver observer5;
+  TestObserver observer6;
+  textureManager2.RequestLoad(filename, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer5, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  textureManager2.RequestLoad(filename, ImageDimensions(32, 32), FittingMode::SCALE_TO_FILL, SamplingMode::LANCZOS, &observer6, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer6.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager2.GetCacheStatistics().missCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager2.GetCacheStatistics().derivedHitCount, 0u, TEST_LOCATION);
+
+  tet_infoline("The decoded image larger than a quarter of the cache is not kept, so the smaller texture is decoded again.");
+  TextureManager textureManager3;
+  textureManager3.SetDecodedImageCacheSize(128u * 1024u);
+
+  TestObserver observer7;
+  TestObserver observer8;
+  textureManager3.RequestLoad(filename, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer7, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  textureManager3.RequestLoad(filename, ImageDimensions(32, 32), FittingMode::SCALE_TO_FILL, SamplingMode::LANCZOS, &observer8, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer8.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager3.GetCacheStatistics().missCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager3.GetCacheStatistics().derivedHitCount, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerDerivedImageEqualsDecodedImage(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerDerivedImageEqualsDecodedImage");
+  tet_infoline("The image derived from the decoded image has the same pixels as the image decoded directly.");
+
+  VisualUrl          url(TEST_IMAGE_FILE_NAME);
+  Devel::PixelBuffer decodedImage = Dali::LoadImageFromFile(TEST_IMAGE_FILE_NAME);
+  DALI_TEST_CHECK(decodedImage);
+
+  const ImageDimensions   sizes[]        = {ImageDimensions(32, 32), ImageDimensions(48, 24)};
+  const FittingMode::Type fittingModes[] = {FittingMode::SHRINK_TO_FIT, FittingMode::SCALE_TO_FILL};
+  for(const auto& size : sizes)
+  {
+    for(const auto fittingMode : fittingModes)
+    {
+      tet_printf("Size:%ux%u FittingMode:%d\n", size.GetWidth(), size.GetHeight(), static_cast<int>(fittingMode));
+
+      LoadingTaskPtr derivedTask = new LoadingTask(1u, url, size, fittingMode, SamplingMode::LANCZOS, true, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, false, nullptr);
+      derivedTask->SetDecodedImage(decodedImage);
+      derivedTask->Process();
+
+      LoadingTaskPtr decodedTask = new LoadingTask(2u, url, size, fittingMode, SamplingMode::LANCZOS, true, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, false, nullptr);
+      decodedTask->Process();
+
+      DALI_TEST_EQUALS(static_cast<bool>(derivedTask->isDerived), true, TEST_LOCATION);
+      DALI_TEST_EQUALS(derivedTask->pixelBuffers.size(), 1u, TEST_LOCATION);
+      DALI_TEST_EQUALS(decodedTask->pixelBuffers.size(), 1u, TEST_LOCATION);
+
+      Devel::PixelBuffer derivedImage = derivedTask->pixelBuffers[0];
+      Devel::PixelBuffer directImage  = decodedTask->pixelBuffers[0];
+      DALI_TEST_EQUALS(derivedImage.GetWidth(), directImage.GetWidth(), TEST_LOCATION);
+      DALI_TEST_EQUALS(derivedImage.GetHeight(), directImage.GetHeight(), TEST_LOCATION);
+      DALI_TEST_EQUALS(derivedImage.GetPixelFormat(), directImage.GetPixelFormat(), TEST_LOCATION);
+
+      const uint32_t byteSize = directImage.GetWidth() * directImage.GetHeight() * Pixel::GetBytesPerPixel(directImage.GetPixelFormat());
+      DALI_TEST_EQUALS(memcmp(derivedImage.GetBuffer(), directImage.GetBuffer(), byteSize), 0, TEST_LOCATION);
+    }
+  }
+
+  tet_infoline("The image with other sampling mode is decoded, not derived.");
+  LoadingTaskPtr task = new LoadingTask(3u, url, ImageDimensions(32, 32), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, false, nullptr);
+  task->SetDecodedImage(decodedImage);
+  task->Process();
+  DALI_TEST_EQUALS(static_cast<bool>(task->isDerived), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(task->pixelBuffers.size(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerLoadPriorityAndCancel(void)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_ASYNC_MANAGER_THREAD_POOL_SIZE", "1");
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE", "1");
+
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerLoadPriorityAndCancel");
+  tet_infoline("The loads which have not started are queued again when their priority changes, and cancelled when their texture is removed.");
+
+  TextureManager textureManager; // Create new texture manager
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+  auto        preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  // Keep the only worker thread busy, so the loads wait in the queue.
+  BlockingTaskPtr blockingTask = new BlockingTask();
+  AsyncTaskManager::Get().AddTask(blockingTask);
+
+  std::vector<TestPriorityObserver*> completedObservers;
+  TestPriorityObserver               observer1(false, completedObservers);
+  TestPriorityObserver               observer2(true, completedObservers);
+  TestPriorityObserver               observer3(true, completedObservers);
+
+  auto textureId1 = textureManager.RequestLoad(filename, ImageDimensions(32, 32), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer1, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  textureManager.RequestLoad(filename, ImageDimensions(48, 48), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer2, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  auto textureId3 = textureManager.RequestLoad(filename, ImageDimensions(64, 64), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, &observer3, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+
+  tet_infoline("The first observer is prioritized now, e.g. it goes on the scene. Its load is queued again, after the second one.");
+  observer1.mPrioritized = true;
+  textureManager.UpdateLoadPriority(textureId1);
+
+  tet_infoline("The third texture is removed before its load starts.");
+  textureManager.RequestRemove(textureId3, &observer3);
+
+  application.SendNotification();
+  application.Render();
+
+  // The blocking task, and the first and second loads.
+  blockingTask->Release();
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(3), true, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(completedObservers.size(), 2u, TEST_LOCATION);
+  DALI_TEST_CHECK(completedObservers[0] == &observer2);
+  DALI_TEST_CHECK(completedObservers[1] == &observer1);
+  DALI_TEST_EQUALS(observer1.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mLoaded, true, TEST_LOCATION);
+
+  tet_infoline("The cancelled load is never completed.");
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 1), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer3.mObserverCalled, false, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerAnimatedImageFrameCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerAnimatedImageFrameCache");
+  tet_infoline("The frames of an animated image are kept after they are removed, and used again without decoding.");
+
+  TextureManager textureManager; // Create new texture manager
+  textureManager.SetAnimatedImageFrameCacheSize(16u * 1024u * 1024u);
+
+  VisualUrl                          url(TEST_ANIMATED_IMAGE_FILE_NAME);
+  Dali::AnimatedImageLoading         animatedImageLoading = Dali::AnimatedImageLoading::New(url.GetUrl(), true);
+  TextureManager::MaskingDataPointer maskInfo             = nullptr;
+  TextureManager::TextureId          textureId1           = TextureManager::INVALID_TEXTURE_ID;
+  auto                               preMultiply          = TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD;
+
+  TestObserver observer1;
+  textureManager.LoadAnimatedImageTexture(url, animatedImageLoading, 0u, textureId1, maskInfo, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, false, &observer1, preMultiply);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer1.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION);
+
+  tet_infoline("Remove the frame. It is kept in the cache.");
+  textureManager.RequestRemove(textureId1, &observer1);
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("Request the frame again, e.g. from another visual or in the next loop. It is an exact hit.");
+  TestObserver              observer2;
+  TextureManager::TextureId textureId2 = TextureManager::INVALID_TEXTURE_ID;
+  textureManager.LoadAnimatedImageTexture(url, animatedImageLoading, 0u, textureId2, maskInfo, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, false, &observer2, preMultiply);
+  DALI_TEST_EQUALS(observer2.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureId2, textureId1, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().exactHitCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION);
+
+  tet_infoline("Without the animated image frame cache, the frame is decoded again.");
+  textureManager.SetAnimatedImageFrameCacheSize(0u);
+  textureManager.RequestRemove(textureId2, &observer2);
+  application.SendNotification();
+  application.Render();
+
+  TestObserver              observer3;
+  TextureManager::TextureId textureId3 = TextureManager::INVALID_TEXTURE_ID;
+  textureManager.LoadAnimatedImageTexture(url, animatedImageLoading, 0u, textureId3, maskInfo, ImageDimensions(), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, false, &observer3, preMultiply);
+  DALI_TEST_EQUALS(observer3.mLoaded, false, TEST_LOCATION);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer3.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 2u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -312,6 +312,94 @@ int UtcDaliStyleManagerApplyTheme(void)
 }
 
 
+int UtcDaliStyleManagerResolvedStyleCache(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline( "Testing that the controls of a type share the resolved theme style until the theme changes" );
+
+  const char* json1 =
+    "{\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"testbutton\":\n"
+    "    {\n"
+    "      \"backgroundColor\":[1.0,1.0,0.0,1.0],\n"
+    "      \"foregroundColor\":[0.0,0.0,1.0,1.0]\n"
+    "    },\n"
+    "    \"otherButton\":\n"
+    "    {\n"
+    "      \"backgroundColor\":[0.0,1.0,0.0,1.0]\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  const char* json2 =
+    "{\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"testbutton\":\n"
+    "    {\n"
+    "      \"backgroundColor\":[1.0,0.0,0.0,1.0],\n"
+    "      \"foregroundColor\":[0.0,1.0,1.0,1.0]\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  std::string themeFile("ThemeOne");
+  Test::StyleMonitor::SetThemeFileOutput(themeFile, json1);
+  StyleManager styleManager = StyleManager::Get();
+  styleManager.ApplyTheme(themeFile);
+
+  tet_infoline("Create many buttons, which are styled at initialization");
+  std::vector<Test::TestButton> buttons;
+  for(int i = 0; i < 100; ++i)
+  {
+    buttons.push_back(Test::TestButton::New());
+    application.GetScene().Add(buttons.back());
+  }
+
+  for(auto& button : buttons)
+  {
+    DALI_TEST_EQUALS( button.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR), Property::Value(Color::YELLOW), 0.001, TEST_LOCATION );
+    DALI_TEST_EQUALS( button.GetProperty(Test::TestButton::Property::FOREGROUND_COLOR), Property::Value(Color::BLUE), 0.001, TEST_LOCATION );
+  }
+
+  tet_infoline("Check that the buttons share the recorded style");
+  const StylePtr style1 = GetImpl(styleManager).GetRecordedStyle(buttons.front());
+  DALI_TEST_CHECK( style1 );
+  DALI_TEST_CHECK( style1 == GetImpl(styleManager).GetRecordedStyle(buttons.back()) );
+
+  tet_infoline("Check that a style name is resolved separately from the type name, ignoring the case");
+  Test::TestButton otherButton = Test::TestButton::New();
+  otherButton.SetStyleName("OtherButton");
+  application.GetScene().Add(otherButton);
+  DALI_TEST_EQUALS( otherButton.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR), Property::Value(Color::GREEN), 0.001, TEST_LOCATION );
+  DALI_TEST_CHECK( style1 != GetImpl(styleManager).GetRecordedStyle(otherButton) );
+
+  tet_infoline("Apply another theme, and check that the resolved style is dropped");
+  std::string themeFile2("ThemeTwo");
+  Test::StyleMonitor::SetThemeFileOutput(themeFile2, json2);
+  styleManager.ApplyTheme(themeFile2);
+
+  for(auto& button : buttons)
+  {
+    DALI_TEST_EQUALS( button.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR), Property::Value(Color::RED), 0.001, TEST_LOCATION );
+    DALI_TEST_EQUALS( button.GetProperty(Test::TestButton::Property::FOREGROUND_COLOR), Property::Value(Color::CYAN), 0.001, TEST_LOCATION );
+  }
+
+  Test::TestButton newButton = Test::TestButton::New();
+  DALI_TEST_EQUALS( newButton.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR), Property::Value(Color::RED), 0.001, TEST_LOCATION );
+
+  const StylePtr style2 = GetImpl(styleManager).GetRecordedStyle(newButton);
+  DALI_TEST_CHECK( style2 );
+  DALI_TEST_CHECK( style1 != style2 );
+  DALI_TEST_CHECK( !GetImpl(styleManager).GetRecordedStyle(otherButton) );
+
+  END_TEST;
+}
+
+
 int UtcDaliStyleManagerApplyDefaultTheme(void)
 {
   tet_infoline( "Testing StyleManager ApplyTheme" );
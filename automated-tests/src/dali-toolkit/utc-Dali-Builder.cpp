@@ -1033,6 +1033,61 @@ int UtcDaliBuilderCustomPropertyP(void)
   END_TEST;
 }
 
+int UtcDaliBuilderTemplateInstancesP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that each instance of a template gets its properties and custom properties");
+
+  std::string json(
+    "{\n"
+    "\"templates\":\n"
+    "{\n"
+    "  \"labelTree\": { \n"
+    "    \"type\": \"Control\",\n"
+    "    \"name\": \"label\",\n"
+    "    \"opacity\": 0.5,\n"
+    "    \"size\": [100,100,1],\n"
+    "    \"overriddenproperty\": 2,\n"
+    "    \"properties\": {\n"
+    "      \"newproperty\": true,\n"
+    "      \"overriddenproperty\": 1\n"
+    "    },\n"
+    "    \"animatableProperties\": {\n"
+    "      \"newAnimatableproperty\": 3\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+    "}\n");
+
+  Builder builder = Builder::New();
+  builder.LoadFromString(json);
+
+  for(int i = 0; i < 3; ++i)
+  {
+    Control control = Control::DownCast(builder.Create("labelTree"));
+    DALI_TEST_CHECK(control);
+
+    DALI_TEST_EQUALS(control.GetProperty<std::string>(Actor::Property::NAME), std::string("label"), TEST_LOCATION);
+    DALI_TEST_EQUALS(control.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+    DALI_TEST_EQUALS(control.GetProperty<Vector3>(Actor::Property::SIZE), Vector3(100.0f, 100.0f, 1.0f), TEST_LOCATION);
+
+    Property::Index index = control.GetPropertyIndex("newproperty");
+    DALI_TEST_CHECK(Property::INVALID_INDEX != index);
+    DALI_TEST_EQUALS(control.GetProperty<bool>(index), true, TEST_LOCATION);
+
+    index = control.GetPropertyIndex("newAnimatableproperty");
+    DALI_TEST_CHECK(Property::INVALID_INDEX != index);
+    DALI_TEST_EQUALS(control.GetProperty<int>(index), 3, TEST_LOCATION);
+
+    // The custom properties are registered before the keys of the node are set, so the key sets the custom property
+    index = control.GetPropertyIndex("overriddenproperty");
+    DALI_TEST_CHECK(Property::INVALID_INDEX != index);
+    DALI_TEST_EQUALS(control.GetProperty<int>(index), 2, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
 int UtcDaliBuilderCustomShaderP(void)
 {
   ToolkitTestApplication application;
@@ -1759,6 +1814,155 @@ int UtcDaliBuilderConfigurationP(void)
   END_TEST;
 }
 
+int UtcDaliBuilderLazyParsingP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the styles, templates and animations are found with lazy parsing");
+
+  std::string json(
+    "{\n"
+    "  // The constants are parsed when loaded\n"
+    "  \"constants\": { \"SIZE\": [10, 20, 30] },\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"baseStyle\": { \"color\": [1, 0, 0, 1], \"opacity\": 0.5 },\n"
+    "    \"derivedStyle\": { \"inherit\": [\"BASESTYLE\"], \"size\": \"{SIZE}\" },\n"
+    "    \"unusedStyle\": { \"name\": \"unused\" }\n"
+    "  },\n"
+    "  \"templates\":\n"
+    "  {\n"
+    "    \"childTemplate\": { \"type\": \"ImageView\", \"name\": \"child\" },\n"
+    "    \"parentTemplate\": { \"type\": \"ImageView\", \"name\": \"parent\", \"styles\": [\"derivedStyle\"], \"actors\": [ { \"type\": \"childTemplate\" } ] }\n"
+    "  },\n"
+    "  \"animations\":\n"
+    "  {\n"
+    "    \"animate\": { \"duration\": 2.0, \"properties\": [ { \"actor\": \"parent\", \"property\": \"positionX\", \"value\": 100.0, \"timePeriod\": { \"delay\": 0, \"duration\": 1 } } ] }\n"
+    "  }\n"
+    "}\n");
+
+  Builder builder = Builder::New();
+  builder.SetLazyParsing(true);
+  builder.LoadFromString(json);
+
+  Property::Map map = builder.GetConstants();
+  DALI_TEST_CHECK(map.Find("SIZE"));
+
+  Actor actor = Actor::DownCast(builder.Create("parentTemplate"));
+  DALI_TEST_CHECK(actor);
+  DALI_TEST_EQUALS(actor.GetProperty<std::string>(Actor::Property::NAME), "parent", TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetChildCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetChildAt(0).GetProperty<std::string>(Actor::Property::NAME), "child", TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetProperty<Vector3>(Actor::Property::SIZE), Vector3(10.0f, 20.0f, 30.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetProperty<Vector4>(Actor::Property::COLOR), Color::RED, TEST_LOCATION);
+
+  Actor styled = Actor::New();
+  DALI_TEST_CHECK(builder.ApplyStyle("DerivedStyle", styled));
+  DALI_TEST_EQUALS(styled.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+  DALI_TEST_CHECK(!builder.ApplyStyle("missingStyle", styled));
+
+  application.GetScene().Add(actor);
+  Animation animation = builder.CreateAnimation("animate");
+  DALI_TEST_CHECK(animation);
+  DALI_TEST_EQUALS(animation.GetDuration(), 2.0f, TEST_LOCATION);
+  DALI_TEST_CHECK(!builder.CreateAnimation("missingAnimation"));
+
+  END_TEST;
+}
+
+int UtcDaliBuilderLazyParsingMergeP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the documents loaded with lazy parsing are merged in the order they were loaded");
+
+  std::string json1(
+    "{\n"
+    "  \"styles\": { \"style\": { \"opacity\": 0.25, \"color\": [0, 1, 0, 1] } }\n"
+    "}\n");
+
+  std::string json2(
+    "{\n"
+    "  \"styles\": { \"style\": { \"opacity\": 0.75 } }\n"
+    "}\n");
+
+  // An escaped name cannot be indexed, so this is parsed whole
+  std::string json3(
+    "{\n"
+    "  \"styles\": { \"escaped\\u0053tyle\": { \"opacity\": 0.5 }, \"style\": { \"color\": [0, 0, 1, 1] } }\n"
+    "}\n");
+
+  Builder builder = Builder::New();
+  builder.SetLazyParsing(true);
+  builder.LoadFromString(json1);
+  builder.LoadFromString(json2);
+
+  Actor actor = Actor::New();
+  DALI_TEST_CHECK(builder.ApplyStyle("style", actor));
+  DALI_TEST_EQUALS(actor.GetProperty<float>(Actor::Property::OPACITY), 0.75f, TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetProperty<Vector4>(Actor::Property::COLOR), Color::GREEN, TEST_LOCATION);
+
+  Builder builder2 = Builder::New();
+  builder2.SetLazyParsing(true);
+  builder2.LoadFromString(json1);
+  builder2.LoadFromString(json3);
+  builder2.LoadFromString(json2);
+
+  actor = Actor::New();
+  DALI_TEST_CHECK(builder2.ApplyStyle("escapedStyle", actor));
+  DALI_TEST_EQUALS(actor.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+  DALI_TEST_CHECK(builder2.ApplyStyle("style", actor));
+  DALI_TEST_EQUALS(actor.GetProperty<float>(Actor::Property::OPACITY), 0.75f, TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetProperty<Vector4>(Actor::Property::COLOR), Color::BLUE, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliBuilderLazyParsingN(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that a JSON which cannot be indexed raises an exception on loading with lazy parsing");
+
+  std::string json(
+    "{\n"
+    "  \"styles\": { \"style\": { \"opacity\": 0.5 }\n"
+    "}\n");
+
+  Builder builder = Builder::New();
+  builder.SetLazyParsing(true);
+
+  bool assert1 = false;
+
+  try
+  {
+    builder.LoadFromString(json);
+  }
+  catch(Dali::DaliException& e)
+  {
+    DALI_TEST_PRINT_ASSERT(e);
+    DALI_TEST_EQUALS(e.condition, "!\"Cannot parse JSON\"", TEST_LOCATION);
+    assert1 = true;
+  }
+
+  DALI_TEST_CHECK(assert1);
+
+  tet_infoline("Test that a member which does not parse is not found");
+
+  std::string badMember(
+    "{\n"
+    "  \"styles\": { \"badStyle\": { \"opacity\": 0.5.5 }, \"goodStyle\": { \"opacity\": 0.5 } }\n"
+    "}\n");
+
+  Builder builder2 = Builder::New();
+  builder2.SetLazyParsing(true);
+  builder2.LoadFromString(badMember);
+
+  Actor actor = Actor::New();
+  DALI_TEST_CHECK(!builder2.ApplyStyle("badStyle", actor));
+  DALI_TEST_CHECK(builder2.ApplyStyle("goodStyle", actor));
+  DALI_TEST_EQUALS(actor.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliBase64EncodingP(void)
 {
   std::vector<uint32_t> data = {0, 1, 2, 3, 4, 5, std::numeric_limits<uint32_t>::min(), std::numeric_limits<uint32_t>::max()};
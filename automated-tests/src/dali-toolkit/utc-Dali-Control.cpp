@@ -1491,4 +1491,46 @@ int UtcDaliControlDoActionMultipleWhenNotStage03(void)
   }
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliControlSetProperties(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that DevelControl::SetProperties sets the properties of the map, registering unknown keys");
+
+  Control control = Control::New();
+
+  Property::Map properties;
+  properties["name"]                        = "bulk";
+  properties[Actor::Property::OPACITY]      = 0.5f;
+  properties["notAProperty"]                = 1.0f;
+  properties[Control::Property::STYLE_NAME] = "bulkStyle";
+
+  DevelControl::SetProperties(control, properties);
+
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(Actor::Property::NAME), std::string("bulk"), TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<std::string>(Control::Property::STYLE_NAME), std::string("bulkStyle"), TEST_LOCATION);
+
+  Property::Index customIndex = control.GetPropertyIndex("notAProperty");
+  DALI_TEST_CHECK(customIndex != Property::INVALID_INDEX);
+  DALI_TEST_EQUALS(control.GetProperty<float>(customIndex), 1.0f, TEST_LOCATION);
+
+  // A second control of the same type uses the indices resolved for the first
+  Control other = Control::New();
+  properties["notAProperty"] = 2.0f;
+  DevelControl::SetProperties(other, properties);
+
+  DALI_TEST_EQUALS(other.GetProperty<std::string>(Actor::Property::NAME), std::string("bulk"), TEST_LOCATION);
+  DALI_TEST_EQUALS(other.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+  DALI_TEST_EQUALS(other.GetProperty<float>(other.GetPropertyIndex("notAProperty")), 2.0f, TEST_LOCATION);
+
+  // Setting the map again sets the custom property instead of registering another
+  properties["notAProperty"] = 3.0f;
+  DevelControl::SetProperties(control, properties);
+
+  DALI_TEST_EQUALS(control.GetPropertyIndex("notAProperty"), customIndex, TEST_LOCATION);
+  DALI_TEST_EQUALS(control.GetProperty<float>(customIndex), 3.0f, TEST_LOCATION);
+
+  END_TEST;
+}
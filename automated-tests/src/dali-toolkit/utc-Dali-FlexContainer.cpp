@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -590,3 +590,55 @@ int UtcDaliToolkitFlexContainerRTLSupportP(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitFlexContainerWrapGridRelayoutP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitFlexContainerWrapGridRelayoutP - 500 item wrapping grid");
+
+  const uint32_t ITEM_COUNT    = 500u;
+  const float    ITEM_SIZE     = 10.0f;
+  const float    ROOT_WIDTH    = 480.0f;
+  const uint32_t ITEMS_PER_ROW = static_cast<uint32_t>(ROOT_WIDTH / ITEM_SIZE);
+
+  FlexContainer flexContainer = FlexContainer::New();
+  flexContainer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  flexContainer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  flexContainer.SetProperty(Actor::Property::SIZE, Vector2(ROOT_WIDTH, 800.0f));
+  flexContainer.SetProperty(FlexContainer::Property::FLEX_DIRECTION, FlexContainer::ROW);
+  flexContainer.SetProperty(FlexContainer::Property::FLEX_WRAP, FlexContainer::WRAP);
+  application.GetScene().Add(flexContainer);
+
+  std::vector<Actor> items;
+  for(uint32_t i = 0u; i < ITEM_COUNT; ++i)
+  {
+    Actor item = Actor::New();
+    item.SetProperty(Actor::Property::SIZE, Vector2(ITEM_SIZE, ITEM_SIZE));
+    flexContainer.Add(item);
+    items.push_back(item);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  Actor lastItem = items.back();
+  DALI_TEST_EQUALS(lastItem.GetProperty<float>(Actor::Property::POSITION_X), ITEM_SIZE * ((ITEM_COUNT - 1) % ITEMS_PER_ROW), TEST_LOCATION);
+  DALI_TEST_EQUALS(lastItem.GetProperty<float>(Actor::Property::POSITION_Y), ITEM_SIZE * ((ITEM_COUNT - 1) / ITEMS_PER_ROW), TEST_LOCATION);
+
+  // Another frame without any change keeps the layout
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(lastItem.GetProperty<float>(Actor::Property::POSITION_X), ITEM_SIZE * ((ITEM_COUNT - 1) % ITEMS_PER_ROW), TEST_LOCATION);
+  DALI_TEST_EQUALS(lastItem.GetProperty<float>(Actor::Property::POSITION_Y), ITEM_SIZE * ((ITEM_COUNT - 1) / ITEMS_PER_ROW), TEST_LOCATION);
+
+  // Widen the first item, the rest of the grid is moved by one item
+  items.front().SetProperty(Actor::Property::SIZE, Vector2(ITEM_SIZE * 2.0f, ITEM_SIZE));
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(lastItem.GetProperty<float>(Actor::Property::POSITION_X), ITEM_SIZE * (ITEM_COUNT % ITEMS_PER_ROW), TEST_LOCATION);
+  DALI_TEST_EQUALS(lastItem.GetProperty<float>(Actor::Property::POSITION_Y), ITEM_SIZE * (ITEM_COUNT / ITEMS_PER_ROW), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
  */
 
 #include <stdlib.h>
+#include <chrono>
 #include <iostream>
 
 #include <dali-toolkit-test-suite-utils.h>
@@ -52,6 +53,18 @@ void MeasureChild(Actor child, float width, int measureModeWidth, float height,
   tet_printf(" MeasureChild test callback executed (%f,%f)\n", childSize->width, childSize->height);
 }
 
+uint32_t gMeasureCallCount = 0u;
+
+void CountingMeasureChild(Actor child, float width, int measureModeWidth, float height, int measureModeHeight, Flex::SizeTuple* childSize)
+{
+  ++gMeasureCallCount;
+  *childSize = ITEM_SIZE;
+  if(child.GetProperty<std::string>(Dali::Actor::Property::NAME) == "callbackTest")
+  {
+    *childSize = ITEM_SIZE_CALLBACK_TEST;
+  }
+}
+
 } // namespace
 
 int UtcDaliToolkitFlexNodeConstructorP(void)
@@ -831,3 +844,113 @@ int UtcDaliToolkitFlexNodeFlexBasisShrinkGrow(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitFlexNodeMarkDirtyP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliToolkitFlexNodeMarkDirtyP");
+  Flex::Node* flexNode = new Flex::Node();
+  DALI_TEST_CHECK(flexNode);
+
+  flexNode->SetFlexDirection(Flex::FlexDirection::COLUMN);
+
+  Actor actor1 = Actor::New();
+  Actor actor2 = Actor::New();
+
+  Flex::Node* childNode1 = flexNode->AddChild(actor1, Extents(0, 0, 0, 0), &CountingMeasureChild, 0);
+  flexNode->AddChild(actor2, Extents(0, 0, 0, 0), &CountingMeasureChild, 1);
+  DALI_TEST_CHECK(childNode1);
+  DALI_TEST_CHECK(flexNode->IsDirty());
+
+  gMeasureCallCount = 0u;
+  flexNode->CalculateLayout(480, 800, false);
+  DALI_TEST_CHECK(gMeasureCallCount >= 2u);
+  DALI_TEST_CHECK(!flexNode->IsDirty());
+
+  tet_infoline(" Same constraints again, nothing is measured");
+  gMeasureCallCount = 0u;
+  flexNode->CalculateLayout(480, 800, false);
+  DALI_TEST_EQUALS(gMeasureCallCount, 0u, TEST_LOCATION);
+
+  tet_infoline(" Change the natural size of the first child and mark it dirty");
+  actor1.SetProperty(Dali::Actor::Property::NAME, "callbackTest");
+  childNode1->MarkDirty();
+  DALI_TEST_CHECK(flexNode->IsDirty());
+
+  gMeasureCallCount = 0u;
+  flexNode->CalculateLayout(480, 800, false);
+  DALI_TEST_CHECK(gMeasureCallCount >= 1u);
+
+  Vector4 actor1Frame = flexNode->GetNodeFrame(0);
+  Vector4 actor2Frame = flexNode->GetNodeFrame(1);
+  DALI_TEST_EQUALS(actor1Frame, Vector4(0.0f, 0.0f, ITEM_SIZE_CALLBACK_TEST.width, ITEM_SIZE_CALLBACK_TEST.height), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor2Frame, Vector4(0.0f, ITEM_SIZE_CALLBACK_TEST.height, ITEM_SIZE.width, ITEM_SIZE_CALLBACK_TEST.height + ITEM_SIZE.height), TEST_LOCATION);
+  DALI_TEST_CHECK(!flexNode->IsDirty());
+
+  tet_infoline(" The style setters mark the node dirty");
+  flexNode->SetFlexDirection(Flex::FlexDirection::ROW);
+  DALI_TEST_CHECK(flexNode->IsDirty());
+  flexNode->CalculateLayout(480, 800, false);
+  DALI_TEST_CHECK(!flexNode->IsDirty());
+
+  childNode1->SetFlexGrow(1.0f);
+  DALI_TEST_CHECK(flexNode->IsDirty());
+  flexNode->CalculateLayout(480, 800, false);
+  DALI_TEST_CHECK(!flexNode->IsDirty());
+
+  tet_infoline(" Removing a child marks the node dirty");
+  flexNode->RemoveChild(actor2);
+  DALI_TEST_CHECK(flexNode->IsDirty());
+
+  delete flexNode;
+
+  END_TEST;
+}
+
+int UtcDaliToolkitFlexNodeWrapGridPerformanceP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliToolkitFlexNodeWrapGridPerformanceP - 500 item wrapping grid");
+
+  const uint32_t ITEM_COUNT = 500u;
+  const float    ROOT_WIDTH = 480.0f;
+  const uint32_t ITEMS_PER_ROW = static_cast<uint32_t>(ROOT_WIDTH / ITEM_SIZE.width);
+
+  Flex::Node* flexNode = new Flex::Node();
+  flexNode->SetFlexDirection(Flex::FlexDirection::ROW);
+  flexNode->SetFlexWrap(Flex::WrapType::WRAP);
+
+  std::vector<Actor>       actors;
+  std::vector<Flex::Node*> childNodes;
+  for(uint32_t i = 0u; i < ITEM_COUNT; ++i)
+  {
+    actors.push_back(Actor::New());
+    childNodes.push_back(flexNode->AddChild(actors.back(), Extents(0, 0, 0, 0), &CountingMeasureChild, i));
+  }
+
+  auto measure = [&](const char* step) {
+    gMeasureCallCount = 0u;
+    auto start        = std::chrono::steady_clock::now();
+    flexNode->CalculateLayout(ROOT_WIDTH, 800, false);
+    auto end = std::chrono::steady_clock::now();
+    tet_printf(" %s : %u measure callbacks, %lld us\n", step, gMeasureCallCount, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+    return gMeasureCallCount;
+  };
+
+  DALI_TEST_CHECK(measure("initial layout") >= ITEM_COUNT);
+  DALI_TEST_EQUALS(measure("unchanged relayout"), 0u, TEST_LOCATION);
+
+  // Only the dirty item is measured again
+  childNodes[ITEM_COUNT / 2]->MarkDirty();
+  uint32_t dirtyCount = measure("one dirty item");
+  DALI_TEST_CHECK(dirtyCount >= 1u);
+  DALI_TEST_CHECK(dirtyCount < ITEM_COUNT);
+
+  Vector4 lastFrame = flexNode->GetNodeFrame(ITEM_COUNT - 1);
+  DALI_TEST_EQUALS(lastFrame.x, ITEM_SIZE.width * ((ITEM_COUNT - 1) % ITEMS_PER_ROW), TEST_LOCATION);
+  DALI_TEST_EQUALS(lastFrame.y, ITEM_SIZE.height * ((ITEM_COUNT - 1) / ITEMS_PER_ROW), TEST_LOCATION);
+
+  delete flexNode;
+
+  END_TEST;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -352,3 +352,78 @@ int UtcDaliGaussianBlurViewFinishedSignalN(void)
 
   END_TEST;
 }
+
+int UtcDaliGaussianBlurViewDualKawase(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliGaussianBlurViewDualKawase");
+
+  Toolkit::GaussianBlurView view = Toolkit::GaussianBlurView::New(33, 1.5f, Pixel::RGBA8888, 0.5f, 0.5f);
+  DALI_TEST_CHECK(view);
+  DALI_TEST_EQUALS(view.GetBlurAlgorithm(), BlurAlgorithm::GAUSSIAN, TEST_LOCATION);
+
+  view.SetBlurAlgorithm(BlurAlgorithm::DUAL_KAWASE);
+  DALI_TEST_EQUALS(view.GetBlurAlgorithm(), BlurAlgorithm::DUAL_KAWASE, TEST_LOCATION);
+
+  view.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  view.SetProperty(Actor::Property::SIZE, application.GetScene().GetSize());
+  view.Add(Actor::New());
+  application.GetScene().Add(view);
+  view.Activate();
+
+  tet_infoline("The radius of 33 pixels is blurred by 4 downsampling and 4 upsampling passes, between the children and the compositing tasks.");
+  RenderTaskList taskList = application.GetScene().GetRenderTaskList();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 11u, TEST_LOCATION);
+  DALI_TEST_CHECK(taskList.GetTask(9u).GetFrameBuffer() != view.GetBlurredRenderTarget());
+  DALI_TEST_CHECK(taskList.GetTask(10u).GetFrameBuffer() == view.GetBlurredRenderTarget());
+
+  application.SendNotification();
+  application.Render(20);
+
+  tet_infoline("Changing the algorithm recreates the render tasks.");
+  view.SetBlurAlgorithm(BlurAlgorithm::GAUSSIAN);
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 5u, TEST_LOCATION);
+
+  view.Deactivate();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(view.GetChildCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurViewDualKawaseUserImage(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliGaussianBlurViewDualKawaseUserImage");
+
+  Toolkit::GaussianBlurView view = Toolkit::GaussianBlurView::New(5, 1.5f, Pixel::RGB888, 0.5f, 0.5f, true);
+  view.SetBlurAlgorithm(BlurAlgorithm::DUAL_KAWASE);
+  view.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  view.SetProperty(Actor::Property::SIZE, application.GetScene().GetSize());
+  application.GetScene().Add(view);
+
+  Texture     texture      = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 480u, 800u);
+  FrameBuffer renderTarget = FrameBuffer::New(240, 400, FrameBuffer::Attachment::NONE);
+  view.SetUserImageAndOutputRenderTarget(texture, renderTarget);
+  view.ActivateOnce();
+
+  tet_infoline("A downsampling and an upsampling pass into the user render target.");
+  RenderTaskList taskList = application.GetScene().GetRenderTaskList();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 3u, TEST_LOCATION);
+  DALI_TEST_CHECK(taskList.GetTask(2u).GetFrameBuffer() == renderTarget);
+  DALI_TEST_EQUALS(taskList.GetTask(2u).GetRefreshRate(), static_cast<uint32_t>(RenderTask::REFRESH_ONCE), TEST_LOCATION);
+
+  tet_infoline("Setting another render target while activated blurs into it.");
+  FrameBuffer otherRenderTarget = FrameBuffer::New(240, 400, FrameBuffer::Attachment::NONE);
+  view.SetUserImageAndOutputRenderTarget(texture, otherRenderTarget);
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 3u, TEST_LOCATION);
+  DALI_TEST_CHECK(taskList.GetTask(2u).GetFrameBuffer() == otherRenderTarget);
+
+  application.SendNotification();
+  application.Render();
+
+  view.Deactivate();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
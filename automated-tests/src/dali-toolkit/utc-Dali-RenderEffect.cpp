@@ -16,6 +16,7 @@
  */
 
 #include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/public-api/controls/render-effects/background-blur-effect.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -305,3 +306,328 @@ int UtcDaliRenderEffectInvalidTargetSize(void)
 
   END_TEST;
 }
+
+int UtcDaliRenderEffectSharedBackgroundBlur(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectSharedBackgroundBlur");
+  tet_infoline("The background is rendered once for all the background blur effects, and blurred once for each distinct parameters.");
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+
+  Control controls[3];
+  for(auto&& control : controls)
+  {
+    control = Control::New();
+    control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    control.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+    scene.Add(control);
+  }
+
+  controls[0].SetRenderEffect(BackgroundBlurEffect::New());
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  controls[1].SetRenderEffect(BackgroundBlurEffect::New());
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+  DALI_TEST_CHECK(controls[0].GetRendererAt(0).GetTextures().GetTexture(0) == controls[1].GetRendererAt(0).GetTextures().GetTexture(0));
+
+  controls[2].SetRenderEffect(BackgroundBlurEffect::New(0.4f, 40));
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 6u, TEST_LOCATION);
+  DALI_TEST_CHECK(controls[0].GetRendererAt(0).GetTextures().GetTexture(0) != controls[2].GetRendererAt(0).GetTextures().GetTexture(0));
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("Each effect samples the area of its control.");
+  Renderer        renderer         = controls[0].GetRendererAt(0);
+  Property::Index textureRectIndex = renderer.GetPropertyIndex(std::string("uTextureRect"));
+  Vector2         sceneSize        = scene.GetSize();
+  Vector4         expectedRect(0.5f - 50.0f / sceneSize.width, 0.5f - 50.0f / sceneSize.height, 100.0f / sceneSize.width, 100.0f / sceneSize.height);
+  DALI_TEST_EQUALS(renderer.GetCurrentProperty<Vector4>(textureRectIndex), expectedRect, 0.001f, TEST_LOCATION);
+
+  controls[2].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  controls[0].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  controls[1].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRenderEffectDualKawaseBackgroundBlur(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectDualKawaseBackgroundBlur");
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+
+  Control controls[2];
+  for(auto&& control : controls)
+  {
+    control = Control::New();
+    control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    control.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+    scene.Add(control);
+  }
+
+  tet_infoline("The capture of the window, then 5 downsampling and 5 upsampling passes.");
+  controls[0].SetRenderEffect(DevelBackgroundBlurEffect::New(0.4f, 40, BlurAlgorithm::DUAL_KAWASE));
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 12u, TEST_LOCATION);
+
+  tet_infoline("The gaussian blur with the same parameters is not shared.");
+  controls[1].SetRenderEffect(DevelBackgroundBlurEffect::New(0.4f, 40, BlurAlgorithm::GAUSSIAN));
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 14u, TEST_LOCATION);
+  DALI_TEST_CHECK(controls[0].GetRendererAt(0).GetTextures().GetTexture(0) != controls[1].GetRendererAt(0).GetTextures().GetTexture(0));
+
+  application.SendNotification();
+  application.Render();
+
+  controls[1].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 12u, TEST_LOCATION);
+
+  controls[0].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRenderEffectBackgroundBlurDrawOrder(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectBackgroundBlurDrawOrder");
+  tet_infoline("The background is rendered until the control drawn first, whatever order the effects are set in.");
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+
+  Control controls[2];
+  for(auto&& control : controls)
+  {
+    control = Control::New();
+    control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    control.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+    control.SetBackgroundColor(Color::RED);
+    scene.Add(control);
+  }
+
+  // The control on the top first.
+  controls[1].SetRenderEffect(BackgroundBlurEffect::New());
+  controls[0].SetRenderEffect(BackgroundBlurEffect::New());
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("The order changes when the controls are reordered, or leave the scene.");
+  controls[0].RaiseToTop();
+  application.SendNotification();
+  application.Render();
+
+  controls[1].Unparent();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  scene.Add(controls[1]);
+  controls[0].ClearRenderEffect();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  controls[1].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRenderEffectBackgroundBlurActorDrawnBetween(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectBackgroundBlurActorDrawnBetween");
+  tet_infoline("The controls share a capture only if no other actor is drawn between them.");
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+
+  // An actor drawn over the second control, which the background of the first one does not have.
+  Actor actor = Actor::New();
+  actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  actor.SetProperty(Actor::Property::POSITION, Vector2(150.0f, 0.0f));
+  actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  actor.AddRenderer(Renderer::New(Geometry::New(), Shader::New("vertexSrc", "fragmentSrc")));
+
+  Control controls[2];
+  for(auto&& control : controls)
+  {
+    control = Control::New();
+    control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    control.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  }
+  controls[0].SetProperty(Actor::Property::POSITION, Vector2(-150.0f, 0.0f));
+  controls[1].SetProperty(Actor::Property::POSITION, Vector2(150.0f, 0.0f));
+
+  scene.Add(controls[0]);
+  scene.Add(actor);
+  scene.Add(controls[1]);
+
+  tet_infoline("The capture of each control, blurred.");
+  controls[0].SetRenderEffect(BackgroundBlurEffect::New());
+  controls[1].SetRenderEffect(BackgroundBlurEffect::New());
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 7u, TEST_LOCATION);
+  DALI_TEST_CHECK(controls[0].GetRendererAt(0).GetTextures().GetTexture(0) != controls[1].GetRendererAt(0).GetTextures().GetTexture(0));
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("The controls share the capture when the actor is drawn after them.");
+  actor.RaiseToTop();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+  DALI_TEST_CHECK(controls[0].GetRendererAt(0).GetTextures().GetTexture(0) == controls[1].GetRendererAt(0).GetTextures().GetTexture(0));
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("And not any more when it is drawn between them again.");
+  actor.LowerBelow(controls[1]);
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 7u, TEST_LOCATION);
+  DALI_TEST_CHECK(controls[0].GetRendererAt(0).GetTextures().GetTexture(0) != controls[1].GetRendererAt(0).GetTextures().GetTexture(0));
+
+  tet_infoline("An actor without renderers between them does not matter.");
+  actor.Unparent();
+  scene.Add(Actor::New());
+  controls[1].RaiseToTop();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  controls[0].ClearRenderEffect();
+  controls[1].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+namespace
+{
+int CountDraws(ToolkitTestApplication& application, uint32_t frameCount)
+{
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+  drawTrace.Reset();
+  for(uint32_t frame = 0u; frame < frameCount; ++frame)
+  {
+    application.SendNotification();
+    application.Render();
+  }
+  return drawTrace.CountMethod("DrawArrays") + drawTrace.CountMethod("DrawElements");
+}
+
+} // namespace
+
+int UtcDaliRenderEffectBackgroundBlurRefreshOnce(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectBackgroundBlurRefreshOnce");
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+
+  Control control = Control::New();
+  control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  control.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  scene.Add(control);
+
+  BackgroundBlurEffect effect = BackgroundBlurEffect::New(0.4f, 40);
+  DALI_TEST_EQUALS(DevelBackgroundBlurEffect::GetRefreshPolicy(effect), DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS, TEST_LOCATION);
+  control.SetRenderEffect(effect);
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 4u, TEST_LOCATION);
+  for(uint32_t i = 1u; i < taskList.GetTaskCount(); ++i)
+  {
+    DALI_TEST_EQUALS(taskList.GetTask(i).GetRefreshRate(), static_cast<uint32_t>(RenderTask::REFRESH_ALWAYS), TEST_LOCATION);
+  }
+  CountDraws(application, 5u);
+  const int continuousDraws = CountDraws(application, 5u);
+
+  tet_infoline("The background is rendered and blurred once, then not any more.");
+  DevelBackgroundBlurEffect::SetRefreshPolicy(effect, DevelBackgroundBlurEffect::RefreshPolicy::ONCE);
+  DALI_TEST_EQUALS(DevelBackgroundBlurEffect::GetRefreshPolicy(effect), DevelBackgroundBlurEffect::RefreshPolicy::ONCE, TEST_LOCATION);
+  for(uint32_t i = 1u; i < taskList.GetTaskCount(); ++i)
+  {
+    DALI_TEST_EQUALS(taskList.GetTask(i).GetRefreshRate(), static_cast<uint32_t>(RenderTask::REFRESH_ONCE), TEST_LOCATION);
+  }
+  CountDraws(application, 5u);
+  const int staticDraws = CountDraws(application, 5u);
+  tet_printf("Draws of 5 frames: continuous %d, static %d\n", continuousDraws, staticDraws);
+  DALI_TEST_CHECK(staticDraws < continuousDraws);
+
+  tet_infoline("A change of the window is not noticed with ONCE.");
+  scene.Add(Actor::New());
+  DALI_TEST_EQUALS(CountDraws(application, 5u), staticDraws, TEST_LOCATION);
+
+  tet_infoline("Refresh() renders the background again.");
+  DevelBackgroundBlurEffect::Refresh(effect);
+  DALI_TEST_CHECK(CountDraws(application, 5u) > staticDraws);
+  DALI_TEST_EQUALS(CountDraws(application, 5u), staticDraws, TEST_LOCATION);
+
+  control.ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRenderEffectBackgroundBlurRefreshOnDirty(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectBackgroundBlurRefreshOnDirty");
+
+  Integration::Scene scene    = application.GetScene();
+  RenderTaskList     taskList = scene.GetRenderTaskList();
+
+  Control controls[2];
+  for(auto&& control : controls)
+  {
+    control = Control::New();
+    control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    control.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+    scene.Add(control);
+  }
+
+  tet_infoline("The policy set before the activation is applied, for the dual Kawase blur too.");
+  BackgroundBlurEffect effect = DevelBackgroundBlurEffect::New(0.4f, 40, BlurAlgorithm::DUAL_KAWASE);
+  DevelBackgroundBlurEffect::SetRefreshPolicy(effect, DevelBackgroundBlurEffect::RefreshPolicy::ON_DIRTY);
+  controls[0].SetRenderEffect(effect);
+  for(uint32_t i = 1u; i < taskList.GetTaskCount(); ++i)
+  {
+    DALI_TEST_EQUALS(taskList.GetTask(i).GetRefreshRate(), static_cast<uint32_t>(RenderTask::REFRESH_ONCE), TEST_LOCATION);
+  }
+  CountDraws(application, 5u);
+  const int staticDraws = CountDraws(application, 5u);
+
+  tet_infoline("Adding an actor to the window renders the background again.");
+  Actor actor = Actor::New();
+  scene.Add(actor);
+  DALI_TEST_CHECK(CountDraws(application, 5u) > staticDraws);
+  DALI_TEST_EQUALS(CountDraws(application, 5u), staticDraws, TEST_LOCATION);
+
+  tet_infoline("So does removing it.");
+  actor.Unparent();
+  DALI_TEST_CHECK(CountDraws(application, 5u) > staticDraws);
+
+  tet_infoline("A continuous effect in the same window renders the background every frame.");
+  controls[1].SetRenderEffect(BackgroundBlurEffect::New(0.4f, 40));
+  DALI_TEST_EQUALS(taskList.GetTask(1u).GetRefreshRate(), static_cast<uint32_t>(RenderTask::REFRESH_ALWAYS), TEST_LOCATION);
+
+  controls[1].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTask(1u).GetRefreshRate(), static_cast<uint32_t>(RenderTask::REFRESH_ONCE), TEST_LOCATION);
+
+  controls[0].ClearRenderEffect();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -15,7 +15,10 @@
  */
 
 #include <stdlib.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <sstream>
 
 #include <toolkit-event-thread-callback.h>
 #include <toolkit-timer.h>
@@ -25,7 +28,10 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/utility/npatch-utilities.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-prototype.h>
+#include <dali-toolkit/devel-api/visuals/color-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/npatch/npatch-loader.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/integration-api/adaptor-framework/shader-precompiler.h>
@@ -111,6 +117,24 @@ void TestVisualAsynchronousRender(ToolkitTestApplication& application,
   DALI_TEST_EQUALS(actor.GetRendererCount(), 1u, TEST_LOCATION);
 }
 
+void TestPropertyMapsEqual(const Property::Map& map, const Property::Map& expected, const char* location)
+{
+  DALI_TEST_EQUALS(map.Count(), expected.Count(), location);
+  for(Property::Map::SizeType i = 0; i < expected.Count(); ++i)
+  {
+    KeyValuePair     pair  = expected.GetKeyValue(i);
+    Property::Value* value = pair.first.type == Property::Key::INDEX ? map.Find(pair.first.indexKey) : map.Find(pair.first.stringKey);
+    DALI_TEST_CHECK(value);
+    if(value)
+    {
+      std::ostringstream valueStream, expectedStream;
+      valueStream << *value;
+      expectedStream << pair.second;
+      DALI_TEST_EQUALS(valueStream.str(), expectedStream.str(), location);
+    }
+  }
+}
+
 int gResourceReadySignalCounter;
 
 void OnResourceReadySignal(Control control)
@@ -2925,3 +2949,298 @@ int UtcDaliVisualFactoryGetPreCompiler(void)
 
   END_TEST;
 }
+
+int UtcDaliVisualFactoryShaderUsageLog(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryShaderUsageLog: Log the shaders used by the visuals");
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK(factory);
+  DALI_TEST_EQUALS(factory.GetShaderUsageLog().size(), 0u, TEST_LOCATION);
+
+  factory.EnableShaderUsageLog(true);
+
+  Property::Map propertyMap;
+  propertyMap.Insert(Toolkit::Visual::Property::TYPE, Visual::COLOR);
+  propertyMap.Insert(ColorVisual::Property::MIX_COLOR, Color::BLUE);
+  propertyMap.Insert(DevelVisual::Property::CORNER_RADIUS, 10.0f);
+  Visual::Base visual = factory.CreateVisual(propertyMap);
+  DummyControl actor  = DummyControl::New(true);
+  TestVisualRender(application, actor, visual);
+
+  // The shader is logged once, though it is used by another visual
+  Visual::Base visual2 = factory.CreateVisual(propertyMap);
+  DummyControl actor2  = DummyControl::New(true);
+  TestVisualRender(application, actor2, visual2);
+
+  std::vector<std::string> shaderUsageLog = factory.GetShaderUsageLog();
+  DALI_TEST_EQUALS(static_cast<int>(std::count(shaderUsageLog.begin(), shaderUsageLog.end(), std::string("COLOR_SHADER_ROUNDED_CORNER"))), 1, TEST_LOCATION);
+
+  // The shaders are not logged after the log is disabled
+  factory.EnableShaderUsageLog(false);
+
+  propertyMap.Insert(DevelVisual::Property::BORDERLINE_WIDTH, 2.0f);
+  Visual::Base visual3 = factory.CreateVisual(propertyMap);
+  DummyControl actor3  = DummyControl::New(true);
+  TestVisualRender(application, actor3, visual3);
+
+  DALI_TEST_EQUALS(factory.GetShaderUsageLog().size(), shaderUsageLog.size(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryUsePreCompiledShaderList(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryUsePreCompiledShaderList: Precompile the given shaders in the given order");
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK(factory);
+
+  std::vector<std::string> shaderNames{
+    "IMAGE_SHADER_ROUNDED_CORNER",
+    "IMAGE_SHADER",
+    "TEXT_SHADER_MULTI_COLOR_TEXT",
+    "COLOR_SHADER_BORDERLINE",
+    "IMAGE_SHADER",        // Duplicated
+    "NATIVE_IMAGE_SHADER", // Cannot be precompiled
+    "NOT_A_SHADER",        // Unknown
+  };
+  factory.UsePreCompiledShader(shaderNames);
+
+  std::vector<RawShaderData> precompiledShaderList;
+  ShaderPreCompiler::Get().GetPreCompileShaderList(precompiledShaderList);
+  DALI_TEST_EQUALS(precompiledShaderList.size(), 3u, TEST_LOCATION);
+
+  // The variants of the image shader given in a row are in a batch
+  DALI_TEST_EQUALS(static_cast<int>(precompiledShaderList[0].shaderCount), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[0].shaderName[0]), std::string("IMAGE_SHADER_ROUNDED_CORNER"), TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[0].vertexPrefix[0]), std::string("#define IS_REQUIRED_ROUNDED_CORNER\n"), TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[0].shaderName[1]), std::string("IMAGE_SHADER"), TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[0].vertexPrefix[1]), std::string(""), TEST_LOCATION);
+
+  DALI_TEST_EQUALS(static_cast<int>(precompiledShaderList[1].shaderCount), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[1].shaderName[0]), std::string("TEXT_SHADER_MULTI_COLOR_TEXT"), TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[1].fragmentPrefix[0]), std::string("#define IS_REQUIRED_MULTI_COLOR\n"), TEST_LOCATION);
+
+  DALI_TEST_EQUALS(static_cast<int>(precompiledShaderList[2].shaderCount), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(precompiledShaderList[2].shaderName[0]), std::string("COLOR_SHADER_BORDERLINE"), TEST_LOCATION);
+
+  // The default shaders are not added afterwards
+  factory.UsePreCompiledShader();
+
+  std::vector<RawShaderData> precompiledShaderList2;
+  ShaderPreCompiler::Get().GetPreCompileShaderList(precompiledShaderList2);
+  DALI_TEST_EQUALS(precompiledShaderList2.size(), 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCreateVisualFromPrototype01(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromPrototype01: Request color and image visuals of prototypes");
+
+  VisualFactory factory = VisualFactory::Get();
+
+  Property::Map colorMap;
+  colorMap["visualType"]    = "COLOR";
+  colorMap["mixColor"]      = Vector4(1.0f, 0.5f, 0.3f, 0.2f);
+  colorMap["opacity"]       = 0.5f;
+  colorMap["cornerRadius"]  = 10.0f;
+  colorMap["blurRadius"]    = 2.0f;
+  colorMap["cutoutPolicy"]  = "CUTOUT_VIEW";
+  colorMap["unknownString"] = "unknown";
+
+  Property::Map imageMap;
+  imageMap.Insert(Visual::Property::TYPE, Visual::IMAGE);
+  imageMap["url"]               = TEST_IMAGE_FILE_NAME;
+  imageMap["fittingMode"]       = "SCALE_TO_FILL";
+  imageMap["samplingMode"]      = "NEAREST";
+  imageMap["wrapModeU"]         = "REPEAT";
+  imageMap["desiredWidth"]      = 30;
+  imageMap["releasePolicy"]     = "NEVER";
+  imageMap["visualFittingMode"] = "FILL";
+  imageMap["mixColor"]          = Vector3(0.5f, 0.5f, 0.5f);
+
+  for(auto& propertyMap : {colorMap, imageMap})
+  {
+    VisualPrototype prototype = VisualPrototype::New(propertyMap);
+    DALI_TEST_CHECK(prototype);
+    DALI_TEST_EQUALS(prototype.GetPropertyMap().Count(), propertyMap.Count(), TEST_LOCATION);
+
+    Visual::Base visual          = factory.CreateVisual(propertyMap);
+    Visual::Base prototypeVisual = factory.CreateVisual(prototype);
+    DALI_TEST_CHECK(visual);
+    DALI_TEST_CHECK(prototypeVisual);
+
+    Property::Map expected, result;
+    visual.CreatePropertyMap(expected);
+    prototypeVisual.CreatePropertyMap(result);
+    TestPropertyMapsEqual(result, expected, TEST_LOCATION);
+  }
+
+  tet_infoline("Test that the enumeration strings are applied");
+  Property::Map result;
+  factory.CreateVisual(VisualPrototype::New(colorMap)).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(DevelColorVisual::Property::CUTOUT_POLICY)->Get<int>(), static_cast<int>(DevelColorVisual::CutoutPolicy::CUTOUT_VIEW), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ColorVisual::Property::MIX_COLOR)->Get<Vector4>(), Vector4(1.0f, 0.5f, 0.3f, 0.2f), TEST_LOCATION);
+
+  factory.CreateVisual(VisualPrototype::New(imageMap)).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::FITTING_MODE)->Get<int>(), static_cast<int>(FittingMode::SCALE_TO_FILL), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::WRAP_MODE_U)->Get<int>(), static_cast<int>(WrapMode::REPEAT), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::RELEASE_POLICY)->Get<int>(), static_cast<int>(ImageVisual::ReleasePolicy::NEVER), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(DevelVisual::Property::VISUAL_FITTING_MODE)->Get<std::string>(), std::string("FILL"), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCreateVisualFromPrototype02(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromPrototype02: Request visuals of a prototype with overrides");
+
+  VisualFactory factory = VisualFactory::Get();
+
+  Property::Map propertyMap;
+  propertyMap.Insert(Visual::Property::TYPE, Visual::IMAGE);
+  propertyMap.Insert(ImageVisual::Property::URL, TEST_IMAGE_FILE_NAME);
+  propertyMap["fittingMode"] = "SCALE_TO_FILL";
+
+  VisualPrototype prototype = VisualPrototype::New(propertyMap);
+
+  tet_infoline("Override the url and a property by its name");
+  Property::Map overrides;
+  overrides["url"]          = TEST_AUX_IMAGE;
+  overrides["samplingMode"] = "NEAREST";
+
+  Property::Map result;
+  factory.CreateVisual(prototype, overrides).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(Visual::Property::TYPE)->Get<int>(), static_cast<int>(Visual::IMAGE), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::URL)->Get<std::string>(), std::string(TEST_AUX_IMAGE), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::FITTING_MODE)->Get<int>(), static_cast<int>(FittingMode::SCALE_TO_FILL), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::SAMPLING_MODE)->Get<int>(), static_cast<int>(SamplingMode::NEAREST), TEST_LOCATION);
+
+  tet_infoline("Override the url with an other kind of image");
+  result.Clear();
+  factory.CreateVisual(prototype, Property::Map().Add(ImageVisual::Property::URL, TEST_SVG_FILE_NAME)).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(Visual::Property::TYPE)->Get<int>(), static_cast<int>(Visual::SVG), TEST_LOCATION);
+
+  tet_infoline("Override the type of the visual");
+  result.Clear();
+  factory.CreateVisual(prototype, Property::Map().Add("visualType", "COLOR").Add("mixColor", Color::RED)).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(Visual::Property::TYPE)->Get<int>(), static_cast<int>(Visual::COLOR), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ColorVisual::Property::MIX_COLOR)->Get<Vector4>(), Color::RED, TEST_LOCATION);
+
+  tet_infoline("The prototype is not changed by the overrides");
+  result.Clear();
+  factory.CreateVisual(prototype).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::URL)->Get<std::string>(), std::string(TEST_IMAGE_FILE_NAME), TEST_LOCATION);
+  DALI_TEST_EQUALS(result.Find(ImageVisual::Property::SAMPLING_MODE)->Get<int>(), static_cast<int>(SamplingMode::BOX_THEN_LINEAR), TEST_LOCATION);
+
+  tet_infoline("Test a prototype of a visual which is created from its property map");
+  VisualPrototype svgPrototype = VisualPrototype::New(Property::Map().Add(Visual::Property::TYPE, Visual::SVG).Add(ImageVisual::Property::URL, TEST_SVG_FILE_NAME));
+  result.Clear();
+  factory.CreateVisual(svgPrototype).CreatePropertyMap(result);
+  DALI_TEST_EQUALS(result.Find(Visual::Property::TYPE)->Get<int>(), static_cast<int>(Visual::SVG), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCreateVisualFromPrototype03(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromPrototype03: Test the handle of a prototype");
+
+  VisualPrototype prototype = VisualPrototype::New(Property::Map().Add(Visual::Property::TYPE, Visual::COLOR));
+
+  VisualPrototype copy(prototype);
+  DALI_TEST_CHECK(copy == prototype);
+
+  VisualPrototype assigned;
+  DALI_TEST_CHECK(!assigned);
+  assigned = prototype;
+  DALI_TEST_CHECK(assigned == prototype);
+
+  BaseHandle handle(prototype);
+  DALI_TEST_CHECK(VisualPrototype::DownCast(handle) == prototype);
+  DALI_TEST_CHECK(!VisualPrototype::DownCast(BaseHandle()));
+
+  tet_infoline("Test that a prototype without a valid url creates no visual, as the property map does");
+  VisualPrototype emptyUrl = VisualPrototype::New(Property::Map().Add(Visual::Property::TYPE, Visual::IMAGE).Add(ImageVisual::Property::URL, ""));
+  DALI_TEST_CHECK(!VisualFactory::Get().CreateVisual(emptyUrl));
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCreateVisualFromPrototypeN(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromPrototypeN: Request a visual of an empty prototype");
+
+  VisualPrototype prototype;
+  try
+  {
+    VisualFactory::Get().CreateVisual(prototype);
+    tet_result(TET_FAIL);
+  }
+  catch(Dali::DaliException& e)
+  {
+    DALI_TEST_ASSERT(e, "VisualPrototype handle is empty", TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCreateVisualFromPrototypeBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromPrototypeBenchmark");
+  tet_infoline("Creates 10000 identical color and image visuals from a property map and from a prototype.");
+
+  const int VISUAL_COUNT = 10000;
+
+  VisualFactory factory = VisualFactory::Get();
+
+  Property::Map colorMap;
+  colorMap["visualType"]   = "COLOR";
+  colorMap["mixColor"]     = Color::BLUE;
+  colorMap["cornerRadius"] = 4.0f;
+
+  Property::Map imageMap;
+  imageMap["visualType"]    = "IMAGE";
+  imageMap["url"]           = TEST_IMAGE_FILE_NAME;
+  imageMap["fittingMode"]   = "SCALE_TO_FILL";
+  imageMap["samplingMode"]  = "BOX_THEN_LINEAR";
+  imageMap["releasePolicy"] = "DESTROYED";
+
+  for(auto& propertyMap : {colorMap, imageMap})
+  {
+    std::vector<Visual::Base> visuals;
+    visuals.reserve(VISUAL_COUNT);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < VISUAL_COUNT; ++i)
+    {
+      visuals.push_back(factory.CreateVisual(propertyMap));
+    }
+    auto mapDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    visuals.clear();
+
+    start                     = std::chrono::steady_clock::now();
+    VisualPrototype prototype = VisualPrototype::New(propertyMap);
+    for(int i = 0; i < VISUAL_COUNT; ++i)
+    {
+      visuals.push_back(factory.CreateVisual(prototype));
+    }
+    auto prototypeDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    DALI_TEST_EQUALS(static_cast<int>(visuals.size()), VISUAL_COUNT, TEST_LOCATION);
+    DALI_TEST_CHECK(visuals.back());
+
+    tet_printf("%s : property map %lld us, prototype %lld us\n", propertyMap.Find(Visual::Property::TYPE, "visualType")->Get<std::string>().c_str(), static_cast<long long>(mapDuration), static_cast<long long>(prototypeDuration));
+  }
+
+  END_TEST;
+}
@@ -52,6 +52,11 @@ void Builder::LoadFromString(const std::string& data, UIFormat rep)
   GetImpl(*this).LoadFromString(data);
 }
 
+void Builder::SetLazyParsing(bool lazy)
+{
+  GetImpl(*this).SetLazyParsing(lazy);
+}
+
 void Builder::AddConstants(const Property::Map& map)
 {
   GetImpl(*this).AddConstants(map);
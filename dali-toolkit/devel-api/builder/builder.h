@@ -159,6 +159,17 @@ public:
    */
   void LoadFromString(const std::string& data, UIFormat format = JSON);
 
+  /**
+   * @brief Sets whether the styles, templates and animations are parsed when they are first used.
+   *
+   * With lazy parsing, LoadFromString() only finds where each style, template and animation is in the string,
+   * and parses the rest of it. Each is parsed when ApplyStyle(), Create() or CreateAnimation() first needs it,
+   * so the parts of a large style sheet which are never used are never parsed.
+   * Errors in them are then logged when they are parsed, rather than raising an exception on loading.
+   * @param[in] lazy Whether to parse lazily. The default is false
+   */
+  void SetLazyParsing(bool lazy);
+
   /**
    * @brief Adds user defined constants to all future style template or animation expansions
    *
@@ -0,0 +1,52 @@
+#ifndef DALI_TOOLKIT_DEVEL_BLUR_ALGORITHM_H
+#define DALI_TOOLKIT_DEVEL_BLUR_ALGORITHM_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+namespace Dali
+{
+namespace Toolkit
+{
+/**
+ * @brief The algorithms which blur the controls, e.g. GaussianBlurView and BackgroundBlurEffect.
+ */
+namespace BlurAlgorithm
+{
+enum Type
+{
+  /**
+   * @brief Two separated passes of a Gaussian kernel.
+   * The number of the samples, and so the cost, grows linearly with the radius.
+   */
+  GAUSSIAN,
+
+  /**
+   * @brief A chain of downsampling passes followed by the upsampling passes (dual Kawase).
+   * Each pass takes a few samples, and a bigger radius adds a pass on a quarter of the pixels of the previous one,
+   * so the cost stays roughly constant as the radius grows. The result is close to, but not exactly, a Gaussian blur.
+   */
+  DUAL_KAWASE
+};
+
+} // namespace BlurAlgorithm
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_DEVEL_BLUR_ALGORITHM_H
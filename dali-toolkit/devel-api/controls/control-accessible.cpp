@@ -121,15 +121,16 @@ std::string ControlAccessible::GetName() const
 
   Internal::Control&       internalControl = Toolkit::Internal::GetImplementation(control);
   Internal::Control::Impl& controlImpl     = Internal::Control::Impl::Get(internalControl);
+  auto*                    accessibilityData = controlImpl.mAccessibilityData.get();
   std::string              name;
 
-  if(!controlImpl.mAccessibilityGetNameSignal.Empty())
+  if(accessibilityData && !accessibilityData->mAccessibilityGetNameSignal.Empty())
   {
-    controlImpl.mAccessibilityGetNameSignal.Emit(name);
+    accessibilityData->mAccessibilityGetNameSignal.Emit(name);
   }
-  else if(!controlImpl.mAccessibilityName.empty())
+  else if(accessibilityData && !accessibilityData->mAccessibilityName.empty())
   {
-    name = controlImpl.mAccessibilityName;
+    name = accessibilityData->mAccessibilityName;
   }
   else if(auto raw = GetNameRaw(); !raw.empty())
   {
@@ -140,9 +141,9 @@ std::string ControlAccessible::GetName() const
     name = Self().GetProperty<std::string>(Actor::Property::NAME);
   }
 
-  if(!controlImpl.mAccessibilityTranslationDomain.empty())
+  if(accessibilityData && !accessibilityData->mAccessibilityTranslationDomain.empty())
   {
-    return GetLocaleText(name, controlImpl.mAccessibilityTranslationDomain.c_str());
+    return GetLocaleText(name, accessibilityData->mAccessibilityTranslationDomain.c_str());
   }
 
   return GetLocaleText(name);
@@ -159,24 +160,25 @@ std::string ControlAccessible::GetDescription() const
 
   Internal::Control&       internalControl = Toolkit::Internal::GetImplementation(control);
   Internal::Control::Impl& controlImpl     = Internal::Control::Impl::Get(internalControl);
+  auto*                    accessibilityData = controlImpl.mAccessibilityData.get();
   std::string              description;
 
-  if(!controlImpl.mAccessibilityGetDescriptionSignal.Empty())
+  if(accessibilityData && !accessibilityData->mAccessibilityGetDescriptionSignal.Empty())
   {
-    controlImpl.mAccessibilityGetDescriptionSignal.Emit(description);
+    accessibilityData->mAccessibilityGetDescriptionSignal.Emit(description);
   }
-  else if(!controlImpl.mAccessibilityDescription.empty())
+  else if(accessibilityData && !accessibilityData->mAccessibilityDescription.empty())
   {
-    description = controlImpl.mAccessibilityDescription;
+    description = accessibilityData->mAccessibilityDescription;
   }
   else
   {
     description = GetDescriptionRaw();
   }
 
-  if(!controlImpl.mAccessibilityTranslationDomain.empty())
+  if(accessibilityData && !accessibilityData->mAccessibilityTranslationDomain.empty())
   {
-    return GetLocaleText(description, controlImpl.mAccessibilityTranslationDomain.c_str());
+    return GetLocaleText(description, accessibilityData->mAccessibilityTranslationDomain.c_str());
   }
 
   return GetLocaleText(description);
@@ -497,10 +499,10 @@ bool ControlAccessible::DoGesture(const Dali::Accessibility::GestureInfo& gestur
   Internal::Control&       internalControl = Toolkit::Internal::GetImplementation(control);
   Internal::Control::Impl& controlImpl     = Internal::Control::Impl::Get(internalControl);
 
-  if(!controlImpl.mAccessibilityDoGestureSignal.Empty())
+  if(controlImpl.mAccessibilityData && !controlImpl.mAccessibilityData->mAccessibilityDoGestureSignal.Empty())
   {
     auto ret = std::make_pair(gestureInfo, false);
-    controlImpl.mAccessibilityDoGestureSignal.Emit(ret);
+    controlImpl.mAccessibilityData->mAccessibilityDoGestureSignal.Emit(ret);
     return ret.second;
   }
 
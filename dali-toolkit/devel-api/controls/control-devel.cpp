@@ -19,11 +19,13 @@
 #include "control-devel.h"
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/atspi-interfaces/component.h>
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/animation/animation.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/transition-data.h>
+#include <dali-toolkit/internal/builder/property-batch.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/control.h>
@@ -37,6 +39,65 @@ Dali::Toolkit::Internal::Control::Impl& GetControlImplementation(Dali::Toolkit::
   return Dali::Toolkit::Internal::Control::Impl::Get(internalControl);
 }
 
+Dali::Accessibility::Accessible* GetRelationTarget(Dali::Actor destination)
+{
+  // The relations keep the accessible object, so it is created even if the creation is deferred until the bridge is up
+  if(auto destinationControl = Dali::Toolkit::Control::DownCast(destination))
+  {
+    if(auto destinationAccessible = GetControlImplementation(destinationControl).EnsureAccessibleObject())
+    {
+      return destinationAccessible.get();
+    }
+  }
+  return Dali::Accessibility::Accessible::Get(destination);
+}
+
+Dali::Property::Map CreateAccessibilityNodeSnapshot(Dali::Accessibility::Accessible* accessible)
+{
+  Dali::Property::Map node;
+  node.Insert("name", accessible->GetName());
+  node.Insert("description", accessible->GetDescription());
+  node.Insert("role", accessible->GetRoleName());
+
+  Dali::Property::Array             states;
+  Dali::Accessibility::States       accessibleStates = accessible->GetStates();
+  for(int state = 0; state < static_cast<int>(Dali::Accessibility::State::MAX_COUNT); ++state)
+  {
+    if(accessibleStates[static_cast<Dali::Accessibility::State>(state)])
+    {
+      states.PushBack(state);
+    }
+  }
+  node.Insert("states", states);
+
+  if(auto component = Dali::Accessibility::Component::DownCast(accessible))
+  {
+    auto extents = component->GetExtents(Dali::Accessibility::CoordinateType::WINDOW);
+    node.Insert("extents", Dali::Vector4(extents.x, extents.y, extents.width, extents.height));
+  }
+
+  Dali::Property::Map attributes;
+  for(auto& attribute : accessible->GetAttributes())
+  {
+    attributes.Insert(attribute.first, attribute.second);
+  }
+  node.Insert("attributes", attributes);
+
+  Dali::Property::Array children;
+  const std::size_t     childCount = accessible->GetChildCount();
+  children.Reserve(childCount);
+  for(std::size_t i = 0; i < childCount; ++i)
+  {
+    if(auto child = accessible->GetChildAtIndex(i))
+    {
+      children.PushBack(CreateAccessibilityNodeSnapshot(child));
+    }
+  }
+  node.Insert("children", children);
+
+  return node;
+}
+
 } // unnamed namespace
 
 namespace Dali
@@ -142,62 +203,68 @@ Dali::Property GetVisualProperty(Control control, Dali::Property::Index index, D
 
 Toolkit::DevelControl::AccessibilityActivateSignalType& AccessibilityActivateSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityActivateSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityActivateSignal;
 }
 
 Toolkit::DevelControl::AccessibilityReadingSkippedSignalType& AccessibilityReadingSkippedSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityReadingSkippedSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityReadingSkippedSignal;
 }
 
 Toolkit::DevelControl::AccessibilityReadingPausedSignalType& AccessibilityReadingPausedSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityReadingPausedSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityReadingPausedSignal;
 }
 
 Toolkit::DevelControl::AccessibilityReadingResumedSignalType& AccessibilityReadingResumedSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityReadingResumedSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityReadingResumedSignal;
 }
 
 Toolkit::DevelControl::AccessibilityReadingCancelledSignalType& AccessibilityReadingCancelledSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityReadingCancelledSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityReadingCancelledSignal;
 }
 
 Toolkit::DevelControl::AccessibilityReadingStoppedSignalType& AccessibilityReadingStoppedSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityReadingStoppedSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityReadingStoppedSignal;
 }
 
 Toolkit::DevelControl::AccessibilityGetNameSignalType& AccessibilityGetNameSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityGetNameSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityGetNameSignal;
 }
 
 Toolkit::DevelControl::AccessibilityGetDescriptionSignalType& AccessibilityGetDescriptionSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityGetDescriptionSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityGetDescriptionSignal;
 }
 
 Toolkit::DevelControl::AccessibilityDoGestureSignalType& AccessibilityDoGestureSignal(Toolkit::Control control)
 {
-  return GetControlImplementation(control).mAccessibilityDoGestureSignal;
+  return GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityDoGestureSignal;
 }
 
 void AppendAccessibilityRelation(Toolkit::Control control, Dali::Actor destination, Dali::Accessibility::RelationType relation)
 {
-  if(auto destinationAccessible = Accessibility::Accessible::Get(destination))
+  if(auto destinationAccessible = GetRelationTarget(destination))
   {
-    GetControlImplementation(control).mAccessibilityRelations[relation].insert(destinationAccessible);
+    GetControlImplementation(control).EnsureAccessibilityData().mAccessibilityRelations[relation].insert(destinationAccessible);
   }
 }
 
 void RemoveAccessibilityRelation(Toolkit::Control control, Dali::Actor destination, Dali::Accessibility::RelationType relation)
 {
-  if(auto destinationAccessible = Accessibility::Accessible::Get(destination))
+  auto* accessibilityData = GetControlImplementation(control).mAccessibilityData.get();
+  if(!accessibilityData)
   {
-    auto& relations = GetControlImplementation(control).mAccessibilityRelations;
+    return;
+  }
+
+  if(auto destinationAccessible = GetRelationTarget(destination))
+  {
+    auto& relations = accessibilityData->mAccessibilityRelations;
 
     relations[relation].erase(destinationAccessible);
 
@@ -210,9 +277,16 @@ void RemoveAccessibilityRelation(Toolkit::Control control, Dali::Actor destinati
 
 std::vector<Accessibility::Relation> GetAccessibilityRelations(Toolkit::Control control)
 {
-  const auto&                          relations = GetControlImplementation(control).mAccessibilityRelations;
+  const auto*                          accessibilityData = GetControlImplementation(control).mAccessibilityData.get();
   std::vector<Accessibility::Relation> result;
 
+  if(!accessibilityData)
+  {
+    return result;
+  }
+
+  const auto& relations = accessibilityData->mAccessibilityRelations;
+
   for(auto& relation : relations)
   {
     auto& targets = relation.second;
@@ -226,7 +300,11 @@ std::vector<Accessibility::Relation> GetAccessibilityRelations(Toolkit::Control
 
 void ClearAccessibilityRelations(Toolkit::Control control)
 {
-  GetControlImplementation(control).mAccessibilityRelations.clear();
+  auto* accessibilityData = GetControlImplementation(control).mAccessibilityData.get();
+  if(accessibilityData)
+  {
+    accessibilityData->mAccessibilityRelations.clear();
+  }
 }
 
 void AppendAccessibilityAttribute(Toolkit::Control control, const std::string& key, const std::string& value)
@@ -308,6 +386,36 @@ bool IsCreateAccessibleEnabled(Toolkit::Control control)
   return GetControlImplementation(control).IsCreateAccessibleEnabled();
 }
 
+void EnableLazyAccessibleCreation(bool enable)
+{
+  Internal::Control::Impl::EnableLazyAccessibleCreation(enable);
+}
+
+bool IsLazyAccessibleCreationEnabled()
+{
+  return Internal::Control::Impl::IsLazyAccessibleCreationEnabled();
+}
+
+Property::Map GetAccessibilityTreeSnapshot(Toolkit::Control control)
+{
+  auto controlAccessible = GetControlImplementation(control).GetAccessibleObject();
+  if(DALI_LIKELY(controlAccessible))
+  {
+    return CreateAccessibilityNodeSnapshot(controlAccessible.get());
+  }
+  return Property::Map();
+}
+
+void SetProperties(Toolkit::Control control, const Property::Map& properties)
+{
+  // Shared by every call, so each type resolves the names of its properties once
+  static Internal::PropertyIndexCache propertyIndexCache;
+
+  Internal::PropertyBatch batch;
+  batch.Add(control, properties, propertyIndexCache);
+  batch.Apply(control);
+}
+
 } // namespace DevelControl
 
 } // namespace Toolkit
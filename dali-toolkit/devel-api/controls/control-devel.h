@@ -22,6 +22,7 @@
 #include <dali/devel-api/adaptor-framework/input-method-context.h>
 #include <dali/public-api/animation/alpha-function.h>
 #include <dali/public-api/animation/time-period.h>
+#include <dali/public-api/object/property-map.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/control-accessible.h>
@@ -624,6 +625,56 @@ DALI_TOOLKIT_API void EnableCreateAccessible(Toolkit::Control control, bool enab
  */
 DALI_TOOLKIT_API bool IsCreateAccessibleEnabled(Toolkit::Control control);
 
+/**
+ * @brief Sets whether the controls create their accessible objects only while the accessibility bridge is up.
+ *
+ * When enabled, a control which is queried for its accessible object while no assistive technology is connected
+ * does not create it; it is created when the bridge first asks for it. The targets of the accessibility relations
+ * are created regardless, as the relations keep them.
+ * @note The accessible objects already created are kept. It is disabled by default.
+ *
+ * @param[in] enable True to defer the creation of the accessible objects until the bridge is up. False otherwise.
+ */
+DALI_TOOLKIT_API void EnableLazyAccessibleCreation(bool enable);
+
+/**
+ * @brief Retrieves whether the controls create their accessible objects only while the accessibility bridge is up.
+ *
+ * @return True if the creation of the accessible objects is deferred until the bridge is up. False otherwise.
+ */
+DALI_TOOLKIT_API bool IsLazyAccessibleCreationEnabled();
+
+/**
+ * @brief Retrieves the accessibility tree of the control and its descendants in one call.
+ *
+ * Each node of the tree is a map with the following keys:
+ * | Key           | Type             | Description                                              |
+ * |---------------|------------------|----------------------------------------------------------|
+ * | "name"        | STRING           | The accessibility name                                   |
+ * | "description" | STRING           | The accessibility description                            |
+ * | "role"        | STRING           | The name of the role                                     |
+ * | "states"      | ARRAY of INTEGER | The Dali::Accessibility::State values which are set      |
+ * | "extents"     | VECTOR4          | The x, y, width and height in the window, if a component |
+ * | "attributes"  | MAP              | The accessibility attributes                             |
+ * | "children"    | ARRAY of MAP     | The nodes of the children, in order                      |
+ *
+ * @param[in] control The root of the tree
+ * @return The node of the control, or an empty map if the control has no accessible object
+ */
+DALI_TOOLKIT_API Property::Map GetAccessibilityTreeSnapshot(Toolkit::Control control);
+
+/**
+ * @brief Sets the given properties of the control in one call.
+ *
+ * The string keys are resolved to property indices once for each type of control, and the properties are then
+ * set in the order of the map. Keys which the control does not have are registered as custom properties,
+ * all together after the other properties are set.
+ *
+ * @param[in] control The control to set the properties of
+ * @param[in] properties The properties to set, keyed by either their indices or their names
+ */
+DALI_TOOLKIT_API void SetProperties(Toolkit::Control control, const Property::Map& properties);
+
 } // namespace DevelControl
 
 } // namespace Toolkit
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -115,6 +115,16 @@ Vector4 GaussianBlurView::GetBackgroundColor() const
   return GetImpl(*this).GetBackgroundColor();
 }
 
+void GaussianBlurView::SetBlurAlgorithm(BlurAlgorithm::Type algorithm)
+{
+  GetImpl(*this).SetBlurAlgorithm(algorithm);
+}
+
+BlurAlgorithm::Type GaussianBlurView::GetBlurAlgorithm() const
+{
+  return GetImpl(*this).GetBlurAlgorithm();
+}
+
 GaussianBlurView::GaussianBlurViewSignal& GaussianBlurView::FinishedSignal()
 {
   return GetImpl(*this).FinishedSignal();
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_GAUSSIAN_BLUR_EFFECT_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/blur-algorithm.h>
 #include <dali-toolkit/public-api/controls/control.h>
 
 namespace Dali
@@ -253,6 +254,22 @@ public:
   */
   Vector4 GetBackgroundColor() const;
 
+  /**
+  * @brief Set the algorithm of the blur. The default is BlurAlgorithm::GAUSSIAN.
+  *
+  * With BlurAlgorithm::DUAL_KAWASE, the blur covers about numSamples pixels of the downsampled render targets, like the
+  * Gaussian kernel does, but its cost does not grow with numSamples. blurBellCurveWidth is not used.
+  * @param[in] algorithm The algorithm of the blur.
+  * @note If the view is activated, its render tasks are recreated.
+  */
+  void SetBlurAlgorithm(BlurAlgorithm::Type algorithm);
+
+  /**
+  * @brief Get the algorithm of the blur.
+  * @return The algorithm of the blur.
+  */
+  BlurAlgorithm::Type GetBlurAlgorithm() const;
+
 public: // Signals
   /**
    * @brief If ActivateOnce has been called, then connect to this signal to be notified when the
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/render-effects/blur-effect-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelBackgroundBlurEffect
+{
+BackgroundBlurEffect New(float downscaleFactor, uint32_t blurRadius, BlurAlgorithm::Type algorithm)
+{
+  Internal::BlurEffectImplPtr internal = Internal::BlurEffectImpl::New(downscaleFactor, blurRadius, true, algorithm);
+  return BackgroundBlurEffect(internal.Get());
+}
+
+void SetRefreshPolicy(BackgroundBlurEffect effect, RefreshPolicy::Type policy)
+{
+  GetImplementation(effect).SetRefreshPolicy(policy);
+}
+
+RefreshPolicy::Type GetRefreshPolicy(BackgroundBlurEffect effect)
+{
+  return GetImplementation(effect).GetRefreshPolicy();
+}
+
+void Refresh(BackgroundBlurEffect effect)
+{
+  GetImplementation(effect).Refresh();
+}
+
+} // namespace DevelBackgroundBlurEffect
+
+} // namespace Toolkit
+
+} // namespace Dali
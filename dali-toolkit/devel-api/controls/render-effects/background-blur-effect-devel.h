@@ -0,0 +1,104 @@
+#ifndef DALI_TOOLKIT_BACKGROUND_BLUR_EFFECT_DEVEL_H
+#define DALI_TOOLKIT_BACKGROUND_BLUR_EFFECT_DEVEL_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/blur-algorithm.h>
+#include <dali-toolkit/public-api/controls/render-effects/background-blur-effect.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelBackgroundBlurEffect
+{
+/**
+ * @brief When the background of the effect is rendered and blurred again.
+ */
+namespace RefreshPolicy
+{
+enum Type
+{
+  /**
+   * @brief The background is rendered and blurred every frame. This is the default.
+   */
+  CONTINUOUS,
+
+  /**
+   * @brief The background is rendered and blurred once when the effect is activated, and again only when Refresh() is called.
+   * Suits a static background, e.g. behind a modal dialog, as the blur takes no GPU time afterwards.
+   */
+  ONCE,
+
+  /**
+   * @brief As ONCE, and the background is also rendered and blurred again when an actor is added to, removed from or
+   * reordered in the root layer of the window. Changes deeper in the tree still need Refresh().
+   */
+  ON_DIRTY
+};
+
+} // namespace RefreshPolicy
+
+/**
+ * @brief Creates an initialized BackgroundBlurEffect which blurs with the given algorithm.
+ *
+ * With BlurAlgorithm::DUAL_KAWASE, the blur covers about as many pixels as the Gaussian kernel of the radius does,
+ * but its cost stays roughly the same for any radius.
+ *
+ * @param[in] downscaleFactor This value should reside in the range [0.0, 1.0].
+ * @param[in] blurRadius The radius of the blur.
+ * @param[in] algorithm The algorithm of the blur.
+ * @return A handle to a newly allocated Dali resource
+ */
+DALI_TOOLKIT_API BackgroundBlurEffect New(float downscaleFactor, uint32_t blurRadius, BlurAlgorithm::Type algorithm);
+
+/**
+ * @brief Sets when the background of the effect is rendered and blurred again.
+ *
+ * The background of a window is rendered once for all the background blur effects in it, so it is rendered every frame
+ * while any effect of the window is CONTINUOUS.
+ *
+ * @param[in] effect The background blur effect.
+ * @param[in] policy The refresh policy.
+ */
+DALI_TOOLKIT_API void SetRefreshPolicy(BackgroundBlurEffect effect, RefreshPolicy::Type policy);
+
+/**
+ * @brief Retrieves when the background of the effect is rendered and blurred again.
+ * @param[in] effect The background blur effect.
+ * @return The refresh policy.
+ */
+DALI_TOOLKIT_API RefreshPolicy::Type GetRefreshPolicy(BackgroundBlurEffect effect);
+
+/**
+ * @brief Renders and blurs the background of the effect once more, e.g. after the background changed.
+ *
+ * Does nothing while the effect is not activated.
+ *
+ * @param[in] effect The background blur effect.
+ */
+DALI_TOOLKIT_API void Refresh(BackgroundBlurEffect effect);
+
+} // namespace DevelBackgroundBlurEffect
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_BACKGROUND_BLUR_EFFECT_DEVEL_H
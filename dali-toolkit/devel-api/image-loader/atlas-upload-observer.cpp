@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -43,6 +43,10 @@ AtlasUploadObserver::~AtlasUploadObserver()
   mAtlasList.Clear();
 }
 
+void AtlasUploadObserver::TextureRectChanged(const Vector4& textureRect)
+{
+}
+
 void AtlasUploadObserver::Register(Internal::ImageAtlas& imageAtlas)
 {
   // Add to the list so that the ImageAtlas could get notified in the destructor.
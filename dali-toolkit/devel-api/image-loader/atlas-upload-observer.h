@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_ATLAS_UPLOAD_OBSERVER_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector4.h>
 #include <dali/public-api/signals/callback.h>
 
 namespace Dali
@@ -54,6 +55,13 @@ public:
    */
   virtual void UploadCompleted() = 0;
 
+  /**
+   * The action to be taken when the image is moved in the atlas, i.e. when the atlas is defragmented.
+   * The texture of the atlas is replaced at the same time.
+   * @param[in] textureRect The new texture area of the image in the atlas.
+   */
+  virtual void TextureRectChanged(const Vector4& textureRect);
+
 public: // not intended for developer, called by ImageAtlas internally to get notified when this observer dies
   /**
    * @brief Register an ImageAtlas which be notified when the observer is destructing.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,8 @@
 #include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/image-disk-cache.h>
+#include <dali-toolkit/internal/image-loader/image-transcoder.h>
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h>
 
 namespace Dali
@@ -47,6 +49,28 @@ TextureSet RemoveTexture(const std::string& textureUrl)
   return textureMgr.RemoveExternalTexture(textureUrl);
 }
 
+void ClearImageDiskCache()
+{
+  Internal::ImageDiskCache::Get().Clear();
+}
+
+void SetTextureCompression(TextureCompressionQuality::Type quality, uint32_t minimumSize)
+{
+  Internal::ImageTranscoder& transcoder = Internal::ImageTranscoder::Get();
+  transcoder.SetQuality(quality);
+  transcoder.SetMinimumSize(minimumSize);
+}
+
+TextureCompressionQuality::Type GetTextureCompressionQuality()
+{
+  return Internal::ImageTranscoder::Get().GetQuality();
+}
+
+TextureCompressionStatistics GetTextureCompressionStatistics()
+{
+  return Internal::ImageTranscoder::Get().GetStatistics();
+}
+
 } // namespace TextureManager
 
 } // namespace Toolkit
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_DEVEL_API_TEXTURE_MANAGER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -33,6 +33,30 @@ namespace Toolkit
  */
 namespace TextureManager
 {
+/**
+ * @brief The compression of the textures of the decoded images.
+ */
+namespace TextureCompressionQuality
+{
+enum Type
+{
+  NONE, ///< The decoded images are uploaded as they are.
+  FAST, ///< The decoded images are transcoded to ETC2 quickly.
+  HIGH  ///< The decoded images are transcoded to ETC2 with fewer artifacts, which takes much longer.
+};
+
+} // namespace TextureCompressionQuality
+
+/**
+ * @brief The memory the compressed textures save.
+ */
+struct TextureCompressionStatistics
+{
+  uint32_t imageCount;     ///< The number of the images uploaded as compressed textures.
+  uint64_t decodedSize;    ///< The size of the images as they were decoded, in bytes.
+  uint64_t compressedSize; ///< The size of the compressed textures, in bytes.
+};
+
 /**
  * @brief Add a Texture to texture manager
  * Toolkit keeps the Texture handle until RemoveTexture is called.
@@ -63,6 +87,41 @@ DALI_TOOLKIT_API std::string AddTexture(TextureSet& textureSet, bool preMultipli
  */
 DALI_TOOLKIT_API TextureSet RemoveTexture(const std::string& textureUrl);
 
+/**
+ * @brief Removes all the decoded images stored on disk.
+ * The images are stored when the DALI_IMAGE_DISK_CACHE_PATH environment variable is set.
+ * Images which are being loaded may be stored again after this is called.
+ */
+DALI_TOOLKIT_API void ClearImageDiskCache();
+
+/**
+ * @brief Sets how the images are transcoded to compressed textures after they are decoded.
+ *
+ * The images are transcoded in the worker threads, and stored in the image disk cache if it is enabled, so they
+ * are uploaded as compressed textures without being decoded the next time. A compressed texture takes a quarter
+ * to a sixth of the memory of a decoded one.
+ * Only the RGB and RGBA images which are not masked are transcoded. The color of the compressed textures is not
+ * pre-multiplied by the alpha.
+ * The DALI_TEXTURE_COMPRESSION_QUALITY (0: NONE, 1: FAST, 2: HIGH) and DALI_TEXTURE_COMPRESSION_MINIMUM_SIZE
+ * environment variables set the initial values.
+ *
+ * @param[in] quality The quality of the compression, or NONE not to compress the textures.
+ * @param[in] minimumSize The images narrower or shorter than this, in pixels, are not transcoded.
+ */
+DALI_TOOLKIT_API void SetTextureCompression(TextureCompressionQuality::Type quality, uint32_t minimumSize);
+
+/**
+ * @brief Retrieves the quality of the compression of the textures.
+ * @return The quality, or NONE if the textures are not compressed.
+ */
+DALI_TOOLKIT_API TextureCompressionQuality::Type GetTextureCompressionQuality();
+
+/**
+ * @brief Retrieves the memory the compressed textures have saved since the application started.
+ * @return The statistics of the images uploaded as compressed textures, including the ones loaded from the disk cache.
+ */
+DALI_TOOLKIT_API TextureCompressionStatistics GetTextureCompressionStatistics();
+
 } // namespace TextureManager
 
 } // namespace Toolkit
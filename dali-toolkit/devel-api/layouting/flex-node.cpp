@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/object/weak-handle.h>
+#include <cmath>
 
 //INTERNAL INCLUDES
 #include <dali-toolkit/third-party/yoga/Yoga.h>
@@ -58,6 +59,11 @@ YGSize MeasureChild(YGNodeRef child, float width, YGMeasureMode measureModeWidth
   return childSize;
 }
 
+inline bool IsSameAvailableSize(float lhs, float rhs)
+{
+  return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+}
+
 } // namespace
 
 struct Node;
@@ -72,6 +78,11 @@ struct Node::Impl
   MeasureCallback         mMeasureCallback;
   WeakHandle<Dali::Actor> mActor;
   FlexNodeVector          mChildNodes;
+
+  float mLastAvailableWidth{0.0f};  ///< Available width of the last CalculateLayout
+  float mLastAvailableHeight{0.0f}; ///< Available height of the last CalculateLayout
+  bool  mLastIsRTL{false};          ///< Direction of the last CalculateLayout
+  bool  mLayoutValid{false};        ///< Whether the last calculated layout can be reused
 };
 
 Node::Node()
@@ -136,6 +147,8 @@ Node* Node::AddChild(Actor child, Extents margin, MeasureCallback measureFunctio
     Node* result = childNode.get();
     mImpl->mChildNodes.emplace_back(std::move(childNode));
 
+    MarkDirty();
+
     return result;
     ;
   }
@@ -152,21 +165,55 @@ void Node::RemoveChild(Actor child)
   {
     YGNodeRemoveChild(mImpl->mYogaNode, (*iterator)->mImpl->mYogaNode);
     mImpl->mChildNodes.erase(iterator);
+
+    MarkDirty();
   }
 
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "RemoveChild internal nodeCount[%d] childCount[%d]\n", YGNodeGetChildCount(mImpl->mYogaNode), mImpl->mChildNodes.size());
 }
 
+void Node::MarkDirty()
+{
+  DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MarkDirty mYogaNode[%p]\n", mImpl->mYogaNode);
+
+  mImpl->mLayoutValid = false;
+
+  // Size constraints of the actor may have changed too. Yoga only dirties the node when the values differ.
+  Actor actor = mImpl->mActor.GetHandle();
+  if(actor)
+  {
+    Vector2 minumumSize = actor.GetProperty<Vector2>(Actor::Property::MINIMUM_SIZE);
+    Vector2 maximumSize = actor.GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE);
+
+    YGNodeStyleSetMaxWidth(mImpl->mYogaNode, maximumSize.width);
+    YGNodeStyleSetMaxHeight(mImpl->mYogaNode, maximumSize.height);
+    YGNodeStyleSetMinWidth(mImpl->mYogaNode, minumumSize.width);
+    YGNodeStyleSetMinHeight(mImpl->mYogaNode, minumumSize.height);
+  }
+
+  // Only leaf nodes with a measure function may be dirtied manually, Yoga propagates it to the ancestors.
+  if(YGNodeGetMeasureFunc(mImpl->mYogaNode))
+  {
+    YGNodeMarkDirty(mImpl->mYogaNode);
+  }
+}
+
+bool Node::IsDirty() const
+{
+  return !mImpl->mLayoutValid || YGNodeIsDirty(mImpl->mYogaNode);
+}
+
 SizeTuple Node::MeasureNode(float width, int widthMode, float height, int heightMode)
 {
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode\n");
 
   // Execute callback registered with AddChild
   Toolkit::Flex::SizeTuple nodeSize{8, 8}; // Default size set to 8,8 to aid bug detection.
-  if(mImpl->mMeasureCallback && mImpl->mActor.GetHandle())
+  Actor                    actor = mImpl->mActor.GetHandle();
+  if(mImpl->mMeasureCallback && actor)
   {
-    DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode MeasureCallback executing on %s\n", mImpl->mActor.GetHandle().GetProperty<std::string>(Dali::Actor::Property::NAME).c_str());
-    mImpl->mMeasureCallback(mImpl->mActor.GetHandle(), width, widthMode, height, heightMode, &nodeSize);
+    DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode MeasureCallback executing on %s\n", actor.GetProperty<std::string>(Dali::Actor::Property::NAME).c_str());
+    mImpl->mMeasureCallback(actor, width, widthMode, height, heightMode, &nodeSize);
   }
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode nodeSize width:%f height:%f\n", nodeSize.width, nodeSize.height);
   return nodeSize;
@@ -174,8 +221,24 @@ SizeTuple Node::MeasureNode(float width, int widthMode, float height, int height
 
 void Node::CalculateLayout(float availableWidth, float availableHeight, bool isRTL)
 {
+  // Nothing in the tree changed since the last calculation so the current layout is still valid.
+  if(mImpl->mLayoutValid &&
+     !YGNodeIsDirty(mImpl->mYogaNode) &&
+     IsSameAvailableSize(mImpl->mLastAvailableWidth, availableWidth) &&
+     IsSameAvailableSize(mImpl->mLastAvailableHeight, availableHeight) &&
+     mImpl->mLastIsRTL == isRTL)
+  {
+    DALI_LOG_INFO(gLogFilter, Debug::General, "CalculateLayout availableSize(%f,%f) skipped, layout not dirty\n", availableWidth, availableHeight);
+    return;
+  }
+
   DALI_LOG_INFO(gLogFilter, Debug::General, "CalculateLayout availableSize(%f,%f)\n", availableWidth, availableHeight);
   YGNodeCalculateLayout(mImpl->mYogaNode, availableWidth, availableHeight, isRTL ? YGDirectionRTL : YGDirectionLTR);
+
+  mImpl->mLastAvailableWidth  = availableWidth;
+  mImpl->mLastAvailableHeight = availableHeight;
+  mImpl->mLastIsRTL           = isRTL;
+  mImpl->mLayoutValid         = true;
 }
 
 Dali::Vector4 Node::GetNodeFrame(int index) const
@@ -207,6 +270,8 @@ void Node::SetFlexDirection(Dali::Toolkit::Flex::FlexDirection flexDirection)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex direction[%d]\n", flexDirection);
 
   YGNodeStyleSetFlexDirection(mImpl->mYogaNode, static_cast<YGFlexDirection>(flexDirection));
+
+  MarkDirty();
 }
 
 Dali::Toolkit::Flex::FlexDirection Node::GetFlexDirection() const
@@ -219,6 +284,8 @@ void Node::SetFlexJustification(Dali::Toolkit::Flex::Justification flexJustifica
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex justification[%d]\n", flexJustification)
 
   YGNodeStyleSetJustifyContent(mImpl->mYogaNode, static_cast<YGJustify>(flexJustification));
+
+  MarkDirty();
 }
 
 Dali::Toolkit::Flex::Justification Node::GetFlexJustification() const
@@ -236,6 +303,8 @@ void Node::SetFlexAlignment(Dali::Toolkit::Flex::Alignment flexAlignment)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex alignment[%d]\n", flexAlignment)
 
   YGNodeStyleSetAlignContent(mImpl->mYogaNode, static_cast<YGAlign>(flexAlignment));
+
+  MarkDirty();
 }
 
 Dali::Toolkit::Flex::Alignment Node::GetFlexAlignment() const
@@ -248,6 +317,8 @@ void Node::SetFlexItemsAlignment(Dali::Toolkit::Flex::Alignment flexAlignment)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex items alignment[%d] on mYogaNode[%p]\n", flexAlignment, mImpl->mYogaNode)
 
   YGNodeStyleSetAlignItems(mImpl->mYogaNode, static_cast<YGAlign>(flexAlignment));
+
+  MarkDirty();
 }
 
 Dali::Toolkit::Flex::Alignment Node::GetFlexItemsAlignment() const
@@ -260,6 +331,8 @@ void Node::SetFlexAlignmentSelf(Dali::Toolkit::Flex::Alignment flexAlignmentSelf
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex alignment self [%d] on mYogaNode[%p]\n", flexAlignmentSelf, mImpl->mYogaNode)
 
   YGNodeStyleSetAlignSelf(mImpl->mYogaNode, static_cast<YGAlign>(flexAlignmentSelf));
+
+  MarkDirty();
 }
 
 Dali::Toolkit::Flex::Alignment Node::GetFlexAlignmentSelf() const
@@ -272,6 +345,8 @@ void Node::SetFlexPositionType(Dali::Toolkit::Flex::PositionType flexPositionTyp
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex position type [%d] on mYogaNode[%p]\n", flexPositionType, mImpl->mYogaNode)
 
   YGNodeStyleSetPositionType(mImpl->mYogaNode, static_cast<YGPositionType>(flexPositionType));
+
+  MarkDirty();
 }
 
 Dali::Toolkit::Flex::PositionType Node::GetFlexPositionType() const
@@ -284,6 +359,8 @@ void Node::SetFlexAspectRatio(float flexAspectRatio)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex aspect ratio [%d] on mYogaNode[%p]\n", flexAspectRatio, mImpl->mYogaNode)
 
   YGNodeStyleSetAspectRatio(mImpl->mYogaNode, static_cast<float>(flexAspectRatio));
+
+  MarkDirty();
 }
 
 float Node::GetFlexAspectRatio() const
@@ -296,6 +373,8 @@ void Node::SetFlexBasis(float flexBasis)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex basis [%d] on mYogaNode[%p]\n", flexBasis, mImpl->mYogaNode)
 
   YGNodeStyleSetFlexBasis(mImpl->mYogaNode, static_cast<float>(flexBasis));
+
+  MarkDirty();
 }
 
 float Node::GetFlexBasis() const
@@ -308,6 +387,8 @@ void Node::SetFlexShrink(float flexShrink)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex shrink [%d] on mYogaNode[%p]\n", flexShrink, mImpl->mYogaNode)
 
   YGNodeStyleSetFlexShrink(mImpl->mYogaNode, static_cast<float>(flexShrink));
+
+  MarkDirty();
 }
 
 float Node::GetFlexShrink() const
@@ -320,6 +401,8 @@ void Node::SetFlexGrow(float flexGrow)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex grow [%d] on mYogaNode[%p]\n", flexGrow, mImpl->mYogaNode)
 
   YGNodeStyleSetFlexGrow(mImpl->mYogaNode, static_cast<float>(flexGrow));
+
+  MarkDirty();
 }
 
 float Node::GetFlexGrow() const
@@ -351,6 +434,8 @@ void Node::SetMargin(Extents margin)
   YGNodeStyleSetMargin(mImpl->mYogaNode, YGEdgeTop, margin.top);
   YGNodeStyleSetMargin(mImpl->mYogaNode, YGEdgeRight, margin.end);
   YGNodeStyleSetMargin(mImpl->mYogaNode, YGEdgeBottom, margin.bottom);
+
+  MarkDirty();
 }
 
 void Node::SetPadding(Extents padding)
@@ -361,6 +446,8 @@ void Node::SetPadding(Extents padding)
   YGNodeStyleSetPadding(mImpl->mYogaNode, YGEdgeTop, padding.top);
   YGNodeStyleSetPadding(mImpl->mYogaNode, YGEdgeRight, padding.end);
   YGNodeStyleSetPadding(mImpl->mYogaNode, YGEdgeBottom, padding.bottom);
+
+  MarkDirty();
 }
 
 void Node::SetFlexWrap(Dali::Toolkit::Flex::WrapType wrapType)
@@ -368,6 +455,8 @@ void Node::SetFlexWrap(Dali::Toolkit::Flex::WrapType wrapType)
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Set flex wrap[%d] on mYogaNode[%p]\n", wrapType, mImpl->mYogaNode)
 
   YGNodeStyleSetFlexWrap(mImpl->mYogaNode, static_cast<YGWrap>(wrapType));
+
+  MarkDirty();
 }
 
 } // namespace Flex
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_LAYOUTING_FLEX_NODE_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -155,6 +155,22 @@ public:
    */
   void RemoveChild(Actor child);
 
+  /**
+   * @brief Mark the node as needing to be measured again.
+   *
+   * Re-reads the minimum and maximum size of its actor and invalidates the measure results Yoga cached for the node.
+   * Only the dirty node and its ancestors are re-measured by the next CalculateLayout.
+   * The child and style setters of the node call it.
+   * @note Call this whenever a size-affecting property of the child actor (e.g. its natural size) changes.
+   */
+  void MarkDirty();
+
+  /**
+   * @brief Whether the node or any of its descendants needs the layout to be calculated again.
+   * @return true if the next CalculateLayout will recalculate the layout.
+   */
+  bool IsDirty() const;
+
   /**
    * @brief Return the dimensions of the node.
    * @param[in] width width specification
@@ -167,6 +183,7 @@ public:
 
   /**
    * @brief Perform the layout measure calculations.
+   * Does nothing if the tree is not dirty and the parameters are the same as the last calculation.
    * @param[in] availableWidth Amount of space available for layout, width.
    * @param[in] availableHeight Amount of space available for layout, height.
    * @param[in] isRTL Is the direction of the layout right to left.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,6 +36,7 @@
 #include <dali-toolkit/internal/text/layouts/layout-parameters.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor.h>
 #include <dali-toolkit/internal/text/multi-language-support.h>
+#include <dali-toolkit/internal/text/rendering/pixel-kernels.h>
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 #include <dali-toolkit/internal/text/segmentation.h>
 #include <dali-toolkit/internal/text/shaper.h>
@@ -1347,41 +1348,26 @@ Devel::PixelBuffer ConvertToRgba8888(Devel::PixelBuffer pixelBuffer, const Vecto
   const unsigned int height         = pixelBuffer.GetHeight();
   Devel::PixelBuffer newPixelBuffer = Devel::PixelBuffer::New(width, height, Dali::Pixel::RGBA8888);
 
-  unsigned char*             dstBuffer = newPixelBuffer.GetBuffer();
+  uint32_t* const            dstBuffer = reinterpret_cast<uint32_t*>(newPixelBuffer.GetBuffer());
   const unsigned char* const srcBuffer = pixelBuffer.GetBuffer();
 
-  const unsigned char r = static_cast<unsigned char>(TO_UCHAR * color.r);
-  const unsigned char g = static_cast<unsigned char>(TO_UCHAR * color.g);
-  const unsigned char b = static_cast<unsigned char>(TO_UCHAR * color.b);
+  const Text::PixelKernels& kernels = Text::GetPixelKernels();
 
-  unsigned char dstColor[4];
-  for(unsigned int j = 0u; j < height; ++j)
+  if(multiplyByAlpha)
   {
-    const unsigned int lineIndex = j * width;
-    for(unsigned int i = 0u; i < width; ++i)
-    {
-      const unsigned int srcIndex = lineIndex + i;
+    const float colorComponents[4u] = {color.r, color.g, color.b, color.a};
+    kernels.expandAlphaMultiplied(srcBuffer, colorComponents, dstBuffer, width * height);
+  }
+  else
+  {
+    uint32_t       packedColor       = 0u;
+    unsigned char* packedColorBuffer = reinterpret_cast<unsigned char*>(&packedColor);
 
-      const float srcAlpha = static_cast<float>(*(srcBuffer + srcIndex));
+    packedColorBuffer[0u] = static_cast<unsigned char>(TO_UCHAR * color.r);
+    packedColorBuffer[1u] = static_cast<unsigned char>(TO_UCHAR * color.g);
+    packedColorBuffer[2u] = static_cast<unsigned char>(TO_UCHAR * color.b);
 
-      if(multiplyByAlpha)
-      {
-        dstColor[0u] = static_cast<unsigned char>(srcAlpha * color.r);
-        dstColor[1u] = static_cast<unsigned char>(srcAlpha * color.g);
-        dstColor[2u] = static_cast<unsigned char>(srcAlpha * color.b);
-        dstColor[3u] = static_cast<unsigned char>(srcAlpha * color.a);
-      }
-      else
-      {
-        dstColor[0u] = r;
-        dstColor[1u] = g;
-        dstColor[2u] = b;
-        dstColor[3u] = static_cast<unsigned char>(srcAlpha);
-      }
-
-      const unsigned int dstIndex = srcIndex * 4u;
-      memcpy(dstBuffer + dstIndex, dstColor, 4u);
-    }
+    kernels.expandAlpha(srcBuffer, packedColor, dstBuffer, width * height);
   }
 
   return newPixelBuffer;
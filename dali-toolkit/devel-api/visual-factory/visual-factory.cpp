@@ -111,6 +111,16 @@ Visual::Base VisualFactory::CreateVisual(const std::string& url, ImageDimensions
   return GetImplementation(*this).CreateVisual(url, size, creationOptions);
 }
 
+Visual::Base VisualFactory::CreateVisual(const VisualPrototype& prototype)
+{
+  return GetImplementation(*this).CreateVisual(prototype, Property::Map());
+}
+
+Visual::Base VisualFactory::CreateVisual(const VisualPrototype& prototype, const Property::Map& overrides)
+{
+  return GetImplementation(*this).CreateVisual(prototype, overrides);
+}
+
 void VisualFactory::SetPreMultiplyOnLoad(bool preMultiply)
 {
   GetImplementation(*this).SetPreMultiplyOnLoad(preMultiply);
@@ -141,6 +151,21 @@ void VisualFactory::UsePreCompiledShader()
   GetImplementation(*this).UsePreCompiledShader();
 }
 
+void VisualFactory::UsePreCompiledShader(const std::vector<std::string>& shaderNames)
+{
+  GetImplementation(*this).UsePreCompiledShader(shaderNames);
+}
+
+void VisualFactory::EnableShaderUsageLog(bool enable)
+{
+  GetImplementation(*this).EnableShaderUsageLog(enable);
+}
+
+std::vector<std::string> VisualFactory::GetShaderUsageLog() const
+{
+  return GetImplementation(*this).GetShaderUsageLog();
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
@@ -19,12 +19,15 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/public-api/object/base-handle.h>
 #include <dali/public-api/object/property-map.h>
+#include <string>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-prototype.h>
 
 namespace Dali
 {
@@ -134,6 +137,24 @@ public:
    */
   Visual::Base CreateVisual(const std::string& url, ImageDimensions size, CreationOptions creationOptions);
 
+  /**
+   * @brief Request the visual of a prototype
+   *
+   * This is faster than requesting the visual with the property map of the prototype, as the prototype has parsed it.
+   * @param[in] prototype The prototype of the visual
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualPrototype& prototype);
+
+  /**
+   * @brief Request the visual of a prototype with some of its properties overridden
+   *
+   * @param[in] prototype The prototype of the visual
+   * @param[in] overrides The properties of this visual which differ from the prototype, e.g. the url of the image
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualPrototype& prototype, const Property::Map& overrides);
+
   /**
    * @brief Enable or disable premultiplying alpha in images and image visuals.
    *
@@ -185,6 +206,36 @@ public:
    */
   void UsePreCompiledShader();
 
+  /**
+   * @brief Compile the given visual shaders in advance, in the given order.
+   *
+   * Only the given shaders are compiled, so that the application can precompile exactly the shaders it uses,
+   * e.g. the ones retrieved by GetShaderUsageLog() in a previous run.
+   * The shaders which cannot be precompiled, e.g. the native image shaders, are skipped.
+   *
+   * @note It is recommended that this method be called at the top of the application code.
+   * @note Either this method or UsePreCompiledShader() takes effect, whichever is called first.
+   * @param[in] shaderNames The names of the shaders, in the order of their priority
+   */
+  void UsePreCompiledShader(const std::vector<std::string>& shaderNames);
+
+  /**
+   * @brief Enable or disable the log of the visual shaders used.
+   *
+   * While enabled, the name of each visual shader created is logged, in the order of their first use.
+   * The log is enabled from the start if the DALI_SHADER_USAGE_LOG environment variable is set to 1.
+   *
+   * @param[in] enable True to enable the log
+   */
+  void EnableShaderUsageLog(bool enable);
+
+  /**
+   * @brief Retrieve the names of the visual shaders used while the log is enabled, in the order of their first use.
+   *
+   * @return The names of the shaders, which can be given to UsePreCompiledShader()
+   */
+  std::vector<std::string> GetShaderUsageLog() const;
+
 private:
   explicit DALI_INTERNAL VisualFactory(Internal::VisualFactory* impl);
 };
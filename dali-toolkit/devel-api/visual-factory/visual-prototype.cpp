@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/devel-api/visual-factory/visual-prototype.h>
+#include <dali-toolkit/internal/visuals/visual-prototype-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+VisualPrototype::VisualPrototype()
+{
+}
+
+VisualPrototype::~VisualPrototype()
+{
+}
+
+VisualPrototype VisualPrototype::New(const Property::Map& propertyMap)
+{
+  Internal::VisualPrototypePtr prototype = Internal::VisualPrototype::New(propertyMap);
+  return VisualPrototype(prototype.Get());
+}
+
+VisualPrototype VisualPrototype::DownCast(BaseHandle handle)
+{
+  return VisualPrototype(dynamic_cast<Dali::Toolkit::Internal::VisualPrototype*>(handle.GetObjectPtr()));
+}
+
+VisualPrototype::VisualPrototype(const VisualPrototype& handle)
+: BaseHandle(handle)
+{
+}
+
+VisualPrototype& VisualPrototype::operator=(const VisualPrototype& handle)
+{
+  BaseHandle::operator=(handle);
+  return *this;
+}
+
+const Property::Map& VisualPrototype::GetPropertyMap() const
+{
+  return GetImplementation(*this).GetSourceProperties();
+}
+
+VisualPrototype::VisualPrototype(Internal::VisualPrototype* pointer)
+: BaseHandle(pointer)
+{
+}
+
+} // namespace Toolkit
+} // namespace Dali
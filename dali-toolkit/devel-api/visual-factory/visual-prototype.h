@@ -0,0 +1,113 @@
+#ifndef DALI_TOOLKIT_VISUAL_PROTOTYPE_H
+#define DALI_TOOLKIT_VISUAL_PROTOTYPE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal DALI_INTERNAL
+{
+class VisualPrototype;
+}
+
+/**
+ * @brief A VisualPrototype is a property map of a visual which is parsed once, to create many visuals.
+ *
+ * The visual type, the url and its kind are resolved when the prototype is created, and the string keys and
+ * enumeration strings of the color and image visuals are converted to their indices and values, so that
+ * VisualFactory::CreateVisual( const VisualPrototype& ) does not look them up for each visual.
+ * The prototype cannot be changed once created; the properties that differ between the visuals are given
+ * as overrides when each visual is created.
+ *
+ * @code
+ * VisualPrototype prototype = VisualPrototype::New( Property::Map().Add( Visual::Property::TYPE, Visual::IMAGE )
+ *                                                                  .Add( ImageVisual::Property::URL, "icon.png" )
+ *                                                                  .Add( "fittingMode", "SCALE_TO_FILL" ) );
+ * Visual::Base visual = VisualFactory::Get().CreateVisual( prototype );
+ * Visual::Base other  = VisualFactory::Get().CreateVisual( prototype, Property::Map().Add( ImageVisual::Property::URL, "other.png" ) );
+ * @endcode
+ */
+class DALI_TOOLKIT_API VisualPrototype : public BaseHandle
+{
+public:
+  /**
+   * @brief Create an uninitialized handle
+   */
+  VisualPrototype();
+
+  /**
+   * @brief Destructor - non virtual
+   */
+  ~VisualPrototype();
+
+  /**
+   * @brief Creates a VisualPrototype object
+   *
+   * @param[in] propertyMap The properties of the visual, as given to VisualFactory::CreateVisual( const Property::Map& )
+   * @return A handle to an initialized prototype.
+   */
+  static VisualPrototype New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Downcast to a VisualPrototype handle
+   *
+   * If handle is not a VisualPrototype, the returned handle is left uninitialized.
+   * @param[in] handle Handle to an object
+   * @return VisualPrototype handle or an uninitialized handle.
+   */
+  static VisualPrototype DownCast(BaseHandle handle);
+
+  /**
+   * @brief Copy constructor
+   *
+   * @param[in] handle Handle to an object
+   */
+  VisualPrototype(const VisualPrototype& handle);
+
+  /**
+   * @brief Assignment Operator
+   *
+   * @param[in] handle Handle to an object
+   * @return A reference to this object.
+   */
+  VisualPrototype& operator=(const VisualPrototype& handle);
+
+  /**
+   * @brief Retrieves the properties the prototype was created with.
+   *
+   * @return The property map given to New()
+   */
+  const Property::Map& GetPropertyMap() const;
+
+public: // Not intended for application developers
+  explicit DALI_INTERNAL VisualPrototype(Internal::VisualPrototype* impl);
+};
+
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_VISUAL_PROTOTYPE_H
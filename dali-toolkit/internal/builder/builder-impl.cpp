@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <sys/stat.h>
+#include <algorithm>
 #include <sstream>
 
 #include <dali-toolkit/devel-api/controls/control-devel.h>
@@ -29,6 +30,7 @@
 #include <dali/public-api/actors/camera-actor.h>
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/object/property-array.h>
+#include <dali/public-api/object/property-index-ranges.h>
 #include <dali/public-api/object/type-info.h>
 #include <dali/public-api/object/type-registry.h>
 #include <dali/public-api/render-tasks/render-task-list.h>
@@ -45,6 +47,9 @@
 #include <dali-toolkit/internal/builder/builder-get-is.inl.h>
 #include <dali-toolkit/internal/builder/builder-impl-debug.h>
 #include <dali-toolkit/internal/builder/builder-set-property.h>
+#include <dali-toolkit/internal/builder/json-parser-impl.h>
+#include <dali-toolkit/internal/builder/json-section-index.h>
+#include <dali-toolkit/internal/builder/property-batch.h>
 #include <dali-toolkit/internal/builder/replacement.h>
 #include <dali-toolkit/internal/builder/tree-node-manipulator.h>
 
@@ -71,6 +76,7 @@ namespace
 #define TOKEN_STRING(x) #x
 
 const char* KEYNAME_ACTORS           = "actors";
+const char* KEYNAME_ANIMATIONS       = "animations";
 const char* KEYNAME_ENTRY_TRANSITION = "entryTransition";
 const char* KEYNAME_EXIT_TRANSITION  = "exitTransition";
 const char* KEYNAME_INCLUDES         = "includes";
@@ -87,7 +93,8 @@ const char* KEYNAME_VISUALS          = "visuals";
 const char* PROPERTIES            = "properties";
 const char* ANIMATABLE_PROPERTIES = "animatableProperties";
 
-typedef std::vector<const TreeNode*> TreeNodeList;
+// The sections deferred by lazy parsing, in the order of Builder::DeferredSection
+const std::vector<const char*> DEFERRED_SECTION_NAMES = {KEYNAME_STYLES, KEYNAME_TEMPLATES, KEYNAME_ANIMATIONS};
 
 bool GetMappingKey(const std::string& str, std::string& key)
 {
@@ -107,45 +114,12 @@ bool GetMappingKey(const std::string& str, std::string& key)
   return result;
 }
 
-/*
- * Recursively collects all styles in a node (An array of style names).
- *
- * stylesCollection The set of styles from the json file (a json object of named styles)
- * style The style array to begin the collection from
- * styleList The style list to add nodes to apply
- */
-void CollectAllStyles(const TreeNode& stylesCollection, const TreeNode& style, TreeNodeList& styleList)
-{
-  // style is an array of style names
-  if(TreeNode::ARRAY == style.GetType())
-  {
-    for(TreeNode::ConstIterator iter = style.CBegin(); iter != style.CEnd(); ++iter)
-    {
-      if(OptionalString styleName = IsString((*iter).second))
-      {
-        if(OptionalChild node = IsChildIgnoreCase(stylesCollection, *styleName))
-        {
-          styleList.push_back(&(*node));
-
-          OptionalChild subStyle = IsChild(*node, KEYNAME_INHERIT);
-          if(!subStyle)
-          {
-            subStyle = IsChild(*node, KEYNAME_STYLES);
-          }
-          if(subStyle)
-          {
-            CollectAllStyles(stylesCollection, *subStyle, styleList);
-          }
-        }
-      }
-    }
-  }
-}
-
 } // namespace
 
 Builder::Builder()
-: mSlotDelegate(this)
+: mSlotDelegate(this),
+  mStyleIndexValid(false),
+  mLazyParsing(false)
 {
   mParser = Dali::Toolkit::JsonParser::New();
 
@@ -162,6 +136,19 @@ Builder::Builder()
 }
 
 void Builder::LoadFromString(std::string const& data, Dali::Toolkit::Builder::UIFormat format)
+{
+  if(mLazyParsing && LoadJsonLazily(data))
+  {
+    return;
+  }
+
+  // Keep the order in which the documents are merged
+  ParseAllDeferred();
+
+  LoadJson(data);
+}
+
+void Builder::LoadJson(const std::string& data)
 {
   // parser to get constants and includes only
   Dali::Toolkit::JsonParser parser = Dali::Toolkit::JsonParser::New();
@@ -177,33 +164,12 @@ void Builder::LoadFromString(std::string const& data, Dali::Toolkit::Builder::UI
   }
   else
   {
-    // load constant map (allows the user to override the constants in the json after loading)
-    LoadConstants(*parser.GetRoot(), mReplacementMap);
-    // load configuration map
-    LoadConfiguration(*parser.GetRoot(), mConfigurationMap);
-    // merge includes
-    if(OptionalChild includes = IsChild(*parser.GetRoot(), KEYNAME_INCLUDES))
-    {
-      Replacement replacer(mReplacementMap);
-
-      for(TreeNode::ConstIterator iter = (*includes).CBegin(); iter != (*includes).CEnd(); ++iter)
-      {
-        OptionalString filename = replacer.IsString((*iter).second);
-
-        if(filename)
-        {
-#if defined(DEBUG_ENABLED)
-          DALI_SCRIPT_VERBOSE("Loading Include '%s'\n", (*filename).c_str());
-#endif
-          LoadFromString(GetFileContents(*filename));
-        }
-      }
-    }
+    LoadConstantsAndIncludes(*parser.GetRoot());
 
     if(mParser.Parse(data))
     {
       // Drop the styles and get them to be rebuilt against the new parse tree as required.
-      mStyles.Clear();
+      ClearStyles();
     }
     else
     {
@@ -222,6 +188,198 @@ void Builder::LoadFromString(std::string const& data, Dali::Toolkit::Builder::UI
   DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Cannot parse JSON");
 }
 
+bool Builder::LoadFromCompiled(const char* data, std::size_t size)
+{
+  ParseAllDeferred();
+
+  // parser to get constants and includes only
+  Dali::Toolkit::JsonParser parser = Dali::Toolkit::JsonParser::New();
+
+  if(!GetImplementation(parser).ParseCompiled(data, size))
+  {
+    DALI_LOG_WARNING("Compiled JSON Parse Error:'%s'\n", parser.GetErrorDescription().c_str());
+    return false;
+  }
+
+  LoadConstantsAndIncludes(*parser.GetRoot());
+
+  if(GetImplementation(mParser).ParseCompiled(data, size))
+  {
+    // Drop the styles and get them to be rebuilt against the new parse tree as required.
+    ClearStyles();
+  }
+  else
+  {
+    DALI_LOG_WARNING("Compiled JSON Parse Error:'%s'\n", mParser.GetErrorDescription().c_str());
+
+    DALI_ASSERT_ALWAYS(!"Cannot parse compiled JSON");
+  }
+
+  DUMP_PARSE_TREE(mParser);
+  DUMP_TEST_MAPPINGS(mParser);
+
+  return true;
+}
+
+void Builder::LoadConstantsAndIncludes(const TreeNode& root)
+{
+  // load constant map (allows the user to override the constants in the json after loading)
+  LoadConstants(root, mReplacementMap);
+  // load configuration map
+  LoadConfiguration(root, mConfigurationMap);
+  // merge includes
+  if(OptionalChild includes = IsChild(root, KEYNAME_INCLUDES))
+  {
+    Replacement replacer(mReplacementMap);
+
+    for(TreeNode::ConstIterator iter = (*includes).CBegin(); iter != (*includes).CEnd(); ++iter)
+    {
+      OptionalString filename = replacer.IsString((*iter).second);
+
+      if(filename)
+      {
+#if defined(DEBUG_ENABLED)
+        DALI_SCRIPT_VERBOSE("Loading Include '%s'\n", (*filename).c_str());
+#endif
+        LoadFromString(GetFileContents(*filename));
+      }
+    }
+  }
+}
+
+bool Builder::LoadJsonLazily(const std::string& data)
+{
+  JsonSectionMembers members;
+  std::string        remainder;
+
+  if(!IndexJsonSections(data, DEFERRED_SECTION_NAMES, members, remainder))
+  {
+    return false;
+  }
+
+  // The includes are loaded by the rest of the JSON, so their members are merged before the members of this JSON.
+  LoadJson(remainder);
+
+  if(!members.empty())
+  {
+    const std::size_t source = mDeferredSources.size();
+    mDeferredSources.push_back(data);
+
+    for(JsonSectionMember& member : members)
+    {
+      if(member.section == DEFERRED_STYLES)
+      {
+        // Styles are found ignoring the case of their names
+        std::transform(member.name.begin(), member.name.end(), member.name.begin(), ::tolower);
+      }
+      mDeferredMembers[member.section][member.name].push_back({source, member.begin, member.end});
+    }
+  }
+
+  return true;
+}
+
+bool Builder::ParseDeferred(DeferredSection section, const std::string& name)
+{
+  DeferredMembers::iterator iter = mDeferredMembers[section].find(name);
+  if(iter == mDeferredMembers[section].end())
+  {
+    return false;
+  }
+
+  std::vector<DeferredMember> members;
+  members.swap(iter->second);
+  mDeferredMembers[section].erase(iter);
+
+  for(const DeferredMember& member : members)
+  {
+    ParseDeferredMember(section, member);
+  }
+
+  if(section == DEFERRED_STYLES)
+  {
+    mStyleIndexValid = false;
+  }
+
+  if(std::all_of(mDeferredMembers, mDeferredMembers + DEFERRED_SECTION_COUNT, [](const DeferredMembers& deferred) { return deferred.empty(); }))
+  {
+    mDeferredSources.clear();
+  }
+
+  return true;
+}
+
+void Builder::ParseAllDeferred()
+{
+  if(mDeferredSources.empty())
+  {
+    return;
+  }
+
+  std::vector<std::pair<DeferredSection, DeferredMember>> members;
+  for(int section = 0; section < DEFERRED_SECTION_COUNT; ++section)
+  {
+    for(const auto& named : mDeferredMembers[section])
+    {
+      for(const DeferredMember& member : named.second)
+      {
+        members.push_back({static_cast<DeferredSection>(section), member});
+      }
+    }
+    mDeferredMembers[section].clear();
+  }
+
+  std::sort(members.begin(), members.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second.source < rhs.second.source || (lhs.second.source == rhs.second.source && lhs.second.begin < rhs.second.begin);
+  });
+
+  for(const auto& member : members)
+  {
+    ParseDeferredMember(member.first, member.second);
+  }
+
+  mDeferredSources.clear();
+  mStyleIndexValid = false;
+}
+
+void Builder::ParseDeferredMember(DeferredSection section, const DeferredMember& member)
+{
+  const std::string& source = mDeferredSources[member.source];
+
+  std::string json;
+  json.reserve(member.end - member.begin + 32u);
+  json.append("{\"").append(DEFERRED_SECTION_NAMES[section]).append("\":{");
+  json.append(source, member.begin, member.end - member.begin);
+  json.append("}}");
+
+  // Check the member alone first, as a failed parse would drop the tree it is merged into.
+  Dali::Toolkit::JsonParser parser = Dali::Toolkit::JsonParser::New();
+  if(parser.Parse(json))
+  {
+    mParser.Parse(json);
+  }
+  else
+  {
+    DALI_LOG_WARNING("JSON Parse Error:%d:%d:'%s' in the %s section\n",
+                     parser.GetErrorLineNumber(),
+                     parser.GetErrorColumn(),
+                     parser.GetErrorDescription().c_str(),
+                     DEFERRED_SECTION_NAMES[section]);
+  }
+}
+
+void Builder::SetLazyParsing(bool lazy)
+{
+  mLazyParsing = lazy;
+}
+
+void Builder::ClearStyles()
+{
+  mStyles.Clear();
+  mStyleIndex.clear();
+  mStyleIndexValid = false;
+}
+
 void Builder::AddConstants(const Property::Map& map)
 {
   mReplacementMap.Merge(map);
@@ -306,6 +464,8 @@ BaseHandle Builder::CreateFromJson(const std::string& json)
 
   if(mParser.Parse(newTemplate))
   {
+    mStyleIndexValid = false;
+
     Replacement replacement(mReplacementMap);
     ret = Create("@temp@", replacement);
   }
@@ -325,6 +485,8 @@ bool Builder::ApplyFromJson(Handle& handle, const std::string& json)
 
   if(mParser.Parse(newStyle))
   {
+    mStyleIndexValid = false;
+
     Replacement replacement(mReplacementMap);
     ret = ApplyStyle("@temp@", handle, replacement);
   }
@@ -340,16 +502,7 @@ bool Builder::ApplyStyle(const std::string& styleName, Handle& handle)
 
 bool Builder::LookupStyleName(const std::string& styleName)
 {
-  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
-
-  OptionalChild styles = IsChild(*mParser.GetRoot(), KEYNAME_STYLES);
-  OptionalChild style  = IsChildIgnoreCase(*styles, styleName);
-
-  if(styles && style)
-  {
-    return true;
-  }
-  return false;
+  return FindStyle(styleName) != NULL;
 }
 
 const StylePtr Builder::GetStyle(const std::string& styleName)
@@ -867,7 +1020,9 @@ Animation Builder::CreateAnimation(const std::string& animationName, const Repla
 
   Animation anim;
 
-  if(OptionalChild animations = IsChild(*mParser.GetRoot(), "animations"))
+  ParseDeferred(DEFERRED_ANIMATIONS, animationName);
+
+  if(OptionalChild animations = IsChild(*mParser.GetRoot(), KEYNAME_ANIMATIONS))
   {
     if(OptionalChild animation = IsChild(*animations, animationName))
     {
@@ -892,6 +1047,8 @@ BaseHandle Builder::Create(const std::string& templateName, const Replacement& c
 
   BaseHandle baseHandle;
 
+  ParseDeferred(DEFERRED_TEMPLATES, templateName);
+
   OptionalChild templates = IsChild(*mParser.GetRoot(), KEYNAME_TEMPLATES);
 
   if(!templates)
@@ -941,6 +1098,8 @@ BaseHandle Builder::DoCreate(const TreeNode& root, const TreeNode& node, Actor p
     if(!typeInfo)
     {
       // a template name is also allowed inplace of the type name
+      ParseDeferred(DEFERRED_TEMPLATES, *typeName);
+
       OptionalChild templates = IsChild(root, KEYNAME_TEMPLATES);
 
       if(templates)
@@ -1091,14 +1250,9 @@ void Builder::SetupTask(RenderTask& task, const TreeNode& node, const Replacemen
 
 bool Builder::ApplyStyle(const std::string& styleName, Handle& handle, const Replacement& replacement)
 {
-  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
-
-  OptionalChild styles = IsChild(*mParser.GetRoot(), KEYNAME_STYLES);
+  const TreeNode* style = FindStyle(styleName);
 
-  std::string   styleNameLower(styleName);
-  OptionalChild style = IsChildIgnoreCase(*styles, styleNameLower);
-
-  if(styles && style)
+  if(style)
   {
     ApplyAllStyleProperties(*mParser.GetRoot(), *style, handle, replacement);
     return true;
@@ -1109,18 +1263,109 @@ bool Builder::ApplyStyle(const std::string& styleName, Handle& handle, const Rep
   }
 }
 
+const TreeNode* Builder::FindStyle(const std::string& styleName)
+{
+  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
+
+  std::string name(styleName);
+  std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+  ParseDeferred(DEFERRED_STYLES, name);
+
+  if(!mStyleIndexValid)
+  {
+    mStyleIndex.clear();
+
+    OptionalChild styles = IsChild(*mParser.GetRoot(), KEYNAME_STYLES);
+    if(styles)
+    {
+      for(TreeNode::ConstIterator iter = (*styles).CBegin(); iter != (*styles).CEnd(); ++iter)
+      {
+        const TreeNode& style = (*iter).second;
+        if(style.GetName())
+        {
+          std::string name(style.GetName());
+          std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+          // Keep the first of the styles whose names differ only in case, as GetChildIgnoreCase() does.
+          mStyleIndex.emplace(std::move(name), &style);
+        }
+      }
+    }
+    mStyleIndexValid = true;
+  }
+
+  StyleIndex::const_iterator iter = mStyleIndex.find(name);
+  return iter != mStyleIndex.end() ? iter->second : NULL;
+}
+
+void Builder::ApplyStyle(const TreeNode& styleNode, StylePtr& style, Handle& handle)
+{
+  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
+
+  Replacement replacer(mReplacementMap);
+  ApplyAllStyleProperties(*mParser.GetRoot(), styleNode, handle, replacer, style);
+}
+
+void Builder::ParseDeferredAnimation(const std::string& animationName)
+{
+  ParseDeferred(DEFERRED_ANIMATIONS, animationName);
+}
+
+/*
+ * Recursively collects all styles in a node (An array of style names).
+ *
+ * style The style array to begin the collection from
+ * styleList The style list to add nodes to apply
+ */
+void Builder::CollectAllStyles(const TreeNode& style, TreeNodeList& styleList)
+{
+  // style is an array of style names
+  if(TreeNode::ARRAY == style.GetType())
+  {
+    for(TreeNode::ConstIterator iter = style.CBegin(); iter != style.CEnd(); ++iter)
+    {
+      if(OptionalString styleName = IsString((*iter).second))
+      {
+        if(const TreeNode* node = FindStyle(*styleName))
+        {
+          styleList.push_back(node);
+
+          OptionalChild subStyle = IsChild(*node, KEYNAME_INHERIT);
+          if(!subStyle)
+          {
+            subStyle = IsChild(*node, KEYNAME_STYLES);
+          }
+          if(subStyle)
+          {
+            CollectAllStyles(*subStyle, styleList);
+          }
+        }
+      }
+    }
+  }
+}
+
 void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node, Dali::Handle& handle, const Replacement& constant)
+{
+  StylePtr recordedStyle;
+  ApplyAllStyleProperties(root, node, handle, constant, recordedStyle);
+}
+
+void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node, Dali::Handle& handle, const Replacement& constant, StylePtr& recordedStyle)
 {
   const char* styleName = node.GetName();
 
-  StylePtr style = Style::New();
+  StylePtr style;
 
-  StylePtr* matchedStyle = NULL;
-  if(styleName)
+  StylePtr* matchedStyle = recordedStyle ? &recordedStyle : NULL;
+  if(styleName && !matchedStyle)
   {
     matchedStyle = mStyles.Find(styleName);
     if(!matchedStyle)
     {
+      style = Style::New();
+
       OptionalChild styleNodes      = IsChild(root, KEYNAME_STYLES);
       OptionalChild inheritFromNode = IsChild(node, KEYNAME_INHERIT);
       if(!inheritFromNode)
@@ -1134,7 +1379,7 @@ void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node
         {
           TreeNodeList additionalStyleNodes;
 
-          CollectAllStyles(*styleNodes, *inheritFromNode, additionalStyleNodes);
+          CollectAllStyles(*inheritFromNode, additionalStyleNodes);
 
 #if defined(DEBUG_ENABLED)
           for(TreeNode::ConstIterator iter = (*inheritFromNode).CBegin(); iter != (*inheritFromNode).CEnd(); ++iter)
@@ -1164,9 +1409,10 @@ void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node
 
   if(matchedStyle)
   {
-    StylePtr                  style(*matchedStyle);
+    recordedStyle = *matchedStyle;
+
     Dictionary<Property::Map> instancedProperties;
-    style->ApplyVisualsAndPropertiesRecursively(handle, instancedProperties);
+    recordedStyle->ApplyVisualsAndPropertiesRecursively(handle, instancedProperties);
   }
   else // If there were no styles, instead set properties
   {
@@ -1275,15 +1521,7 @@ void Builder::RecordStyle(StylePtr           style,
       Property::Value value;
       if(MapToTargetProperty(handle, key, keyValue.second, replacements, index, value))
       {
-        Property::Value* existingValuePtr = style->properties.Find(index);
-        if(existingValuePtr != NULL)
-        {
-          *existingValuePtr = value; // Overwrite existing property.
-        }
-        else
-        {
-          style->properties.Add(index, value);
-        }
+        style->properties.Add(index, value); // Overwrites an existing property.
       }
     }
   }
@@ -1402,6 +1640,13 @@ void Builder::SetProperties(const TreeNode& node, Handle& handle, const Replacem
 {
   if(handle)
   {
+    // Add custom properties first, so the keys of the node can be mapped to them
+    SetCustomProperties(node, handle, constant, PROPERTIES, Property::READ_WRITE);
+    SetCustomProperties(node, handle, constant, ANIMATABLE_PROPERTIES, Property::ANIMATABLE);
+
+    PropertyBatch batch;
+    batch.Reserve(node.Size());
+
     for(TreeNode::ConstIterator iter = node.CBegin(); iter != node.CEnd(); ++iter)
     {
       const TreeNode::KeyNodePair& keyChild = *iter;
@@ -1419,7 +1664,9 @@ void Builder::SetProperties(const TreeNode& node, Handle& handle, const Replacem
          key == KEYNAME_VISUALS ||
          key == KEYNAME_ENTRY_TRANSITION ||
          key == KEYNAME_EXIT_TRANSITION ||
-         key == KEYNAME_TRANSITIONS)
+         key == KEYNAME_TRANSITIONS ||
+         key == PROPERTIES ||
+         key == ANIMATABLE_PROPERTIES)
       {
         continue;
       }
@@ -1432,14 +1679,11 @@ void Builder::SetProperties(const TreeNode& node, Handle& handle, const Replacem
       {
         DALI_SCRIPT_VERBOSE("SetProperty '%s' Index=:%d Value Type=%d Value '%s'\n", key.c_str(), index, value.GetType(), PropertyValueToString(value).c_str());
 
-        handle.SetProperty(index, value);
+        batch.Add(index, value);
       }
-
-      // Add custom properties
-      SetCustomProperties(node, handle, constant, PROPERTIES, Property::READ_WRITE);
-      SetCustomProperties(node, handle, constant, ANIMATABLE_PROPERTIES, Property::ANIMATABLE);
-
     } // for property nodes
+
+    batch.Apply(handle);
   }
   else
   {
@@ -1455,13 +1699,12 @@ bool Builder::MapToTargetProperty(
   Property::Index&   index,
   Property::Value&   value)
 {
-  bool mapped = false;
+  bool           mapped = false;
+  Property::Type type   = Property::NONE;
 
-  index = propertyObject.GetPropertyIndex(key);
+  index = mPropertyIndexCache.GetPropertyIndex(propertyObject, key, type);
   if(Property::INVALID_INDEX != index)
   {
-    Property::Type type = propertyObject.GetPropertyType(index);
-
     // if node.value is a mapping, get the property value from the "mappings" table
     if(node.GetType() == TreeNode::STRING)
     {
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_INTERNAL_BUILDER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,11 +28,13 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/builder/builder.h>
 #include <dali-toolkit/devel-api/builder/json-parser.h>
 #include <dali-toolkit/internal/builder/builder-declarations.h>
+#include <dali-toolkit/internal/builder/property-batch.h>
 #include <dali-toolkit/internal/builder/style.h>
 
 // Warning messages usually displayed
@@ -79,6 +81,19 @@ public:
   void LoadFromString(const std::string&               data,
                       Dali::Toolkit::Builder::UIFormat rep = Dali::Toolkit::Builder::JSON);
 
+  /**
+   * Loads a JSON file compiled by the theme compiler, as LoadFromString() loads the JSON.
+   * @param[in] data The compiled file
+   * @param[in] size The size of the file
+   * @return true if the file is a valid compiled file and has been loaded
+   */
+  bool LoadFromCompiled(const char* data, std::size_t size);
+
+  /**
+   * @copydoc Toolkit::Builder::SetLazyParsing
+   */
+  void SetLazyParsing(bool lazy);
+
   /**
    * @copydoc Toolkit::Builder::AddConstants
    */
@@ -167,6 +182,30 @@ public:
    */
   const StylePtr GetStyle(const std::string& styleName);
 
+  /**
+   * Finds a style in the parse tree, ignoring the case of its name.
+   * The styles are indexed by the first search after each parse, so a search is a hash lookup.
+   * With lazy parsing, the style is parsed by the first search for it.
+   * @param[in] styleName The style name to search for
+   * @return The node of the style, or NULL if there is no such style. It is valid until more JSON is parsed.
+   */
+  const TreeNode* FindStyle(const std::string& styleName);
+
+  /**
+   * Applies a style found with FindStyle().
+   * @param[in] styleNode The node of the style
+   * @param[in,out] style The recorded style. If it is empty, it is set to the style recorded from the node,
+   * so the next call does not need to search the recorded styles.
+   * @param[in] handle The handle to apply the style to
+   */
+  void ApplyStyle(const TreeNode& styleNode, StylePtr& style, Handle& handle);
+
+  /**
+   * Parses an animation whose parsing was deferred by lazy parsing, so it can be found in the parse tree.
+   * @param[in] animationName The name of the animation
+   */
+  void ParseDeferredAnimation(const std::string& animationName);
+
   /**
    * @copydoc Toolkit::Builder::AddActors
    */
@@ -274,11 +313,23 @@ private:
                   Handle&            handle,
                   const Replacement& replacement);
 
+  void LoadJson(const std::string& data);
+
+  void LoadConstantsAndIncludes(const TreeNode& root);
+
+  void ClearStyles();
+
   void ApplyAllStyleProperties(const TreeNode&    root,
                                const TreeNode&    node,
                                Dali::Handle&      handle,
                                const Replacement& constant);
 
+  void ApplyAllStyleProperties(const TreeNode&    root,
+                               const TreeNode&    node,
+                               Dali::Handle&      handle,
+                               const Replacement& constant,
+                               StylePtr&          recordedStyle);
+
   void RecordStyles(const char*        styleName,
                     const TreeNode&    node,
                     Dali::Handle&      handle,
@@ -372,7 +423,56 @@ private:
                          KeyStack&        keyStack,
                          Property::Value& value);
 
+  typedef std::vector<const TreeNode*> TreeNodeList;
+
+  void CollectAllStyles(const TreeNode& style, TreeNodeList& styleList);
+
+  /**
+   * The sections whose members are parsed when they are first used, with lazy parsing.
+   */
+  enum DeferredSection
+  {
+    DEFERRED_STYLES,
+    DEFERRED_TEMPLATES,
+    DEFERRED_ANIMATIONS,
+    DEFERRED_SECTION_COUNT
+  };
+
+  /**
+   * Where a deferred member is in mDeferredSources.
+   */
+  struct DeferredMember
+  {
+    std::size_t source;
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  /**
+   * Indexes the sections of the JSON, and parses the rest of it.
+   * @return false if the JSON cannot be indexed, and must be parsed whole
+   */
+  bool LoadJsonLazily(const std::string& data);
+
+  /**
+   * Parses the members deferred of the given name, in the order they were loaded.
+   * @param[in] section The section of the member
+   * @param[in] name The name of the member; in lower case for the styles
+   * @return true if any member was parsed
+   */
+  bool ParseDeferred(DeferredSection section, const std::string& name);
+
+  /**
+   * Parses all the deferred members, in the order they were loaded.
+   */
+  void ParseAllDeferred();
+
+  void ParseDeferredMember(DeferredSection section, const DeferredMember& member);
+
 private:
+  using StyleIndex      = std::unordered_map<std::string, const TreeNode*>;
+  using DeferredMembers = std::unordered_map<std::string, std::vector<DeferredMember>>;
+
   Toolkit::JsonParser                 mParser;
   PathLut                             mPathLut;
   PathConstrainerLut                  mPathConstrainerLut;
@@ -382,6 +482,12 @@ private:
   Property::Map                       mConfigurationMap;
   MappingsLut                         mCompleteMappings;
   Dictionary<StylePtr>                mStyles; // State based styles
+  StyleIndex                          mStyleIndex; // Style nodes keyed by their lower case names
+  bool                                mStyleIndexValid;
+  std::vector<std::string>            mDeferredSources; // The JSON whose members are still to be parsed
+  DeferredMembers                     mDeferredMembers[DEFERRED_SECTION_COUNT]; // Keyed by member name
+  bool                                mLazyParsing;
+  PropertyIndexCache                  mPropertyIndexCache; // The property indices resolved for each type
   Toolkit::Builder::BuilderSignalType mQuitSignal;
 };
 
@@ -514,8 +514,13 @@ void SetActionOnSignal(const TreeNode& root, const TreeNode& child, Actor actor,
   }
   else if("play" == *actionName)
   {
-    OptionalChild  animations    = IsChild(root, "animations");
     OptionalString animationName = IsString(IsChild(child, "animation"));
+    if(animationName && builder)
+    {
+      builder->ParseDeferredAnimation(*animationName);
+    }
+
+    OptionalChild animations = IsChild(root, "animations");
     if(animations && animationName)
     {
       if(OptionalChild animNode = IsChild(*animations, *animationName))
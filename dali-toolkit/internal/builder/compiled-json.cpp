@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/compiled-json.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace CompiledJson
+{
+namespace
+{
+constexpr char     IDENTIFIER[4]    = {'D', 'J', 'S', 'B'};
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME        = 1099511628211ull;
+
+/**
+ * @brief Writes the nodes and interns their strings.
+ */
+class Writer
+{
+public:
+  Writer(std::vector<Node>& nodes, std::vector<char>& strings)
+  : mNodes(nodes),
+    mStrings(strings)
+  {
+  }
+
+  void Write(const TreeNode& treeNode)
+  {
+    Node node;
+    node.name         = Intern(treeNode.GetName());
+    node.type         = static_cast<uint8_t>(treeNode.GetType());
+    node.substitution = treeNode.HasSubstitution() ? 1u : 0u;
+    node.reserved     = 0u;
+    node.childCount   = static_cast<uint32_t>(treeNode.Size());
+
+    switch(treeNode.GetType())
+    {
+      case TreeNode::STRING:
+      {
+        node.value.string = Intern(treeNode.GetString());
+        break;
+      }
+      case TreeNode::INTEGER:
+      {
+        node.value.integer = treeNode.GetInteger();
+        break;
+      }
+      case TreeNode::FLOAT:
+      {
+        node.value.number = treeNode.GetFloat();
+        break;
+      }
+      case TreeNode::BOOLEAN:
+      {
+        node.value.integer = treeNode.GetBoolean() ? 1 : 0;
+        break;
+      }
+      default:
+      {
+        node.value.integer = 0;
+        break;
+      }
+    }
+    mNodes.push_back(node);
+
+    for(TreeNode::ConstIterator iter = treeNode.CBegin(); iter != treeNode.CEnd(); ++iter)
+    {
+      Write((*iter).second);
+    }
+  }
+
+private:
+  uint32_t Intern(const char* string)
+  {
+    if(!string)
+    {
+      return NO_STRING;
+    }
+
+    auto iter = mOffsets.find(string);
+    if(iter != mOffsets.end())
+    {
+      return iter->second;
+    }
+
+    const uint32_t offset = static_cast<uint32_t>(mStrings.size());
+    mStrings.insert(mStrings.end(), string, string + strlen(string) + 1u);
+
+    // The key views the string of the tree, which outlives the writer.
+    mOffsets.emplace(string, offset);
+    return offset;
+  }
+
+  std::vector<Node>&                              mNodes;
+  std::vector<char>&                              mStrings;
+  std::unordered_map<std::string_view, uint32_t> mOffsets;
+};
+
+} // namespace
+
+uint64_t CalculateSourceHash(const char* source, std::size_t size)
+{
+  uint64_t hash = FNV_OFFSET_BASIS;
+  for(std::size_t i = 0u; i < size; ++i)
+  {
+    hash = (hash ^ static_cast<uint8_t>(source[i])) * FNV_PRIME;
+  }
+  return hash;
+}
+
+void Compile(const TreeNode& root, uint32_t sourceSize, uint64_t sourceHash, std::vector<char>& output)
+{
+  std::vector<Node> nodes;
+  std::vector<char> strings;
+
+  Writer writer(nodes, strings);
+  writer.Write(root);
+
+  Header header;
+  memcpy(header.identifier, IDENTIFIER, sizeof(IDENTIFIER));
+  header.version         = VERSION;
+  header.sourceHash      = sourceHash;
+  header.sourceSize      = sourceSize;
+  header.nodeCount       = static_cast<uint32_t>(nodes.size());
+  header.stringTableSize = static_cast<uint32_t>(strings.size());
+  header.reserved        = 0u;
+
+  output.resize(sizeof(Header) + nodes.size() * sizeof(Node) + strings.size());
+  memcpy(output.data(), &header, sizeof(Header));
+  memcpy(output.data() + sizeof(Header), nodes.data(), nodes.size() * sizeof(Node));
+  if(!strings.empty())
+  {
+    memcpy(output.data() + sizeof(Header) + nodes.size() * sizeof(Node), strings.data(), strings.size());
+  }
+}
+
+const Header* GetHeader(const char* data, std::size_t size)
+{
+  if(!data || size < sizeof(Header))
+  {
+    return nullptr;
+  }
+
+  const Header* header = reinterpret_cast<const Header*>(data);
+  if(memcmp(header->identifier, IDENTIFIER, sizeof(IDENTIFIER)) != 0 || header->version != VERSION)
+  {
+    return nullptr;
+  }
+
+  // The strings must be null terminated, so reading the last one stops in the data.
+  const uint64_t expectedSize = sizeof(Header) + static_cast<uint64_t>(header->nodeCount) * sizeof(Node) + header->stringTableSize;
+  if(header->nodeCount == 0u || expectedSize != size || (header->stringTableSize > 0u && data[size - 1u] != '\0'))
+  {
+    return nullptr;
+  }
+
+  return header;
+}
+
+} // namespace CompiledJson
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
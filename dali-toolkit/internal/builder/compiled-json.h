@@ -0,0 +1,121 @@
+#ifndef DALI_TOOLKIT_INTERNAL_COMPILED_JSON_H
+#define DALI_TOOLKIT_INTERNAL_COMPILED_JSON_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <dali/public-api/common/vector-wrapper.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/tree-node.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief A binary form of a parsed JSON tree, which is loaded without tokenizing the JSON again.
+ *
+ * The file is a Header, the nodes in depth first order and a table of the strings, each of which is stored once.
+ * The nodes refer to the strings by offset, so the file can be used where it is loaded or mapped.
+ * The values are stored in the byte order of the machine which compiled it, which the version detects.
+ */
+namespace CompiledJson
+{
+constexpr const char* FILE_EXTENSION = ".bin"; ///< Appended to the name of the JSON file compiled
+
+constexpr uint32_t VERSION   = 2u;
+constexpr uint32_t NO_STRING = 0xFFFFFFFFu;
+
+/**
+ * @brief The header of a compiled file.
+ */
+struct Header
+{
+  char     identifier[4];   ///< "DJSB"
+  uint32_t version;         ///< VERSION
+  uint64_t sourceHash;      ///< The CalculateSourceHash() of the JSON compiled, to detect the files compiled from another JSON
+  uint32_t sourceSize;      ///< The size of the JSON compiled
+  uint32_t nodeCount;       ///< The number of nodes following the header
+  uint32_t stringTableSize; ///< The size of the strings following the nodes, including their null terminators
+  uint32_t reserved;        ///< Padding
+};
+
+static_assert(sizeof(Header) == 32u, "The compiled header must be packed");
+
+/**
+ * @brief A node of the tree.
+ */
+struct Node
+{
+  uint32_t name;         ///< The offset of the name in the string table, or NO_STRING
+  uint8_t  type;         ///< The TreeNode::NodeType
+  uint8_t  substitution; ///< Whether the string refers to other nodes
+  uint16_t reserved;     ///< Padding
+  uint32_t childCount;   ///< The number of children, which follow the node
+  union
+  {
+    int32_t  integer; ///< The value of INTEGER and BOOLEAN nodes
+    float    number;  ///< The value of FLOAT nodes
+    uint32_t string;  ///< The offset of the value of STRING nodes in the string table
+  } value;
+};
+
+static_assert(sizeof(Node) == 16u, "The compiled nodes must be packed");
+
+/**
+ * @brief Calculates the hash of a JSON, which is the same on every machine.
+ *
+ * The modification time is not used, as it is not kept when the files are installed.
+ *
+ * @param[in] source The JSON
+ * @param[in] size The size of the JSON
+ * @return The 64 bit FNV-1a hash of the JSON
+ */
+uint64_t CalculateSourceHash(const char* source, std::size_t size);
+
+/**
+ * @brief Compiles a parsed JSON tree.
+ * @param[in] root The root of the tree
+ * @param[in] sourceSize The size of the JSON the tree was parsed from
+ * @param[in] sourceHash The CalculateSourceHash() of the JSON the tree was parsed from
+ * @param[out] output The compiled file
+ */
+void Compile(const TreeNode& root, uint32_t sourceSize, uint64_t sourceHash, std::vector<char>& output);
+
+/**
+ * @brief Checks whether data is a valid compiled file of this version.
+ * @param[in] data The data
+ * @param[in] size The size of the data
+ * @return The header, or NULL if the data is not a valid compiled file
+ */
+const Header* GetHeader(const char* data, std::size_t size);
+
+} // namespace CompiledJson
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_COMPILED_JSON_H
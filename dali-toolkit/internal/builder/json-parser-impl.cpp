@@ -22,6 +22,7 @@
 #include <cstring>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/builder/compiled-json.h>
 #include <dali-toolkit/internal/builder/json-parser-state.h>
 #include <dali-toolkit/internal/builder/tree-node-manipulator.h>
 
@@ -33,7 +34,8 @@ namespace Internal
 {
 namespace
 {
-const char ERROR_DESCRIPTION_NONE[] = "No Error";
+const char ERROR_DESCRIPTION_NONE[]         = "No Error";
+const char ERROR_DESCRIPTION_NOT_COMPILED[] = "Not a compiled json of this version";
 
 template<typename IteratorType, typename EndIteratorType>
 inline IteratorType Advance(IteratorType& iter, EndIteratorType& end, int n)
@@ -97,7 +99,28 @@ bool JsonParser::Parse(const std::string& source)
 
   JsonParserState parserState(mRoot);
 
-  if(parserState.ParseJson(mSources.back()))
+  return UpdateRoot(parserState, parserState.ParseJson(mSources.back()));
+}
+
+bool JsonParser::ParseCompiled(const char* data, std::size_t size)
+{
+  if(!CompiledJson::GetHeader(data, size))
+  {
+    // Keep the tree, so the json the file was compiled from can be parsed instead.
+    mErrorDescription = ERROR_DESCRIPTION_NOT_COMPILED;
+    return false;
+  }
+
+  mSources.push_back(VectorChar(data, data + size));
+
+  JsonParserState parserState(mRoot);
+
+  return UpdateRoot(parserState, parserState.ParseCompiled(mSources.back()));
+}
+
+bool JsonParser::UpdateRoot(JsonParserState& parserState, bool parsed)
+{
+  if(parsed)
   {
     mRoot = parserState.GetRoot();
 
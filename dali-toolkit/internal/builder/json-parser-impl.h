@@ -36,6 +36,8 @@ namespace Toolkit
 {
 namespace Internal
 {
+class JsonParserState;
+
 /*
  * Parses JSON
  */
@@ -61,6 +63,14 @@ public:
    */
   bool Parse(const std::string& source);
 
+  /*
+   * Parses a compiled json file, merging it as Parse() merges json
+   * @param[in] data The compiled file
+   * @param[in] size The size of the file
+   * @return true if the file was parsed
+   */
+  bool ParseCompiled(const char* data, std::size_t size);
+
   /*
    * @copydoc Toolkit::JsonParser::Pack()
    */
@@ -111,6 +121,14 @@ private:
   JsonParser(JsonParser&);
   JsonParser& operator=(const JsonParser&);
 
+  /*
+   * Takes the tree and the errors of a parse
+   * @param[in] parserState The state of the parse
+   * @param[in] parsed Whether the parse succeeded
+   * @return true if the parse succeeded
+   */
+  bool UpdateRoot(JsonParserState& parserState, bool parsed);
+
   SourceContainer mSources; ///< List of strings from Parse() merge operations
 
   TreeNode* mRoot; ///< Tree root
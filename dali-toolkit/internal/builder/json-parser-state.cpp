@@ -20,8 +20,12 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstring>
 #include <string>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/builder/compiled-json.h>
+
 namespace Dali
 {
 namespace Toolkit
@@ -928,6 +932,144 @@ bool JsonParserState::ParseJson(VectorChar& source)
 
 } // ParseJson
 
+bool JsonParserState::ParseCompiled(const VectorChar& source)
+{
+  Reset();
+
+  const CompiledJson::Header* header = CompiledJson::GetHeader(source.data(), source.size());
+  if(nullptr == header)
+  {
+    return Error("Not a compiled json of this version");
+  }
+
+  const CompiledJson::Node* node    = reinterpret_cast<const CompiledJson::Node*>(source.data() + sizeof(CompiledJson::Header));
+  const char*               strings = reinterpret_cast<const char*>(node + header->nodeCount);
+
+  auto GetString = [header, strings](uint32_t offset, const char*& string) {
+    if(offset == CompiledJson::NO_STRING)
+    {
+      string = nullptr;
+      return true;
+    }
+    string = strings + offset;
+    return offset < header->stringTableSize;
+  };
+
+  // The numbers of children still to add to the open objects and arrays
+  std::vector<uint32_t> remainingChildren;
+
+  for(uint32_t i = 0; i < header->nodeCount; ++i, ++node)
+  {
+    if(i > 0 && remainingChildren.empty())
+    {
+      return Error("Unexpected node. Json must have one object or array at its root");
+    }
+
+    const char* name = nullptr;
+    if(!GetString(node->name, name))
+    {
+      return Error("Invalid name");
+    }
+    if(name)
+    {
+      mNumberOfParsedChars += strlen(name) + 1;
+    }
+
+    const TreeNode::NodeType type = static_cast<TreeNode::NodeType>(node->type);
+    switch(type)
+    {
+      case TreeNode::OBJECT:
+      case TreeNode::ARRAY:
+      {
+        NewNode(name, type);
+        break;
+      }
+      case TreeNode::STRING:
+      {
+        const char* value = nullptr;
+        if(!GetString(node->value.string, value) || nullptr == value)
+        {
+          return Error("Invalid string");
+        }
+        mNumberOfParsedChars += strlen(value) + 1;
+
+        NewNode(name, TreeNode::STRING);
+        mCurrent.SetString(value);
+        break;
+      }
+      case TreeNode::INTEGER:
+      {
+        NewNode(name, TreeNode::IS_NULL);
+        mCurrent.SetType(TreeNode::INTEGER);
+        mCurrent.SetInteger(node->value.integer);
+        break;
+      }
+      case TreeNode::FLOAT:
+      {
+        NewNode(name, TreeNode::IS_NULL);
+        mCurrent.SetType(TreeNode::FLOAT);
+        mCurrent.SetFloat(node->value.number);
+        break;
+      }
+      case TreeNode::BOOLEAN:
+      {
+        NewNode(name, TreeNode::BOOLEAN);
+        mCurrent.SetInteger(node->value.integer);
+        mCurrent.SetType(TreeNode::BOOLEAN);
+        break;
+      }
+      case TreeNode::IS_NULL:
+      {
+        NewNode(name, TreeNode::IS_NULL);
+        break;
+      }
+      default:
+      {
+        return Error("Invalid node type");
+      }
+    }
+    mCurrent.SetSubstitution(node->substitution != 0u);
+
+    if(i == 0 && type != TreeNode::OBJECT && type != TreeNode::ARRAY)
+    {
+      return Error("Json must start with object {} or array []");
+    }
+
+    if((type == TreeNode::OBJECT || type == TreeNode::ARRAY) && node->childCount > 0u)
+    {
+      remainingChildren.push_back(node->childCount);
+      continue;
+    }
+
+    // The node is complete; walk up from it and from each object or array it completes
+    bool complete = true;
+    while(complete)
+    {
+      if(mCurrent.GetParent() == nullptr)
+      {
+        mState = STATE_END;
+        break;
+      }
+      if(!UpToParent())
+      {
+        return false;
+      }
+      complete = !remainingChildren.empty() && --remainingChildren.back() == 0u;
+      if(complete)
+      {
+        remainingChildren.pop_back();
+      }
+    }
+  }
+
+  if(mState != STATE_END)
+  {
+    return Error("Unexpected end of the compiled json");
+  }
+
+  return true;
+}
+
 void JsonParserState::Reset()
 {
   mCurrent = TreeNodeManipulator(mRoot);
@@ -72,6 +72,14 @@ public:
    */
   bool ParseJson(VectorChar& source);
 
+  /**
+   * Parse a compiled json file, merging it as ParseJson() merges the json it was compiled from
+   * The strings of the nodes point to the source, which must outlive them
+   * @param source The vector buffer of the compiled file
+   * @return true if parsed successfully
+   */
+  bool ParseCompiled(const VectorChar& source);
+
   /**
    * Get the root node
    * @return The root TreeNode
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/json-section-index.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+/**
+ * @brief Skips over the values of a JSON document, accepting what JsonParserState accepts.
+ */
+class Scanner
+{
+public:
+  explicit Scanner(const std::string& source)
+  : mSource(source),
+    mPosition(0u)
+  {
+  }
+
+  std::size_t GetPosition() const
+  {
+    return mPosition;
+  }
+
+  bool AtEnd() const
+  {
+    return mPosition >= mSource.size();
+  }
+
+  char Char() const
+  {
+    return AtEnd() ? '\0' : mSource[mPosition];
+  }
+
+  /**
+   * Skips white space and C and C++ style comments.
+   */
+  void SkipWhiteSpace()
+  {
+    while(!AtEnd())
+    {
+      const char c    = mSource[mPosition];
+      const char next = mPosition + 1u < mSource.size() ? mSource[mPosition + 1u] : '\0';
+
+      if(c == ' ' || c == '\t' || c == '\r' || c == '\n')
+      {
+        ++mPosition;
+      }
+      else if(c == '/' && next == '/')
+      {
+        mPosition = mSource.find('\n', mPosition);
+      }
+      else if(c == '/' && next == '*')
+      {
+        mPosition = mSource.find("*/", mPosition + 2u);
+        mPosition = mPosition == std::string::npos ? mPosition : mPosition + 2u;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    if(mPosition > mSource.size())
+    {
+      mPosition = mSource.size();
+    }
+  }
+
+  /**
+   * Skips a quoted string.
+   * @param[out] escaped Whether the string has an escape sequence
+   * @return false if the string is not terminated
+   */
+  bool SkipString(bool& escaped)
+  {
+    escaped = false;
+    ++mPosition;
+    while(!AtEnd())
+    {
+      const char c = mSource[mPosition++];
+      if(c == '\\')
+      {
+        escaped = true;
+        ++mPosition;
+      }
+      else if(c == '"')
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Scans the members of the object at the current position.
+   * @param[in] onMember Called with the offsets of the quoted name of each member and whether it is escaped,
+   * at the value of the member. It must skip the value, returning false if it cannot.
+   * @return false if the object is not balanced
+   */
+  template<typename MemberFunction>
+  bool ScanObject(MemberFunction onMember)
+  {
+    ++mPosition;
+    SkipWhiteSpace();
+    while(Char() != '}')
+    {
+      bool              escaped   = false;
+      const std::size_t nameBegin = mPosition;
+      if(Char() != '"' || !SkipString(escaped))
+      {
+        return false;
+      }
+      const std::size_t nameEnd = mPosition;
+
+      SkipWhiteSpace();
+      if(Char() != ':')
+      {
+        return false;
+      }
+      ++mPosition;
+      SkipWhiteSpace();
+
+      if(!onMember(nameBegin, nameEnd, escaped))
+      {
+        return false;
+      }
+
+      if(!SkipSeparator('}'))
+      {
+        return false;
+      }
+    }
+    ++mPosition;
+    return true;
+  }
+
+  /**
+   * Skips the value at the current position.
+   * @return false if the value is not balanced
+   */
+  bool SkipValue()
+  {
+    switch(Char())
+    {
+      case '{':
+      {
+        return ScanObject([this](std::size_t, std::size_t, bool) { return SkipValue(); });
+      }
+      case '[':
+      {
+        ++mPosition;
+        SkipWhiteSpace();
+        while(Char() != ']')
+        {
+          if(!SkipValue() || !SkipSeparator(']'))
+          {
+            return false;
+          }
+        }
+        ++mPosition;
+        return true;
+      }
+      case '"':
+      {
+        bool escaped = false;
+        return SkipString(escaped);
+      }
+      default:
+      {
+        // Numbers, true, false and null; they are checked when parsed
+        const std::size_t begin = mPosition;
+        while(!AtEnd() && !strchr(",:]}/ \t\r\n", mSource[mPosition]))
+        {
+          ++mPosition;
+        }
+        return mPosition > begin;
+      }
+    }
+  }
+
+private:
+  /**
+   * Skips the comma after a value.
+   * @param[in] close The character closing the object or array
+   * @return false if the value is followed by neither a comma nor close, or the comma is followed by close
+   */
+  bool SkipSeparator(char close)
+  {
+    SkipWhiteSpace();
+    if(Char() == ',')
+    {
+      ++mPosition;
+      SkipWhiteSpace();
+      return Char() != close;
+    }
+    return Char() == close;
+  }
+
+  const std::string& mSource;
+  std::size_t        mPosition;
+};
+
+} // namespace
+
+bool IndexJsonSections(const std::string&              source,
+                       const std::vector<const char*>& sectionNames,
+                       JsonSectionMembers&             members,
+                       std::string&                    remainder)
+{
+  members.clear();
+  remainder.clear();
+
+  Scanner     scanner(source);
+  std::size_t copied  = 0u;
+  bool        indexed = false;
+
+  scanner.SkipWhiteSpace();
+  if(scanner.Char() == '{')
+  {
+    indexed = scanner.ScanObject([&](std::size_t nameBegin, std::size_t nameEnd, bool) {
+      const std::size_t nameLength = nameEnd - nameBegin - 2u;
+
+      std::size_t section = 0u;
+      while(section < sectionNames.size() &&
+            (strlen(sectionNames[section]) != nameLength || source.compare(nameBegin + 1u, nameLength, sectionNames[section]) != 0))
+      {
+        ++section;
+      }
+
+      if(section == sectionNames.size() || scanner.Char() != '{')
+      {
+        return scanner.SkipValue();
+      }
+
+      const std::size_t sectionBegin = scanner.GetPosition();
+
+      const bool sectionIndexed = scanner.ScanObject([&](std::size_t memberBegin, std::size_t memberEnd, bool escaped) {
+        // The name must be found as it is written
+        if(escaped || !scanner.SkipValue())
+        {
+          return false;
+        }
+        members.push_back({section, source.substr(memberBegin + 1u, memberEnd - memberBegin - 2u), memberBegin, scanner.GetPosition()});
+        return true;
+      });
+
+      if(sectionIndexed)
+      {
+        remainder.append(source, copied, sectionBegin - copied);
+        remainder.append("{}");
+        copied = scanner.GetPosition();
+      }
+      return sectionIndexed;
+    });
+  }
+  else
+  {
+    indexed = scanner.SkipValue();
+  }
+
+  scanner.SkipWhiteSpace();
+  if(!indexed || !scanner.AtEnd())
+  {
+    members.clear();
+    remainder.clear();
+    return false;
+  }
+
+  remainder.append(source, copied, std::string::npos);
+  return true;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,68 @@
+#ifndef DALI_TOOLKIT_INTERNAL_JSON_SECTION_INDEX_H
+#define DALI_TOOLKIT_INTERNAL_JSON_SECTION_INDEX_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <cstddef>
+#include <string>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Where a member of a top level section is in a JSON document.
+ */
+struct JsonSectionMember
+{
+  std::size_t section; ///< The index of the name of the section
+  std::string name;    ///< The name of the member
+  std::size_t begin;   ///< The offset of the quoted name of the member
+  std::size_t end;     ///< The offset after the value of the member
+};
+
+typedef std::vector<JsonSectionMember> JsonSectionMembers;
+
+/**
+ * @brief Finds the members of the top level sections of a JSON document without parsing their values.
+ *
+ * The text from begin to end of a member can be parsed alone by wrapping it in its section, e.g.
+ * {"styles":{ text }}. The document is only checked to be balanced; the values are checked when they are parsed.
+ *
+ * @param[in] source The JSON document
+ * @param[in] sectionNames The names of the sections. Only the sections whose values are objects are indexed
+ * @param[out] members The members of the sections, in the order of the document
+ * @param[out] remainder The document with each section indexed replaced by an empty object
+ * @return false if the document is not balanced or a member name has an escape sequence, in which case it must be parsed whole
+ */
+bool IndexJsonSections(const std::string&              source,
+                       const std::vector<const char*>& sectionNames,
+                       JsonSectionMembers&             members,
+                       std::string&                    remainder);
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_JSON_SECTION_INDEX_H
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/property-batch.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/object/property-index-ranges.h>
+#include <algorithm>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+Property::Index PropertyIndexCache::GetPropertyIndex(Handle& handle, const std::string& key, Property::Type& type)
+{
+  // The index of a default or registered property only depends on the type of the object
+  const std::string& typeName = handle.GetTypeName();
+  if(!typeName.empty())
+  {
+    ResolvedProperties& resolvedProperties = mResolvedTypes[typeName];
+
+    auto iter = resolvedProperties.find(key);
+    if(iter != resolvedProperties.end())
+    {
+      type = iter->second.second;
+      return iter->second.first;
+    }
+
+    Property::Index index = handle.GetPropertyIndex(key);
+    if(index != Property::INVALID_INDEX)
+    {
+      type = handle.GetPropertyType(index);
+      if(index < PROPERTY_CUSTOM_START_INDEX)
+      {
+        resolvedProperties.emplace(key, std::make_pair(index, type));
+      }
+    }
+    return index;
+  }
+
+  Property::Index index = handle.GetPropertyIndex(key);
+  if(index != Property::INVALID_INDEX)
+  {
+    type = handle.GetPropertyType(index);
+  }
+  return index;
+}
+
+void PropertyBatch::Add(Property::Index index, const Property::Value& value)
+{
+  Property::Value* existingValue = Find(index);
+  if(existingValue)
+  {
+    *existingValue = value;
+  }
+  else
+  {
+    mIndices.push_back(index);
+    mValues.push_back(value);
+  }
+}
+
+PropertyBatch::SizeType PropertyBatch::Add(Handle handle, const Property::Map& properties)
+{
+  SizeType unresolved = 0;
+  Reserve(mIndices.size() + properties.Count());
+
+  for(Property::Map::SizeType i = 0; i < properties.Count(); ++i)
+  {
+    const Property::Key& key   = properties.GetKeyAt(i);
+    Property::Index      index = (key.type == Property::Key::INDEX) ? key.indexKey : handle.GetPropertyIndex(key.stringKey);
+    if(index != Property::INVALID_INDEX)
+    {
+      Add(index, properties.GetValue(i));
+    }
+    else
+    {
+      DALI_LOG_ERROR("Key '%s' not found.\n", key.stringKey.c_str());
+      ++unresolved;
+    }
+  }
+  return unresolved;
+}
+
+void PropertyBatch::Add(Handle handle, const Property::Map& properties, PropertyIndexCache& cache)
+{
+  Reserve(mIndices.size() + properties.Count());
+
+  for(Property::Map::SizeType i = 0; i < properties.Count(); ++i)
+  {
+    const Property::Key& key = properties.GetKeyAt(i);
+    if(key.type == Property::Key::INDEX)
+    {
+      Add(key.indexKey, properties.GetValue(i));
+      continue;
+    }
+
+    Property::Type  type;
+    Property::Index index = cache.GetPropertyIndex(handle, key.stringKey, type);
+    if(index != Property::INVALID_INDEX)
+    {
+      Add(index, properties.GetValue(i));
+    }
+    else
+    {
+      AddCustomProperty(key.stringKey, properties.GetValue(i));
+    }
+  }
+}
+
+void PropertyBatch::AddCustomProperty(const std::string& name, const Property::Value& value)
+{
+  auto iter = std::find(mCustomNames.begin(), mCustomNames.end(), name);
+  if(iter != mCustomNames.end())
+  {
+    mCustomValues[iter - mCustomNames.begin()] = value;
+  }
+  else
+  {
+    mCustomNames.push_back(name);
+    mCustomValues.push_back(value);
+  }
+}
+
+Property::Value* PropertyBatch::Find(Property::Index index)
+{
+  auto iter = std::find(mIndices.begin(), mIndices.end(), index);
+  return iter != mIndices.end() ? &mValues[iter - mIndices.begin()] : nullptr;
+}
+
+const Property::Value* PropertyBatch::Find(Property::Index index) const
+{
+  auto iter = std::find(mIndices.begin(), mIndices.end(), index);
+  return iter != mIndices.end() ? &mValues[iter - mIndices.begin()] : nullptr;
+}
+
+void PropertyBatch::Reserve(SizeType count)
+{
+  mIndices.reserve(count);
+  mValues.reserve(count);
+}
+
+void PropertyBatch::Clear()
+{
+  mIndices.clear();
+  mValues.clear();
+  mCustomNames.clear();
+  mCustomValues.clear();
+}
+
+void PropertyBatch::Apply(Handle handle) const
+{
+  const SizeType count = mIndices.size();
+  for(SizeType i = 0; i < count; ++i)
+  {
+    handle.SetProperty(mIndices[i], mValues[i]);
+  }
+
+  // Registers the property, or sets it if the handle has it already
+  const SizeType customCount = mCustomNames.size();
+  for(SizeType i = 0; i < customCount; ++i)
+  {
+    handle.RegisterProperty(mCustomNames[i], mCustomValues[i]);
+  }
+}
+
+} // namespace Internal
+} // namespace Toolkit
+} // namespace Dali
@@ -0,0 +1,198 @@
+#ifndef DALI_TOOLKIT_INTERNAL_BUILDER_PROPERTY_BATCH_H
+#define DALI_TOOLKIT_INTERNAL_BUILDER_PROPERTY_BATCH_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/object/handle.h>
+#include <dali/public-api/object/property-map.h>
+#include <dali/public-api/object/property-value.h>
+#include <string>
+#include <unordered_map>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * The indices of the default and registered properties, resolved by name
+ * for each type of object.
+ *
+ * The index of such a property only depends on the type of the object, so
+ * each name is looked up once per type. Custom property indices are not cached.
+ */
+class PropertyIndexCache
+{
+public:
+  /**
+   * Retrieves the index and the type of the property of the object with
+   * the given name.
+   *
+   * @param[in] handle The object to find the property of
+   * @param[in] key The name of the property
+   * @param[out] type The type of the property, if it is found
+   * @return The index of the property, or Property::INVALID_INDEX
+   */
+  Property::Index GetPropertyIndex(Handle& handle, const std::string& key, Property::Type& type);
+
+private:
+  using ResolvedProperties = std::unordered_map<std::string, std::pair<Property::Index, Property::Type>>; // Keyed by property name
+  using ResolvedTypes      = std::unordered_map<std::string, ResolvedProperties>;                           // Keyed by type name
+
+  ResolvedTypes mResolvedTypes;
+};
+
+/**
+ * A list of properties whose keys are already resolved to indices,
+ * to be applied to any number of handles.
+ *
+ * Unlike a Property::Map, the batch is applied without copying its
+ * keys and values, and without looking up the keys of the handle.
+ */
+class PropertyBatch
+{
+public:
+  using SizeType = std::vector<Property::Index>::size_type;
+
+  /**
+   * Adds a property to the batch, overwriting the value of the index
+   * if it is already in the batch.
+   *
+   * @param[in] index The resolved index of the property
+   * @param[in] value The value of the property
+   */
+  void Add(Property::Index index, const Property::Value& value);
+
+  /**
+   * Adds the properties of a map to the batch, resolving their
+   * string keys with the given handle.
+   *
+   * @param[in] handle The handle whose properties the keys name
+   * @param[in] properties The properties to add
+   * @return The number of keys which could not be resolved
+   */
+  SizeType Add(Handle handle, const Property::Map& properties);
+
+  /**
+   * Adds the properties of a map to the batch, resolving their string
+   * keys with the cache. The string keys which the handle does not have
+   * are added as custom properties.
+   *
+   * @param[in] handle The handle whose properties the keys name
+   * @param[in] properties The properties to add
+   * @param[in] cache The indices resolved for the type of the handle
+   */
+  void Add(Handle handle, const Property::Map& properties, PropertyIndexCache& cache);
+
+  /**
+   * Adds a custom property to the batch, to be registered with its value
+   * on the handle, or set if the handle has it already.
+   *
+   * @param[in] name The name of the property
+   * @param[in] value The value of the property
+   */
+  void AddCustomProperty(const std::string& name, const Property::Value& value);
+
+  /**
+   * Finds the value of the given index.
+   *
+   * @param[in] index The index to find
+   * @return A pointer to the value, or nullptr if the index is not in the batch
+   */
+  Property::Value* Find(Property::Index index);
+
+  /**
+   * @copydoc Find
+   */
+  const Property::Value* Find(Property::Index index) const;
+
+  /**
+   * Retrieves the number of resolved properties in the batch.
+   */
+  SizeType Count() const
+  {
+    return mIndices.size();
+  }
+
+  /**
+   * Retrieves the number of custom properties in the batch.
+   */
+  SizeType GetCustomPropertyCount() const
+  {
+    return mCustomNames.size();
+  }
+
+  /**
+   * Retrieves whether the batch is empty.
+   */
+  bool Empty() const
+  {
+    return mIndices.empty() && mCustomNames.empty();
+  }
+
+  /**
+   * Retrieves the index of the property at the given position.
+   */
+  Property::Index GetIndex(SizeType position) const
+  {
+    return mIndices[position];
+  }
+
+  /**
+   * Retrieves the value of the property at the given position.
+   */
+  const Property::Value& GetValue(SizeType position) const
+  {
+    return mValues[position];
+  }
+
+  /**
+   * Reserves space for the given number of properties.
+   */
+  void Reserve(SizeType count);
+
+  /**
+   * Removes all the properties from the batch.
+   */
+  void Clear();
+
+  /**
+   * Applies the properties of the batch to the handle, in the order
+   * they were added, then registers the custom properties in one pass.
+   *
+   * @note Each property is still set through Handle::SetProperty, as the
+   * core has no setter of several properties to hand the batch to.
+   *
+   * @param[in] handle The handle to apply the properties to
+   */
+  void Apply(Handle handle) const;
+
+private:
+  std::vector<Property::Index> mIndices;      ///< The resolved indices, in the order they were added
+  std::vector<Property::Value> mValues;       ///< The values of the indices
+  std::vector<std::string>     mCustomNames;  ///< The names of the custom properties, in the order they were added
+  std::vector<Property::Value> mCustomValues; ///< The values of the custom properties
+};
+
+} // namespace Internal
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_BUILDER_PROPERTY_BATCH_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -148,14 +148,7 @@ void Style::ApplyVisual(
 
 void Style::ApplyProperties(Handle handle) const
 {
-  for(Property::Map::SizeType i = 0; i < properties.Count(); ++i)
-  {
-    KeyValuePair keyValue = properties.GetKeyValue(i);
-    if(keyValue.first.type == Property::Key::INDEX)
-    {
-      handle.SetProperty(keyValue.first.indexKey, keyValue.second);
-    }
-  }
+  properties.Apply(handle);
 }
 
 Style::Style()
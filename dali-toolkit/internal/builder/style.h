@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_INTERNAL_BUILDER_STYLE_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 
 #include <dali-toolkit/devel-api/visual-factory/transition-data.h>
 #include <dali-toolkit/internal/builder/dictionary.h>
+#include <dali-toolkit/internal/builder/property-batch.h>
 #include <dali/public-api/object/ref-object.h>
 
 namespace Dali
@@ -120,7 +121,7 @@ public:
   // Everything must be shallow-copiable.
   Dictionary<StylePtr>      subStates; // Each named style maps to a state.
   Dictionary<Property::Map> visuals;
-  Property::Map             properties;
+  PropertyBatch             properties; // Resolved when the style is recorded, to be applied to each control.
   Property::Array           transitions;
   Toolkit::TransitionData   entryTransition;
   Toolkit::TransitionData   exitTransition;
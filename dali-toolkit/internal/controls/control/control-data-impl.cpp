@@ -33,6 +33,7 @@
 #include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/object/object-registry.h>
 #include <dali/public-api/object/type-registry-helper.h>
+#include <algorithm>
 #include <cstring>
 #include <limits>
 
@@ -59,6 +60,10 @@ const char* READING_INFO_TYPE_DESCRIPTION    = "description";
 const char* READING_INFO_TYPE_STATE          = "state";
 const char* READING_INFO_TYPE_ATTRIBUTE_NAME = "reading_info_type";
 const char* READING_INFO_TYPE_SEPARATOR      = "|";
+
+bool gLazyAccessibleCreation = false; ///< Whether the accessible objects are created only while the accessibility bridge is up
+
+constexpr uint32_t VISUAL_LOOKUP_MINIMUM_COUNT = 8u; ///< The number of visuals from which they are found through the sorted lookup
 } // namespace
 
 namespace Dali
@@ -79,6 +84,142 @@ const Scripting::StringEnum ControlStateTable[] = {
 const unsigned int ControlStateTableCount = sizeof(ControlStateTable) / sizeof(ControlStateTable[0]);
 const Vector4      FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 
+bool RegisteredVisualContainer::Find(Property::Index index, Iterator& iter) const
+{
+  Update();
+  if(!mLookup)
+  {
+    for(iter = Begin(); iter != End(); ++iter)
+    {
+      if((*iter)->index == index)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const auto& indices = mLookup->indices;
+  auto        found   = std::lower_bound(indices.begin(), indices.end(), index, [](const std::pair<Property::Index, uint32_t>& entry, Property::Index key) { return entry.first < key; });
+  if(found != indices.end() && found->first == index)
+  {
+    iter = Begin() + found->second;
+    return true;
+  }
+  return false;
+}
+
+bool RegisteredVisualContainer::Find(const Visual::Base& visual, Iterator& iter) const
+{
+  Update();
+  if(!mLookup)
+  {
+    for(iter = Begin(); iter != End(); ++iter)
+    {
+      if((*iter)->visual && &Toolkit::GetImplementation((*iter)->visual) == &visual)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const auto& visuals = mLookup->visuals;
+  auto        found   = std::lower_bound(visuals.begin(), visuals.end(), &visual, [](const std::pair<const Visual::Base*, uint32_t>& entry, const Visual::Base* key) { return std::less<const Visual::Base*>()(entry.first, key); });
+  if(found != visuals.end() && found->first == &visual)
+  {
+    iter = Begin() + found->second;
+    return true;
+  }
+  return false;
+}
+
+void RegisteredVisualContainer::UpdateReadyState(Iterator iter)
+{
+  if(mDirty)
+  {
+    // Counted on the next update
+    return;
+  }
+
+  RegisteredVisual* registeredVisual = *iter;
+  const bool        notReady         = registeredVisual->visual && registeredVisual->enabled && !Toolkit::GetImplementation(registeredVisual->visual).IsResourceReady();
+  if(notReady != registeredVisual->notReady)
+  {
+    registeredVisual->notReady = notReady;
+    if(notReady)
+    {
+      ++mNotReadyVisualCount;
+    }
+    else
+    {
+      --mNotReadyVisualCount;
+    }
+  }
+}
+
+uint32_t RegisteredVisualContainer::GetNotReadyVisualCount() const
+{
+  Update();
+  return mNotReadyVisualCount;
+}
+
+uint32_t RegisteredVisualContainer::CountNotReadyVisuals() const
+{
+  mNotReadyVisualCount = 0u;
+  for(auto iter = Begin(), endIter = End(); iter != endIter; ++iter)
+  {
+    RegisteredVisual* registeredVisual = *iter;
+    registeredVisual->notReady         = registeredVisual->visual && registeredVisual->enabled && !Toolkit::GetImplementation(registeredVisual->visual).IsResourceReady();
+    if(registeredVisual->notReady)
+    {
+      ++mNotReadyVisualCount;
+    }
+  }
+  return mNotReadyVisualCount;
+}
+
+void RegisteredVisualContainer::Update() const
+{
+  if(!mDirty)
+  {
+    return;
+  }
+  mDirty = false;
+
+  CountNotReadyVisuals();
+
+  const uint32_t count = Count();
+  if(count < VISUAL_LOOKUP_MINIMUM_COUNT)
+  {
+    mLookup.reset();
+    return;
+  }
+
+  if(!mLookup)
+  {
+    mLookup.reset(new Lookup());
+  }
+  mLookup->indices.clear();
+  mLookup->visuals.clear();
+  mLookup->indices.reserve(count);
+  mLookup->visuals.reserve(count);
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    const RegisteredVisual* registeredVisual = (*this)[i];
+    mLookup->indices.emplace_back(registeredVisual->index, i);
+    if(registeredVisual->visual)
+    {
+      mLookup->visuals.emplace_back(&Toolkit::GetImplementation(registeredVisual->visual), i);
+    }
+  }
+
+  // Stable, so that the first of the visuals with the same key is found as by a linear search
+  std::stable_sort(mLookup->indices.begin(), mLookup->indices.end(), [](const std::pair<Property::Index, uint32_t>& lhs, const std::pair<Property::Index, uint32_t>& rhs) { return lhs.first < rhs.first; });
+  std::stable_sort(mLookup->visuals.begin(), mLookup->visuals.end(), [](const std::pair<const Visual::Base*, uint32_t>& lhs, const std::pair<const Visual::Base*, uint32_t>& rhs) { return std::less<const Visual::Base*>()(lhs.first, rhs.first); });
+}
+
 namespace
 {
 #if defined(DEBUG_ENABLED)
@@ -105,14 +246,7 @@ void Remove(DictionaryKeys& keys, const std::string& name)
  */
 bool FindVisual(Property::Index targetIndex, const RegisteredVisualContainer& visuals, RegisteredVisualContainer::Iterator& iter)
 {
-  for(iter = visuals.Begin(); iter != visuals.End(); iter++)
-  {
-    if((*iter)->index == targetIndex)
-    {
-      return true;
-    }
-  }
-  return false;
+  return visuals.Find(targetIndex, iter);
 }
 
 /**
@@ -136,15 +270,7 @@ bool FindVisual(std::string visualName, const RegisteredVisualContainer& visuals
  */
 bool FindVisual(const Toolkit::Visual::Base findVisual, const RegisteredVisualContainer& visuals, RegisteredVisualContainer::Iterator& iter)
 {
-  for(iter = visuals.Begin(); iter != visuals.End(); iter++)
-  {
-    Toolkit::Visual::Base visual = (*iter)->visual;
-    if(visual && visual == findVisual)
-    {
-      return true;
-    }
-  }
-  return false;
+  return findVisual && visuals.Find(Toolkit::GetImplementation(findVisual), iter);
 }
 
 /**
@@ -152,15 +278,7 @@ bool FindVisual(const Toolkit::Visual::Base findVisual, const RegisteredVisualCo
  */
 bool FindVisual(const Visual::Base& findInternalVisual, const RegisteredVisualContainer& visuals, RegisteredVisualContainer::Iterator& iter)
 {
-  for(iter = visuals.Begin(); iter != visuals.End(); iter++)
-  {
-    Visual::Base& visual = Toolkit::GetImplementation((*iter)->visual);
-    if((&visual == &findInternalVisual))
-    {
-      return true;
-    }
-  }
-  return false;
+  return visuals.Find(findInternalVisual, iter);
 }
 
 void FindChangableVisuals(Dictionary<Property::Map>& stateVisualsToAdd,
@@ -210,13 +328,9 @@ Toolkit::Visual::Base GetVisualByIndex(
   Toolkit::Visual::Base visualHandle;
 
   RegisteredVisualContainer::Iterator iter;
-  for(iter = visuals.Begin(); iter != visuals.End(); iter++)
+  if(FindVisual(index, visuals, iter))
   {
-    if((*iter)->index == index)
-    {
-      visualHandle = (*iter)->visual;
-      break;
-    }
+    visualHandle = (*iter)->visual;
   }
   return visualHandle;
 }
@@ -532,15 +646,8 @@ Control::Impl::Impl(Control& controlImpl)
 : mControlImpl(controlImpl),
   mState(Toolkit::DevelControl::NORMAL),
   mSubStateName(""),
-  mLeftFocusableActorId(-1),
-  mRightFocusableActorId(-1),
-  mUpFocusableActorId(-1),
-  mDownFocusableActorId(-1),
-  mClockwiseFocusableActorId(-1),
-  mCounterClockwiseFocusableActorId(-1),
   mStyleName(""),
   mBackgroundColor(Color::TRANSPARENT),
-  mStartingPinchScale(nullptr),
   mMargin(0, 0, 0, 0),
   mPadding(0, 0, 0, 0),
   mSize(0, 0),
@@ -549,13 +656,9 @@ Control::Impl::Impl(Control& controlImpl)
   mKeyInputFocusLostSignal(),
   mResourceReadySignal(),
   mVisualEventSignal(),
-  mAccessibilityGetNameSignal(),
-  mAccessibilityGetDescriptionSignal(),
-  mAccessibilityDoGestureSignal(),
-  mPinchGestureDetector(),
-  mPanGestureDetector(),
-  mTapGestureDetector(),
-  mLongPressGestureDetector(),
+  mAccessibilityData(),
+  mGestureData(),
+  mFocusData(),
   mTooltip(NULL),
   mInputMethodContext(),
   mIdleCallback(nullptr),
@@ -601,7 +704,6 @@ Control::Impl::~Impl()
   }
 
   // All gesture detectors will be destroyed so no need to disconnect.
-  delete mStartingPinchScale;
 
   if(mProcessorRegistered && Adaptor::IsAvailable())
   {
@@ -635,17 +737,19 @@ void Control::Impl::CheckHighlightedObjectGeometry()
   auto accessible = GetAccessibleObject();
   if(DALI_LIKELY(accessible))
   {
+    AccessibilityData& accessibilityData = EnsureAccessibilityData();
+
     auto lastPosition   = accessible->GetLastPosition();
     auto accessibleRect = accessible->GetExtents(Dali::Accessibility::CoordinateType::WINDOW);
     auto rect           = GetShowingGeometry(accessibleRect, accessible.get());
 
-    switch(mAccessibilityLastScreenRelativeMoveType)
+    switch(accessibilityData.mAccessibilityLastScreenRelativeMoveType)
     {
       case Dali::Accessibility::ScreenRelativeMoveType::OUTSIDE:
       {
         if(IsShowingGeometryOnScreen(rect))
         {
-          mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::INSIDE;
+          accessibilityData.mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::INSIDE;
         }
         break;
       }
@@ -653,16 +757,16 @@ void Control::Impl::CheckHighlightedObjectGeometry()
       {
         if(rect.width < 0 && !Dali::Equals(accessibleRect.x, lastPosition.x))
         {
-          mAccessibilityLastScreenRelativeMoveType = (accessibleRect.x < lastPosition.x) ? Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_TOP_LEFT : Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_BOTTOM_RIGHT;
+          accessibilityData.mAccessibilityLastScreenRelativeMoveType = (accessibleRect.x < lastPosition.x) ? Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_TOP_LEFT : Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_BOTTOM_RIGHT;
         }
         if(rect.height < 0 && !Dali::Equals(accessibleRect.y, lastPosition.y))
         {
-          mAccessibilityLastScreenRelativeMoveType = (accessibleRect.y < lastPosition.y) ? Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_TOP_LEFT : Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_BOTTOM_RIGHT;
+          accessibilityData.mAccessibilityLastScreenRelativeMoveType = (accessibleRect.y < lastPosition.y) ? Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_TOP_LEFT : Dali::Accessibility::ScreenRelativeMoveType::OUTGOING_BOTTOM_RIGHT;
         }
         // notify AT-clients on outgoing moves only
-        if(mAccessibilityLastScreenRelativeMoveType != Dali::Accessibility::ScreenRelativeMoveType::INSIDE)
+        if(accessibilityData.mAccessibilityLastScreenRelativeMoveType != Dali::Accessibility::ScreenRelativeMoveType::INSIDE)
         {
-          accessible->EmitMovedOutOfScreen(mAccessibilityLastScreenRelativeMoveType);
+          accessible->EmitMovedOutOfScreen(accessibilityData.mAccessibilityLastScreenRelativeMoveType);
         }
         break;
       }
@@ -671,11 +775,11 @@ void Control::Impl::CheckHighlightedObjectGeometry()
       {
         if(IsShowingGeometryOnScreen(rect))
         {
-          mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::INSIDE;
+          accessibilityData.mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::INSIDE;
         }
         else
         {
-          mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::OUTSIDE;
+          accessibilityData.mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::OUTSIDE;
         }
         break;
       }
@@ -691,44 +795,50 @@ void Control::Impl::CheckHighlightedObjectGeometry()
 
 void Control::Impl::RegisterAccessibilityPositionPropertyNotification()
 {
-  if(mIsAccessibilityPositionPropertyNotificationSet)
+  AccessibilityData& accessibilityData = EnsureAccessibilityData();
+  if(accessibilityData.mIsAccessibilityPositionPropertyNotificationSet)
   {
     return;
   }
   // set default value until first move of object is detected
-  mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::OUTSIDE;
+  accessibilityData.mAccessibilityLastScreenRelativeMoveType = Dali::Accessibility::ScreenRelativeMoveType::OUTSIDE;
   // recalculate mAccessibilityLastScreenRelativeMoveType accordingly to the initial position
   CheckHighlightedObjectGeometry();
-  mAccessibilityPositionNotification = mControlImpl.Self().AddPropertyNotification(Actor::Property::WORLD_POSITION, StepCondition(1.0f, 1.0f));
-  mAccessibilityPositionNotification.SetNotifyMode(PropertyNotification::NOTIFY_ON_CHANGED);
-  mAccessibilityPositionNotification.NotifySignal().Connect(this, [this](PropertyNotification&) { CheckHighlightedObjectGeometry(); });
-  mIsAccessibilityPositionPropertyNotificationSet = true;
+  accessibilityData.mAccessibilityPositionNotification = mControlImpl.Self().AddPropertyNotification(Actor::Property::WORLD_POSITION, StepCondition(1.0f, 1.0f));
+  accessibilityData.mAccessibilityPositionNotification.SetNotifyMode(PropertyNotification::NOTIFY_ON_CHANGED);
+  accessibilityData.mAccessibilityPositionNotification.NotifySignal().Connect(this, [this](PropertyNotification&) { CheckHighlightedObjectGeometry(); });
+  accessibilityData.mIsAccessibilityPositionPropertyNotificationSet = true;
 }
 
 void Control::Impl::UnregisterAccessibilityPositionPropertyNotification()
 {
-  mControlImpl.Self().RemovePropertyNotification(mAccessibilityPositionNotification);
-  mIsAccessibilityPositionPropertyNotificationSet = false;
+  if(!mAccessibilityData)
+  {
+    return;
+  }
+  mControlImpl.Self().RemovePropertyNotification(mAccessibilityData->mAccessibilityPositionNotification);
+  mAccessibilityData->mIsAccessibilityPositionPropertyNotificationSet = false;
 }
 
 void Control::Impl::RegisterAccessibilityPropertySetSignal()
 {
-  if(mIsAccessibilityPropertySetSignalRegistered)
+  AccessibilityData& accessibilityData = EnsureAccessibilityData();
+  if(accessibilityData.mIsAccessibilityPropertySetSignalRegistered)
   {
     return;
   }
   mControlImpl.Self().PropertySetSignal().Connect(this, &Control::Impl::OnAccessibilityPropertySet);
-  mIsAccessibilityPropertySetSignalRegistered = true;
+  accessibilityData.mIsAccessibilityPropertySetSignalRegistered = true;
 }
 
 void Control::Impl::UnregisterAccessibilityPropertySetSignal()
 {
-  if(!mIsAccessibilityPropertySetSignalRegistered)
+  if(!mAccessibilityData || !mAccessibilityData->mIsAccessibilityPropertySetSignalRegistered)
   {
     return;
   }
   mControlImpl.Self().PropertySetSignal().Disconnect(this, &Control::Impl::OnAccessibilityPropertySet);
-  mIsAccessibilityPropertySetSignalRegistered = false;
+  mAccessibilityData->mIsAccessibilityPropertySetSignalRegistered = false;
 }
 
 void Control::Impl::OnAccessibilityPropertySet(Dali::Handle& handle, Dali::Property::Index index, const Dali::Property::Value& value)
@@ -736,17 +846,20 @@ void Control::Impl::OnAccessibilityPropertySet(Dali::Handle& handle, Dali::Prope
   auto accessible = GetAccessibleObject();
   if(DALI_LIKELY(accessible))
   {
-    if(mAccessibilityGetNameSignal.Empty())
+    // The signal is registered while the control is highlighted, which allocates the accessibility data
+    AccessibilityData& accessibilityData = EnsureAccessibilityData();
+
+    if(accessibilityData.mAccessibilityGetNameSignal.Empty())
     {
-      if(index == DevelControl::Property::ACCESSIBILITY_NAME || (mAccessibilityName.empty() && index == accessible->GetNamePropertyIndex()))
+      if(index == DevelControl::Property::ACCESSIBILITY_NAME || (accessibilityData.mAccessibilityName.empty() && index == accessible->GetNamePropertyIndex()))
       {
         accessible->Emit(Dali::Accessibility::ObjectPropertyChangeEvent::NAME);
       }
     }
 
-    if(mAccessibilityGetDescriptionSignal.Empty())
+    if(accessibilityData.mAccessibilityGetDescriptionSignal.Empty())
     {
-      if(index == DevelControl::Property::ACCESSIBILITY_DESCRIPTION || (mAccessibilityDescription.empty() && index == accessible->GetDescriptionPropertyIndex()))
+      if(index == DevelControl::Property::ACCESSIBILITY_DESCRIPTION || (accessibilityData.mAccessibilityDescription.empty() && index == accessible->GetDescriptionPropertyIndex()))
       {
         accessible->Emit(Dali::Accessibility::ObjectPropertyChangeEvent::DESCRIPTION);
       }
@@ -990,7 +1103,9 @@ void Control::Impl::EnableVisual(Property::Index index, bool enable)
       return;
     }
 
-    (*iter)->enabled  = enable;
+    (*iter)->enabled = enable;
+    mVisuals.UpdateReadyState(iter);
+
     Actor parentActor = mControlImpl.Self();
     if(mControlImpl.Self().GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE)) // If control not on Scene then Visual will be added when SceneConnection is called.
     {
@@ -1080,6 +1195,7 @@ void Control::Impl::ResourceReady(Visual::Base& object)
   {
     return;
   }
+  mVisuals.UpdateReadyState(registeredIter);
 
   RegisteredVisualContainer::Iterator visualToRemoveIter;
   // Find visual with the same index in the removal container
@@ -1110,15 +1226,11 @@ void Control::Impl::ResourceReady(Visual::Base& object)
 
 void Control::Impl::NotifyVisualEvent(Visual::Base& object, Property::Index signalId)
 {
-  for(auto registeredIter = mVisuals.Begin(), end = mVisuals.End(); registeredIter != end; ++registeredIter)
+  RegisteredVisualContainer::Iterator registeredIter;
+  if(FindVisual(object, mVisuals, registeredIter))
   {
-    Internal::Visual::Base& registeredVisualImpl = Toolkit::GetImplementation((*registeredIter)->visual);
-    if(&object == &registeredVisualImpl)
-    {
-      Dali::Toolkit::Control handle(mControlImpl.GetOwner());
-      mVisualEventSignal.Emit(handle, (*registeredIter)->index, signalId);
-      break;
-    }
+    Dali::Toolkit::Control handle(mControlImpl.GetOwner());
+    mVisualEventSignal.Emit(handle, (*registeredIter)->index, signalId);
   }
 }
 
@@ -1132,21 +1244,9 @@ void Control::Impl::RelayoutRequest(Visual::Base& object)
 
 bool Control::Impl::IsResourceReady() const
 {
-  // Iterate through and check all the enabled visuals are ready
-  for(auto visualIter = mVisuals.Begin();
-      visualIter != mVisuals.End();
-      ++visualIter)
-  {
-    const Toolkit::Visual::Base   visual     = (*visualIter)->visual;
-    const Internal::Visual::Base& visualImpl = Toolkit::GetImplementation(visual);
-
-    // one of the enabled visuals is not ready
-    if(!visualImpl.IsResourceReady() && (*visualIter)->enabled)
-    {
-      return false;
-    }
-  }
-  return true;
+  // The cached count is only checked against every visual once it reaches zero,
+  // as a visual may stop being ready, e.g. when it is taken off the scene, without notifying the control.
+  return mVisuals.GetNotReadyVisualCount() == 0u && mVisuals.CountNotReadyVisuals() == 0u;
 }
 
 Toolkit::Visual::ResourceStatus Control::Impl::GetVisualResourceStatus(Property::Index index) const
@@ -1263,14 +1363,15 @@ void Control::Impl::DoActionExtension(Dali::Property::Index visualIndex, Dali::P
 
 void Control::Impl::AppendAccessibilityAttribute(const std::string& key, const std::string value)
 {
-  Property::Value* checkedValue = mAccessibilityAttributes.Find(key);
+  Property::Map&   accessibilityAttributes = EnsureAccessibilityData().mAccessibilityAttributes;
+  Property::Value* checkedValue            = accessibilityAttributes.Find(key);
   if(checkedValue)
   {
-    mAccessibilityAttributes[key] = Property::Value(value);
+    accessibilityAttributes[key] = Property::Value(value);
   }
   else
   {
-    mAccessibilityAttributes.Insert(key, value);
+    accessibilityAttributes.Insert(key, value);
   }
 }
 
@@ -1334,7 +1435,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         int focusId;
         if(value.Get(focusId))
         {
-          controlImpl.mImpl->mLeftFocusableActorId = focusId;
+          controlImpl.mImpl->EnsureFocusData().mLeftFocusableActorId = focusId;
         }
       }
       break;
@@ -1344,7 +1445,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         int focusId;
         if(value.Get(focusId))
         {
-          controlImpl.mImpl->mRightFocusableActorId = focusId;
+          controlImpl.mImpl->EnsureFocusData().mRightFocusableActorId = focusId;
         }
       }
       break;
@@ -1354,7 +1455,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         int focusId;
         if(value.Get(focusId))
         {
-          controlImpl.mImpl->mUpFocusableActorId = focusId;
+          controlImpl.mImpl->EnsureFocusData().mUpFocusableActorId = focusId;
         }
       }
       break;
@@ -1364,7 +1465,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         int focusId;
         if(value.Get(focusId))
         {
-          controlImpl.mImpl->mDownFocusableActorId = focusId;
+          controlImpl.mImpl->EnsureFocusData().mDownFocusableActorId = focusId;
         }
       }
       break;
@@ -1463,7 +1564,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         std::string name;
         if(value.Get(name))
         {
-          controlImpl.mImpl->mAccessibilityName = name;
+          controlImpl.mImpl->EnsureAccessibilityData().mAccessibilityName = name;
         }
         break;
       }
@@ -1473,7 +1574,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         std::string text;
         if(value.Get(text))
         {
-          controlImpl.mImpl->mAccessibilityDescription = text;
+          controlImpl.mImpl->EnsureAccessibilityData().mAccessibilityDescription = text;
         }
         break;
       }
@@ -1483,7 +1584,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         std::string text;
         if(value.Get(text))
         {
-          controlImpl.mImpl->mAccessibilityTranslationDomain = text;
+          controlImpl.mImpl->EnsureAccessibilityData().mAccessibilityTranslationDomain = text;
         }
         break;
       }
@@ -1513,7 +1614,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         const Property::Map* map = value.GetMap();
         if(map && !map->Empty())
         {
-          controlImpl.mImpl->mAccessibilityAttributes = *map;
+          controlImpl.mImpl->EnsureAccessibilityData().mAccessibilityAttributes = *map;
         }
         break;
       }
@@ -1552,7 +1653,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         int focusId;
         if(value.Get(focusId))
         {
-          controlImpl.mImpl->mClockwiseFocusableActorId = focusId;
+          controlImpl.mImpl->EnsureFocusData().mClockwiseFocusableActorId = focusId;
         }
         break;
       }
@@ -1561,7 +1662,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         int focusId;
         if(value.Get(focusId))
         {
-          controlImpl.mImpl->mCounterClockwiseFocusableActorId = focusId;
+          controlImpl.mImpl->EnsureFocusData().mCounterClockwiseFocusableActorId = focusId;
         }
         break;
       }
@@ -1571,7 +1672,7 @@ void Control::Impl::SetProperty(BaseObject* object, Property::Index index, const
         std::string automationId;
         if(value.Get(automationId))
         {
-          controlImpl.mImpl->mAutomationId = automationId;
+          controlImpl.mImpl->EnsureAccessibilityData().mAutomationId = automationId;
         }
         break;
       }
@@ -1613,25 +1714,25 @@ Property::Value Control::Impl::GetProperty(BaseObject* object, Property::Index i
 
       case Toolkit::DevelControl::Property::LEFT_FOCUSABLE_ACTOR_ID:
       {
-        value = controlImpl.mImpl->mLeftFocusableActorId;
+        value = controlImpl.mImpl->mFocusData ? controlImpl.mImpl->mFocusData->mLeftFocusableActorId : -1;
         break;
       }
 
       case Toolkit::DevelControl::Property::RIGHT_FOCUSABLE_ACTOR_ID:
       {
-        value = controlImpl.mImpl->mRightFocusableActorId;
+        value = controlImpl.mImpl->mFocusData ? controlImpl.mImpl->mFocusData->mRightFocusableActorId : -1;
         break;
       }
 
       case Toolkit::DevelControl::Property::UP_FOCUSABLE_ACTOR_ID:
       {
-        value = controlImpl.mImpl->mUpFocusableActorId;
+        value = controlImpl.mImpl->mFocusData ? controlImpl.mImpl->mFocusData->mUpFocusableActorId : -1;
         break;
       }
 
       case Toolkit::DevelControl::Property::DOWN_FOCUSABLE_ACTOR_ID:
       {
-        value = controlImpl.mImpl->mDownFocusableActorId;
+        value = controlImpl.mImpl->mFocusData ? controlImpl.mImpl->mFocusData->mDownFocusableActorId : -1;
         break;
       }
 
@@ -1692,19 +1793,19 @@ Property::Value Control::Impl::GetProperty(BaseObject* object, Property::Index i
 
       case Toolkit::DevelControl::Property::ACCESSIBILITY_NAME:
       {
-        value = controlImpl.mImpl->mAccessibilityName;
+        value = controlImpl.mImpl->mAccessibilityData ? controlImpl.mImpl->mAccessibilityData->mAccessibilityName : std::string();
         break;
       }
 
       case Toolkit::DevelControl::Property::ACCESSIBILITY_DESCRIPTION:
       {
-        value = controlImpl.mImpl->mAccessibilityDescription;
+        value = controlImpl.mImpl->mAccessibilityData ? controlImpl.mImpl->mAccessibilityData->mAccessibilityDescription : std::string();
         break;
       }
 
       case Toolkit::DevelControl::Property::ACCESSIBILITY_TRANSLATION_DOMAIN:
       {
-        value = controlImpl.mImpl->mAccessibilityTranslationDomain;
+        value = controlImpl.mImpl->mAccessibilityData ? controlImpl.mImpl->mAccessibilityData->mAccessibilityTranslationDomain : std::string();
         break;
       }
 
@@ -1722,7 +1823,7 @@ Property::Value Control::Impl::GetProperty(BaseObject* object, Property::Index i
 
       case Toolkit::DevelControl::Property::ACCESSIBILITY_ATTRIBUTES:
       {
-        value = controlImpl.mImpl->mAccessibilityAttributes;
+        value = controlImpl.mImpl->mAccessibilityData ? controlImpl.mImpl->mAccessibilityData->mAccessibilityAttributes : Property::Map();
         break;
       }
 
@@ -1740,19 +1841,19 @@ Property::Value Control::Impl::GetProperty(BaseObject* object, Property::Index i
 
       case Toolkit::DevelControl::Property::CLOCKWISE_FOCUSABLE_ACTOR_ID:
       {
-        value = controlImpl.mImpl->mClockwiseFocusableActorId;
+        value = controlImpl.mImpl->mFocusData ? controlImpl.mImpl->mFocusData->mClockwiseFocusableActorId : -1;
         break;
       }
 
       case Toolkit::DevelControl::Property::COUNTER_CLOCKWISE_FOCUSABLE_ACTOR_ID:
       {
-        value = controlImpl.mImpl->mCounterClockwiseFocusableActorId;
+        value = controlImpl.mImpl->mFocusData ? controlImpl.mImpl->mFocusData->mCounterClockwiseFocusableActorId : -1;
         break;
       }
 
       case Toolkit::DevelControl::Property::AUTOMATION_ID:
       {
-        value = controlImpl.mImpl->mAutomationId;
+        value = controlImpl.mImpl->mAccessibilityData ? controlImpl.mImpl->mAccessibilityData->mAutomationId : std::string();
         break;
       }
     }
@@ -1763,16 +1864,24 @@ Property::Value Control::Impl::GetProperty(BaseObject* object, Property::Index i
 
 void Control::Impl::RemoveAccessibilityAttribute(const std::string& key)
 {
-  Property::Value* value = mAccessibilityAttributes.Find(key);
+  if(!mAccessibilityData)
+  {
+    return;
+  }
+
+  Property::Value* value = mAccessibilityData->mAccessibilityAttributes.Find(key);
   if(value)
   {
-    mAccessibilityAttributes[key] = Property::Value();
+    mAccessibilityData->mAccessibilityAttributes[key] = Property::Value();
   }
 }
 
 void Control::Impl::ClearAccessibilityAttributes()
 {
-  mAccessibilityAttributes.Clear();
+  if(mAccessibilityData)
+  {
+    mAccessibilityData->mAccessibilityAttributes.Clear();
+  }
 }
 
 void Control::Impl::SetAccessibilityReadingInfoType(const Dali::Accessibility::ReadingInfoTypes types)
@@ -1812,7 +1921,7 @@ void Control::Impl::SetAccessibilityReadingInfoType(const Dali::Accessibility::R
 Dali::Accessibility::ReadingInfoTypes Control::Impl::GetAccessibilityReadingInfoType() const
 {
   std::string value{};
-  auto        place = mAccessibilityAttributes.Find(READING_INFO_TYPE_ATTRIBUTE_NAME);
+  auto        place = mAccessibilityData ? mAccessibilityData->mAccessibilityAttributes.Find(READING_INFO_TYPE_ATTRIBUTE_NAME) : nullptr;
   if(place)
   {
     place->Get(value);
@@ -2092,20 +2201,14 @@ void Control::Impl::OnSceneDisconnection()
   SetVisualsOffScene(mVisuals, self);
 
   // Visuals pending replacement can now be taken out of the removal list and set off scene
-  // Iterate through all replacement visuals and add to a move queue then set off scene
-
-  if(!mRemoveVisuals.Empty())
+  // Iterate through all replacement visuals, in the order they were queued, then set off scene
+  while(!mRemoveVisuals.Empty())
   {
-    std::reverse(mRemoveVisuals.Begin(), mRemoveVisuals.End());
+    auto removalIter = mRemoveVisuals.Begin();
+    Toolkit::GetImplementation((*removalIter)->visual).SetOffScene(self);
 
-    while(!mRemoveVisuals.Empty())
-    {
-      auto removalIter = mRemoveVisuals.End() - 1u;
-      Toolkit::GetImplementation((*removalIter)->visual).SetOffScene(self);
-
-      // Discard removed visual. It will be destroyed at next Idle time.
-      DiscardVisual(removalIter, mRemoveVisuals);
-    }
+    // Discard removed visual. It will be destroyed at next Idle time.
+    DiscardVisual(removalIter, mRemoveVisuals);
   }
 
   for(auto replacedIter = mVisuals.Begin(), end = mVisuals.End(); replacedIter != end; replacedIter++)
@@ -2302,6 +2405,16 @@ bool Control::Impl::OnIdleCallback()
 }
 
 std::shared_ptr<Toolkit::DevelControl::ControlAccessible> Control::Impl::GetAccessibleObject()
+{
+  if(!mAccessibleObject && (!gLazyAccessibleCreation || Accessibility::IsUp()))
+  {
+    return EnsureAccessibleObject();
+  }
+
+  return mAccessibleObject;
+}
+
+std::shared_ptr<Toolkit::DevelControl::ControlAccessible> Control::Impl::EnsureAccessibleObject()
 {
   if(mAccessibleCreatable && !mAccessibleObject)
   {
@@ -2326,6 +2439,16 @@ bool Control::Impl::IsCreateAccessibleEnabled() const
   return mAccessibleCreatable;
 }
 
+void Control::Impl::EnableLazyAccessibleCreation(bool enable)
+{
+  gLazyAccessibleCreation = enable;
+}
+
+bool Control::Impl::IsLazyAccessibleCreationEnabled()
+{
+  return gLazyAccessibleCreation;
+}
+
 void Control::Impl::ApplyFittingMode(const Vector2& size)
 {
   Actor self = mControlImpl.Self();
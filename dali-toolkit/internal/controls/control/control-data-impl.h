@@ -41,6 +41,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace Dali
 {
@@ -58,18 +59,207 @@ struct RegisteredVisual
   bool                  enabled : 1;
   bool                  pending : 1;
   bool                  overideReadyTransition : 1;
+  bool                  notReady : 1; ///< Whether the visual is counted as enabled but not ready by its container
 
   RegisteredVisual(Property::Index aIndex, Toolkit::Visual::Base& aVisual, bool aEnabled, bool aPendingReplacement)
   : index(aIndex),
     visual(aVisual),
     enabled(aEnabled),
     pending(aPendingReplacement),
-    overideReadyTransition(false)
+    overideReadyTransition(false),
+    notReady(false)
   {
   }
 };
 
-typedef Dali::OwnerContainer<RegisteredVisual*> RegisteredVisualContainer;
+/**
+ * @brief Container of the registered visuals.
+ *
+ * The visuals are found by their property index or by their visual through a small sorted map, once there are
+ * enough of them for a linear search to cost more. The map, and the number of the enabled visuals which are not
+ * ready, are brought up to date on the first query after a visual is added or removed.
+ *
+ * The visuals are owned by an OwnerContainer which only the mutators below change, so the map cannot get out of date.
+ * The iterators do not allow the elements to be replaced or reordered in place.
+ */
+class RegisteredVisualContainer
+{
+public:
+  using Container     = Dali::OwnerContainer<RegisteredVisual*>;
+  using SizeType      = Container::SizeType;
+  using Iterator      = RegisteredVisual* const*;
+  using ConstIterator = Iterator;
+
+  /**
+   * @copydoc Dali::Vector::Begin()
+   */
+  Iterator Begin() const
+  {
+    return mVisuals.Begin();
+  }
+
+  /**
+   * @copydoc Dali::Vector::End()
+   */
+  Iterator End() const
+  {
+    return mVisuals.End();
+  }
+
+  /**
+   * @brief Support for C++11 Range-based for loop: for( item : container ).
+   * @return The start iterator
+   */
+  Iterator begin() const
+  {
+    return Begin();
+  }
+
+  /**
+   * @brief Support for C++11 Range-based for loop: for( item : container ).
+   * @return The end iterator
+   */
+  Iterator end() const
+  {
+    return End();
+  }
+
+  /**
+   * @copydoc Dali::VectorBase::Count()
+   */
+  SizeType Count() const
+  {
+    return mVisuals.Count();
+  }
+
+  /**
+   * @copydoc Dali::VectorBase::Size()
+   */
+  SizeType Size() const
+  {
+    return mVisuals.Size();
+  }
+
+  /**
+   * @copydoc Dali::VectorBase::Empty()
+   */
+  bool Empty() const
+  {
+    return mVisuals.Empty();
+  }
+
+  /**
+   * @copydoc Dali::Vector::operator[]()
+   */
+  RegisteredVisual* operator[](SizeType index) const
+  {
+    return mVisuals[index];
+  }
+
+  /**
+   * @copydoc Dali::Vector::PushBack()
+   */
+  void PushBack(RegisteredVisual* element)
+  {
+    mVisuals.PushBack(element);
+    mDirty = true;
+  }
+
+  /**
+   * @copydoc Dali::OwnerContainer::Erase()
+   */
+  Iterator Erase(Iterator position)
+  {
+    mDirty = true;
+    return mVisuals.Erase(ToContainerIterator(position));
+  }
+
+  /**
+   * @copydoc Dali::OwnerContainer::Release()
+   */
+  RegisteredVisual* Release(Iterator position)
+  {
+    mDirty = true;
+    return mVisuals.Release(ToContainerIterator(position));
+  }
+
+  /**
+   * @copydoc Dali::OwnerContainer::Clear()
+   */
+  void Clear()
+  {
+    mDirty = true;
+    mVisuals.Clear();
+  }
+
+  /**
+   * @brief Finds the first visual registered with the property index.
+   * @param[in] index The property index
+   * @param[out] iter The iterator of the visual, if found
+   * @return true if found
+   */
+  bool Find(Property::Index index, Iterator& iter) const;
+
+  /**
+   * @brief Finds the first entry of the visual.
+   * @param[in] visual The visual
+   * @param[out] iter The iterator of the visual, if found
+   * @return true if found
+   */
+  bool Find(const Visual::Base& visual, Iterator& iter) const;
+
+  /**
+   * @brief Updates the number of the enabled visuals which are not ready, after a visual is enabled, disabled or its resource status changes.
+   * @param[in] iter The iterator of the visual
+   */
+  void UpdateReadyState(Iterator iter);
+
+  /**
+   * @brief Retrieves the number of the enabled visuals which are not ready.
+   *
+   * The visuals which stop being ready without notifying their observer are counted once the container is updated,
+   * so zero is to be confirmed by CountNotReadyVisuals().
+   * @return The number of the enabled visuals which are not ready
+   */
+  uint32_t GetNotReadyVisualCount() const;
+
+  /**
+   * @brief Counts the enabled visuals which are not ready, checking every visual.
+   * @return The number of the enabled visuals which are not ready
+   */
+  uint32_t CountNotReadyVisuals() const;
+
+private:
+  /**
+   * @brief Converts an iterator to the iterator of the owner container, to change it.
+   * @param[in] position The iterator
+   * @return The iterator of the owner container
+   */
+  Container::Iterator ToContainerIterator(Iterator position)
+  {
+    return mVisuals.Begin() + (position - Begin());
+  }
+
+  /**
+   * @brief Rebuilds the lookup maps and the number of the visuals which are not ready, if a visual was added or removed.
+   */
+  void Update() const;
+
+private:
+  /**
+   * @brief The positions of the visuals sorted by their property index and by their visual.
+   */
+  struct Lookup
+  {
+    std::vector<std::pair<Property::Index, uint32_t>>     indices;
+    std::vector<std::pair<const Visual::Base*, uint32_t>> visuals;
+  };
+
+  Container                       mVisuals;                ///< The registered visuals, which are owned
+  mutable std::unique_ptr<Lookup> mLookup;                ///< Allocated once there are enough visuals to search
+  mutable uint32_t                mNotReadyVisualCount{0}; ///< The number of the enabled visuals which are not ready
+  mutable bool                    mDirty{false};           ///< Whether a visual was added or removed since the last update
+};
 
 /**
  * @brief Holds the Implementation for the internal control class
@@ -458,6 +648,13 @@ public:
    */
   std::shared_ptr<Toolkit::DevelControl::ControlAccessible> GetAccessibleObject();
 
+  /**
+   * @brief Retrieves the accessible object, creating it even if the creation is deferred until the accessibility bridge is up.
+   * The accessible objects which others keep, e.g. as the targets of the relations, are created with this.
+   * @return The accessible object, or nullptr if its creation is not enabled
+   */
+  std::shared_ptr<Toolkit::DevelControl::ControlAccessible> EnsureAccessibleObject();
+
   /**
    * @copydoc Dali::Toolkit::DevelControl::IsAccessibleCreated()
    */
@@ -473,6 +670,16 @@ public:
    */
   bool IsCreateAccessibleEnabled() const;
 
+  /**
+   * @copydoc Dali::Toolkit::DevelControl::EnableLazyAccessibleCreation()
+   */
+  static void EnableLazyAccessibleCreation(bool enable);
+
+  /**
+   * @copydoc Dali::Toolkit::DevelControl::IsLazyAccessibleCreationEnabled()
+   */
+  static bool IsLazyAccessibleCreationEnabled();
+
   /**
    * @brief Apply fittingMode
    *
@@ -586,63 +793,130 @@ private:
   void OnAccessibilityPropertySet(Dali::Handle& handle, Dali::Property::Index index, const Dali::Property::Value& value);
 
 public:
+  /**
+   * @brief The accessibility data which only the controls given accessibility names, attributes, relations or signals use.
+   */
+  struct AccessibilityData
+  {
+    Property::Map mAccessibilityAttributes;
+
+    Toolkit::DevelControl::AccessibilityActivateSignalType         mAccessibilityActivateSignal;
+    Toolkit::DevelControl::AccessibilityReadingSkippedSignalType   mAccessibilityReadingSkippedSignal;
+    Toolkit::DevelControl::AccessibilityReadingPausedSignalType    mAccessibilityReadingPausedSignal;
+    Toolkit::DevelControl::AccessibilityReadingResumedSignalType   mAccessibilityReadingResumedSignal;
+    Toolkit::DevelControl::AccessibilityReadingCancelledSignalType mAccessibilityReadingCancelledSignal;
+    Toolkit::DevelControl::AccessibilityReadingStoppedSignalType   mAccessibilityReadingStoppedSignal;
+
+    Toolkit::DevelControl::AccessibilityGetNameSignalType        mAccessibilityGetNameSignal;
+    Toolkit::DevelControl::AccessibilityGetDescriptionSignalType mAccessibilityGetDescriptionSignal;
+    Toolkit::DevelControl::AccessibilityDoGestureSignalType      mAccessibilityDoGestureSignal;
+
+    std::string mAccessibilityName;
+    std::string mAccessibilityDescription;
+    std::string mAccessibilityTranslationDomain;
+    std::string mAutomationId;
+
+    std::map<Dali::Accessibility::RelationType, std::set<Accessibility::Accessible*>> mAccessibilityRelations;
+
+    // Notification for highlighted object to check if it is showing.
+    Dali::PropertyNotification                  mAccessibilityPositionNotification;
+    Dali::Accessibility::ScreenRelativeMoveType mAccessibilityLastScreenRelativeMoveType{Accessibility::ScreenRelativeMoveType::OUTSIDE};
+    bool                                        mIsAccessibilityPositionPropertyNotificationSet{false};
+    bool                                        mIsAccessibilityPropertySetSignalRegistered{false};
+  };
+
+  /**
+   * @brief The gesture detectors, which only the controls enabling gesture detection use.
+   */
+  struct GestureData
+  {
+    PinchGestureDetector     mPinchGestureDetector;
+    PanGestureDetector       mPanGestureDetector;
+    TapGestureDetector       mTapGestureDetector;
+    LongPressGestureDetector mLongPressGestureDetector;
+    Vector3                  mStartingPinchScale; ///< The scale when a pinch gesture starts
+  };
+
+  /**
+   * @brief The actors to move the keyboard focus to, which only the controls given them use.
+   */
+  struct FocusData
+  {
+    int mLeftFocusableActorId{-1};             ///< Actor ID of Left focusable control.
+    int mRightFocusableActorId{-1};            ///< Actor ID of Right focusable control.
+    int mUpFocusableActorId{-1};               ///< Actor ID of Up focusable control.
+    int mDownFocusableActorId{-1};             ///< Actor ID of Down focusable control.
+    int mClockwiseFocusableActorId{-1};        ///< Actor ID of Clockwise focusable control.
+    int mCounterClockwiseFocusableActorId{-1}; ///< Actor ID of Counter clockwise focusable control.
+  };
+
+  /**
+   * @brief Retrieves the accessibility data, allocating it if it is not yet.
+   */
+  AccessibilityData& EnsureAccessibilityData()
+  {
+    if(!mAccessibilityData)
+    {
+      mAccessibilityData.reset(new AccessibilityData());
+    }
+    return *mAccessibilityData;
+  }
+
+  /**
+   * @brief Retrieves the gesture data, allocating it if it is not yet.
+   */
+  GestureData& EnsureGestureData()
+  {
+    if(!mGestureData)
+    {
+      mGestureData.reset(new GestureData());
+    }
+    return *mGestureData;
+  }
+
+  /**
+   * @brief Retrieves the focus data, allocating it if it is not yet.
+   */
+  FocusData& EnsureFocusData()
+  {
+    if(!mFocusData)
+    {
+      mFocusData.reset(new FocusData());
+    }
+    return *mFocusData;
+  }
+
   Control&            mControlImpl;
   DevelControl::State mState;
   std::string         mSubStateName;
-  Property::Map       mAccessibilityAttributes;
-
-  int mLeftFocusableActorId;             ///< Actor ID of Left focusable control.
-  int mRightFocusableActorId;            ///< Actor ID of Right focusable control.
-  int mUpFocusableActorId;               ///< Actor ID of Up focusable control.
-  int mDownFocusableActorId;             ///< Actor ID of Down focusable control.
-  int mClockwiseFocusableActorId;        ///< Actor ID of Clockwise focusable control.
-  int mCounterClockwiseFocusableActorId; ///< Actor ID of Counter clockwise focusable control.
 
   RegisteredVisualContainer                 mVisuals; ///< Stores visuals needed by the control, non trivial type so std::vector used.
   std::string                               mStyleName;
-  Vector4                                   mBackgroundColor;    ///< The color of the background visual
-  RenderEffect                              mRenderEffect;       ///< The render effect on this control
-  Vector3*                                  mStartingPinchScale; ///< The scale when a pinch gesture starts, TODO: consider removing this
-  Extents                                   mMargin;             ///< The margin values
-  Extents                                   mPadding;            ///< The padding values
-  Vector2                                   mSize;               ///< The size of the control
+  Vector4                                   mBackgroundColor; ///< The color of the background visual
+  RenderEffect                              mRenderEffect;    ///< The render effect on this control
+  Extents                                   mMargin;          ///< The margin values
+  Extents                                   mPadding;         ///< The padding values
+  Vector2                                   mSize;            ///< The size of the control
   Toolkit::Control::KeyEventSignalType      mKeyEventSignal;
   Toolkit::Control::KeyInputFocusSignalType mKeyInputFocusGainedSignal;
   Toolkit::Control::KeyInputFocusSignalType mKeyInputFocusLostSignal;
   Toolkit::Control::ResourceReadySignalType mResourceReadySignal;
   DevelControl::VisualEventSignalType       mVisualEventSignal;
 
-  // Accessibility
-  Toolkit::DevelControl::AccessibilityActivateSignalType         mAccessibilityActivateSignal;
-  Toolkit::DevelControl::AccessibilityReadingSkippedSignalType   mAccessibilityReadingSkippedSignal;
-  Toolkit::DevelControl::AccessibilityReadingPausedSignalType    mAccessibilityReadingPausedSignal;
-  Toolkit::DevelControl::AccessibilityReadingResumedSignalType   mAccessibilityReadingResumedSignal;
-  Toolkit::DevelControl::AccessibilityReadingCancelledSignalType mAccessibilityReadingCancelledSignal;
-  Toolkit::DevelControl::AccessibilityReadingStoppedSignalType   mAccessibilityReadingStoppedSignal;
-
-  Toolkit::DevelControl::AccessibilityGetNameSignalType        mAccessibilityGetNameSignal;
-  Toolkit::DevelControl::AccessibilityGetDescriptionSignalType mAccessibilityGetDescriptionSignal;
-  Toolkit::DevelControl::AccessibilityDoGestureSignalType      mAccessibilityDoGestureSignal;
-
-  std::string mAccessibilityName;
-  std::string mAccessibilityDescription;
-  std::string mAccessibilityTranslationDomain;
-  std::string mAutomationId;
+  // Accessibility; most of the controls only have a role
+  std::unique_ptr<AccessibilityData>                        mAccessibilityData;
+  std::shared_ptr<Toolkit::DevelControl::ControlAccessible> mAccessibleObject;
+  Dali::Accessibility::Role                                 mAccessibilityRole = Dali::Accessibility::Role::UNKNOWN;
 
   bool mAccessibilityHighlightable = false;
   bool mAccessibilityHidden        = false;
   bool mAccessibleCreatable        = true;
 
-  Dali::Accessibility::Role mAccessibilityRole = Dali::Accessibility::Role::UNKNOWN;
-
-  std::map<Dali::Accessibility::RelationType, std::set<Accessibility::Accessible*>> mAccessibilityRelations;
-  std::shared_ptr<Toolkit::DevelControl::ControlAccessible>                         mAccessibleObject;
-
   // Gesture Detection
-  PinchGestureDetector     mPinchGestureDetector;
-  PanGestureDetector       mPanGestureDetector;
-  TapGestureDetector       mTapGestureDetector;
-  LongPressGestureDetector mLongPressGestureDetector;
+  std::unique_ptr<GestureData> mGestureData;
+
+  // Keyboard focus
+  std::unique_ptr<FocusData> mFocusData;
 
   // Tooltip
   TooltipPtr mTooltip;
@@ -687,13 +961,6 @@ public:
   static const PropertyRegistration PROPERTY_24;
   static const PropertyRegistration PROPERTY_25;
   static const PropertyRegistration PROPERTY_26;
-
-private:
-  // Accessibility - notification for highlighted object to check if it is showing.
-  bool                                        mIsAccessibilityPositionPropertyNotificationSet{false};
-  bool                                        mIsAccessibilityPropertySetSignalRegistered{false};
-  Dali::PropertyNotification                  mAccessibilityPositionNotification;
-  Dali::Accessibility::ScreenRelativeMoveType mAccessibilityLastScreenRelativeMoveType{Accessibility::ScreenRelativeMoveType::OUTSIDE};
 };
 
 } // namespace Internal
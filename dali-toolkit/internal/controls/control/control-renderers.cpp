@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -90,7 +90,11 @@ Geometry CreateGridGeometry(Uint16Pair gridSize)
 Dali::Renderer CreateRenderer(std::string_view vertexSrc, std::string_view fragmentSrc)
 {
   Dali::Shader shader = Dali::Shader::New(vertexSrc, fragmentSrc);
+  return CreateRenderer(shader);
+}
 
+Dali::Renderer CreateRenderer(Dali::Shader shader)
+{
   Dali::Geometry texturedQuadGeometry = Dali::Geometry::New();
 
   struct VertexPosition
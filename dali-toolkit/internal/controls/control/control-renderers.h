@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_INTERNAL_CONTROL_RENDERERS_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -37,6 +37,13 @@ namespace Internal
  */
 Dali::Renderer CreateRenderer(std::string_view vertexSrc, std::string_view fragmentSrc);
 
+/**
+ * Helper method for rendering an image with a shader already created, e.g. a cached one.
+ * @param[in] shader The shader.
+ * @return A newly created renderer.
+ */
+Dali::Renderer CreateRenderer(Dali::Shader shader);
+
 /**
  * Helper method for rendering an image with custom shader.
  * @param[in] vertextSrc The custom vertex shader.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -608,10 +608,13 @@ void FlexContainer::ComputeLayout()
       Actor     childActor = mChildrenNodes[i].actor.GetHandle();
 
       // Intialize the style of the child.
-      YGNodeStyleSetMinWidth(childNode, childActor.GetProperty<Vector2>(Actor::Property::MINIMUM_SIZE).x);
-      YGNodeStyleSetMinHeight(childNode, childActor.GetProperty<Vector2>(Actor::Property::MINIMUM_SIZE).y);
-      YGNodeStyleSetMaxWidth(childNode, childActor.GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE).x);
-      YGNodeStyleSetMaxHeight(childNode, childActor.GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE).y);
+      // Yoga only marks the node (and its ancestors) dirty when a style value actually changes.
+      const Vector2 minimumSize = childActor.GetProperty<Vector2>(Actor::Property::MINIMUM_SIZE);
+      const Vector2 maximumSize = childActor.GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE);
+      YGNodeStyleSetMinWidth(childNode, minimumSize.x);
+      YGNodeStyleSetMinHeight(childNode, minimumSize.y);
+      YGNodeStyleSetMaxWidth(childNode, maximumSize.x);
+      YGNodeStyleSetMaxHeight(childNode, maximumSize.y);
 
       // Check child properties on the child for how to layout it.
       // These properties should be dynamically registered to the child which
@@ -674,13 +677,25 @@ void FlexContainer::ComputeLayout()
       }
     }
 
+    const Vector2 availableSize = Self().GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE);
+
+    // Skip the calculation if no style in the tree changed since the last one.
+    if(mLayoutValid && !YGNodeIsDirty(mRootNode.node) && mLastAvailableSize == availableSize && mLastLayoutDirection == nodeLayoutDirection)
+    {
+      return;
+    }
+
 #if defined(FLEX_CONTAINER_DEBUG)
     YGNodePrint(mRootNode.node, (YGPrintOptions)(YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren));
 #endif
-    YGNodeCalculateLayout(mRootNode.node, Self().GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE).x, Self().GetProperty<Vector2>(Actor::Property::MAXIMUM_SIZE).y, nodeLayoutDirection);
+    YGNodeCalculateLayout(mRootNode.node, availableSize.x, availableSize.y, nodeLayoutDirection);
 #if defined(FLEX_CONTAINER_DEBUG)
     YGNodePrint(mRootNode.node, (YGPrintOptions)(YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren));
 #endif
+
+    mLastAvailableSize   = availableSize;
+    mLastLayoutDirection = nodeLayoutDirection;
+    mLayoutValid         = true;
   }
 }
 
@@ -692,10 +707,12 @@ void FlexContainer::RelayoutChildren()
   for(unsigned int i = 0; i < mChildrenNodes.size(); i++)
   {
     Dali::Actor child = mChildrenNodes[i].actor.GetHandle();
-    if(child)
+    if(child && YGNodeGetHasNewLayout(mChildrenNodes[i].node))
     {
+      // Only the nodes visited by the last calculation can have moved.
       child.SetProperty(Actor::Property::POSITION_X, YGNodeLayoutGetLeft(mChildrenNodes[i].node));
       child.SetProperty(Actor::Property::POSITION_Y, YGNodeLayoutGetTop(mChildrenNodes[i].node));
+      YGNodeSetHasNewLayout(mChildrenNodes[i].node, false);
     }
   }
 }
@@ -809,7 +826,10 @@ FlexContainer::FlexContainer()
   mFlexWrap(Toolkit::FlexContainer::NO_WRAP),
   mJustifyContent(Toolkit::FlexContainer::JUSTIFY_FLEX_START),
   mAlignItems(Toolkit::FlexContainer::ALIGN_STRETCH),
-  mAlignContent(Toolkit::FlexContainer::ALIGN_FLEX_START)
+  mAlignContent(Toolkit::FlexContainer::ALIGN_FLEX_START),
+  mLastAvailableSize(Vector2::ZERO),
+  mLastLayoutDirection(YGDirectionInherit),
+  mLayoutValid(false)
 {
   SetKeyboardNavigationSupport(true);
 }
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_INTERNAL_FLEX_CONTAINER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -234,6 +234,10 @@ private:                                // Data
   Toolkit::FlexContainer::Justification    mJustifyContent;   ///< The alignment of flex items in the container on the main-axis
   Toolkit::FlexContainer::Alignment        mAlignItems;       ///< The alignment of flex items in the container on the cross-axis
   Toolkit::FlexContainer::Alignment        mAlignContent;     ///< The alignment of flex lines in the container on the cross-axis
+
+  Vector2     mLastAvailableSize;   ///< The available size used by the last layout calculation
+  YGDirection mLastLayoutDirection; ///< The layout direction used by the last layout calculation
+  bool        mLayoutValid;         ///< Whether the last layout calculation can be reused while the tree is not dirty
 };
 
 } // namespace Internal
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -69,6 +69,9 @@
 // mVertBlurTask renders mVertBlurActor Actor showing mRenderTarget2 into FB mUserOutputRenderTarget
 //
 // Only this 2nd mode handles ActivateOnce
+//
+// With BlurAlgorithm::DUAL_KAWASE, mDualKawaseBlurFilter replaces mHorizBlurTask and mVertBlurTask in both modes. It downsamples the input
+// to half the size of the render targets and further, then upsamples back into FB mRenderTarget1 or FB mUserOutputRenderTarget
 
 namespace Dali
 {
@@ -105,6 +108,7 @@ GaussianBlurView::GaussianBlurView()
   mNumSamples(GAUSSIAN_BLUR_VIEW_DEFAULT_NUM_SAMPLES),
   mBlurBellCurveWidth(0.001f),
   mPixelFormat(GAUSSIAN_BLUR_VIEW_DEFAULT_RENDER_TARGET_PIXEL_FORMAT),
+  mBlurAlgorithm(Toolkit::BlurAlgorithm::GAUSSIAN),
   mDownsampleWidthScale(GAUSSIAN_BLUR_VIEW_DEFAULT_DOWNSAMPLE_WIDTH_SCALE),
   mDownsampleHeightScale(GAUSSIAN_BLUR_VIEW_DEFAULT_DOWNSAMPLE_HEIGHT_SCALE),
   mDownsampledWidth(0.0f),
@@ -132,6 +136,7 @@ GaussianBlurView::GaussianBlurView(const unsigned int  numSamples,
   mNumSamples(numSamples),
   mBlurBellCurveWidth(0.001f),
   mPixelFormat(renderTargetPixelFormat),
+  mBlurAlgorithm(Toolkit::BlurAlgorithm::GAUSSIAN),
   mDownsampleWidthScale(downsampleWidthScale),
   mDownsampleHeightScale(downsampleHeightScale),
   mDownsampledWidth(0.0f),
@@ -189,6 +194,12 @@ void GaussianBlurView::SetUserImageAndOutputRenderTarget(Texture inputImage, Fra
   SetRendererTexture(mHorizBlurActor.GetRendererAt(0), inputImage);
 
   mUserOutputRenderTarget = outputRenderTarget;
+
+  if(mActivated && mBlurAlgorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+  {
+    mDualKawaseBlurFilter.Disable();
+    EnableDualKawaseBlurFilter();
+  }
 }
 
 FrameBuffer GaussianBlurView::GetBlurredRenderTarget() const
@@ -211,6 +222,26 @@ Vector4 GaussianBlurView::GetBackgroundColor() const
   return mBackgroundColor;
 }
 
+void GaussianBlurView::SetBlurAlgorithm(Toolkit::BlurAlgorithm::Type algorithm)
+{
+  if(mBlurAlgorithm != algorithm)
+  {
+    mBlurAlgorithm = algorithm;
+
+    // recreate the render tasks for the new algorithm
+    if(mActivated)
+    {
+      Deactivate();
+      Activate();
+    }
+  }
+}
+
+Toolkit::BlurAlgorithm::Type GaussianBlurView::GetBlurAlgorithm() const
+{
+  return mBlurAlgorithm;
+}
+
 ///////////////////////////////////////////////////////////
 //
 // Private methods
@@ -394,6 +425,12 @@ void GaussianBlurView::AllocateResources()
     SetRendererTexture(mTargetActor.GetRendererAt(0), mRenderTargetForRenderingChildren);
   }
 
+  // the dual Kawase filter allocates its own intermediate buffers when it is enabled
+  if(mBlurAlgorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+  {
+    return;
+  }
+
   // Create offscreen buffer for horiz blur pass
   mRenderTarget2  = FrameBuffer::New(mDownsampledWidth, mDownsampledHeight, FrameBuffer::Attachment::NONE);
   Texture texture = Texture::New(TextureType::TEXTURE_2D, mPixelFormat, unsigned(mDownsampledWidth), unsigned(mDownsampledHeight));
@@ -433,6 +470,36 @@ void GaussianBlurView::CreateRenderTasks()
     }
   }
 
+  if(mBlurAlgorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+  {
+    // blur into the first buffer with a chain of downsampling and upsampling passes
+    EnableDualKawaseBlurFilter();
+  }
+  else
+  {
+    CreateGaussianBlurTasks(taskList);
+  }
+
+  // use the completed blur in the first buffer and composite with the original child actors render
+  if(!mBlurUserImage)
+  {
+    mCompositeTask = taskList.CreateTask();
+    mCompositeTask.SetSourceActor(mCompositingActor);
+    mCompositeTask.SetExclusive(true);
+    mCompositeTask.SetInputEnabled(false);
+
+    mCompositeTask.SetCameraActor(mRenderFullSizeCamera);
+    mCompositeTask.SetFrameBuffer(mRenderTargetForRenderingChildren);
+
+    if(mRenderOnce)
+    {
+      mCompositeTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
+    }
+  }
+}
+
+void GaussianBlurView::CreateGaussianBlurTasks(RenderTaskList taskList)
+{
   // perform a horizontal blur targeting the second buffer
   mHorizBlurTask = taskList.CreateTask();
   mHorizBlurTask.SetSourceActor(mHorizBlurActor);
@@ -468,22 +535,24 @@ void GaussianBlurView::CreateRenderTasks()
     mVertBlurTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
     mVertBlurTask.FinishedSignal().Connect(this, &GaussianBlurView::OnRenderTaskFinished);
   }
+}
 
-  // use the completed blur in the first buffer and composite with the original child actors render
-  if(!mBlurUserImage)
+void GaussianBlurView::EnableDualKawaseBlurFilter()
+{
+  // the blur covers about as many pixels of the downsampled targets as the Gaussian kernel of mNumSamples does
+  mDualKawaseBlurFilter.SetRootActor(mInternalRoot);
+  mDualKawaseBlurFilter.SetSize(Vector2(mDownsampledWidth, mDownsampledHeight));
+  mDualKawaseBlurFilter.SetRadius(static_cast<float>(mNumSamples));
+  mDualKawaseBlurFilter.SetPixelFormat(mPixelFormat);
+  mDualKawaseBlurFilter.SetBackgroundColor(mBackgroundColor);
+  mDualKawaseBlurFilter.SetRefreshOnDemand(mRenderOnce);
+  mDualKawaseBlurFilter.SetInputTexture(mBlurUserImage ? mUserInputImage : mRenderTargetForRenderingChildren.GetColorTexture());
+  mDualKawaseBlurFilter.SetOutputFrameBuffer(mUserOutputRenderTarget ? mUserOutputRenderTarget : mRenderTarget1);
+  mDualKawaseBlurFilter.Enable();
+
+  if(mRenderOnce)
   {
-    mCompositeTask = taskList.CreateTask();
-    mCompositeTask.SetSourceActor(mCompositingActor);
-    mCompositeTask.SetExclusive(true);
-    mCompositeTask.SetInputEnabled(false);
-
-    mCompositeTask.SetCameraActor(mRenderFullSizeCamera);
-    mCompositeTask.SetFrameBuffer(mRenderTargetForRenderingChildren);
-
-    if(mRenderOnce)
-    {
-      mCompositeTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
-    }
+    mDualKawaseBlurFilter.GetOutputRenderTask().FinishedSignal().Connect(this, &GaussianBlurView::OnRenderTaskFinished);
   }
 }
 
@@ -492,8 +561,14 @@ void GaussianBlurView::RemoveRenderTasks()
   RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
 
   taskList.RemoveTask(mRenderChildrenTask);
-  taskList.RemoveTask(mHorizBlurTask);
-  taskList.RemoveTask(mVertBlurTask);
+  if(mHorizBlurTask)
+  {
+    taskList.RemoveTask(mHorizBlurTask);
+    taskList.RemoveTask(mVertBlurTask);
+    mHorizBlurTask.Reset();
+    mVertBlurTask.Reset();
+  }
+  mDualKawaseBlurFilter.Disable();
   taskList.RemoveTask(mCompositeTask);
 }
 
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_INTERNAL_GAUSSIAN_BLUR_EFFECT_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/gaussian-blur-view/gaussian-blur-view.h>
+#include <dali-toolkit/internal/filters/dual-kawase-blur-filter.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/image-view/image-view.h>
 
@@ -81,6 +82,12 @@ public:
   /// @copydoc Dali::Toolkit::GaussianBlurView::GetBackgroundColor
   Vector4 GetBackgroundColor() const;
 
+  /// @copydoc Dali::Toolkit::GaussianBlurView::SetBlurAlgorithm
+  void SetBlurAlgorithm(Toolkit::BlurAlgorithm::Type algorithm);
+
+  /// @copydoc Dali::Toolkit::GaussianBlurView::GetBlurAlgorithm
+  Toolkit::BlurAlgorithm::Type GetBlurAlgorithm() const;
+
   void                                                     AllocateResources();
   void                                                     CreateRenderTasks();
   void                                                     RemoveRenderTasks();
@@ -108,11 +115,24 @@ private:
 
   void OnRenderTaskFinished(Dali::RenderTask& renderTask);
 
+  /**
+   * Creates the render tasks of the separated horizontal and vertical Gaussian passes.
+   * @param[in] taskList The render task list to create them in.
+   */
+  void CreateGaussianBlurTasks(RenderTaskList taskList);
+
+  /**
+   * Sets up the dual Kawase filter with the current input and output, and creates its render tasks.
+   */
+  void EnableDualKawaseBlurFilter();
+
   /////////////////////////////////////////////////////////////
   unsigned int  mNumSamples;         // number of blur samples in each of horiz/vert directions
   float         mBlurBellCurveWidth; // constant used when calculating the gaussian weights
   Pixel::Format mPixelFormat;        // pixel format used by render targets
 
+  Toolkit::BlurAlgorithm::Type mBlurAlgorithm; // whether the separated Gaussian passes or the dual Kawase filter blur the image
+
   /////////////////////////////////////////////////////////////
   // downsampling is used for the separated blur passes to get increased blur with the same number of samples and also to make rendering quicker
   float mDownsampleWidthScale;
@@ -164,6 +184,10 @@ private:
   RenderTask mHorizBlurTask;
   RenderTask mVertBlurTask;
 
+  /////////////////////////////////////////////////////////////
+  // for the blur with BlurAlgorithm::DUAL_KAWASE, instead of the separated passes
+  DualKawaseBlurFilter mDualKawaseBlurFilter;
+
   /////////////////////////////////////////////////////////////
   // for compositing blur and children renders to offscreen target
   Actor      mCompositingActor;
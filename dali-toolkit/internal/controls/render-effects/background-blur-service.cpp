@@ -0,0 +1,649 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/render-effects/background-blur-service.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/common/stage.h>
+#include <dali/integration-api/scene.h>
+#include <dali/public-api/animation/constraints.h>
+#include <dali/public-api/math/math-utils.h>
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/controls/render-effects/blur-effect-impl.h>
+#include <dali-toolkit/internal/controls/render-effects/render-effect-impl.h>
+#include <dali-toolkit/internal/visuals/visual-factory-impl.h>
+#include <dali-toolkit/public-api/visuals/visual-factory.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+static constexpr int32_t BLUR_EFFECT_ORDER_INDEX = 101;
+
+static const Vector4 FULL_TEXTURE_RECT(0.0f, 0.0f, 1.0f, 1.0f);
+
+/**
+ * @brief Calculates the area of the control in the texture of the whole window.
+ * The world position is the center of the control, and the origin of the world is the center of the window.
+ */
+struct TextureRectConstraint
+{
+  TextureRectConstraint(const Vector2& windowSize)
+  : mWindowSize(windowSize)
+  {
+  }
+
+  void operator()(Vector4& current, const PropertyInputContainer& inputs)
+  {
+    const Vector3& worldPosition = inputs[0]->GetVector3();
+    const Vector3& size          = inputs[1]->GetVector3();
+    const Vector3& worldScale    = inputs[2]->GetVector3();
+
+    const float width  = size.width * worldScale.x;
+    const float height = size.height * worldScale.y;
+
+    current.x = (worldPosition.x - width * 0.5f) / mWindowSize.width + 0.5f;
+    current.y = (worldPosition.y - height * 0.5f) / mWindowSize.height + 0.5f;
+    current.z = width / mWindowSize.width;
+    current.w = height / mWindowSize.height;
+  }
+
+  Vector2 mWindowSize;
+};
+
+CameraActor CreateCamera(float width, float height)
+{
+  const float cameraPosConstraintScale = 0.5f / tanf(Math::PI / 4.0f * 0.5f);
+
+  CameraActor camera = CameraActor::New();
+  camera.SetInvertYAxis(true);
+  camera.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  camera.SetNearClippingPlane(1.0f);
+  camera.SetType(Dali::Camera::FREE_LOOK);
+  camera.SetFieldOfView(Math::PI / 4.0f);
+  camera.SetAspectRatio(width / height);
+  camera.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, cameraPosConstraintScale * height));
+  return camera;
+}
+
+FrameBuffer CreateFrameBuffer(uint32_t width, uint32_t height)
+{
+  FrameBuffer frameBuffer = FrameBuffer::New(width, height, FrameBuffer::Attachment::NONE);
+  Texture     texture     = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, width, height);
+  frameBuffer.AttachColorTexture(texture);
+  return frameBuffer;
+}
+
+/**
+ * @brief Retrieves the position of an actor in the order its window is drawn in, to compare with the others.
+ * The layers are drawn from the bottom, and the actors of a layer in the order of the tree.
+ * @note The depth indices of the renderers are not considered.
+ */
+std::vector<int32_t> GetDrawOrder(Actor actor)
+{
+  std::vector<int32_t> drawOrder;
+
+  Layer layer = actor.GetLayer();
+  for(Actor current = actor; current && current != layer; current = current.GetParent())
+  {
+    drawOrder.push_back(current.GetProperty<int32_t>(DevelActor::Property::SIBLING_ORDER));
+  }
+  drawOrder.push_back(layer ? static_cast<int32_t>(layer.GetDepth()) : 0);
+
+  // From the layer down to the actor, so a parent comes before its children.
+  std::reverse(drawOrder.begin(), drawOrder.end());
+  return drawOrder;
+}
+
+/**
+ * @brief A registered control on the scene, and its position in the draw order.
+ */
+struct DrawnControl
+{
+  std::vector<int32_t> drawOrder;
+  Toolkit::Control     control;
+  std::size_t          clientIndex;
+};
+
+/**
+ * @brief Marks the controls before which an actor with renderers is drawn, after the previous control.
+ * @param[in] actor The actor to search from.
+ * @param[in] internalRoot The actors of the service, which are not drawn by the window.
+ * @param[in] drawnControls The registered controls, sorted by the draw order.
+ * @param[in,out] drawnBetween Whether an actor is drawn between each control and the previous one.
+ */
+void FindActorsDrawnBetween(Actor actor, const Actor& internalRoot, const std::vector<DrawnControl>& drawnControls, std::vector<bool>& drawnBetween)
+{
+  if(actor == internalRoot || !actor.GetProperty<bool>(Actor::Property::VISIBLE))
+  {
+    return;
+  }
+
+  // The children of a control are expected in the area of the control.
+  if(std::any_of(drawnControls.begin(), drawnControls.end(), [&actor](const DrawnControl& drawnControl) { return drawnControl.control == actor; }))
+  {
+    return;
+  }
+
+  if(actor.GetRendererCount() > 0u)
+  {
+    const std::vector<int32_t> drawOrder = GetDrawOrder(actor);
+
+    auto iter = std::upper_bound(drawnControls.begin(), drawnControls.end(), drawOrder, [](const std::vector<int32_t>& order, const DrawnControl& drawnControl) { return order < drawnControl.drawOrder; });
+    if(iter != drawnControls.begin() && iter != drawnControls.end())
+    {
+      drawnBetween[iter - drawnControls.begin()] = true;
+    }
+  }
+
+  for(uint32_t i = 0u, count = actor.GetChildCount(); i < count; ++i)
+  {
+    FindActorsDrawnBetween(actor.GetChildAt(i), internalRoot, drawnControls, drawnBetween);
+  }
+}
+
+} // namespace
+
+BackgroundBlurServicePtr BackgroundBlurService::Get(Actor actor)
+{
+  Layer          rootLayer;
+  RenderTaskList taskList;
+  Vector2        windowSize;
+
+  Integration::Scene scene = Integration::Scene::Get(actor);
+  if(scene)
+  {
+    rootLayer  = scene.GetRootLayer();
+    taskList   = scene.GetRenderTaskList();
+    windowSize = scene.GetSize();
+  }
+  else
+  {
+    Stage stage = Stage::GetCurrent();
+    rootLayer   = stage.GetRootLayer();
+    taskList    = stage.GetRenderTaskList();
+    windowSize  = stage.GetSize();
+  }
+
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+  for(auto&& service : GetImplementation(factory).GetBackgroundBlurServices())
+  {
+    if(service->mRootLayer.GetHandle() == rootLayer)
+    {
+      return service;
+    }
+  }
+
+  return new BackgroundBlurService(rootLayer, taskList, windowSize);
+}
+
+BackgroundBlurService::BackgroundBlurService(Layer rootLayer, RenderTaskList taskList, const Vector2& windowSize)
+: mVisualFactory(Toolkit::VisualFactory::Get()),
+  mRootLayer(rootLayer),
+  mTaskList(taskList),
+  mWindowSize(std::max(windowSize.width, 1.0f), std::max(windowSize.height, 1.0f)),
+  mInternalRoot(Actor::New())
+{
+  Toolkit::VisualFactory factory = mVisualFactory.GetHandle();
+  GetImplementation(factory).GetBackgroundBlurServices().push_back(this);
+
+  mInternalRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  rootLayer.Add(mInternalRoot);
+
+  mCaptureCamera = CreateCamera(mWindowSize.width, mWindowSize.height);
+  mInternalRoot.Add(mCaptureCamera);
+
+  DevelActor::ChildAddedSignal(rootLayer).Connect(this, &BackgroundBlurService::OnTreeChanged);
+  DevelActor::ChildRemovedSignal(rootLayer).Connect(this, &BackgroundBlurService::OnTreeChanged);
+  DevelActor::ChildOrderChangedSignal(rootLayer).Connect(this, &BackgroundBlurService::OnTreeChanged);
+}
+
+BackgroundBlurService::~BackgroundBlurService()
+{
+  // The factory may have been destroyed first, on termination.
+  Toolkit::VisualFactory factory = mVisualFactory.GetHandle();
+  if(factory)
+  {
+    auto& services = GetImplementation(factory).GetBackgroundBlurServices();
+    services.erase(std::remove(services.begin(), services.end(), this), services.end());
+  }
+
+  // Not notified of mInternalRoot being removed below.
+  DisconnectAll();
+
+  for(auto&& client : mClients)
+  {
+    client.textureRectConstraint.Remove();
+  }
+
+  for(auto&& capture : mCaptures)
+  {
+    for(auto&& blur : capture->blurs)
+    {
+      RemoveBlurTasks(*blur);
+    }
+
+    if(capture->task)
+    {
+      mTaskList.RemoveTask(capture->task);
+    }
+  }
+
+  mInternalRoot.Unparent();
+}
+
+void BackgroundBlurService::Register(Toolkit::Control control, Renderer renderer, float downscaleFactor, uint32_t pixelRadius, Toolkit::BlurAlgorithm::Type algorithm, DevelBackgroundBlurEffect::RefreshPolicy::Type refreshPolicy)
+{
+  Property::Index textureRectIndex = renderer.RegisterProperty(RenderEffectImpl::TEXTURE_RECT_UNIFORM_NAME, FULL_TEXTURE_RECT);
+  Constraint      constraint       = Constraint::New<Vector4>(renderer, textureRectIndex, TextureRectConstraint(mWindowSize));
+  constraint.AddSource(Source(control, Actor::Property::WORLD_POSITION));
+  constraint.AddSource(Source(control, Actor::Property::SIZE));
+  constraint.AddSource(Source(control, Actor::Property::WORLD_SCALE));
+  constraint.Apply();
+
+  // The capture and the blur are set by UpdateCaptures().
+  mClients.push_back(Client{WeakHandle<Toolkit::Control>(control), renderer, constraint, downscaleFactor, pixelRadius, algorithm, nullptr, nullptr, refreshPolicy});
+
+  control.OnSceneSignal().Connect(this, &BackgroundBlurService::OnTreeChanged);
+  control.OffSceneSignal().Connect(this, &BackgroundBlurService::OnTreeChanged);
+
+  UpdateCaptures();
+  UpdateRefreshRates();
+}
+
+void BackgroundBlurService::Unregister(Toolkit::Control control)
+{
+  auto iter = std::find_if(mClients.begin(), mClients.end(), [&control](const Client& client) { return client.control.GetHandle() == control; });
+  if(iter == mClients.end())
+  {
+    return;
+  }
+
+  iter->textureRectConstraint.Remove();
+  iter->renderer.RegisterProperty(RenderEffectImpl::TEXTURE_RECT_UNIFORM_NAME, FULL_TEXTURE_RECT);
+
+  if(control)
+  {
+    control.OnSceneSignal().Disconnect(this, &BackgroundBlurService::OnTreeChanged);
+    control.OffSceneSignal().Disconnect(this, &BackgroundBlurService::OnTreeChanged);
+  }
+
+  if(iter->capture)
+  {
+    ReleaseBlur(*iter->capture, iter->blur);
+  }
+  mClients.erase(iter);
+
+  UpdateCaptures();
+  UpdateRefreshRates();
+}
+
+void BackgroundBlurService::SetRefreshPolicy(Toolkit::Control control, DevelBackgroundBlurEffect::RefreshPolicy::Type refreshPolicy)
+{
+  auto iter = std::find_if(mClients.begin(), mClients.end(), [&control](const Client& client) { return client.control.GetHandle() == control; });
+  if(iter == mClients.end())
+  {
+    return;
+  }
+
+  iter->refreshPolicy = refreshPolicy;
+  UpdateRefreshRates();
+}
+
+void BackgroundBlurService::Refresh()
+{
+  UpdateRefreshRates();
+}
+
+uint32_t BackgroundBlurService::GetBlurCount() const
+{
+  uint32_t count = 0u;
+  for(auto&& capture : mCaptures)
+  {
+    count += static_cast<uint32_t>(capture->blurs.size());
+  }
+  return count;
+}
+
+BackgroundBlurService::Capture& BackgroundBlurService::AcquireCapture(Toolkit::Control endControl)
+{
+  for(auto&& capture : mCaptures)
+  {
+    if(capture->endControl.GetHandle() == endControl)
+    {
+      return *capture;
+    }
+  }
+
+  std::unique_ptr<Capture> capture(new Capture());
+  capture->endControl      = WeakHandle<Toolkit::Control>(endControl);
+  capture->downscaleFactor = 0.0f;
+
+  mCaptures.push_back(std::move(capture));
+  return *mCaptures.back();
+}
+
+bool BackgroundBlurService::SetClientCapture(Client& client, Capture& capture)
+{
+  if(client.capture == &capture)
+  {
+    return false;
+  }
+
+  if(client.capture)
+  {
+    ReleaseBlur(*client.capture, client.blur);
+  }
+
+  client.capture = &capture;
+  client.blur    = &AcquireBlur(capture, client.downscaleFactor, client.pixelRadius, client.algorithm);
+  SetRendererTexture(client.renderer, client.blur->outputFrameBuffer);
+  return true;
+}
+
+BackgroundBlurService::Blur& BackgroundBlurService::AcquireBlur(Capture& capture, float downscaleFactor, uint32_t pixelRadius, Toolkit::BlurAlgorithm::Type algorithm)
+{
+  for(auto&& blur : capture.blurs)
+  {
+    if(Dali::Equals(blur->downscaleFactor, downscaleFactor) && blur->pixelRadius == pixelRadius && blur->algorithm == algorithm)
+    {
+      ++blur->referenceCount;
+      return *blur;
+    }
+  }
+
+  const uint32_t downsampledWidth  = std::max(static_cast<uint32_t>(mWindowSize.width * downscaleFactor), 1u);
+  const uint32_t downsampledHeight = std::max(static_cast<uint32_t>(mWindowSize.height * downscaleFactor), 1u);
+
+  std::unique_ptr<Blur> blur(new Blur());
+  blur->downscaleFactor   = downscaleFactor;
+  blur->pixelRadius       = pixelRadius;
+  blur->algorithm         = algorithm;
+  blur->referenceCount    = 1u;
+  blur->size              = Vector2(downsampledWidth, downsampledHeight);
+  blur->outputFrameBuffer = CreateFrameBuffer(downsampledWidth, downsampledHeight);
+
+  if(algorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+  {
+    // The filter is enabled by UpdateCapture(), once its input is known.
+    blur->dualKawaseBlurFilter.SetRootActor(mInternalRoot);
+    blur->dualKawaseBlurFilter.SetRenderTaskList(mTaskList);
+    blur->dualKawaseBlurFilter.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX + 1);
+    blur->dualKawaseBlurFilter.SetSize(blur->size);
+    blur->dualKawaseBlurFilter.SetRadius(BlurEffectImpl::GetDualKawaseBlurRadius(pixelRadius));
+    blur->dualKawaseBlurFilter.SetOutputFrameBuffer(blur->outputFrameBuffer);
+  }
+  else
+  {
+    CreateGaussianBlur(*blur);
+  }
+
+  capture.blurs.push_back(std::move(blur));
+  return *capture.blurs.back();
+}
+
+void BackgroundBlurService::CreateGaussianBlur(Blur& blur)
+{
+  const uint32_t downsampledWidth  = static_cast<uint32_t>(blur.size.width);
+  const uint32_t downsampledHeight = static_cast<uint32_t>(blur.size.height);
+
+  blur.camera = CreateCamera(float(downsampledWidth), float(downsampledHeight));
+  mInternalRoot.Add(blur.camera);
+
+  // The shader is shared by all the blurs which take the same number of samples.
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+  Shader                 shader  = GetImplementation(factory).GetBlurShader(blur.pixelRadius);
+
+  blur.horizontalBlurActor = Actor::New();
+  blur.horizontalBlurActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  blur.horizontalBlurActor.SetProperty(Actor::Property::SIZE, blur.size);
+  blur.horizontalBlurActor.AddRenderer(CreateRenderer(shader));
+  mInternalRoot.Add(blur.horizontalBlurActor);
+
+  blur.verticalBlurActor = Actor::New();
+  blur.verticalBlurActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  blur.verticalBlurActor.SetProperty(Actor::Property::SIZE, blur.size);
+  blur.verticalBlurActor.AddRenderer(CreateRenderer(shader));
+  mInternalRoot.Add(blur.verticalBlurActor);
+
+  BlurEffectImpl::SetShaderConstants(blur.horizontalBlurActor, blur.verticalBlurActor, blur.pixelRadius, downsampledWidth, downsampledHeight);
+
+  blur.temporaryFrameBuffer = CreateFrameBuffer(downsampledWidth, downsampledHeight);
+
+  // The input of the horizontal blur is set by UpdateCapture().
+  blur.horizontalBlurTask = mTaskList.CreateTask();
+  blur.horizontalBlurTask.SetSourceActor(blur.horizontalBlurActor);
+  blur.horizontalBlurTask.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX + 1);
+  blur.horizontalBlurTask.SetExclusive(true);
+  blur.horizontalBlurTask.SetInputEnabled(false);
+  blur.horizontalBlurTask.SetCameraActor(blur.camera);
+  blur.horizontalBlurTask.SetFrameBuffer(blur.temporaryFrameBuffer);
+
+  SetRendererTexture(blur.verticalBlurActor.GetRendererAt(0), blur.temporaryFrameBuffer);
+  blur.verticalBlurTask = mTaskList.CreateTask();
+  blur.verticalBlurTask.SetSourceActor(blur.verticalBlurActor);
+  blur.verticalBlurTask.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX + 2);
+  blur.verticalBlurTask.SetExclusive(true);
+  blur.verticalBlurTask.SetInputEnabled(false);
+  blur.verticalBlurTask.SetCameraActor(blur.camera);
+  blur.verticalBlurTask.SetFrameBuffer(blur.outputFrameBuffer);
+}
+
+void BackgroundBlurService::RemoveBlurTasks(Blur& blur)
+{
+  if(blur.algorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+  {
+    blur.dualKawaseBlurFilter.Disable();
+    return;
+  }
+
+  mTaskList.RemoveTask(blur.horizontalBlurTask);
+  mTaskList.RemoveTask(blur.verticalBlurTask);
+  blur.camera.Unparent();
+  blur.horizontalBlurActor.Unparent();
+  blur.verticalBlurActor.Unparent();
+}
+
+void BackgroundBlurService::ReleaseBlur(Capture& capture, Blur* blur)
+{
+  if(--blur->referenceCount > 0u)
+  {
+    return;
+  }
+
+  RemoveBlurTasks(*blur);
+
+  capture.blurs.erase(std::remove_if(capture.blurs.begin(), capture.blurs.end(), [blur](const std::unique_ptr<Blur>& item) { return item.get() == blur; }), capture.blurs.end());
+}
+
+void BackgroundBlurService::UpdateCapture(Capture& capture)
+{
+  if(capture.blurs.empty())
+  {
+    return;
+  }
+
+  // Render the background once, with the least downscale any blur of the capture needs.
+  float downscaleFactor = 0.0f;
+  for(auto&& blur : capture.blurs)
+  {
+    downscaleFactor = std::max(downscaleFactor, blur->downscaleFactor);
+  }
+
+  const bool captureChanged = !Dali::Equals(downscaleFactor, capture.downscaleFactor);
+  if(captureChanged)
+  {
+    capture.downscaleFactor = downscaleFactor;
+
+    const uint32_t downsampledWidth  = std::max(static_cast<uint32_t>(mWindowSize.width * downscaleFactor), 1u);
+    const uint32_t downsampledHeight = std::max(static_cast<uint32_t>(mWindowSize.height * downscaleFactor), 1u);
+    capture.frameBuffer              = CreateFrameBuffer(downsampledWidth, downsampledHeight);
+
+    if(!capture.task)
+    {
+      capture.task = mTaskList.CreateTask();
+      capture.task.SetSourceActor(mRootLayer.GetHandle());
+      capture.task.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX);
+      capture.task.SetCameraActor(mCaptureCamera);
+      capture.task.SetInputEnabled(false);
+      capture.task.SetExclusive(false);
+
+      Toolkit::Control endControl = capture.endControl.GetHandle();
+      if(endControl)
+      {
+        capture.task.RenderUntil(endControl);
+      }
+    }
+    capture.task.SetFrameBuffer(capture.frameBuffer);
+  }
+
+  for(auto&& blur : capture.blurs)
+  {
+    if(blur->algorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+    {
+      // The filter creates its passes for its input, so it is enabled again when the capture changes.
+      if(captureChanged || !blur->dualKawaseBlurFilter.GetOutputRenderTask())
+      {
+        blur->dualKawaseBlurFilter.Disable();
+        blur->dualKawaseBlurFilter.SetInputTexture(capture.frameBuffer.GetColorTexture());
+        blur->dualKawaseBlurFilter.Enable();
+      }
+    }
+    else
+    {
+      SetRendererTexture(blur->horizontalBlurActor.GetRendererAt(0), capture.frameBuffer);
+    }
+  }
+}
+
+bool BackgroundBlurService::UpdateCaptures()
+{
+  // The controls are registered in any order, e.g. the one on the top may be registered first.
+  std::vector<DrawnControl> drawnControls;
+  for(std::size_t i = 0u; i < mClients.size(); ++i)
+  {
+    Toolkit::Control control = mClients[i].control.GetHandle();
+    if(control && control.GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE))
+    {
+      drawnControls.push_back(DrawnControl{GetDrawOrder(control), control, i});
+    }
+  }
+  std::sort(drawnControls.begin(), drawnControls.end(), [](const DrawnControl& lhs, const DrawnControl& rhs) { return lhs.drawOrder < rhs.drawOrder; });
+
+  std::vector<bool> drawnBetween(drawnControls.size(), false);
+  if(drawnControls.size() > 1u)
+  {
+    FindActorsDrawnBetween(mRootLayer.GetHandle(), mInternalRoot, drawnControls, drawnBetween);
+  }
+
+  // A control starts a new capture if it is drawn first, or if another actor is drawn after the previous control.
+  bool     moved   = false;
+  Capture* capture = nullptr;
+  for(std::size_t i = 0u; i < drawnControls.size(); ++i)
+  {
+    if(!capture || drawnBetween[i])
+    {
+      capture = &AcquireCapture(drawnControls[i].control);
+    }
+    moved |= SetClientCapture(mClients[drawnControls[i].clientIndex], *capture);
+  }
+
+  // The controls off the scene keep their capture, or share the first one.
+  for(auto&& client : mClients)
+  {
+    if(!client.capture)
+    {
+      Capture& firstCapture = drawnControls.empty() ? AcquireCapture(Toolkit::Control()) : *mClients[drawnControls.front().clientIndex].capture;
+      moved |= SetClientCapture(client, firstCapture);
+    }
+  }
+
+  // Remove the captures which no control uses any more. Their blurs have been released already.
+  for(auto iter = mCaptures.begin(); iter != mCaptures.end();)
+  {
+    if((*iter)->blurs.empty())
+    {
+      if((*iter)->task)
+      {
+        mTaskList.RemoveTask((*iter)->task);
+      }
+      iter = mCaptures.erase(iter);
+    }
+    else
+    {
+      UpdateCapture(**iter);
+      ++iter;
+    }
+  }
+
+  return moved;
+}
+
+void BackgroundBlurService::UpdateRefreshRates()
+{
+  for(auto&& capture : mCaptures)
+  {
+    bool isCaptureContinuous = false;
+    for(auto&& blur : capture->blurs)
+    {
+      const Blur* blurPtr      = blur.get();
+      const bool  isContinuous = std::any_of(mClients.begin(), mClients.end(), [blurPtr](const Client& client) { return client.blur == blurPtr && client.refreshPolicy == DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS; });
+
+      if(blur->algorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+      {
+        blur->dualKawaseBlurFilter.SetRefreshOnDemand(!isContinuous);
+        blur->dualKawaseBlurFilter.Refresh();
+      }
+      else
+      {
+        const uint32_t refreshRate = isContinuous ? RenderTask::REFRESH_ALWAYS : RenderTask::REFRESH_ONCE;
+        blur->horizontalBlurTask.SetRefreshRate(refreshRate);
+        blur->verticalBlurTask.SetRefreshRate(refreshRate);
+      }
+      isCaptureContinuous |= isContinuous;
+    }
+
+    if(capture->task)
+    {
+      capture->task.SetRefreshRate(isCaptureContinuous ? RenderTask::REFRESH_ALWAYS : RenderTask::REFRESH_ONCE);
+    }
+  }
+}
+
+void BackgroundBlurService::OnTreeChanged(Actor actor)
+{
+  // A control moved to another capture needs its new capture rendered, whatever its policy is.
+  const bool moved = UpdateCaptures();
+
+  if(moved || std::any_of(mClients.begin(), mClients.end(), [](const Client& client) { return client.refreshPolicy == DevelBackgroundBlurEffect::RefreshPolicy::ON_DIRTY; }))
+  {
+    UpdateRefreshRates();
+  }
+}
+
+} // namespace Internal
+} // namespace Toolkit
+} // namespace Dali
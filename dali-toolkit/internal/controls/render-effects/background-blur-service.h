@@ -0,0 +1,276 @@
+#ifndef DALI_TOOLKIT_INTERNAL_BACKGROUND_BLUR_SERVICE_H
+#define DALI_TOOLKIT_INTERNAL_BACKGROUND_BLUR_SERVICE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/camera-actor.h>
+#include <dali/public-api/actors/layer.h>
+#include <dali/public-api/animation/constraint.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <dali/public-api/render-tasks/render-task-list.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/public-api/rendering/frame-buffer.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <memory>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/blur-algorithm.h>
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
+#include <dali-toolkit/internal/filters/dual-kawase-blur-filter.h>
+#include <dali-toolkit/public-api/controls/control.h>
+#include <dali-toolkit/public-api/visuals/visual-factory.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class BackgroundBlurService;
+using BackgroundBlurServicePtr = IntrusivePtr<BackgroundBlurService>;
+
+/**
+ * @brief Blurs the background of a window once for all the background blur effects in it.
+ *
+ * The controls with an effect which are drawn one after another share a capture: the window is rendered into a texture,
+ * scaled down by the biggest downscale factor of their effects, until the first of them. Where another actor is drawn
+ * between two controls, the later control starts a new capture, so every control samples all that is drawn before it.
+ * The children of a control are not considered, as they are expected in the area of the control.
+ * Then each capture is blurred once for each distinct downscale factor, radius and algorithm of its effects. Each effect
+ * samples the area of its control from the blurred texture, so the controls should not overlap.
+ *
+ * A capture is rendered and blurred every frame while any of its effects is RefreshPolicy::CONTINUOUS. Otherwise it is
+ * rendered and blurred once, and again on Refresh(), on the registration of an effect, when a control moves to another
+ * capture, or, for RefreshPolicy::ON_DIRTY, when the root layer of the window changes.
+ *
+ * The service of a window exists while any effect in the window is activated. The visual factory keeps track of the
+ * services, so the effects of a window share one.
+ */
+class BackgroundBlurService : public RefObject, public ConnectionTracker
+{
+public:
+  /**
+   * @brief Retrieves the service of the window which has the actor, creating it if necessary.
+   * @param[in] actor The actor on the window. The current stage is used if it is not on any window.
+   * @return The service of the window.
+   */
+  static BackgroundBlurServicePtr Get(Actor actor);
+
+  /**
+   * @brief Registers the control of an effect, so the renderer samples the area of the control from the blurred background.
+   *
+   * @param[in] control The control which background is blurred.
+   * @param[in] renderer The renderer of the effect added to the control.
+   * @param[in] downscaleFactor The downscale factor of the effect.
+   * @param[in] pixelRadius The number of the sample pairs of the blur kernel.
+   * @param[in] algorithm The algorithm of the blur.
+   * @param[in] refreshPolicy When the background of the effect is rendered and blurred again.
+   */
+  void Register(Toolkit::Control control, Renderer renderer, float downscaleFactor, uint32_t pixelRadius, Toolkit::BlurAlgorithm::Type algorithm, DevelBackgroundBlurEffect::RefreshPolicy::Type refreshPolicy);
+
+  /**
+   * @brief Unregisters the control of an effect. The blur which is not used any more is removed.
+   * @param[in] control The control which background is blurred.
+   */
+  void Unregister(Toolkit::Control control);
+
+  /**
+   * @brief Changes the refresh policy of a registered control.
+   * @param[in] control The control which background is blurred.
+   * @param[in] refreshPolicy When the background of the effect is rendered and blurred again.
+   */
+  void SetRefreshPolicy(Toolkit::Control control, DevelBackgroundBlurEffect::RefreshPolicy::Type refreshPolicy);
+
+  /**
+   * @brief Renders and blurs the background once more. Does nothing more while the background is rendered every frame.
+   */
+  void Refresh();
+
+  /**
+   * @brief Retrieves the number of the blurs of the background, i.e. the distinct sets of downscale factor, radius and algorithm in each capture.
+   * @return The number of the blurs.
+   */
+  uint32_t GetBlurCount() const;
+
+  /**
+   * @brief Retrieves the number of the captures of the background.
+   * @return The number of the captures.
+   */
+  uint32_t GetCaptureCount() const
+  {
+    return static_cast<uint32_t>(mCaptures.size());
+  }
+
+protected:
+  /**
+   * @brief Constructor.
+   * @param[in] rootLayer The root layer of the window.
+   * @param[in] taskList The render task list of the window.
+   * @param[in] windowSize The size of the window.
+   */
+  BackgroundBlurService(Layer rootLayer, RenderTaskList taskList, const Vector2& windowSize);
+
+  /**
+   * @brief Destructor. The render tasks are removed.
+   */
+  ~BackgroundBlurService() override;
+
+private:
+  /**
+   * @brief The blur of the background with a downscale factor, a radius and an algorithm.
+   */
+  struct Blur
+  {
+    float                        downscaleFactor;
+    uint32_t                     pixelRadius;
+    Toolkit::BlurAlgorithm::Type algorithm;
+    uint32_t                     referenceCount;
+    Vector2                      size; ///< The size of the blurred texture.
+    CameraActor                  camera;
+    Actor                        horizontalBlurActor;
+    RenderTask                   horizontalBlurTask;
+    FrameBuffer                  temporaryFrameBuffer;
+    Actor                        verticalBlurActor;
+    RenderTask                   verticalBlurTask;
+    DualKawaseBlurFilter         dualKawaseBlurFilter; ///< Replaces the horizontal and vertical blurs with BlurAlgorithm::DUAL_KAWASE.
+    FrameBuffer                  outputFrameBuffer;
+  };
+
+  /**
+   * @brief The background rendered until a control, shared by the controls drawn one after another from it.
+   */
+  struct Capture
+  {
+    WeakHandle<Toolkit::Control>       endControl; ///< The window is rendered until this control. Empty to render the whole window.
+    RenderTask                         task;
+    FrameBuffer                        frameBuffer; ///< The background, scaled down.
+    float                              downscaleFactor;
+    std::vector<std::unique_ptr<Blur>> blurs;
+  };
+
+  /**
+   * @brief A registered control.
+   */
+  struct Client
+  {
+    WeakHandle<Toolkit::Control>                   control;
+    Renderer                                       renderer;
+    Constraint                                     textureRectConstraint;
+    float                                          downscaleFactor;
+    uint32_t                                       pixelRadius;
+    Toolkit::BlurAlgorithm::Type                   algorithm;
+    Capture*                                       capture;
+    Blur*                                          blur;
+    DevelBackgroundBlurEffect::RefreshPolicy::Type refreshPolicy;
+  };
+
+  /**
+   * @brief Retrieves the capture which ends at the given control, creating it if necessary.
+   * @param[in] endControl The control to render the window until. Empty to render the whole window.
+   * @return The capture.
+   */
+  Capture& AcquireCapture(Toolkit::Control endControl);
+
+  /**
+   * @brief Moves a client to a capture, and to the blur of the capture with its parameters.
+   * @param[in] client The client.
+   * @param[in] capture The capture.
+   * @return true if the client has moved.
+   */
+  bool SetClientCapture(Client& client, Capture& capture);
+
+  /**
+   * @brief Retrieves the blur of a capture with the given downscale factor, radius and algorithm, creating it if necessary.
+   * @param[in] capture The capture.
+   * @param[in] downscaleFactor The downscale factor.
+   * @param[in] pixelRadius The number of the sample pairs of the blur kernel.
+   * @param[in] algorithm The algorithm of the blur.
+   * @return The blur.
+   */
+  Blur& AcquireBlur(Capture& capture, float downscaleFactor, uint32_t pixelRadius, Toolkit::BlurAlgorithm::Type algorithm);
+
+  /**
+   * @brief Creates the horizontal and vertical gaussian blurs of a blur. Their input is set by UpdateCapture().
+   * @param[in] blur The blur.
+   */
+  void CreateGaussianBlur(Blur& blur);
+
+  /**
+   * @brief Removes the render tasks and the actors of a blur.
+   * @param[in] blur The blur.
+   */
+  void RemoveBlurTasks(Blur& blur);
+
+  /**
+   * @brief Releases a blur of a capture, removing it if it is not used any more.
+   * @param[in] capture The capture.
+   * @param[in] blur The blur.
+   */
+  void ReleaseBlur(Capture& capture, Blur* blur);
+
+  /**
+   * @brief Creates the render task and the frame buffer of a capture to render the background with the biggest downscale factor of its blurs.
+   * @param[in] capture The capture.
+   */
+  void UpdateCapture(Capture& capture);
+
+  /**
+   * @brief Groups the registered controls by the capture they share, removing the captures which are not used any more.
+   * @note Called again whenever the order in which the controls and the other actors are drawn may have changed.
+   * @return true if any control has moved to another capture.
+   */
+  bool UpdateCaptures();
+
+  /**
+   * @brief Sets the refresh rates of the capture and the blurs by the refresh policies of the controls.
+   * A blur is rendered every frame while any of its controls is CONTINUOUS, and a capture while any of its blurs is.
+   * Otherwise the render tasks are set to RenderTask::REFRESH_ONCE again, which renders them once more.
+   */
+  void UpdateRefreshRates();
+
+  /**
+   * @brief Called when an actor is added to, removed from or reordered in the root layer of the window, or when a
+   * registered control is added to or removed from the window.
+   * @param[in] actor The actor.
+   */
+  void OnTreeChanged(Actor actor);
+
+  BackgroundBlurService(const BackgroundBlurService&) = delete;
+  BackgroundBlurService& operator=(const BackgroundBlurService&) = delete;
+
+private:
+  WeakHandle<Toolkit::VisualFactory> mVisualFactory; ///< Keeps track of the services.
+  WeakHandle<Layer>                  mRootLayer;
+  RenderTaskList                     mTaskList;
+  Vector2                            mWindowSize;
+
+  Actor       mInternalRoot;
+  CameraActor mCaptureCamera; ///< Shared by the captures.
+
+  std::vector<std::unique_ptr<Capture>> mCaptures;
+  std::vector<Client>                   mClients;
+};
+
+} // namespace Internal
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_BACKGROUND_BLUR_SERVICE_H
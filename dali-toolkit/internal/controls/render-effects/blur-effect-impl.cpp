@@ -31,6 +31,8 @@
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
 #include <dali-toolkit/internal/graphics/builtin-shader-extern-gen.h>
+#include <dali-toolkit/internal/visuals/visual-factory-impl.h>
+#include <dali-toolkit/public-api/visuals/visual-factory.h>
 
 namespace
 {
@@ -51,18 +53,20 @@ BlurEffectImpl::BlurEffectImpl(bool isBackground)
   mInternalRoot(Actor::New()),
   mDownscaleFactor(BLUR_EFFECT_DOWNSCALE_FACTOR),
   mPixelRadius(BLUR_EFFECT_PIXEL_RADIUS),
-  mBellCurveWidth(0.001f),
+  mBlurAlgorithm(Toolkit::BlurAlgorithm::GAUSSIAN),
+  mRefreshPolicy(DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS),
   mIsActivated(false),
   mIsBackground(isBackground)
 {
 }
 
-BlurEffectImpl::BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground)
+BlurEffectImpl::BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground, Toolkit::BlurAlgorithm::Type algorithm)
 : RenderEffectImpl(),
   mInternalRoot(Actor::New()),
   mDownscaleFactor(downscaleFactor),
   mPixelRadius((blurRadius >> 2) + 1),
-  mBellCurveWidth(0.001f),
+  mBlurAlgorithm(algorithm),
+  mRefreshPolicy(DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS),
   mIsActivated(false),
   mIsBackground(isBackground)
 {
@@ -80,15 +84,21 @@ BlurEffectImplPtr BlurEffectImpl::New(bool isBackground)
   return handle;
 }
 
-BlurEffectImplPtr BlurEffectImpl::New(float downscaleFactor, uint32_t blurRadius, bool isBackground)
+BlurEffectImplPtr BlurEffectImpl::New(float downscaleFactor, uint32_t blurRadius, bool isBackground, Toolkit::BlurAlgorithm::Type algorithm)
 {
-  BlurEffectImplPtr handle = new BlurEffectImpl(downscaleFactor, blurRadius, isBackground);
+  BlurEffectImplPtr handle = new BlurEffectImpl(downscaleFactor, blurRadius, isBackground, algorithm);
   handle->Initialize();
   return handle;
 }
 
 void BlurEffectImpl::Initialize()
 {
+  if(mIsBackground)
+  {
+    // The background is blurred by the service of the window, which is shared with the other background blur effects.
+    return;
+  }
+
   mRenderFullSizeCamera = CameraActor::New();
   mRenderFullSizeCamera.SetInvertYAxis(true);
   mRenderFullSizeCamera.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
@@ -106,22 +116,9 @@ void BlurEffectImpl::Initialize()
   mInternalRoot.Add(mRenderDownsampledCamera);
 
   //////////////////////////////////////////////////////
-  // Create shaders
-
-  std::ostringstream fragmentStringStream;
-  fragmentStringStream << "#define NUM_SAMPLES " << mPixelRadius << "\n";
-  fragmentStringStream << SHADER_BLUR_EFFECT_FRAG;
-  std::string fragmentSource(fragmentStringStream.str());
-
-  float sigma = 0.5f;
-  {
-    float epsilon = 1e-2f / (mPixelRadius * 2);
-    while((CalculateGaussianWeight((mPixelRadius * 2) - 1, sigma) < epsilon) && (sigma < 50.0f))
-    {
-      sigma += 1.0f;
-    }
-  }
-  mBellCurveWidth = sigma;
+  // Get the shader, cached by the number of samples
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+  Shader                 shader  = GetImplementation(factory).GetBlurShader(mPixelRadius);
 
   //////////////////////////////////////////////////////
   // Create actors
@@ -130,14 +127,14 @@ void BlurEffectImpl::Initialize()
   // Create an actor for performing a horizontal blur on the texture
   mHorizontalBlurActor = Actor::New();
   mHorizontalBlurActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  Renderer horizontalBlurRenderer = CreateRenderer(BASIC_VERTEX_SOURCE, fragmentSource.c_str());
+  Renderer horizontalBlurRenderer = CreateRenderer(shader);
   mHorizontalBlurActor.AddRenderer(horizontalBlurRenderer);
   mInternalRoot.Add(mHorizontalBlurActor);
 
   // Create an actor for performing a vertical blur on the texture
   mVerticalBlurActor = Actor::New();
   mVerticalBlurActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  Renderer verticalBlurRenderer = CreateRenderer(BASIC_VERTEX_SOURCE, fragmentSource.c_str());
+  Renderer verticalBlurRenderer = CreateRenderer(shader);
   mVerticalBlurActor.AddRenderer(verticalBlurRenderer);
   mInternalRoot.Add(mVerticalBlurActor);
 }
@@ -181,6 +178,13 @@ void BlurEffectImpl::Activate()
   {
     return;
   }
+
+  if(mIsBackground)
+  {
+    ActivateBackground();
+    return;
+  }
+
   uint32_t downsampledWidth  = static_cast<uint32_t>(size.width * mDownscaleFactor);
   uint32_t downsampledHeight = static_cast<uint32_t>(size.height * mDownscaleFactor);
   if(downsampledWidth == 0u)
@@ -200,42 +204,20 @@ void BlurEffectImpl::Activate()
   Texture inputBackgroundTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
   mInputBackgroundFrameBuffer.AttachColorTexture(inputBackgroundTexture);
 
-  // half-blurred output
-  mTemporaryFrameBuffer    = FrameBuffer::New(downsampledWidth, downsampledHeight, FrameBuffer::Attachment::NONE);
-  Texture temporaryTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
-  mTemporaryFrameBuffer.AttachColorTexture(temporaryTexture);
-
   // blurred output
   mSourceFrameBuffer    = FrameBuffer::New(downsampledWidth, downsampledHeight, FrameBuffer::Attachment::NONE);
   Texture sourceTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
   mSourceFrameBuffer.AttachColorTexture(sourceTexture);
 
-  // Add BlurActors
-  mHorizontalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight)); // mTemporaryFrameBuffer
-  mVerticalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight));   // mSourceFrameBuffer
-
   // Add CameraActors
   float cameraPosConstraintScale = 0.5f / tanf(Math::PI / 4.0f * 0.5f);
 
   mRenderFullSizeCamera.SetAspectRatio(size.width / size.height);
   mRenderFullSizeCamera.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, cameraPosConstraintScale * size.height));
 
-  mRenderDownsampledCamera.SetAspectRatio(float(downsampledWidth) / float(downsampledHeight));
-  mRenderDownsampledCamera.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, cameraPosConstraintScale * size.height * mDownscaleFactor));
-
-  SetShaderConstants(downsampledWidth, downsampledHeight);
-
   // Prepare input texture
   mSourceRenderTask = taskList.CreateTask();
-  if(mIsBackground)
-  {
-    mSourceRenderTask.SetSourceActor(Stage::GetCurrent().GetRootLayer());
-    mSourceRenderTask.RenderUntil(ownerControl);
-  }
-  else
-  {
-    mSourceRenderTask.SetSourceActor(ownerControl);
-  }
+  mSourceRenderTask.SetSourceActor(ownerControl);
   mSourceRenderTask.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX);
   mSourceRenderTask.SetCameraActor(mRenderFullSizeCamera);
   mSourceRenderTask.SetFrameBuffer(mInputBackgroundFrameBuffer);
@@ -243,6 +225,54 @@ void BlurEffectImpl::Activate()
   mSourceRenderTask.SetExclusive(false);
 
   // Blur tasks
+  if(mBlurAlgorithm == Toolkit::BlurAlgorithm::DUAL_KAWASE)
+  {
+    mDualKawaseBlurFilter.SetRootActor(mInternalRoot);
+    mDualKawaseBlurFilter.SetRenderTaskList(taskList);
+    mDualKawaseBlurFilter.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX + 1);
+    mDualKawaseBlurFilter.SetSize(Vector2(downsampledWidth, downsampledHeight));
+    mDualKawaseBlurFilter.SetRadius(GetDualKawaseBlurRadius(mPixelRadius));
+    mDualKawaseBlurFilter.SetInputTexture(inputBackgroundTexture);
+    mDualKawaseBlurFilter.SetOutputFrameBuffer(mSourceFrameBuffer);
+    mDualKawaseBlurFilter.SetRefreshOnDemand(mRefreshPolicy != DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS);
+    mDualKawaseBlurFilter.Enable();
+  }
+  else
+  {
+    ActivateGaussianBlur(downsampledWidth, downsampledHeight);
+  }
+  ApplyRefreshPolicy();
+
+  // Inject output to control
+  Renderer renderer = GetTargetRenderer();
+  renderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, Dali::Toolkit::DepthIndex::CONTENT);
+  ownerControl.AddRenderer(renderer);
+  SetRendererTexture(renderer, mSourceFrameBuffer);
+
+  ownerControl.Add(mInternalRoot);
+}
+
+void BlurEffectImpl::ActivateGaussianBlur(uint32_t downsampledWidth, uint32_t downsampledHeight)
+{
+  RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
+
+  // half-blurred output
+  mTemporaryFrameBuffer    = FrameBuffer::New(downsampledWidth, downsampledHeight, FrameBuffer::Attachment::NONE);
+  Texture temporaryTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
+  mTemporaryFrameBuffer.AttachColorTexture(temporaryTexture);
+
+  // Add BlurActors
+  mHorizontalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight)); // mTemporaryFrameBuffer
+  mVerticalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight));   // mSourceFrameBuffer
+
+  // Add CameraActors
+  float cameraPosConstraintScale = 0.5f / tanf(Math::PI / 4.0f * 0.5f);
+
+  mRenderDownsampledCamera.SetAspectRatio(float(downsampledWidth) / float(downsampledHeight));
+  mRenderDownsampledCamera.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, cameraPosConstraintScale * float(downsampledHeight)));
+
+  SetShaderConstants(mHorizontalBlurActor, mVerticalBlurActor, mPixelRadius, downsampledWidth, downsampledHeight);
+
   SetRendererTexture(mHorizontalBlurActor.GetRendererAt(0), mInputBackgroundFrameBuffer);
   mHorizontalBlurTask = taskList.CreateTask();
   mHorizontalBlurTask.SetSourceActor(mHorizontalBlurActor);
@@ -260,53 +290,132 @@ void BlurEffectImpl::Activate()
   mVerticalBlurTask.SetInputEnabled(false);
   mVerticalBlurTask.SetCameraActor(mRenderDownsampledCamera);
   mVerticalBlurTask.SetFrameBuffer(mSourceFrameBuffer);
+}
+
+void BlurEffectImpl::ActivateBackground()
+{
+  Toolkit::Control ownerControl = GetOwnerControl();
 
-  // Inject output to control
   Renderer renderer = GetTargetRenderer();
-  if(mIsBackground)
-  {
-    renderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, Dali::Toolkit::DepthIndex::BACKGROUND - 3);
-  }
-  else
-  {
-    renderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, Dali::Toolkit::DepthIndex::CONTENT);
-  }
+  renderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, Dali::Toolkit::DepthIndex::BACKGROUND - 3);
   ownerControl.AddRenderer(renderer);
-  SetRendererTexture(renderer, mSourceFrameBuffer);
 
-  ownerControl.Add(mInternalRoot);
+  // The background of the window is rendered and blurred once, for all the background blur effects with the same parameters.
+  mBackgroundBlurService = BackgroundBlurService::Get(ownerControl);
+  mBackgroundBlurService->Register(ownerControl, renderer, mDownscaleFactor, mPixelRadius, mBlurAlgorithm, mRefreshPolicy);
+  mBlurredControl = WeakHandle<Toolkit::Control>(ownerControl);
+
+  SynchronizeBackgroundCornerRadius();
 }
 
 void BlurEffectImpl::Deactivate()
 {
   mIsActivated = false;
 
+  if(mBackgroundBlurService)
+  {
+    mBackgroundBlurService->Unregister(mBlurredControl.GetHandle());
+    mBackgroundBlurService.Reset();
+    mBlurredControl.Reset();
+  }
+
   mInternalRoot.Unparent();
 
   mInputBackgroundFrameBuffer.Reset();
   mTemporaryFrameBuffer.Reset();
   mSourceFrameBuffer.Reset();
 
+  mDualKawaseBlurFilter.Disable();
+
   RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
-  taskList.RemoveTask(mHorizontalBlurTask);
-  taskList.RemoveTask(mVerticalBlurTask);
-  taskList.RemoveTask(mSourceRenderTask);
+  if(mHorizontalBlurTask)
+  {
+    taskList.RemoveTask(mHorizontalBlurTask);
+    taskList.RemoveTask(mVerticalBlurTask);
+
+    mHorizontalBlurTask.Reset();
+    mVerticalBlurTask.Reset();
+  }
+
+  if(mSourceRenderTask)
+  {
+    taskList.RemoveTask(mSourceRenderTask);
+    mSourceRenderTask.Reset();
+  }
 }
 
-void BlurEffectImpl::SetShaderConstants(float downsampledWidth, float downsampledHeight)
+void BlurEffectImpl::SetRefreshPolicy(DevelBackgroundBlurEffect::RefreshPolicy::Type policy)
 {
-  std::vector<float> uvOffsets(mPixelRadius);
-  std::vector<float> weights(mPixelRadius);
+  mRefreshPolicy = policy;
+
+  if(mBackgroundBlurService)
+  {
+    mBackgroundBlurService->SetRefreshPolicy(mBlurredControl.GetHandle(), mRefreshPolicy);
+  }
+  else if(mSourceRenderTask)
+  {
+    mDualKawaseBlurFilter.SetRefreshOnDemand(mRefreshPolicy != DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS);
+    ApplyRefreshPolicy();
+  }
+}
+
+DevelBackgroundBlurEffect::RefreshPolicy::Type BlurEffectImpl::GetRefreshPolicy() const
+{
+  return mRefreshPolicy;
+}
+
+void BlurEffectImpl::Refresh()
+{
+  if(mBackgroundBlurService)
+  {
+    mBackgroundBlurService->Refresh();
+  }
+  else if(mSourceRenderTask)
+  {
+    ApplyRefreshPolicy();
+  }
+}
+
+void BlurEffectImpl::ApplyRefreshPolicy()
+{
+  // The foreground blur renders the owner control itself, so ON_DIRTY is refreshed on demand as ONCE is.
+  const uint32_t refreshRate = (mRefreshPolicy == DevelBackgroundBlurEffect::RefreshPolicy::CONTINUOUS) ? RenderTask::REFRESH_ALWAYS : RenderTask::REFRESH_ONCE;
+
+  mSourceRenderTask.SetRefreshRate(refreshRate);
+  if(mHorizontalBlurTask)
+  {
+    mHorizontalBlurTask.SetRefreshRate(refreshRate);
+    mVerticalBlurTask.SetRefreshRate(refreshRate);
+  }
+  mDualKawaseBlurFilter.Refresh();
+}
+
+float BlurEffectImpl::CalculateBellCurveWidth(uint32_t pixelRadius)
+{
+  float sigma   = 0.5f;
+  float epsilon = 1e-2f / (pixelRadius * 2);
+  while((CalculateGaussianWeight((pixelRadius * 2) - 1, sigma) < epsilon) && (sigma < 50.0f))
+  {
+    sigma += 1.0f;
+  }
+  return sigma;
+}
+
+void BlurEffectImpl::SetShaderConstants(Actor horizontalBlurActor, Actor verticalBlurActor, uint32_t pixelRadius, float downsampledWidth, float downsampledHeight)
+{
+  std::vector<float> uvOffsets(pixelRadius);
+  std::vector<float> weights(pixelRadius);
 
   // generate bell curve kernel
-  unsigned int       halfSize = mPixelRadius * 2;
+  const float        bellCurveWidth = CalculateBellCurveWidth(pixelRadius);
+  unsigned int       halfSize       = pixelRadius * 2;
   std::vector<float> halfSideKernel(halfSize);
 
-  halfSideKernel[0]  = CalculateGaussianWeight(0.0f, mBellCurveWidth);
+  halfSideKernel[0]  = CalculateGaussianWeight(0.0f, bellCurveWidth);
   float totalWeights = halfSideKernel[0];
   for(unsigned int i = 1; i < halfSize; i++)
   {
-    float w           = CalculateGaussianWeight(i, mBellCurveWidth);
+    float w           = CalculateGaussianWeight(i, bellCurveWidth);
     halfSideKernel[i] = w;
     totalWeights += w * 2.0f;
   }
@@ -317,36 +426,31 @@ void BlurEffectImpl::SetShaderConstants(float downsampledWidth, float downsample
   halfSideKernel[0] *= 0.5f;
 
   // compress kernel
-  for(unsigned int i = 0; i < mPixelRadius; i++)
+  for(unsigned int i = 0; i < pixelRadius; i++)
   {
     weights[i]   = halfSideKernel[2 * i] + halfSideKernel[2 * i + 1];
     uvOffsets[i] = 2.0f * i + halfSideKernel[2 * i + 1] / weights[i];
   }
 
   // set shader constants
-  for(unsigned int i = 0; i < mPixelRadius; ++i)
+  for(unsigned int i = 0; i < pixelRadius; ++i)
   {
-    mHorizontalBlurActor.RegisterProperty(GetSampleOffsetsPropertyName(i), Vector2(uvOffsets[i] / downsampledWidth, 0.0f));
-    mHorizontalBlurActor.RegisterProperty(GetSampleWeightsPropertyName(i), weights[i]);
+    horizontalBlurActor.RegisterProperty(GetSampleOffsetsPropertyName(i), Vector2(uvOffsets[i] / downsampledWidth, 0.0f));
+    horizontalBlurActor.RegisterProperty(GetSampleWeightsPropertyName(i), weights[i]);
 
-    mVerticalBlurActor.RegisterProperty(GetSampleOffsetsPropertyName(i), Vector2(0.0f, uvOffsets[i] / downsampledHeight));
-    mVerticalBlurActor.RegisterProperty(GetSampleWeightsPropertyName(i), weights[i]);
-  }
-
-  if(mIsBackground)
-  {
-    SynchronizeBackgroundCornerRadius();
+    verticalBlurActor.RegisterProperty(GetSampleOffsetsPropertyName(i), Vector2(0.0f, uvOffsets[i] / downsampledHeight));
+    verticalBlurActor.RegisterProperty(GetSampleWeightsPropertyName(i), weights[i]);
   }
 }
 
-std::string BlurEffectImpl::GetSampleOffsetsPropertyName(unsigned int index) const
+std::string BlurEffectImpl::GetSampleOffsetsPropertyName(unsigned int index)
 {
   std::ostringstream oss;
   oss << "uSampleOffsets[" << index << "]";
   return oss.str();
 }
 
-std::string BlurEffectImpl::GetSampleWeightsPropertyName(unsigned int index) const
+std::string BlurEffectImpl::GetSampleWeightsPropertyName(unsigned int index)
 {
   std::ostringstream oss;
   oss << "uSampleWeights[" << index << "]";
@@ -19,7 +19,11 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/blur-algorithm.h>
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
+#include <dali-toolkit/internal/controls/render-effects/background-blur-service.h>
 #include <dali-toolkit/internal/controls/render-effects/render-effect-impl.h>
+#include <dali-toolkit/internal/filters/dual-kawase-blur-filter.h>
 #include <dali-toolkit/public-api/controls/render-effects/background-blur-effect.h>
 
 namespace Dali
@@ -56,9 +60,10 @@ public:
    * @param[in] downscaleFactor This value should reside in the range [0.0, 1.0].
    * @param[in] blurRadius The radius of Gaussian kernel.
    * @param[in] isBackground True when blurring background, False otherwise
+   * @param[in] algorithm The algorithm of the blur.
    * @return A handle to a newly allocated Dali resource
    */
-  static BlurEffectImplPtr New(float downscaleFactor, uint32_t blurRadius, bool isBackground);
+  static BlurEffectImplPtr New(float downscaleFactor, uint32_t blurRadius, bool isBackground, Toolkit::BlurAlgorithm::Type algorithm = Toolkit::BlurAlgorithm::GAUSSIAN);
 
   /**
    * @brief Activates blur effect
@@ -70,6 +75,42 @@ public:
    */
   void Deactivate() override;
 
+  /**
+   * @copydoc Dali::Toolkit::DevelBackgroundBlurEffect::SetRefreshPolicy
+   */
+  void SetRefreshPolicy(DevelBackgroundBlurEffect::RefreshPolicy::Type policy);
+
+  /**
+   * @copydoc Dali::Toolkit::DevelBackgroundBlurEffect::GetRefreshPolicy
+   */
+  DevelBackgroundBlurEffect::RefreshPolicy::Type GetRefreshPolicy() const;
+
+  /**
+   * @copydoc Dali::Toolkit::DevelBackgroundBlurEffect::Refresh
+   */
+  void Refresh();
+
+  /**
+   * @brief Sets shader constants, gaussian kernel weights and pixel offsets, to the actors of a blur.
+   * @param[in] horizontalBlurActor The actor performing the horizontal blur.
+   * @param[in] verticalBlurActor The actor performing the vertical blur.
+   * @param[in] pixelRadius The number of the sample pairs.
+   * @param[in] downsampledWidth Downsized width of input texture.
+   * @param[in] downsampledHeight Downsized height of input texture.
+   */
+  static void SetShaderConstants(Actor horizontalBlurActor, Actor verticalBlurActor, uint32_t pixelRadius, float downsampledWidth, float downsampledHeight);
+
+  /**
+   * @brief Retrieves the radius of the dual Kawase blur which matches the gaussian kernel.
+   * @param[in] pixelRadius The number of the sample pairs of the gaussian kernel.
+   * @return The radius in pixels of the downsampled texture.
+   */
+  static float GetDualKawaseBlurRadius(uint32_t pixelRadius)
+  {
+    // Each sample pair covers two pixels.
+    return static_cast<float>(pixelRadius * 2u);
+  }
+
 protected:
   /**
    * @brief Creates an uninitialized blur effect implementation
@@ -82,8 +123,9 @@ protected:
    * @param[in] downscaleFactor This value should reside in the range [0.0, 1.0].
    * @param[in] blurRadius The radius of Gaussian kernel.
    * @param[in] isBackground True when blurring background, False otherwise
+   * @param[in] algorithm The algorithm of the blur.
    */
-  BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground);
+  BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground, Toolkit::BlurAlgorithm::Type algorithm);
 
   /**
    * @brief Destructor
@@ -109,31 +151,49 @@ private:
    * @brief Calculates gaussian weight
    * @param[in] localOffset Input to the function
    */
-  inline float CalculateGaussianWeight(float localOffset, float sigma) const
+  static inline float CalculateGaussianWeight(float localOffset, float sigma)
   {
     return (1.0f / sqrt(2.0f * Math::PI * sigma)) * exp(-(localOffset * localOffset) * (1.0f / (2.0f * sigma * sigma)));
   }
 
   /**
-   * @brief Sets shader constants, gaussian kernel weights and pixel offsets.
-   * @param[in] downsampledWidth Downsized width of input texture.
-   * @param[in] downsampledHeight Downsized height of input texture.
+   * @brief Calculates the width of the bell curve of the gaussian kernel.
+   * @param[in] pixelRadius The number of the sample pairs.
+   * @return The width of the bell curve.
    */
-  void SetShaderConstants(float downsampledWidth, float downsampledHeight);
+  static float CalculateBellCurveWidth(uint32_t pixelRadius);
 
   /**
    * @brief Get an offset property in std::string format
    * @param[in] index Property's index
    * @return A string for shader
    */
-  std::string GetSampleOffsetsPropertyName(unsigned int index) const;
+  static std::string GetSampleOffsetsPropertyName(unsigned int index);
 
   /**
    * @brief Get a weight property in std::string format
    * @param[in] index Property's index
    * @return A string for shader
    */
-  std::string GetSampleWeightsPropertyName(unsigned int index) const;
+  static std::string GetSampleWeightsPropertyName(unsigned int index);
+
+  /**
+   * @brief Creates the horizontal and vertical gaussian blurs from mInputBackgroundFrameBuffer into mSourceFrameBuffer.
+   * @param[in] downsampledWidth Downsized width of input texture.
+   * @param[in] downsampledHeight Downsized height of input texture.
+   */
+  void ActivateGaussianBlur(uint32_t downsampledWidth, uint32_t downsampledHeight);
+
+  /**
+   * @brief Activates the blur of the background, shared with the other background blur effects of the window.
+   */
+  void ActivateBackground();
+
+  /**
+   * @brief Sets the refresh rates of the render tasks of the foreground blur by mRefreshPolicy.
+   * Setting RenderTask::REFRESH_ONCE again renders the tasks once more.
+   */
+  void ApplyRefreshPolicy();
 
   /**
    * @brief Synchronize mOwnerControl's background corner radius to the blurred output.
@@ -160,13 +220,20 @@ private:
   Actor       mVerticalBlurActor;
   RenderTask  mVerticalBlurTask;
 
+  DualKawaseBlurFilter mDualKawaseBlurFilter; // Replaces the horizontal and vertical blurs with BlurAlgorithm::DUAL_KAWASE.
+
   FrameBuffer mSourceFrameBuffer; // Output. Blurred background texture for mOwnerControl and mRenderer.
   RenderTask  mSourceRenderTask;
 
+  BackgroundBlurServicePtr     mBackgroundBlurService; // Blurs the background of the window. Only for the background blur.
+  WeakHandle<Toolkit::Control> mBlurredControl;        // The control registered to mBackgroundBlurService.
+
   // Variables
-  float    mDownscaleFactor;
-  uint32_t mPixelRadius;
-  float    mBellCurveWidth;
+  float                        mDownscaleFactor;
+  uint32_t                     mPixelRadius;
+  Toolkit::BlurAlgorithm::Type mBlurAlgorithm;
+
+  DevelBackgroundBlurEffect::RefreshPolicy::Type mRefreshPolicy;
 
   bool mIsActivated : 1;
   bool mIsBackground : 1;
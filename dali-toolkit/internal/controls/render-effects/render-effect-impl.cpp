@@ -25,6 +25,8 @@
 namespace
 {
 static constexpr float SIZE_STEP_CONDITION = 3.0f;
+
+static const Dali::Vector4 FULL_TEXTURE_RECT(0.0f, 0.0f, 1.0f, 1.0f);
 } // namespace
 
 namespace Dali
@@ -49,6 +51,7 @@ void RenderEffectImpl::SetOwnerControl(Dali::Toolkit::Control control)
 
     mTargetSize = mOwnerControl.GetProperty<Vector2>(Actor::Property::SIZE);
     mRenderer   = CreateRenderer(SHADER_RENDER_EFFECT_VERT, SHADER_RENDER_EFFECT_FRAG);
+    mRenderer.RegisterProperty(TEXTURE_RECT_UNIFORM_NAME, FULL_TEXTURE_RECT);
 
     mSizeNotification = control.AddPropertyNotification(Actor::Property::SIZE, StepCondition(SIZE_STEP_CONDITION));
     mSizeNotification.NotifySignal().Connect(this, &RenderEffectImpl::OnSizeSet);
@@ -37,6 +37,12 @@ using RenderEffectImplPtr = IntrusivePtr<RenderEffectImpl>;
 class RenderEffectImpl : public BaseObject, public ConnectionTracker
 {
 public:
+  /**
+   * @brief The name of the uniform of the target renderer which has the area of its texture to sample.
+   * The whole texture is sampled by default.
+   */
+  static constexpr const char* TEXTURE_RECT_UNIFORM_NAME = "uTextureRect";
+
   /**
    * @brief Activates effect on ownerControl
    */
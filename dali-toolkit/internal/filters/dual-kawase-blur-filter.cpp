@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "dual-kawase-blur-filter.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/stage.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <algorithm>
+#include <cmath>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/visuals/visual-factory-impl.h>
+#include <dali-toolkit/public-api/visuals/visual-factory.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+const char* const HALF_PIXEL_UNIFORM_NAME("uHalfPixel");
+const char* const OFFSET_UNIFORM_NAME("uOffset");
+
+const uint32_t MAXIMUM_ITERATION_COUNT = 10u;
+const float    MINIMUM_LEVEL_SIZE      = 2.0f; ///< The shorter side of the smallest level, in pixels
+
+} // namespace
+
+DualKawaseBlurFilter::DualKawaseBlurFilter()
+: ImageFilter(),
+  mRadius(0.0f),
+  mOrderIndex(0)
+{
+}
+
+DualKawaseBlurFilter::~DualKawaseBlurFilter()
+{
+}
+
+void DualKawaseBlurFilter::SetRadius(float radius)
+{
+  mRadius = std::max(radius, 0.0f);
+}
+
+void DualKawaseBlurFilter::SetRenderTaskList(RenderTaskList taskList)
+{
+  mRenderTaskList = taskList;
+}
+
+void DualKawaseBlurFilter::SetOrderIndex(int32_t orderIndex)
+{
+  mOrderIndex = orderIndex;
+}
+
+RenderTask DualKawaseBlurFilter::GetOutputRenderTask() const
+{
+  return mRenderTasks.empty() ? RenderTask() : mRenderTasks.back();
+}
+
+uint32_t DualKawaseBlurFilter::CalculateIterationCount(float radius, const Vector2& size)
+{
+  // A pair of passes at level n spreads the samples by about 2^n pixels of the output, so n passes cover a radius of
+  // about 2^(n+1) pixels. The remainder is covered by the offset of the samples, which is kept in [1, 2).
+  uint32_t iterations = 1u;
+  while(iterations < MAXIMUM_ITERATION_COUNT && float(1u << (iterations + 2u)) <= radius)
+  {
+    ++iterations;
+  }
+
+  // Stop before the levels become smaller than a few pixels. The offset gets bigger instead.
+  const float shorterSide = std::min(size.width, size.height);
+  while(iterations > 1u && shorterSide / float(1u << iterations) < MINIMUM_LEVEL_SIZE)
+  {
+    --iterations;
+  }
+
+  return iterations;
+}
+
+void DualKawaseBlurFilter::Enable()
+{
+  if(!mRenderTaskList)
+  {
+    mRenderTaskList = Stage::GetCurrent().GetRenderTaskList();
+  }
+
+  const uint32_t iterations = CalculateIterationCount(mRadius, mTargetSize);
+  const float    offset     = mRadius / float(1u << (iterations + 1u));
+
+  // The shaders are shared by all the filters.
+  Toolkit::VisualFactory factory          = Toolkit::VisualFactory::Get();
+  Shader                 downsampleShader = GetImplementation(factory).GetDualKawaseBlurShader(false);
+  Shader                 upsampleShader   = GetImplementation(factory).GetDualKawaseBlurShader(true);
+
+  // The camera covers the target size. Every pass renders an actor of the target size, and the viewport of the task is
+  // the size of its frame buffer, so each level is filled whatever its size is.
+  SetupCamera();
+
+  // Downsample the input into smaller and smaller levels
+  std::vector<Vector2> levelSizes;
+  Vector2              levelSize = mTargetSize;
+  Texture              input     = mInputTexture;
+  for(uint32_t i = 0u; i < iterations; ++i)
+  {
+    levelSize.width  = std::max(std::floor(levelSize.width * 0.5f), 1.0f);
+    levelSize.height = std::max(std::floor(levelSize.height * 0.5f), 1.0f);
+
+    FrameBuffer frameBuffer = FrameBuffer::New(unsigned(levelSize.width), unsigned(levelSize.height), FrameBuffer::Attachment::NONE);
+    Texture     texture     = Texture::New(TextureType::TEXTURE_2D, mPixelFormat, unsigned(levelSize.width), unsigned(levelSize.height));
+    frameBuffer.AttachColorTexture(texture);
+
+    CreatePass(downsampleShader, input, frameBuffer, levelSize);
+    mActors.back().RegisterProperty(OFFSET_UNIFORM_NAME, offset);
+
+    mFrameBuffers.push_back(frameBuffer);
+    levelSizes.push_back(levelSize);
+    input = texture;
+  }
+
+  // Upsample back to the target size. The levels are reused, as their downsampled images have been consumed already.
+  for(uint32_t i = iterations; i > 0u; --i)
+  {
+    const bool  isLast     = (i == 1u);
+    FrameBuffer output     = isLast ? mOutputFrameBuffer : mFrameBuffers[i - 2u];
+    Vector2     outputSize = isLast ? mTargetSize : levelSizes[i - 2u];
+
+    CreatePass(upsampleShader, mFrameBuffers[i - 1u].GetColorTexture(), output, outputSize);
+    mActors.back().RegisterProperty(OFFSET_UNIFORM_NAME, offset);
+  }
+}
+
+void DualKawaseBlurFilter::Disable()
+{
+  for(auto&& task : mRenderTasks)
+  {
+    mRenderTaskList.RemoveTask(task);
+  }
+  mRenderTasks.clear();
+
+  for(auto&& actor : mActors)
+  {
+    actor.Unparent();
+  }
+  mActors.clear();
+  mFrameBuffers.clear();
+
+  if(mCameraActor)
+  {
+    mCameraActor.Unparent();
+    mCameraActor.Reset();
+  }
+}
+
+void DualKawaseBlurFilter::Refresh()
+{
+  for(auto&& task : mRenderTasks)
+  {
+    task.SetRefreshRate(mRefreshOnDemand ? RenderTask::REFRESH_ONCE : RenderTask::REFRESH_ALWAYS);
+  }
+}
+
+void DualKawaseBlurFilter::CreatePass(Shader shader, Texture input, FrameBuffer output, const Vector2& outputSize)
+{
+  Renderer renderer = CreateRenderer(shader);
+  SetRendererTexture(renderer, input);
+
+  Actor actor = Actor::New();
+  actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  actor.SetProperty(Actor::Property::SIZE, mTargetSize);
+  actor.AddRenderer(renderer);
+  actor.RegisterProperty(HALF_PIXEL_UNIFORM_NAME, Vector2(0.5f / outputSize.width, 0.5f / outputSize.height));
+  mRootActor.Add(actor);
+
+  RenderTask task = mRenderTaskList.CreateTask();
+  task.SetRefreshRate(mRefreshOnDemand ? RenderTask::REFRESH_ONCE : RenderTask::REFRESH_ALWAYS);
+  task.SetSourceActor(actor);
+  task.SetOrderIndex(mOrderIndex);
+  task.SetExclusive(true);
+  task.SetInputEnabled(false);
+  task.SetClearEnabled(true);
+  task.SetClearColor(mBackgroundColor);
+  task.SetFrameBuffer(output);
+  task.SetCameraActor(mCameraActor);
+
+  mActors.push_back(actor);
+  mRenderTasks.push_back(task);
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
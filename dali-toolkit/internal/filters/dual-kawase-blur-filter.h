@@ -0,0 +1,127 @@
+#ifndef DALI_TOOLKIT_INTERNAL_DUAL_KAWASE_BLUR_FILTER_H
+#define DALI_TOOLKIT_INTERNAL_DUAL_KAWASE_BLUR_FILTER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/render-tasks/render-task-list.h>
+#include <dali/public-api/render-tasks/render-task.h>
+#include <dali/public-api/rendering/shader.h>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "image-filter.h"
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * A dual Kawase blur filter. The input texture is downsampled by half a number of times, then upsampled back
+ * to the size of the filter into the output frame buffer. Each pass takes 5 or 8 bilinear samples, and every
+ * additional pass works on a quarter of the pixels of the previous one, so the cost stays roughly constant
+ * however big the radius is.
+ */
+class DualKawaseBlurFilter : public ImageFilter
+{
+public:
+  /**
+   * Default constructor
+   */
+  DualKawaseBlurFilter();
+
+  /**
+   * Destructor
+   */
+  virtual ~DualKawaseBlurFilter();
+
+  /**
+   * Set the radius of the blur
+   * @param[in] radius The radius in pixels of the output frame buffer.
+   */
+  void SetRadius(float radius);
+
+  /**
+   * Set the render task list the render tasks are created in. The list of the current stage is used by default.
+   * @param[in] taskList The render task list of the window.
+   */
+  void SetRenderTaskList(RenderTaskList taskList);
+
+  /**
+   * Set the order index of the render tasks, so they are rendered after the input texture.
+   * @param[in] orderIndex The order index.
+   */
+  void SetOrderIndex(int32_t orderIndex);
+
+  /**
+   * Retrieve the render task which renders the output frame buffer
+   * @return The last render task, or an empty handle if the filter is not enabled.
+   */
+  RenderTask GetOutputRenderTask() const;
+
+  /**
+   * Calculate the number of the downsampling passes, which is also the number of the upsampling passes.
+   * @param[in] radius The radius of the blur in pixels.
+   * @param[in] size The size of the output.
+   * @return The number of the passes in each direction.
+   */
+  static uint32_t CalculateIterationCount(float radius, const Vector2& size);
+
+public: // From ImageFilter
+  /// @copydoc Dali::Toolkit::Internal::ImageFilter::Enable
+  void Enable() override;
+
+  /// @copydoc Dali::Toolkit::Internal::ImageFilter::Disable
+  void Disable() override;
+
+  /// @copydoc Dali::Toolkit::Internal::ImageFilter::Refresh
+  void Refresh() override;
+
+private:
+  /**
+   * Create an actor and its render task for a pass
+   * @param[in] shader The shader of the pass.
+   * @param[in] input The texture the pass samples.
+   * @param[in] output The frame buffer the pass renders.
+   * @param[in] outputSize The size of the output frame buffer.
+   */
+  void CreatePass(Shader shader, Texture input, FrameBuffer output, const Vector2& outputSize);
+
+private:
+  DualKawaseBlurFilter(const DualKawaseBlurFilter&);
+  DualKawaseBlurFilter& operator=(const DualKawaseBlurFilter&);
+
+private: // Attributes
+  RenderTaskList           mRenderTaskList;
+  std::vector<FrameBuffer> mFrameBuffers; ///< The downsampled levels, reused by the upsampling passes
+  std::vector<Actor>       mActors;
+  std::vector<RenderTask>  mRenderTasks;
+  float                    mRadius;
+  int32_t                  mOrderIndex;
+
+}; // class DualKawaseBlurFilter
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_DUAL_KAWASE_BLUR_FILTER_H
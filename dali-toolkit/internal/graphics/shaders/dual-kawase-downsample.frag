@@ -0,0 +1,15 @@
+varying highp vec2 vTexCoord;
+uniform sampler2D sTexture;
+uniform highp vec2 uHalfPixel;
+uniform highp float uOffset;
+
+void main()
+{
+  highp vec2 offset = uHalfPixel * uOffset;
+  highp vec4 sum = texture2D(sTexture, vTexCoord) * 4.0;
+  sum += texture2D(sTexture, vTexCoord - offset);
+  sum += texture2D(sTexture, vTexCoord + offset);
+  sum += texture2D(sTexture, vTexCoord + vec2(offset.x, -offset.y));
+  sum += texture2D(sTexture, vTexCoord - vec2(offset.x, -offset.y));
+  gl_FragColor = sum * 0.125;
+}
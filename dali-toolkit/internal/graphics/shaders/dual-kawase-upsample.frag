@@ -0,0 +1,18 @@
+varying highp vec2 vTexCoord;
+uniform sampler2D sTexture;
+uniform highp vec2 uHalfPixel;
+uniform highp float uOffset;
+
+void main()
+{
+  highp vec2 offset = uHalfPixel * uOffset;
+  highp vec4 sum = texture2D(sTexture, vTexCoord + vec2(-offset.x * 2.0, 0.0));
+  sum += texture2D(sTexture, vTexCoord + vec2(-offset.x, offset.y)) * 2.0;
+  sum += texture2D(sTexture, vTexCoord + vec2(0.0, offset.y * 2.0));
+  sum += texture2D(sTexture, vTexCoord + vec2(offset.x, offset.y)) * 2.0;
+  sum += texture2D(sTexture, vTexCoord + vec2(offset.x * 2.0, 0.0));
+  sum += texture2D(sTexture, vTexCoord + vec2(offset.x, -offset.y)) * 2.0;
+  sum += texture2D(sTexture, vTexCoord + vec2(0.0, -offset.y * 2.0));
+  sum += texture2D(sTexture, vTexCoord + vec2(-offset.x, -offset.y)) * 2.0;
+  gl_FragColor = sum / 12.0;
+}
@@ -1,6 +1,7 @@
 precision highp float;
 varying highp vec2 vFragCoord;
 varying highp vec2 vTexCoord;
+varying highp vec2 vSampleCoord;
 varying highp vec4 vCornerRadius;
 uniform highp vec3 uSize;
 uniform sampler2D sTexture;
@@ -30,7 +31,7 @@ float roundedBoxSDF(vec2 PixelPositionFromCenter, vec2 RectangleEdgePositionFrom
 
 void main()
 {
-  gl_FragColor = texture2D(sTexture, vTexCoord);
+  gl_FragColor = texture2D(sTexture, vSampleCoord);
 
   highp vec2 location = vTexCoord.xy - vec2(0.5);
   float radius =
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,7 +20,9 @@
 
 // EXTERNAL HEADER
 #include <dali/integration-api/debug.h>
+#include <algorithm>
 #include <cstdlib> // For abs()
+#include <limits>
 
 namespace Dali
 {
@@ -47,6 +49,18 @@ void Swap(Uint16Pair& first, Uint16Pair& second)
   second          = temp;
 }
 
+bool IsOverlap(const AtlasPacker::RectArea& first, const AtlasPacker::RectArea& second)
+{
+  return first.x < second.x + second.width && second.x < first.x + first.width &&
+         first.y < second.y + second.height && second.y < first.y + first.height;
+}
+
+bool IsContained(const AtlasPacker::RectArea& inner, const AtlasPacker::RectArea& outer)
+{
+  return inner.x >= outer.x && inner.y >= outer.y &&
+         inner.x + inner.width <= outer.x + outer.width && inner.y + inner.height <= outer.y + outer.height;
+}
+
 } // namespace
 
 AtlasPacker::Node::Node(Node* parent, SizeType x, SizeType y, SizeType width, SizeType height)
@@ -58,10 +72,22 @@ AtlasPacker::Node::Node(Node* parent, SizeType x, SizeType y, SizeType width, Si
   child[1] = NULL;
 }
 
-AtlasPacker::AtlasPacker(SizeType atlasWidth, SizeType atlasHeight)
-: mAvailableArea(atlasWidth * atlasHeight)
+AtlasPacker::AtlasPacker(SizeType atlasWidth, SizeType atlasHeight, Algorithm algorithm)
+: mRoot(NULL),
+  mAtlasWidth(atlasWidth),
+  mAtlasHeight(atlasHeight),
+  mAvailableArea(atlasWidth * atlasHeight),
+  mAlgorithm(algorithm),
+  mFreeRectsDirty(false)
 {
-  mRoot = new Node(NULL, 0u, 0u, atlasWidth, atlasHeight);
+  if(mAlgorithm == Algorithm::MAX_RECTS)
+  {
+    mFreeRects.push_back(RectArea(0u, 0u, atlasWidth, atlasHeight));
+  }
+  else
+  {
+    mRoot = new Node(NULL, 0u, 0u, atlasWidth, atlasHeight);
+  }
 }
 
 AtlasPacker::~AtlasPacker()
@@ -71,6 +97,11 @@ AtlasPacker::~AtlasPacker()
 
 bool AtlasPacker::Pack(SizeType blockWidth, SizeType blockHeight, SizeType& packPositionX, SizeType& packPositionY)
 {
+  if(mAlgorithm == Algorithm::MAX_RECTS)
+  {
+    return PackMaxRects(blockWidth, blockHeight, packPositionX, packPositionY);
+  }
+
   Node* firstFit = InsertNode(mRoot, blockWidth, blockHeight);
   if(firstFit != NULL)
   {
@@ -85,6 +116,12 @@ bool AtlasPacker::Pack(SizeType blockWidth, SizeType blockHeight, SizeType& pack
 
 void AtlasPacker::DeleteBlock(SizeType packPositionX, SizeType packPositionY, SizeType blockWidth, SizeType blockHeight)
 {
+  if(mAlgorithm == Algorithm::MAX_RECTS)
+  {
+    DeleteBlockMaxRects(packPositionX, packPositionY, blockWidth, blockHeight);
+    return;
+  }
+
   Node* node = SearchNode(mRoot, packPositionX, packPositionY, blockWidth, blockHeight);
   if(node != NULL)
   {
@@ -296,6 +333,137 @@ void AtlasPacker::GrowNode(SizeType blockWidth, SizeType blockHeight)
   }
 }
 
+bool AtlasPacker::PackMaxRects(SizeType blockWidth, SizeType blockHeight, SizeType& packPositionX, SizeType& packPositionY)
+{
+  // Best short side fit: the free rectangle which leaves the smallest remaining width or height.
+  const RectArea* bestFit          = NULL;
+  SizeType        bestShortSideFit = std::numeric_limits<SizeType>::max();
+  SizeType        bestLongSideFit  = std::numeric_limits<SizeType>::max();
+  for(const auto& freeRect : mFreeRects)
+  {
+    if(freeRect.width >= blockWidth && freeRect.height >= blockHeight)
+    {
+      SizeType remainingWidth  = freeRect.width - blockWidth;
+      SizeType remainingHeight = freeRect.height - blockHeight;
+      SizeType shortSideFit    = std::min(remainingWidth, remainingHeight);
+      SizeType longSideFit     = std::max(remainingWidth, remainingHeight);
+      if(shortSideFit < bestShortSideFit || (shortSideFit == bestShortSideFit && longSideFit < bestLongSideFit))
+      {
+        bestFit          = &freeRect;
+        bestShortSideFit = shortSideFit;
+        bestLongSideFit  = longSideFit;
+      }
+    }
+  }
+
+  if(bestFit == NULL)
+  {
+    if(mFreeRectsDirty)
+    {
+      // The deleted blocks may join the free rectangles into bigger ones.
+      RebuildFreeRects();
+      return PackMaxRects(blockWidth, blockHeight, packPositionX, packPositionY);
+    }
+    return false;
+  }
+
+  RectArea usedRect(bestFit->x, bestFit->y, blockWidth, blockHeight);
+  SplitFreeRects(usedRect);
+  mUsedRects.push_back(usedRect);
+
+  packPositionX = usedRect.x;
+  packPositionY = usedRect.y;
+  mAvailableArea -= blockWidth * blockHeight;
+  return true;
+}
+
+void AtlasPacker::DeleteBlockMaxRects(SizeType packPositionX, SizeType packPositionY, SizeType blockWidth, SizeType blockHeight)
+{
+  for(auto iter = mUsedRects.begin(), endIter = mUsedRects.end(); iter != endIter; ++iter)
+  {
+    if(ApproximatelyEqual(iter->x, packPositionX) && ApproximatelyEqual(iter->y, packPositionY) && ApproximatelyEqual(iter->width, blockWidth) && ApproximatelyEqual(iter->height, blockHeight))
+    {
+      const RectArea freedRect = *iter;
+      mAvailableArea += freedRect.width * freedRect.height;
+      mUsedRects.erase(iter);
+
+      // The freed area can be used as it is. It may join the other free rectangles into bigger ones, which are only
+      // found again when a block doesn't fit, as it is expensive.
+      mFreeRects.erase(std::remove_if(mFreeRects.begin(), mFreeRects.end(), [&freedRect](const RectArea& freeRect) { return IsContained(freeRect, freedRect); }), mFreeRects.end());
+      mFreeRects.push_back(freedRect);
+      mFreeRectsDirty = true;
+      return;
+    }
+  }
+}
+
+void AtlasPacker::SplitFreeRects(const RectArea& usedRect)
+{
+  std::vector<RectArea> splitRects;
+
+  std::size_t keptCount = 0u;
+  for(std::size_t index = 0u; index < mFreeRects.size(); ++index)
+  {
+    const RectArea freeRect = mFreeRects[index];
+    if(!IsOverlap(freeRect, usedRect))
+    {
+      mFreeRects[keptCount++] = freeRect;
+      continue;
+    }
+
+    // Keep the parts of the free rectangle at the left, right, top and bottom of the used rectangle. They can overlap each other.
+    if(usedRect.x > freeRect.x)
+    {
+      splitRects.push_back(RectArea(freeRect.x, freeRect.y, usedRect.x - freeRect.x, freeRect.height));
+    }
+    if(usedRect.x + usedRect.width < freeRect.x + freeRect.width)
+    {
+      splitRects.push_back(RectArea(usedRect.x + usedRect.width, freeRect.y, freeRect.x + freeRect.width - usedRect.x - usedRect.width, freeRect.height));
+    }
+    if(usedRect.y > freeRect.y)
+    {
+      splitRects.push_back(RectArea(freeRect.x, freeRect.y, freeRect.width, usedRect.y - freeRect.y));
+    }
+    if(usedRect.y + usedRect.height < freeRect.y + freeRect.height)
+    {
+      splitRects.push_back(RectArea(freeRect.x, usedRect.y + usedRect.height, freeRect.width, freeRect.y + freeRect.height - usedRect.y - usedRect.height));
+    }
+  }
+  mFreeRects.resize(keptCount);
+
+  // Only the split rectangles can be contained in another one, as the kept rectangles were maximal already.
+  for(std::size_t index = 0u; index < splitRects.size(); ++index)
+  {
+    const RectArea& splitRect = splitRects[index];
+    bool            contained = false;
+    for(std::size_t keptIndex = 0u; keptIndex < keptCount && !contained; ++keptIndex)
+    {
+      contained = IsContained(splitRect, mFreeRects[keptIndex]);
+    }
+    for(std::size_t otherIndex = 0u; otherIndex < splitRects.size() && !contained; ++otherIndex)
+    {
+      // Of two equal rectangles, keep the first one.
+      contained = otherIndex != index && IsContained(splitRect, splitRects[otherIndex]) && (otherIndex < index || !IsContained(splitRects[otherIndex], splitRect));
+    }
+
+    if(!contained)
+    {
+      mFreeRects.push_back(splitRect);
+    }
+  }
+}
+
+void AtlasPacker::RebuildFreeRects()
+{
+  mFreeRects.clear();
+  mFreeRects.push_back(RectArea(0u, 0u, mAtlasWidth, mAtlasHeight));
+  for(const auto& usedRect : mUsedRects)
+  {
+    SplitFreeRects(usedRect);
+  }
+  mFreeRectsDirty = false;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
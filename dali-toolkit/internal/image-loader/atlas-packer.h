@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_ATLAS_PACKER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <dali/public-api/math/rect.h>
 #include <dali/public-api/math/uint-16-pair.h>
 #include <stdint.h>
+#include <vector>
 
 namespace Dali
 {
@@ -32,6 +33,9 @@ namespace Internal
  * Binary space tree based bin packing algorithm.
  * It is initialised with a fixed width and height and will fit each block into the first node where it fits
  * and then split that node into 2 parts (down and right) to track the remaining empty space.
+ *
+ * Alternatively, it can keep the maximal free rectangles (MaxRects), and fit each block into the one which leaves the
+ * shortest side. The empty space is not tied to the order the blocks were packed, so it fragments less when blocks are deleted.
  */
 class AtlasPacker
 {
@@ -42,6 +46,15 @@ public:
   typedef uint32_t       SizeType;
   typedef Rect<SizeType> RectArea;
 
+  /**
+   * The algorithm to find the position of a block.
+   */
+  enum class Algorithm
+  {
+    BINARY_TREE, ///< Fits the block into the first node of the binary space tree where it fits.
+    MAX_RECTS    ///< Fits the block into the maximal free rectangle which leaves the shortest side.
+  };
+
   /**
    * Tree node.
    */
@@ -60,8 +73,9 @@ public:
    *
    * @param[in] atlasWidth The width of the atlas.
    * @param[in] atlasHeight The height of the atlas.
+   * @param[in] algorithm The algorithm to find the position of a block.
    */
-  AtlasPacker(SizeType atlasWidth, SizeType atlasHeight);
+  AtlasPacker(SizeType atlasWidth, SizeType atlasHeight, Algorithm algorithm = Algorithm::BINARY_TREE);
 
   /**
    * Destructor
@@ -96,6 +110,16 @@ public:
    */
   unsigned int GetAvailableArea() const;
 
+  /**
+   * Query the algorithm to find the position of a block.
+   *
+   * @return The algorithm.
+   */
+  Algorithm GetAlgorithm() const
+  {
+    return mAlgorithm;
+  }
+
   /**
    * Pack a group of blocks with different sizes, calculate the required packing size and the position of each block.
    * @param[in] blockSizes The size list of the blocks .
@@ -168,6 +192,39 @@ private:
    */
   void GrowNode(SizeType blockWidth, SizeType blockHeight);
 
+  /**
+   * Pack a block into the maximal free rectangle which leaves the shortest side.
+   *
+   * @param[in] blockWidth The width of the block to pack.
+   * @param[in] blockHeight The height of the block to pack.
+   * @param[out] packPositionX The x coordinate of the position to pack the block.
+   * @param[out] packPositionY The y coordinate of the position to pack the block.
+   * @return True if there are room for this block, false otherwise.
+   */
+  bool PackMaxRects(SizeType blockWidth, SizeType blockHeight, SizeType& packPositionX, SizeType& packPositionY);
+
+  /**
+   * Delete a block packed into the maximal free rectangles.
+   *
+   * @param[in] packPositionX The x coordinate of the pack position.
+   * @param[in] packPositionY The y coordinate of the pack position.
+   * @param[in] blockWidth The width of the block to delete.
+   * @param[in] blockHeight The height of the block to delete.
+   */
+  void DeleteBlockMaxRects(SizeType packPositionX, SizeType packPositionY, SizeType blockWidth, SizeType blockHeight);
+
+  /**
+   * Split the free rectangles which overlap the packed block, so they only cover the remaining empty space.
+   *
+   * @param[in] usedRect The area of the packed block.
+   */
+  void SplitFreeRects(const RectArea& usedRect);
+
+  /**
+   * Find the maximal free rectangles again from the packed blocks, e.g. after a block is deleted.
+   */
+  void RebuildFreeRects();
+
   // Undefined
   AtlasPacker(const AtlasPacker& atlasPacker);
 
@@ -175,8 +232,14 @@ private:
   AtlasPacker& operator=(const AtlasPacker& atlasPacker);
 
 private:
-  Node*        mRoot; ///< The root of the binary space tree
-  unsigned int mAvailableArea;
+  Node*                 mRoot;           ///< The root of the binary space tree
+  std::vector<RectArea> mFreeRects;      ///< The maximal free rectangles, for Algorithm::MAX_RECTS
+  std::vector<RectArea> mUsedRects;      ///< The packed blocks, for Algorithm::MAX_RECTS
+  SizeType              mAtlasWidth;     ///< The width of the atlas
+  SizeType              mAtlasHeight;    ///< The height of the atlas
+  unsigned int          mAvailableArea;  ///< The area available for packing
+  Algorithm             mAlgorithm;      ///< The algorithm to find the position of a block
+  bool                  mFreeRectsDirty; ///< Whether the maximal free rectangles need to be found again
 };
 
 } // namespace Internal
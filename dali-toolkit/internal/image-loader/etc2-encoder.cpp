@@ -0,0 +1,542 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/image-loader/etc2-encoder.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace Etc2Encoder
+{
+namespace
+{
+constexpr uint32_t PIXEL_COUNT = BLOCK_SIZE * BLOCK_SIZE;
+
+/**
+ * The intensity modifiers of the color tables. A pixel index selects +small, +large, -small or -large.
+ */
+constexpr int32_t COLOR_MODIFIERS[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+
+/**
+ * The modifiers of the alpha tables.
+ */
+constexpr int32_t ALPHA_MODIFIERS[16][8] = {
+  {-3, -6, -9, -15, 2, 5, 8, 14},
+  {-3, -7, -10, -13, 2, 6, 9, 12},
+  {-2, -5, -8, -13, 1, 4, 7, 12},
+  {-2, -4, -6, -13, 1, 3, 5, 12},
+  {-3, -6, -8, -12, 2, 5, 7, 11},
+  {-3, -7, -9, -11, 2, 6, 8, 10},
+  {-4, -7, -8, -11, 3, 6, 7, 10},
+  {-3, -5, -8, -11, 2, 4, 7, 10},
+  {-2, -6, -8, -10, 1, 5, 7, 9},
+  {-2, -5, -8, -10, 1, 4, 7, 9},
+  {-2, -4, -8, -10, 1, 3, 7, 9},
+  {-2, -5, -7, -10, 1, 4, 6, 9},
+  {-3, -4, -7, -10, 2, 3, 6, 9},
+  {-1, -2, -3, -10, 0, 1, 2, 9},
+  {-4, -6, -8, -9, 3, 5, 7, 8},
+  {-3, -5, -7, -9, 2, 4, 6, 8}};
+
+constexpr uint32_t OPAQUE_ALPHA_TABLE = 13u; ///< The alpha table which has a zero modifier
+constexpr uint32_t OPAQUE_ALPHA_INDEX = 4u;  ///< The index of the zero modifier
+
+/**
+ * The weights of the color channels in the error, close to their contribution to the luminance.
+ */
+constexpr uint32_t CHANNEL_WEIGHTS[3] = {3u, 6u, 1u};
+
+inline int32_t Clamp(int32_t value)
+{
+  return std::min(std::max(value, 0), 255);
+}
+
+inline int32_t Expand4(int32_t value)
+{
+  return (value << 4) | value;
+}
+
+inline int32_t Expand5(int32_t value)
+{
+  return (value << 3) | (value >> 2);
+}
+
+/**
+ * The half of a block which shares a base color and a table.
+ */
+struct SubBlock
+{
+  uint8_t pixels[8][3];  ///< The colors of the pixels
+  uint8_t positions[8];  ///< The index of the pixels in the block, in columns
+};
+
+/**
+ * The encoding of a sub block.
+ */
+struct SubBlockEncoding
+{
+  uint32_t error;
+  uint32_t table;
+  uint8_t  selectors[8];
+};
+
+/**
+ * Finds the table which encodes the sub block with the least error, for a base color.
+ */
+SubBlockEncoding EncodeSubBlock(const SubBlock& subBlock, const int32_t base[3])
+{
+  SubBlockEncoding best;
+  best.error = std::numeric_limits<uint32_t>::max();
+  best.table = 0u;
+
+  for(uint32_t table = 0u; table < 8u; ++table)
+  {
+    // Index 0: +small, 1: +large, 2: -small, 3: -large
+    const int32_t modifiers[4] = {COLOR_MODIFIERS[table][0], COLOR_MODIFIERS[table][1], -COLOR_MODIFIERS[table][0], -COLOR_MODIFIERS[table][1]};
+    int32_t       colors[4][3];
+    for(uint32_t index = 0u; index < 4u; ++index)
+    {
+      for(uint32_t channel = 0u; channel < 3u; ++channel)
+      {
+        colors[index][channel] = Clamp(base[channel] + modifiers[index]);
+      }
+    }
+
+    SubBlockEncoding encoding;
+    encoding.error = 0u;
+    encoding.table = table;
+    for(uint32_t pixel = 0u; pixel < 8u && encoding.error < best.error; ++pixel)
+    {
+      uint32_t bestPixelError = std::numeric_limits<uint32_t>::max();
+      for(uint32_t index = 0u; index < 4u; ++index)
+      {
+        uint32_t error = 0u;
+        for(uint32_t channel = 0u; channel < 3u; ++channel)
+        {
+          const int32_t difference = colors[index][channel] - subBlock.pixels[pixel][channel];
+          error += CHANNEL_WEIGHTS[channel] * static_cast<uint32_t>(difference * difference);
+        }
+        if(error < bestPixelError)
+        {
+          bestPixelError            = error;
+          encoding.selectors[pixel] = static_cast<uint8_t>(index);
+        }
+      }
+      encoding.error += bestPixelError;
+    }
+
+    if(encoding.error < best.error)
+    {
+      best = encoding;
+    }
+  }
+  return best;
+}
+
+/**
+ * Encodes a sub block with a quantized base color, refining the color by one step in each channel for the HIGH quality.
+ * @param[in,out] quantized The quantized base color, which is updated with the refined one.
+ */
+SubBlockEncoding EncodeQuantizedSubBlock(const SubBlock& subBlock, int32_t quantized[3], uint32_t bits, Quality quality)
+{
+  const int32_t maximum = (1 << bits) - 1;
+  auto          expand  = [bits](int32_t value) { return bits == 5u ? Expand5(value) : Expand4(value); };
+
+  int32_t          base[3] = {expand(quantized[0]), expand(quantized[1]), expand(quantized[2])};
+  SubBlockEncoding best    = EncodeSubBlock(subBlock, base);
+  if(quality == Quality::FAST)
+  {
+    return best;
+  }
+
+  int32_t bestQuantized[3] = {quantized[0], quantized[1], quantized[2]};
+  for(int32_t dr = -1; dr <= 1; ++dr)
+  {
+    for(int32_t dg = -1; dg <= 1; ++dg)
+    {
+      for(int32_t db = -1; db <= 1; ++db)
+      {
+        const int32_t candidate[3] = {quantized[0] + dr, quantized[1] + dg, quantized[2] + db};
+        if((dr == 0 && dg == 0 && db == 0) ||
+           candidate[0] < 0 || candidate[0] > maximum ||
+           candidate[1] < 0 || candidate[1] > maximum ||
+           candidate[2] < 0 || candidate[2] > maximum)
+        {
+          continue;
+        }
+
+        const int32_t    candidateBase[3] = {expand(candidate[0]), expand(candidate[1]), expand(candidate[2])};
+        SubBlockEncoding encoding         = EncodeSubBlock(subBlock, candidateBase);
+        if(encoding.error < best.error)
+        {
+          best = encoding;
+          std::copy(candidate, candidate + 3, bestQuantized);
+        }
+      }
+    }
+  }
+  std::copy(bestQuantized, bestQuantized + 3, quantized);
+  return best;
+}
+
+/**
+ * An encoded color block, before it is written.
+ */
+struct ColorBlock
+{
+  uint32_t         error;
+  bool             differential;
+  bool             flip;
+  int32_t          colors[2][3]; ///< The quantized base colors, 4 bits in the individual mode, 5 bits in the differential mode
+  SubBlockEncoding subBlocks[2];
+  SubBlock         layout[2];
+};
+
+void EncodeIndividual(ColorBlock& block, const float averages[2][3], Quality quality)
+{
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    for(uint32_t channel = 0u; channel < 3u; ++channel)
+    {
+      block.colors[i][channel] = std::min(15, static_cast<int32_t>(averages[i][channel] * 15.0f / 255.0f + 0.5f));
+    }
+    block.subBlocks[i] = EncodeQuantizedSubBlock(block.layout[i], block.colors[i], 4u, quality);
+  }
+  block.differential = false;
+  block.error        = block.subBlocks[0].error + block.subBlocks[1].error;
+}
+
+/**
+ * Encodes a block in the differential mode.
+ * @return false if the base colors are too far apart for the mode.
+ */
+bool EncodeDifferential(ColorBlock& block, const float averages[2][3], Quality quality)
+{
+  int32_t colors[2][3];
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    for(uint32_t channel = 0u; channel < 3u; ++channel)
+    {
+      colors[i][channel] = std::min(31, static_cast<int32_t>(averages[i][channel] * 31.0f / 255.0f + 0.5f));
+    }
+  }
+
+  auto isInRange = [](const int32_t first[3], const int32_t second[3]) {
+    for(uint32_t channel = 0u; channel < 3u; ++channel)
+    {
+      const int32_t difference = second[channel] - first[channel];
+      if(difference < -4 || difference > 3)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // The second color is stored as a difference from the first one. It must be in [-4, 3], otherwise the block is
+  // decoded in one of the other modes of ETC2.
+  if(!isInRange(colors[0], colors[1]))
+  {
+    return false;
+  }
+
+  SubBlockEncoding subBlocks[2];
+  int32_t          refined[2][3];
+  std::copy(&colors[0][0], &colors[0][0] + 6, &refined[0][0]);
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    subBlocks[i] = EncodeQuantizedSubBlock(block.layout[i], refined[i], 5u, quality);
+  }
+
+  if(!isInRange(refined[0], refined[1]))
+  {
+    // The refined colors are too far apart. Use the averages.
+    for(uint32_t i = 0u; i < 2u; ++i)
+    {
+      subBlocks[i] = EncodeQuantizedSubBlock(block.layout[i], colors[i], 5u, Quality::FAST);
+    }
+    std::copy(&colors[0][0], &colors[0][0] + 6, &refined[0][0]);
+  }
+
+  block.differential = true;
+  block.error        = subBlocks[0].error + subBlocks[1].error;
+  block.subBlocks[0] = subBlocks[0];
+  block.subBlocks[1] = subBlocks[1];
+  std::copy(&refined[0][0], &refined[0][0] + 6, &block.colors[0][0]);
+  return true;
+}
+
+void WriteBigEndian(uint64_t bits, uint8_t* output)
+{
+  for(uint32_t i = 0u; i < 8u; ++i)
+  {
+    output[i] = static_cast<uint8_t>(bits >> (56u - i * 8u));
+  }
+}
+
+void WriteColorBlock(const ColorBlock& block, uint8_t* output)
+{
+  uint64_t bits = 0u;
+  if(block.differential)
+  {
+    for(uint32_t channel = 0u; channel < 3u; ++channel)
+    {
+      const uint32_t shift      = 59u - channel * 8u;
+      const int32_t  difference = block.colors[1][channel] - block.colors[0][channel];
+      bits |= static_cast<uint64_t>(block.colors[0][channel]) << shift;
+      bits |= static_cast<uint64_t>(difference & 0x7) << (shift - 3u);
+    }
+    bits |= uint64_t(1u) << 33u;
+  }
+  else
+  {
+    for(uint32_t channel = 0u; channel < 3u; ++channel)
+    {
+      const uint32_t shift = 60u - channel * 8u;
+      bits |= static_cast<uint64_t>(block.colors[0][channel]) << shift;
+      bits |= static_cast<uint64_t>(block.colors[1][channel]) << (shift - 4u);
+    }
+  }
+  bits |= static_cast<uint64_t>(block.subBlocks[0].table) << 37u;
+  bits |= static_cast<uint64_t>(block.subBlocks[1].table) << 34u;
+  bits |= static_cast<uint64_t>(block.flip ? 1u : 0u) << 32u;
+
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    for(uint32_t pixel = 0u; pixel < 8u; ++pixel)
+    {
+      const uint32_t position = block.layout[i].positions[pixel];
+      const uint32_t selector = block.subBlocks[i].selectors[pixel];
+      bits |= static_cast<uint64_t>(selector >> 1u) << (16u + position);
+      bits |= static_cast<uint64_t>(selector & 1u) << position;
+    }
+  }
+
+  WriteBigEndian(bits, output);
+}
+
+/**
+ * Finds the encoding error of the alpha of a block for a table, a multiplier and a base value.
+ */
+uint32_t EncodeAlpha(const uint8_t alphas[PIXEL_COUNT], uint32_t table, int32_t multiplier, int32_t base, uint8_t indices[PIXEL_COUNT], uint32_t limit)
+{
+  int32_t values[8];
+  for(uint32_t index = 0u; index < 8u; ++index)
+  {
+    values[index] = Clamp(base + ALPHA_MODIFIERS[table][index] * multiplier);
+  }
+
+  uint32_t error = 0u;
+  for(uint32_t pixel = 0u; pixel < PIXEL_COUNT && error < limit; ++pixel)
+  {
+    uint32_t bestError = std::numeric_limits<uint32_t>::max();
+    for(uint32_t index = 0u; index < 8u; ++index)
+    {
+      const int32_t  difference = values[index] - alphas[pixel];
+      const uint32_t pixelError = static_cast<uint32_t>(difference * difference);
+      if(pixelError < bestError)
+      {
+        bestError      = pixelError;
+        indices[pixel] = static_cast<uint8_t>(index);
+      }
+    }
+    error += bestError;
+  }
+  return error;
+}
+
+} // namespace
+
+void EncodeColorBlock(const uint8_t* pixels, Quality quality, uint8_t* output)
+{
+  ColorBlock best{};
+  best.error = std::numeric_limits<uint32_t>::max();
+
+  for(uint32_t flip = 0u; flip < 2u; ++flip)
+  {
+    // Not flipped: the left and the right 2x4 halves. Flipped: the top and the bottom 4x2 halves.
+    ColorBlock block;
+    block.flip         = (flip == 1u);
+    float averages[2][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    uint32_t counts[2]   = {0u, 0u};
+    for(uint32_t y = 0u; y < BLOCK_SIZE; ++y)
+    {
+      for(uint32_t x = 0u; x < BLOCK_SIZE; ++x)
+      {
+        const uint32_t half  = block.flip ? (y >> 1u) : (x >> 1u);
+        const uint32_t index = counts[half]++;
+        const uint8_t* pixel = pixels + (y * BLOCK_SIZE + x) * 4u;
+
+        block.layout[half].positions[index] = static_cast<uint8_t>(x * BLOCK_SIZE + y);
+        for(uint32_t channel = 0u; channel < 3u; ++channel)
+        {
+          block.layout[half].pixels[index][channel] = pixel[channel];
+          averages[half][channel] += pixel[channel];
+        }
+      }
+    }
+    for(uint32_t half = 0u; half < 2u; ++half)
+    {
+      for(uint32_t channel = 0u; channel < 3u; ++channel)
+      {
+        averages[half][channel] /= 8.0f;
+      }
+    }
+
+    // The differential mode has more precise colors, so the individual mode is only tried when it can't be used,
+    // unless the quality is high.
+    ColorBlock differential = block;
+    const bool hasDifferential = EncodeDifferential(differential, averages, quality);
+    if(hasDifferential && differential.error < best.error)
+    {
+      best = differential;
+    }
+    if(!hasDifferential || quality == Quality::HIGH)
+    {
+      EncodeIndividual(block, averages, quality);
+      if(block.error < best.error)
+      {
+        best = block;
+      }
+    }
+  }
+
+  WriteColorBlock(best, output);
+}
+
+void EncodeAlphaBlock(const uint8_t* pixels, Quality quality, uint8_t* output)
+{
+  // The alphas in columns, as the indices are stored.
+  uint8_t alphas[PIXEL_COUNT];
+  int32_t minimum = 255;
+  int32_t maximum = 0;
+  for(uint32_t x = 0u; x < BLOCK_SIZE; ++x)
+  {
+    for(uint32_t y = 0u; y < BLOCK_SIZE; ++y)
+    {
+      const uint8_t alpha            = pixels[(y * BLOCK_SIZE + x) * 4u + 3u];
+      alphas[x * BLOCK_SIZE + y]     = alpha;
+      minimum                        = std::min(minimum, static_cast<int32_t>(alpha));
+      maximum                        = std::max(maximum, static_cast<int32_t>(alpha));
+    }
+  }
+
+  uint32_t bestTable      = OPAQUE_ALPHA_TABLE;
+  int32_t  bestMultiplier = 1;
+  int32_t  bestBase       = minimum;
+  uint8_t  bestIndices[PIXEL_COUNT];
+  std::fill(bestIndices, bestIndices + PIXEL_COUNT, static_cast<uint8_t>(OPAQUE_ALPHA_INDEX));
+
+  if(minimum != maximum)
+  {
+    uint32_t bestError = std::numeric_limits<uint32_t>::max();
+    uint8_t  indices[PIXEL_COUNT];
+    for(uint32_t table = 0u; table < 16u && bestError > 0u; ++table)
+    {
+      // Spread the modifiers of the table over the range of the alphas.
+      const int32_t lowest   = ALPHA_MODIFIERS[table][3];
+      const int32_t highest  = ALPHA_MODIFIERS[table][7];
+      const int32_t estimate = std::max(1, std::min(15, ((maximum - minimum) + (highest - lowest) / 2) / (highest - lowest)));
+
+      const int32_t multiplierRange = (quality == Quality::HIGH) ? 2 : 0;
+      const int32_t baseRange       = (quality == Quality::HIGH) ? 1 : 0;
+      for(int32_t multiplier = std::max(1, estimate - multiplierRange); multiplier <= std::min(15, estimate + multiplierRange + 1); ++multiplier)
+      {
+        const int32_t center = Clamp(static_cast<int32_t>((minimum + maximum) / 2.0f - (lowest + highest) * multiplier / 2.0f + 0.5f));
+        for(int32_t base = std::max(0, center - baseRange); base <= std::min(255, center + baseRange); ++base)
+        {
+          const uint32_t error = EncodeAlpha(alphas, table, multiplier, base, indices, bestError);
+          if(error < bestError)
+          {
+            bestError      = error;
+            bestTable      = table;
+            bestMultiplier = multiplier;
+            bestBase       = base;
+            std::copy(indices, indices + PIXEL_COUNT, bestIndices);
+          }
+        }
+      }
+    }
+  }
+
+  uint64_t bits = static_cast<uint64_t>(bestBase) << 56u;
+  bits |= static_cast<uint64_t>(bestMultiplier) << 52u;
+  bits |= static_cast<uint64_t>(bestTable) << 48u;
+  for(uint32_t pixel = 0u; pixel < PIXEL_COUNT; ++pixel)
+  {
+    bits |= static_cast<uint64_t>(bestIndices[pixel]) << (45u - pixel * 3u);
+  }
+  WriteBigEndian(bits, output);
+}
+
+uint32_t GetEncodedSize(uint32_t width, uint32_t height, bool hasAlpha)
+{
+  const uint32_t blockCount = ((width + BLOCK_SIZE - 1u) / BLOCK_SIZE) * ((height + BLOCK_SIZE - 1u) / BLOCK_SIZE);
+  return blockCount * (hasAlpha ? COLOR_BLOCK_SIZE + ALPHA_BLOCK_SIZE : COLOR_BLOCK_SIZE);
+}
+
+void EncodeImage(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t bytesPerPixel, bool hasAlpha, Quality quality, uint8_t* output)
+{
+  const uint32_t stride = width * bytesPerPixel;
+  uint8_t        block[PIXEL_COUNT * 4u];
+
+  for(uint32_t blockY = 0u; blockY < height; blockY += BLOCK_SIZE)
+  {
+    for(uint32_t blockX = 0u; blockX < width; blockX += BLOCK_SIZE)
+    {
+      // Gather the block in RGBA, repeating the last row and column of the image.
+      for(uint32_t y = 0u; y < BLOCK_SIZE; ++y)
+      {
+        const uint8_t* row = pixels + std::min(blockY + y, height - 1u) * stride;
+        for(uint32_t x = 0u; x < BLOCK_SIZE; ++x)
+        {
+          const uint8_t* pixel       = row + std::min(blockX + x, width - 1u) * bytesPerPixel;
+          uint8_t*       blockPixel  = block + (y * BLOCK_SIZE + x) * 4u;
+          blockPixel[0]              = pixel[0];
+          blockPixel[1]              = pixel[1];
+          blockPixel[2]              = pixel[2];
+          blockPixel[3]              = (bytesPerPixel == 4u) ? pixel[3] : 255u;
+        }
+      }
+
+      if(hasAlpha)
+      {
+        EncodeAlphaBlock(block, quality, output);
+        output += ALPHA_BLOCK_SIZE;
+      }
+      EncodeColorBlock(block, quality, output);
+      output += COLOR_BLOCK_SIZE;
+    }
+  }
+}
+
+} // namespace Etc2Encoder
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
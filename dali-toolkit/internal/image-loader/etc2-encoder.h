@@ -0,0 +1,95 @@
+#ifndef DALI_TOOLKIT_INTERNAL_ETC2_ENCODER_H
+#define DALI_TOOLKIT_INTERNAL_ETC2_ENCODER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief A CPU encoder of the ETC2 compressed texture formats, which every OpenGL ES 3.0 device can sample.
+ *
+ * The color of each 4x4 block is encoded in the ETC1 compatible individual and differential modes of ETC2,
+ * 8 bytes per block. The alpha of each block is encoded in an EAC block of another 8 bytes.
+ */
+namespace Etc2Encoder
+{
+enum class Quality
+{
+  FAST, ///< Uses the average color of each half block.
+  HIGH  ///< Refines the colors and tries more alpha ranges. About 20 times slower.
+};
+
+constexpr uint32_t BLOCK_SIZE       = 4u; ///< The width and height of a block in pixels.
+constexpr uint32_t COLOR_BLOCK_SIZE = 8u; ///< The size of an encoded color block in bytes.
+constexpr uint32_t ALPHA_BLOCK_SIZE = 8u; ///< The size of an encoded alpha block in bytes.
+
+/**
+ * @brief Encodes the color of a block.
+ * @param[in] pixels The 16 RGBA pixels of the block, in rows.
+ * @param[in] quality The quality of the encoding.
+ * @param[out] output The COLOR_BLOCK_SIZE bytes of the encoded block.
+ */
+void EncodeColorBlock(const uint8_t* pixels, Quality quality, uint8_t* output);
+
+/**
+ * @brief Encodes the alpha of a block.
+ * @param[in] pixels The 16 RGBA pixels of the block, in rows.
+ * @param[in] quality The quality of the encoding.
+ * @param[out] output The ALPHA_BLOCK_SIZE bytes of the encoded block.
+ */
+void EncodeAlphaBlock(const uint8_t* pixels, Quality quality, uint8_t* output);
+
+/**
+ * @brief Retrieves the size of an encoded image.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[in] hasAlpha Whether the alpha is encoded.
+ * @return The size in bytes.
+ */
+uint32_t GetEncodedSize(uint32_t width, uint32_t height, bool hasAlpha);
+
+/**
+ * @brief Encodes an image in COMPRESSED_RGB8_ETC2, or COMPRESSED_RGBA8_ETC2_EAC if the alpha is encoded.
+ * The pixels of the incomplete blocks on the right and bottom edges are repeated.
+ *
+ * @param[in] pixels The pixels of the image, in rows.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[in] bytesPerPixel 3 for RGB, 4 for RGBA.
+ * @param[in] hasAlpha Whether the alpha is encoded. The pixels must be RGBA.
+ * @param[in] quality The quality of the encoding.
+ * @param[out] output The GetEncodedSize() bytes of the encoded image.
+ */
+void EncodeImage(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t bytesPerPixel, bool hasAlpha, Quality quality, uint8_t* output);
+
+} // namespace Etc2Encoder
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_ETC2_ENCODER_H
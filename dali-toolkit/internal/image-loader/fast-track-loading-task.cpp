@@ -26,6 +26,9 @@
 #include <dali/integration-api/trace.h>
 #include <dali/public-api/common/vector-wrapper.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/image-disk-cache.h>
+
 #ifdef TRACE_ENABLED
 #include <chrono>
 #include <iomanip>
@@ -182,7 +185,13 @@ void FastTrackLoadingTask::Load()
     }
     else
     {
-      pixelBuffer = Dali::LoadImageFromFile(mUrl.GetUrl(), mDimensions, mFittingMode, mSamplingMode, mOrientationCorrection);
+      ImageDiskCache& diskCache = ImageDiskCache::Get();
+      pixelBuffer               = diskCache.Load(mUrl, mDimensions, mFittingMode, mSamplingMode, mOrientationCorrection);
+      if(!pixelBuffer)
+      {
+        pixelBuffer = Dali::LoadImageFromFile(mUrl.GetUrl(), mDimensions, mFittingMode, mSamplingMode, mOrientationCorrection);
+        diskCache.Save(mUrl, mDimensions, mFittingMode, mSamplingMode, mOrientationCorrection, pixelBuffer);
+      }
     }
   }
   else if(mUrl.IsValid())
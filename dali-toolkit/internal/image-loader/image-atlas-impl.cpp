@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/signals/callback.h>
 #include <string.h>
+#include <algorithm>
 
 // INTERNAL HEADERS
 #include <dali-toolkit/internal/image-loader/async-image-loader-impl.h>
@@ -74,15 +75,18 @@ Texture ImageAtlas::PackToAtlas(const std::vector<PixelData>& pixelData, Dali::V
   return atlasTexture;
 }
 
-ImageAtlas::ImageAtlas(SizeType width, SizeType height, Pixel::Format pixelFormat)
+ImageAtlas::ImageAtlas(SizeType width, SizeType height, Pixel::Format pixelFormat, AtlasPacker::Algorithm algorithm)
 : mAtlas(Texture::New(Dali::TextureType::TEXTURE_2D, pixelFormat, width, height)),
-  mPacker(width, height),
+  mPacker(new AtlasPacker(width, height, algorithm)),
   mAsyncLoader(Toolkit::AsyncImageLoader::New()),
   mBrokenImageUrl(""),
   mBrokenImageSize(),
   mWidth(static_cast<float>(width)),
   mHeight(static_cast<float>(height)),
-  mPixelFormat(pixelFormat)
+  mPixelFormat(pixelFormat),
+  mMovingImageCount(0u),
+  mDefragmentationCount(0u),
+  mDefragmentationEnabled(false)
 {
   mAsyncLoader.ImageLoadedSignal().Connect(this, &ImageAtlas::UploadToAtlas);
 }
@@ -108,11 +112,30 @@ ImageAtlas::~ImageAtlas()
   }
 
   mLoadingTaskInfoContainer.Clear();
+
+  // The observers of the kept images and the deferred observers are registered too.
+  for(auto&& entry : mEntries)
+  {
+    if(entry.observer)
+    {
+      entry.observer->Unregister(*this);
+    }
+  }
+  mEntries.clear();
+
+  for(auto&& observer : mDeferredObservers)
+  {
+    if(observer)
+    {
+      observer->Unregister(*this);
+    }
+  }
+  mDeferredObservers.Clear();
 }
 
-IntrusivePtr<ImageAtlas> ImageAtlas::New(SizeType width, SizeType height, Pixel::Format pixelFormat)
+IntrusivePtr<ImageAtlas> ImageAtlas::New(SizeType width, SizeType height, Pixel::Format pixelFormat, AtlasPacker::Algorithm algorithm)
 {
-  IntrusivePtr<ImageAtlas> internal = new ImageAtlas(width, height, pixelFormat);
+  IntrusivePtr<ImageAtlas> internal = new ImageAtlas(width, height, pixelFormat, algorithm);
 
   return internal;
 }
@@ -124,7 +147,7 @@ Texture ImageAtlas::GetAtlas()
 
 float ImageAtlas::GetOccupancyRate() const
 {
-  return 1.f - static_cast<float>(mPacker.GetAvailableArea()) / (mWidth * mHeight);
+  return 1.f - static_cast<float>(mPacker->GetAvailableArea()) / (mWidth * mHeight);
 }
 
 void ImageAtlas::SetBrokenImage(const std::string& brokenImageUrl)
@@ -164,10 +187,17 @@ bool ImageAtlas::Upload(Vector4&             textureRect,
 
   uint32_t packPositionX = 0;
   uint32_t packPositionY = 0;
-  if(mPacker.Pack(dimensions.GetWidth(), dimensions.GetHeight(), packPositionX, packPositionY))
+  if(mPacker->Pack(dimensions.GetWidth(), dimensions.GetHeight(), packPositionX, packPositionY))
   {
+    if(IsTextureRectInUse(Rect<uint32_t>(packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight())))
+    {
+      mPacker->DeleteBlock(packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight());
+      return false;
+    }
+
     uint32_t loadId = GetImplementation(mAsyncLoader).Load(url, size, fittingMode, SamplingMode::BOX_THEN_LINEAR, orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, false);
     mLoadingTaskInfoContainer.PushBack(new LoadingTaskInfo(loadId, packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight(), atlasUploadObserver));
+    AddEntry(Rect<uint32_t>(packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight()), url, EncodedImageBuffer(), size, fittingMode, orientationCorrection, atlasUploadObserver);
     // apply the half pixel correction
     textureRect.x = (static_cast<float>(packPositionX) + 0.5f) / mWidth;                      // left
     textureRect.y = (static_cast<float>(packPositionY) + 0.5f) / mHeight;                     // top
@@ -213,10 +243,17 @@ bool ImageAtlas::Upload(Vector4&                  textureRect,
 
   uint32_t packPositionX = 0;
   uint32_t packPositionY = 0;
-  if(mPacker.Pack(size.GetWidth(), size.GetHeight(), packPositionX, packPositionY))
+  if(mPacker->Pack(size.GetWidth(), size.GetHeight(), packPositionX, packPositionY))
   {
+    if(IsTextureRectInUse(Rect<uint32_t>(packPositionX, packPositionY, size.GetWidth(), size.GetHeight())))
+    {
+      mPacker->DeleteBlock(packPositionX, packPositionY, size.GetWidth(), size.GetHeight());
+      return false;
+    }
+
     uint32_t loadId = GetImplementation(mAsyncLoader).LoadEncodedImageBuffer(encodedImageBuffer, size, fittingMode, SamplingMode::BOX_THEN_LINEAR, orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF);
     mLoadingTaskInfoContainer.PushBack(new LoadingTaskInfo(loadId, packPositionX, packPositionY, size.GetWidth(), size.GetHeight(), atlasUploadObserver));
+    AddEntry(Rect<uint32_t>(packPositionX, packPositionY, size.GetWidth(), size.GetHeight()), VisualUrl(), encodedImageBuffer, size, fittingMode, orientationCorrection, atlasUploadObserver);
 
     // apply the half pixel correction
     textureRect.x = (static_cast<float>(packPositionX) + 0.5f) / mWidth;                // left
@@ -239,11 +276,18 @@ bool ImageAtlas::Upload(Vector4&                  textureRect,
 
 bool ImageAtlas::Upload(Vector4& textureRect, PixelData pixelData)
 {
+  if(IsDefragmenting())
+  {
+    // The pixel data would be shown before the new atlas texture is used.
+    return false;
+  }
+
   uint32_t packPositionX = 0;
   uint32_t packPositionY = 0;
-  if(mPacker.Pack(pixelData.GetWidth(), pixelData.GetHeight(), packPositionX, packPositionY))
+  if(mPacker->Pack(pixelData.GetWidth(), pixelData.GetHeight(), packPositionX, packPositionY))
   {
     mAtlas.Upload(pixelData, 0u, 0u, packPositionX, packPositionY, pixelData.GetWidth(), pixelData.GetHeight());
+    AddEntry(Rect<uint32_t>(packPositionX, packPositionY, pixelData.GetWidth(), pixelData.GetHeight()), VisualUrl(), EncodedImageBuffer(), ImageDimensions(), FittingMode::DEFAULT, false, nullptr);
 
     // apply the half pixel correction
     textureRect.x = (static_cast<float>(packPositionX) + 0.5f) / mWidth;                          // left
@@ -259,7 +303,30 @@ bool ImageAtlas::Upload(Vector4& textureRect, PixelData pixelData)
 
 void ImageAtlas::Remove(const Vector4& textureRect)
 {
-  mPacker.DeleteBlock(static_cast<SizeType>(textureRect.x * mWidth),
+  if(mDefragmentationEnabled)
+  {
+    // While the atlas is being defragmented, the texture rect may be the one before the image was moved.
+    for(auto iter = mEntries.begin(), endIter = mEntries.end(); iter != endIter; ++iter)
+    {
+      if(iter->textureRect == textureRect)
+      {
+        mPacker->DeleteBlock(iter->packRect.x, iter->packRect.y, iter->packRect.width, iter->packRect.height);
+        if(iter->observer)
+        {
+          iter->observer->Unregister(*this);
+        }
+        mEntries.erase(iter);
+        return;
+      }
+    }
+
+    if(IsDefragmenting())
+    {
+      return;
+    }
+  }
+
+  mPacker->DeleteBlock(static_cast<SizeType>(textureRect.x * mWidth),
                       static_cast<SizeType>(textureRect.y * mHeight),
                       static_cast<SizeType>((textureRect.z - textureRect.x) * mWidth + 1.f),
                       static_cast<SizeType>((textureRect.w - textureRect.y) * mHeight + 1.f));
@@ -276,6 +343,114 @@ void ImageAtlas::ObserverDestroyed(AtlasUploadObserver* observer)
       mLoadingTaskInfoContainer[i]->observer = NULL;
     }
   }
+
+  for(auto&& entry : mEntries)
+  {
+    if(entry.observer == observer)
+    {
+      // The image can still be moved, as nobody else knows its texture rect.
+      entry.observer = NULL;
+    }
+  }
+
+  for(auto&& deferredObserver : mDeferredObservers)
+  {
+    if(deferredObserver == observer)
+    {
+      deferredObserver = NULL;
+    }
+  }
+}
+
+TextureSet ImageAtlas::GetTextureSet()
+{
+  if(!mTextureSet)
+  {
+    mTextureSet = TextureSet::New();
+    mTextureSet.SetTexture(0u, mAtlas);
+  }
+  return mTextureSet;
+}
+
+void ImageAtlas::SetDefragmentationEnabled(bool enabled)
+{
+  mDefragmentationEnabled = enabled;
+}
+
+bool ImageAtlas::Defragment(ImageDimensions size)
+{
+  if(!mDefragmentationEnabled || IsDefragmenting() || mEntries.empty() || mLoadingTaskInfoContainer.Count() > 0u)
+  {
+    return false;
+  }
+
+  for(auto&& entry : mEntries)
+  {
+    if(!entry.isMovable)
+    {
+      return false;
+    }
+  }
+
+  // Pack the bigger images first, as AtlasPacker::GroupPack() does.
+  std::vector<std::size_t> packOrder(mEntries.size());
+  for(std::size_t index = 0u; index < packOrder.size(); ++index)
+  {
+    packOrder[index] = index;
+  }
+  std::stable_sort(packOrder.begin(), packOrder.end(), [this](std::size_t lhs, std::size_t rhs) {
+    return std::max(mEntries[lhs].packRect.width, mEntries[lhs].packRect.height) > std::max(mEntries[rhs].packRect.width, mEntries[rhs].packRect.height);
+  });
+
+  std::unique_ptr<AtlasPacker> packer(new AtlasPacker(static_cast<SizeType>(mWidth), static_cast<SizeType>(mHeight), mPacker->GetAlgorithm()));
+  std::vector<Rect<uint32_t>>  packRects(mEntries.size());
+  uint32_t                     packPositionX = 0;
+  uint32_t                     packPositionY = 0;
+  for(auto&& index : packOrder)
+  {
+    const Rect<uint32_t>& packRect = mEntries[index].packRect;
+    if(!packer->Pack(packRect.width, packRect.height, packPositionX, packPositionY))
+    {
+      return false;
+    }
+    packRects[index] = Rect<uint32_t>(packPositionX, packPositionY, packRect.width, packRect.height);
+  }
+
+  if(size.GetWidth() > 0u && size.GetHeight() > 0u)
+  {
+    if(!packer->Pack(size.GetWidth(), size.GetHeight(), packPositionX, packPositionY))
+    {
+      return false;
+    }
+    packer->DeleteBlock(packPositionX, packPositionY, size.GetWidth(), size.GetHeight());
+  }
+
+  DALI_LOG_RELEASE_INFO("ImageAtlas::Defragment: %zu images are moved, occupancy rate %f\n", mEntries.size(), GetOccupancyRate());
+
+  mPacker            = std::move(packer);
+  mDefragmentedAtlas = Texture::New(Dali::TextureType::TEXTURE_2D, mPixelFormat, static_cast<SizeType>(mWidth), static_cast<SizeType>(mHeight));
+
+  // Load the images again into the new atlas texture. The observers still know the texture rects in the current one.
+  for(std::size_t index = 0u; index < mEntries.size(); ++index)
+  {
+    AtlasEntry&           entry    = mEntries[index];
+    const Rect<uint32_t>& packRect = packRects[index];
+
+    uint32_t loadId;
+    if(entry.encodedImageBuffer)
+    {
+      loadId = GetImplementation(mAsyncLoader).LoadEncodedImageBuffer(entry.encodedImageBuffer, entry.size, entry.fittingMode, SamplingMode::BOX_THEN_LINEAR, entry.orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF);
+    }
+    else
+    {
+      loadId = GetImplementation(mAsyncLoader).Load(entry.url, entry.size, entry.fittingMode, SamplingMode::BOX_THEN_LINEAR, entry.orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, false);
+    }
+    mLoadingTaskInfoContainer.PushBack(new LoadingTaskInfo(loadId, packRect.x, packRect.y, packRect.width, packRect.height, NULL, true));
+    entry.packRect = packRect;
+    ++mMovingImageCount;
+  }
+
+  return true;
 }
 
 void ImageAtlas::UploadToAtlas(uint32_t id, PixelData pixelData)
@@ -286,6 +461,7 @@ void ImageAtlas::UploadToAtlas(uint32_t id, PixelData pixelData)
     if((*loadingTaskIterator) && (*loadingTaskIterator)->loadTaskId == id)
     {
       Rect<uint32_t> packRect((*loadingTaskIterator)->packRect);
+      Texture        atlas = GetUploadTexture();
       if(!pixelData || (pixelData.GetWidth() == 0 && pixelData.GetHeight() == 0))
       {
         if(!mBrokenImageUrl.empty()) // replace with the broken image
@@ -304,16 +480,30 @@ void ImageAtlas::UploadToAtlas(uint32_t id, PixelData pixelData)
                         packRect.height);
         }
 
-        mAtlas.Upload(pixelData, 0u, 0u, packRect.x, packRect.y, packRect.width, packRect.height);
+        atlas.Upload(pixelData, 0u, 0u, packRect.x, packRect.y, packRect.width, packRect.height);
       }
 
       if((*loadingTaskIterator)->observer)
       {
-        (*loadingTaskIterator)->observer->UploadCompleted();
-        (*loadingTaskIterator)->observer->Unregister(*this);
+        if(IsDefragmenting())
+        {
+          // The image is shown once the new atlas texture is used.
+          mDeferredObservers.PushBack((*loadingTaskIterator)->observer);
+        }
+        else
+        {
+          (*loadingTaskIterator)->observer->UploadCompleted();
+          (*loadingTaskIterator)->observer->Unregister(*this);
+        }
       }
 
+      const bool isMoving = (*loadingTaskIterator)->isMoving;
       mLoadingTaskInfoContainer.Erase(loadingTaskIterator);
+
+      if(isMoving && --mMovingImageCount == 0u)
+      {
+        CompleteDefragmentation();
+      }
       break;
     }
   }
@@ -350,11 +540,102 @@ void ImageAtlas::UploadBrokenImage(const Rect<uint32_t>& area)
       buffer[idx] = 0x00;
     }
     PixelData pixelData = Devel::PixelBuffer::Convert(background);
-    mAtlas.Upload(pixelData, 0u, 0u, area.x, area.y, area.width, area.height);
+    GetUploadTexture().Upload(pixelData, 0u, 0u, area.x, area.y, area.width, area.height);
   }
 
   PixelData brokenPixelData = Devel::PixelBuffer::Convert(brokenBuffer);
-  mAtlas.Upload(brokenPixelData, 0u, 0u, packX, packY, loadedWidth, loadedHeight);
+  GetUploadTexture().Upload(brokenPixelData, 0u, 0u, packX, packY, loadedWidth, loadedHeight);
+}
+
+Texture ImageAtlas::GetUploadTexture() const
+{
+  return IsDefragmenting() ? mDefragmentedAtlas : mAtlas;
+}
+
+Vector4 ImageAtlas::GetTextureRect(const Rect<uint32_t>& packRect) const
+{
+  // apply the half pixel correction
+  return Vector4((static_cast<float>(packRect.x) + 0.5f) / mWidth,                    // left
+                 (static_cast<float>(packRect.y) + 0.5f) / mHeight,                   // top
+                 (static_cast<float>(packRect.x + packRect.width) - 0.5f) / mWidth,   // right
+                 (static_cast<float>(packRect.y + packRect.height) - 0.5f) / mHeight); // bottom
+}
+
+bool ImageAtlas::IsTextureRectInUse(const Rect<uint32_t>& packRect) const
+{
+  if(IsDefragmenting())
+  {
+    // An image which is not moved yet may have the same texture rect in the current atlas texture.
+    const Vector4 textureRect = GetTextureRect(packRect);
+    for(auto&& entry : mEntries)
+    {
+      if(entry.textureRect == textureRect)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void ImageAtlas::AddEntry(const Rect<uint32_t>& packRect, const VisualUrl& url, const EncodedImageBuffer& encodedImageBuffer, ImageDimensions size, FittingMode::Type fittingMode, bool orientationCorrection, AtlasUploadObserver* atlasUploadObserver)
+{
+  if(!mDefragmentationEnabled)
+  {
+    return;
+  }
+
+  const bool isMovable = atlasUploadObserver && (url.IsValid() || encodedImageBuffer);
+  mEntries.push_back(AtlasEntry{packRect, GetTextureRect(packRect), url, encodedImageBuffer, size, fittingMode, orientationCorrection, isMovable, atlasUploadObserver});
+
+  if(atlasUploadObserver)
+  {
+    // Keep registered until the image is removed, so the observer can be notified when the image is moved.
+    atlasUploadObserver->Register(*this);
+  }
+}
+
+void ImageAtlas::CompleteDefragmentation()
+{
+  mAtlas = mDefragmentedAtlas;
+  mDefragmentedAtlas.Reset();
+  if(mTextureSet)
+  {
+    mTextureSet.SetTexture(0u, mAtlas);
+  }
+  ++mDefragmentationCount;
+
+  // The observers may remove their images while they are notified.
+  std::vector<std::pair<AtlasUploadObserver*, Vector4>> movedImages;
+  for(auto&& entry : mEntries)
+  {
+    Vector4 textureRect = GetTextureRect(entry.packRect);
+    if(textureRect != entry.textureRect)
+    {
+      entry.textureRect = textureRect;
+      if(entry.observer)
+      {
+        movedImages.push_back(std::make_pair(entry.observer, textureRect));
+      }
+    }
+  }
+
+  Dali::Vector<AtlasUploadObserver*> deferredObservers;
+  deferredObservers.Swap(mDeferredObservers);
+
+  for(auto&& movedImage : movedImages)
+  {
+    movedImage.first->TextureRectChanged(movedImage.second);
+  }
+
+  for(auto&& observer : deferredObservers)
+  {
+    if(observer)
+    {
+      observer->UploadCompleted();
+      observer->Unregister(*this);
+    }
+  }
 }
 
 } // namespace Internal
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_IMAGE_ATLAS_IMPL_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,7 +22,10 @@
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/object/base-object.h>
+#include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/signals/connection-tracker.h>
+#include <memory>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/image-atlas.h>
@@ -53,13 +56,15 @@ public:
    * @param [in] width          The atlas width in pixels.
    * @param [in] height         The atlas height in pixels.
    * @param [in] pixelFormat    The pixel format.
+   * @param [in] algorithm      The algorithm to find the position of an image.
    */
-  ImageAtlas(SizeType width, SizeType height, Pixel::Format pixelFormat);
+  ImageAtlas(SizeType width, SizeType height, Pixel::Format pixelFormat, AtlasPacker::Algorithm algorithm);
 
   /**
    * @copydoc Toolkit::ImageAtlas::New
+   * @param [in] algorithm The algorithm to find the position of an image.
    */
-  static IntrusivePtr<ImageAtlas> New(SizeType width, SizeType height, Pixel::Format pixelFormat);
+  static IntrusivePtr<ImageAtlas> New(SizeType width, SizeType height, Pixel::Format pixelFormat, AtlasPacker::Algorithm algorithm = AtlasPacker::Algorithm::BINARY_TREE);
 
   /**
    * @copydoc Toolkit::ImageAtlas::GetAtlas
@@ -127,6 +132,51 @@ public:
    */
   void ObserverDestroyed(AtlasUploadObserver* observer);
 
+  /**
+   * @brief Retrieves the texture set which has the atlas texture.
+   * The texture of the texture set is replaced when the atlas is defragmented.
+   * @return The texture set.
+   */
+  TextureSet GetTextureSet();
+
+  /**
+   * @brief Sets whether the uploaded images are kept, so the atlas can be defragmented.
+   * @note It should be set before any image is uploaded. Only the images uploaded afterwards can be moved.
+   * @param[in] enabled True to enable the defragmentation.
+   */
+  void SetDefragmentationEnabled(bool enabled);
+
+  /**
+   * @brief Packs the images again into a new atlas texture, so the empty space between them is joined.
+   *
+   * The images are loaded again into the new texture. Once all of them are loaded, the texture of the texture set
+   * is replaced and the observers are notified of the new texture rects by AtlasUploadObserver::TextureRectChanged().
+   * The images uploaded in the meantime are packed into the new texture, and their observers are notified once it is used.
+   *
+   * @param[in] size The size of an image which should fit after the images are packed again.
+   * @return True if the atlas is being defragmented. False if an image can't be loaded again, e.g. it was uploaded
+   *         from pixel data or without an observer, or if the images and the given size don't fit together.
+   */
+  bool Defragment(ImageDimensions size);
+
+  /**
+   * @brief Whether the images are being loaded again into a new atlas texture.
+   * @return True if the atlas is being defragmented.
+   */
+  bool IsDefragmenting() const
+  {
+    return !!mDefragmentedAtlas;
+  }
+
+  /**
+   * @brief Retrieves how many times the atlas has been defragmented.
+   * @return The number of the defragmentations completed.
+   */
+  uint32_t GetDefragmentationCount() const
+  {
+    return mDefragmentationCount;
+  }
+
 protected:
   /**
    * Destructor
@@ -146,6 +196,48 @@ private:
    */
   void UploadBrokenImage(const Rect<uint32_t>& area);
 
+  /**
+   * Retrieves the texture the loaded images are uploaded to, i.e. the new atlas texture while the atlas is being defragmented.
+   *
+   * @return The texture.
+   */
+  Texture GetUploadTexture() const;
+
+  /**
+   * Calculates the texture rect of a packed area, with the half pixel correction.
+   *
+   * @param[in] packRect The area in the atlas.
+   * @return The texture rect.
+   */
+  Vector4 GetTextureRect(const Rect<uint32_t>& packRect) const;
+
+  /**
+   * Checks whether an image which is not moved yet has the same texture rect, while the atlas is being defragmented.
+   * The images are removed by their texture rects, so the new image can't be packed there.
+   *
+   * @param[in] packRect The area in the new atlas texture.
+   * @return True if the texture rect is in use.
+   */
+  bool IsTextureRectInUse(const Rect<uint32_t>& packRect) const;
+
+  /**
+   * Keeps an uploaded image, so it can be loaded again when the atlas is defragmented.
+   *
+   * @param[in] packRect The area of the image in the atlas.
+   * @param[in] url The url of the image. Invalid if it is not uploaded from a url.
+   * @param[in] encodedImageBuffer The encoded buffer of the image. Empty if it is not uploaded from a buffer.
+   * @param[in] size The size the image is loaded with.
+   * @param[in] fittingMode The fitting mode the image is loaded with.
+   * @param[in] orientationCorrection Whether the image is rotated by its metadata.
+   * @param[in] atlasUploadObserver The observer to notify when the image is moved. The image can't be moved without it.
+   */
+  void AddEntry(const Rect<uint32_t>& packRect, const VisualUrl& url, const EncodedImageBuffer& encodedImageBuffer, ImageDimensions size, FittingMode::Type fittingMode, bool orientationCorrection, AtlasUploadObserver* atlasUploadObserver);
+
+  /**
+   * Replaces the atlas texture with the new one once all the images are loaded again, and notifies the observers.
+   */
+  void CompleteDefragmentation();
+
   // Undefined
   ImageAtlas(const ImageAtlas& imageAtlas);
 
@@ -164,28 +256,54 @@ private:
                     uint32_t             packPositionY,
                     uint32_t             width,
                     uint32_t             height,
-                    AtlasUploadObserver* observer)
+                    AtlasUploadObserver* observer,
+                    bool                 isMoving = false)
     : loadTaskId(loadTaskId),
       packRect(packPositionX, packPositionY, width, height),
-      observer(observer)
+      observer(observer),
+      isMoving(isMoving)
     {
     }
 
     uint32_t             loadTaskId;
     Rect<uint32_t>       packRect;
     AtlasUploadObserver* observer;
+    bool                 isMoving; ///< Whether the image is loaded again to be moved to the new atlas texture
   };
 
-  OwnerContainer<LoadingTaskInfo*> mLoadingTaskInfoContainer;
+  /**
+   * An image uploaded to the atlas, which is kept to load it again when the atlas is defragmented.
+   */
+  struct AtlasEntry
+  {
+    Rect<uint32_t>       packRect;              ///< The area of the image in the atlas
+    Vector4              textureRect;           ///< The texture rect the observer knows
+    VisualUrl            url;                   ///< The url of the image, if it is uploaded from a url
+    EncodedImageBuffer   encodedImageBuffer;    ///< The encoded buffer of the image, if it is uploaded from a buffer
+    ImageDimensions      size;                  ///< The size the image is loaded with
+    FittingMode::Type    fittingMode;           ///< The fitting mode the image is loaded with
+    bool                 orientationCorrection; ///< Whether the image is rotated by its metadata
+    bool                 isMovable;             ///< Whether the image can be loaded again and its observer was given
+    AtlasUploadObserver* observer;              ///< The observer to notify when the image is moved. Null if it is destroyed
+  };
 
-  Texture                   mAtlas;
-  AtlasPacker               mPacker;
-  Toolkit::AsyncImageLoader mAsyncLoader;
-  std::string               mBrokenImageUrl;
-  ImageDimensions           mBrokenImageSize;
-  float                     mWidth;
-  float                     mHeight;
-  Pixel::Format             mPixelFormat;
+  OwnerContainer<LoadingTaskInfo*>   mLoadingTaskInfoContainer;
+  std::vector<AtlasEntry>            mEntries;           ///< The uploaded images, if the defragmentation is enabled
+  Dali::Vector<AtlasUploadObserver*> mDeferredObservers; ///< The observers of the images uploaded to the new atlas texture, notified once it is used
+
+  Texture                      mAtlas;
+  Texture                      mDefragmentedAtlas; ///< The new atlas texture while the atlas is being defragmented
+  TextureSet                   mTextureSet;
+  std::unique_ptr<AtlasPacker> mPacker;
+  Toolkit::AsyncImageLoader    mAsyncLoader;
+  std::string                  mBrokenImageUrl;
+  ImageDimensions              mBrokenImageSize;
+  float                        mWidth;
+  float                        mHeight;
+  Pixel::Format                mPixelFormat;
+  uint32_t                     mMovingImageCount;     ///< The number of the images being loaded again into the new atlas texture
+  uint32_t                     mDefragmentationCount; ///< The number of the defragmentations completed
+  bool                         mDefragmentationEnabled;
 };
 
 } // namespace Internal
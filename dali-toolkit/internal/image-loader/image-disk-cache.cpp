@@ -0,0 +1,603 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/image-loader/image-disk-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+constexpr auto DISK_CACHE_PATH_ENV = "DALI_IMAGE_DISK_CACHE_PATH";
+constexpr auto DISK_CACHE_SIZE_ENV = "DALI_IMAGE_DISK_CACHE_SIZE";
+
+constexpr uint64_t DEFAULT_DISK_CACHE_SIZE = 32u * 1024u * 1024u; ///< 32MB
+constexpr uint64_t MAXIMUM_PENDING_SIZE    = 16u * 1024u * 1024u; ///< The images are dropped instead of queued while this is waiting to be written.
+
+constexpr auto STALE_TEMPORARY_FILE_AGE = std::chrono::minutes(10); ///< A temporary file older than this has been left by a process which was stopped while writing.
+
+constexpr char     FILE_MAGIC[4]       = {'D', 'I', 'M', 'G'};
+constexpr uint32_t FILE_VERSION        = 1u;
+constexpr uint32_t PIXEL_ALIGNMENT     = 16u;
+constexpr auto     FILE_EXTENSION      = ".dimg";
+constexpr auto     TEMPORARY_EXTENSION = ".tmp";
+
+/**
+ * @brief The header of a stored file.
+ */
+struct FileHeader
+{
+  char     magic[4];    ///< FILE_MAGIC
+  uint32_t version;     ///< FILE_VERSION
+  uint32_t width;       ///< The width of the image.
+  uint32_t height;      ///< The height of the image.
+  uint32_t pixelFormat; ///< The Pixel::Format of the image.
+  uint32_t keyLength;   ///< The length of the key following the header.
+  uint32_t dataOffset;  ///< The offset of the pixels from the beginning of the file. Multiple of PIXEL_ALIGNMENT.
+  uint32_t dataSize;    ///< The size of the pixels in bytes.
+};
+
+/**
+ * @brief Generates the key of an image. It is empty if the file doesn't exist.
+ */
+std::string GenerateKey(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection)
+{
+  std::error_code errorCode;
+  const auto      fileSize = std::filesystem::file_size(url.GetUrl(), errorCode);
+  if(errorCode)
+  {
+    return std::string();
+  }
+  const auto lastWriteTime = std::filesystem::last_write_time(url.GetUrl(), errorCode);
+  if(errorCode)
+  {
+    return std::string();
+  }
+
+  std::string key = url.GetUrl();
+  key += '\n';
+  key += std::to_string(lastWriteTime.time_since_epoch().count());
+  key += ' ';
+  key += std::to_string(fileSize);
+  key += ' ';
+  key += std::to_string(dimensions.GetWidth());
+  key += ' ';
+  key += std::to_string(dimensions.GetHeight());
+  key += ' ';
+  key += std::to_string(static_cast<int>(fittingMode));
+  key += ' ';
+  key += std::to_string(static_cast<int>(samplingMode));
+  key += ' ';
+  key += orientationCorrection ? '1' : '0';
+  return key;
+}
+
+/**
+ * @brief Gets the name of the file an image is stored in.
+ */
+std::string GetFileName(const std::string& key)
+{
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(Dali::CalculateHash(key)));
+  return std::string(name) + FILE_EXTENSION;
+}
+
+uint32_t GetDataOffset(uint32_t keyLength)
+{
+  const uint32_t offset = static_cast<uint32_t>(sizeof(FileHeader)) + keyLength;
+  return (offset + PIXEL_ALIGNMENT - 1u) & ~(PIXEL_ALIGNMENT - 1u);
+}
+
+} // namespace
+
+ImageDiskCache& ImageDiskCache::Get()
+{
+  static ImageDiskCache diskCache(
+    []() {
+      auto path = Dali::EnvironmentVariable::GetEnvironmentVariable(DISK_CACHE_PATH_ENV);
+      return path ? std::string(path) : std::string();
+    }(),
+    []() {
+      auto size = Dali::EnvironmentVariable::GetEnvironmentVariable(DISK_CACHE_SIZE_ENV);
+      return size ? static_cast<uint64_t>(std::atoll(size)) * 1024u : DEFAULT_DISK_CACHE_SIZE;
+    }());
+  return diskCache;
+}
+
+ImageDiskCache::ImageDiskCache(const std::string& path, uint64_t maximumSize)
+: mPath(path),
+  mMaximumSize(maximumSize),
+  mSize(0u),
+  mUseCounter(0u),
+  mEntries(),
+  mMutex(),
+  mIndexLoaded(false),
+  mPendingFiles(),
+  mPendingSize(0u),
+  mSaveWait(),
+  mSaveThread(),
+  mSaving(false),
+  mDestroying(false)
+{
+  if(!mPath.empty())
+  {
+    std::error_code errorCode;
+    if(!std::filesystem::is_directory(mPath, errorCode))
+    {
+      DALI_LOG_ERROR("Image disk cache directory doesn't exist: %s\n", mPath.c_str());
+      mPath.clear();
+    }
+  }
+}
+
+ImageDiskCache::~ImageDiskCache()
+{
+  if(mSaveThread)
+  {
+    {
+      ConditionalWait::ScopedLock lock(mSaveWait);
+      mDestroying = true;
+      mPendingFiles.clear();
+      mSaveWait.Notify(lock);
+    }
+    mSaveThread->Join();
+  }
+}
+
+Devel::PixelBuffer ImageDiskCache::Load(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection)
+{
+  if(!IsEnabled() || !url.IsLocalResource())
+  {
+    return Devel::PixelBuffer();
+  }
+
+  const std::string key = GenerateKey(url, dimensions, fittingMode, samplingMode, orientationCorrection);
+  if(key.empty())
+  {
+    return Devel::PixelBuffer();
+  }
+
+  return LoadFile(key, false);
+}
+
+Devel::PixelBuffer ImageDiskCache::LoadEncoded(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, const std::string& format)
+{
+  if(!IsEnabled() || !url.IsLocalResource())
+  {
+    return Devel::PixelBuffer();
+  }
+
+  const std::string key = GenerateKey(url, dimensions, fittingMode, samplingMode, orientationCorrection);
+  if(key.empty())
+  {
+    return Devel::PixelBuffer();
+  }
+
+  return LoadFile(key + '\n' + format, true);
+}
+
+void ImageDiskCache::Save(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, Devel::PixelBuffer pixelBuffer)
+{
+  if(!IsEnabled() || !pixelBuffer || !url.IsLocalResource())
+  {
+    return;
+  }
+
+  const Pixel::Format pixelFormat   = pixelBuffer.GetPixelFormat();
+  const uint32_t      bytesPerPixel = Pixel::GetBytesPerPixel(pixelFormat);
+  if(Pixel::IsCompressed(pixelFormat) || bytesPerPixel == 0u || pixelBuffer.IsAlphaPreMultiplied())
+  {
+    return;
+  }
+
+  const std::string key = GenerateKey(url, dimensions, fittingMode, samplingMode, orientationCorrection);
+  if(key.empty())
+  {
+    return;
+  }
+
+  QueueFile(url, key, pixelFormat, pixelBuffer.GetWidth(), pixelBuffer.GetHeight(), pixelBuffer.GetBuffer(), pixelBuffer.GetWidth() * pixelBuffer.GetHeight() * bytesPerPixel);
+}
+
+void ImageDiskCache::SaveEncoded(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, const std::string& format, Pixel::Format pixelFormat, uint32_t width, uint32_t height, const Dali::Vector<uint8_t>& encodedData)
+{
+  if(!IsEnabled() || encodedData.Empty() || !url.IsLocalResource())
+  {
+    return;
+  }
+
+  const std::string key = GenerateKey(url, dimensions, fittingMode, samplingMode, orientationCorrection);
+  if(key.empty())
+  {
+    return;
+  }
+
+  QueueFile(url, key + '\n' + format, pixelFormat, width, height, encodedData.Begin(), static_cast<uint32_t>(encodedData.Count()));
+}
+
+void ImageDiskCache::Flush()
+{
+  ConditionalWait::ScopedLock lock(mSaveWait);
+  while(!mPendingFiles.empty() || mSaving)
+  {
+    mSaveWait.Wait(lock);
+  }
+}
+
+void ImageDiskCache::Clear()
+{
+  if(!IsEnabled())
+  {
+    return;
+  }
+
+  {
+    ConditionalWait::ScopedLock lock(mSaveWait);
+    mPendingFiles.clear();
+    mPendingSize = 0u;
+  }
+  // Wait for the image being written, so it is removed as well.
+  Flush();
+
+  Mutex::ScopedLock lock(mMutex);
+  LoadIndex();
+
+  std::error_code errorCode;
+  for(const auto& entry : mEntries)
+  {
+    std::filesystem::remove(mPath + '/' + entry.first, errorCode);
+  }
+  mEntries.clear();
+  mSize = 0u;
+}
+
+uint64_t ImageDiskCache::GetSize()
+{
+  if(!IsEnabled())
+  {
+    return 0u;
+  }
+
+  Mutex::ScopedLock lock(mMutex);
+  LoadIndex();
+  return mSize;
+}
+
+Devel::PixelBuffer ImageDiskCache::LoadFile(const std::string& key, bool encoded)
+{
+  const std::string fileName = GetFileName(key);
+  {
+    Mutex::ScopedLock lock(mMutex);
+    LoadIndex();
+
+    auto iter = mEntries.find(fileName);
+    if(iter == mEntries.end())
+    {
+      return Devel::PixelBuffer();
+    }
+    iter->second.lastUsed = ++mUseCounter;
+  }
+
+  const std::string  filePath = mPath + '/' + fileName;
+  Devel::PixelBuffer pixelBuffer;
+  bool               valid = false;
+
+  std::ifstream file(filePath, std::ios::in | std::ios::binary);
+  FileHeader    header;
+  if(file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+     memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0 &&
+     header.version == FILE_VERSION &&
+     header.keyLength == key.size())
+  {
+    std::string storedKey(header.keyLength, '\0');
+    if(file.read(&storedKey[0], header.keyLength) && storedKey == key && header.dataSize > 0u)
+    {
+      const Pixel::Format pixelFormat = static_cast<Pixel::Format>(header.pixelFormat);
+      if(encoded)
+      {
+        // The data is an image file, e.g. a KTX file of a compressed texture, which the image loaders decode.
+        Dali::Vector<uint8_t> encodedData;
+        encodedData.ResizeUninitialized(header.dataSize);
+        if(file.seekg(header.dataOffset) && file.read(reinterpret_cast<char*>(encodedData.Begin()), header.dataSize))
+        {
+          pixelBuffer = Dali::LoadImageFromBuffer(encodedData);
+          valid       = pixelBuffer && pixelBuffer.GetPixelFormat() == pixelFormat && pixelBuffer.GetWidth() == header.width && pixelBuffer.GetHeight() == header.height;
+        }
+      }
+      else if(header.dataSize == header.width * header.height * Pixel::GetBytesPerPixel(pixelFormat))
+      {
+        pixelBuffer = Devel::PixelBuffer::New(header.width, header.height, pixelFormat);
+        valid       = file.seekg(header.dataOffset) && file.read(reinterpret_cast<char*>(pixelBuffer.GetBuffer()), header.dataSize);
+      }
+    }
+  }
+  file.close();
+
+  if(!valid)
+  {
+    // Hash collision or broken file.
+    Mutex::ScopedLock lock(mMutex);
+    RemoveEntry(fileName);
+    return Devel::PixelBuffer();
+  }
+
+  // Update the modification time, so the order of use is kept for the next run.
+  std::error_code errorCode;
+  std::filesystem::last_write_time(filePath, std::filesystem::file_time_type::clock::now(), errorCode);
+
+  return pixelBuffer;
+}
+
+void ImageDiskCache::QueueFile(const VisualUrl& url, const std::string& key, Pixel::Format pixelFormat, uint32_t width, uint32_t height, const uint8_t* data, uint32_t dataSize)
+{
+  const uint64_t fileSize = static_cast<uint64_t>(GetDataOffset(static_cast<uint32_t>(key.size()))) + dataSize;
+  if(fileSize > mMaximumSize)
+  {
+    return;
+  }
+
+  ConditionalWait::ScopedLock lock(mSaveWait);
+  if(mPendingSize + dataSize > MAXIMUM_PENDING_SIZE)
+  {
+    // The disk doesn't keep up. The image will be stored when it is decoded again.
+    return;
+  }
+  for(const auto& pendingFile : mPendingFiles)
+  {
+    if(pendingFile.key == key)
+    {
+      // Already queued by another task.
+      return;
+    }
+  }
+
+  // Copy the data, as the caller may change it, e.g. pre-multiply the color, before it is written.
+  PendingFile pendingFile{url.GetUrl(), key, pixelFormat, width, height, Dali::Vector<uint8_t>()};
+  pendingFile.data.ResizeUninitialized(dataSize);
+  memcpy(pendingFile.data.Begin(), data, dataSize);
+
+  mPendingSize += dataSize;
+  mPendingFiles.push_back(std::move(pendingFile));
+
+  if(!mSaveThread)
+  {
+    mSaveThread = std::make_unique<SaveThread>(*this);
+    mSaveThread->Start();
+  }
+  mSaveWait.Notify(lock);
+}
+
+void ImageDiskCache::SavePendingFiles()
+{
+  while(true)
+  {
+    PendingFile pendingFile;
+    {
+      ConditionalWait::ScopedLock lock(mSaveWait);
+      mSaving = false;
+      while(mPendingFiles.empty() && !mDestroying)
+      {
+        // Wake Flush() up, then wait for the next image.
+        mSaveWait.Notify(lock);
+        mSaveWait.Wait(lock);
+      }
+      if(mDestroying)
+      {
+        return;
+      }
+
+      pendingFile = std::move(mPendingFiles.front());
+      mPendingFiles.pop_front();
+      mPendingSize -= pendingFile.data.Count();
+      mSaving = true;
+    }
+
+    SaveFile(pendingFile);
+  }
+}
+
+void ImageDiskCache::SaveFile(const PendingFile& pendingFile)
+{
+  FileHeader header;
+  memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header.version     = FILE_VERSION;
+  header.width       = pendingFile.width;
+  header.height      = pendingFile.height;
+  header.pixelFormat = static_cast<uint32_t>(pendingFile.pixelFormat);
+  header.keyLength   = static_cast<uint32_t>(pendingFile.key.size());
+  header.dataOffset  = GetDataOffset(header.keyLength);
+  header.dataSize    = static_cast<uint32_t>(pendingFile.data.Count());
+
+  const uint64_t    fileSize = static_cast<uint64_t>(header.dataOffset) + header.dataSize;
+  const std::string fileName = GetFileName(pendingFile.key);
+  std::string       temporaryPath;
+  {
+    Mutex::ScopedLock lock(mMutex);
+    LoadIndex();
+    if(mEntries.find(fileName) != mEntries.end())
+    {
+      // Already stored by another task.
+      return;
+    }
+    // The process id keeps the temporary files of the processes sharing the directory apart.
+    temporaryPath = mPath + '/' + fileName + '.' + std::to_string(getpid()) + '.' + std::to_string(++mUseCounter) + TEMPORARY_EXTENSION;
+  }
+
+  // Write a temporary file first, so other threads never read a partial file.
+  bool written = false;
+  {
+    std::ofstream file(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if(file)
+    {
+      const std::vector<char> padding(header.dataOffset - sizeof(FileHeader) - header.keyLength, '\0');
+
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(pendingFile.key.data(), pendingFile.key.size());
+      file.write(padding.data(), padding.size());
+      file.write(reinterpret_cast<const char*>(pendingFile.data.Begin()), header.dataSize);
+      written = static_cast<bool>(file);
+    }
+  }
+
+  const std::string filePath = mPath + '/' + fileName;
+  std::error_code   errorCode;
+  if(written)
+  {
+    std::filesystem::rename(temporaryPath, filePath, errorCode);
+  }
+  if(!written || errorCode)
+  {
+    DALI_LOG_ERROR("Fail to store image in disk cache: %s\n", pendingFile.url.c_str());
+    std::filesystem::remove(temporaryPath, errorCode);
+    return;
+  }
+
+  Mutex::ScopedLock lock(mMutex);
+  auto              iter = mEntries.find(fileName);
+  if(iter != mEntries.end())
+  {
+    mSize -= iter->second.size;
+  }
+  mEntries[fileName] = Entry{fileSize, ++mUseCounter};
+  mSize += fileSize;
+
+  Trim();
+}
+
+void ImageDiskCache::LoadIndex()
+{
+  if(mIndexLoaded)
+  {
+    return;
+  }
+  mIndexLoaded = true;
+
+  struct StoredFile
+  {
+    std::string                     name;
+    uint64_t                        size;
+    std::filesystem::file_time_type lastWriteTime;
+  };
+  std::vector<StoredFile> storedFiles;
+
+  std::error_code errorCode;
+  for(const auto& directoryEntry : std::filesystem::directory_iterator(mPath, errorCode))
+  {
+    const auto& path = directoryEntry.path();
+    if(path.extension() == TEMPORARY_EXTENSION)
+    {
+      // Other processes may be writing theirs, so only the ones left by a process which was stopped while writing are removed.
+      const auto lastWriteTime = directoryEntry.last_write_time(errorCode);
+      if(!errorCode && std::filesystem::file_time_type::clock::now() - lastWriteTime > STALE_TEMPORARY_FILE_AGE)
+      {
+        std::filesystem::remove(path, errorCode);
+      }
+    }
+    else if(path.extension() == FILE_EXTENSION)
+    {
+      const auto size          = directoryEntry.file_size(errorCode);
+      const auto lastWriteTime = directoryEntry.last_write_time(errorCode);
+      if(!errorCode)
+      {
+        storedFiles.push_back(StoredFile{path.filename().string(), size, lastWriteTime});
+      }
+    }
+  }
+
+  // The least recently used first.
+  std::sort(storedFiles.begin(), storedFiles.end(), [](const StoredFile& lhs, const StoredFile& rhs) { return lhs.lastWriteTime < rhs.lastWriteTime; });
+  for(auto& storedFile : storedFiles)
+  {
+    mEntries[storedFile.name] = Entry{storedFile.size, ++mUseCounter};
+    mSize += storedFile.size;
+  }
+
+  Trim();
+}
+
+void ImageDiskCache::Trim()
+{
+  if(mSize <= mMaximumSize)
+  {
+    return;
+  }
+
+  std::vector<std::pair<uint64_t, std::string>> entries;
+  entries.reserve(mEntries.size());
+  for(const auto& entry : mEntries)
+  {
+    entries.emplace_back(entry.second.lastUsed, entry.first);
+  }
+  std::sort(entries.begin(), entries.end());
+
+  for(const auto& entry : entries)
+  {
+    if(mSize <= mMaximumSize)
+    {
+      break;
+    }
+    RemoveEntry(entry.second);
+  }
+}
+
+void ImageDiskCache::RemoveEntry(const std::string& fileName)
+{
+  auto iter = mEntries.find(fileName);
+  if(iter != mEntries.end())
+  {
+    mSize -= iter->second.size;
+    mEntries.erase(iter);
+  }
+
+  std::error_code errorCode;
+  std::filesystem::remove(mPath + '/' + fileName, errorCode);
+}
+
+ImageDiskCache::SaveThread::SaveThread(ImageDiskCache& diskCache)
+: mDiskCache(diskCache)
+{
+}
+
+void ImageDiskCache::SaveThread::Run()
+{
+  SetThreadName("ImageDiskCacheThread");
+  mDiskCache.SavePendingFiles();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,290 @@
+#ifndef DALI_TOOLKIT_INTERNAL_IMAGE_DISK_CACHE_H
+#define DALI_TOOLKIT_INTERNAL_IMAGE_DISK_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/images/image-operations.h>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Keeps the decoded images in files, so the image decoders are not needed the next time they are loaded.
+ *
+ * The images are stored after they are decoded and resized, before their color is pre-multiplied.
+ * They are keyed by the url, the modification time and size of the file, and the loading parameters.
+ *
+ * Each file has a fixed size header, followed by the key and the pixels. The pixels start at an aligned
+ * offset, so the file can be memory mapped.
+ *
+ * The encoded images, e.g. the compressed textures transcoded from the decoded images, are stored as image
+ * files which the image loaders decode. They are keyed by their format as well.
+ *
+ * The cache is enabled when the DALI_IMAGE_DISK_CACHE_PATH environment variable is set with an existing
+ * directory. DALI_IMAGE_DISK_CACHE_SIZE sets the maximum size of the files in kilobytes. The least recently
+ * used files are removed when it is exceeded.
+ *
+ * The files are written by a thread of the cache, so the loading tasks don't wait for the disk.
+ *
+ * All the methods can be called from any thread.
+ */
+class ImageDiskCache
+{
+public:
+  /**
+   * @brief Retrieves the disk cache. It is created the first time this is called.
+   * @return The disk cache.
+   */
+  static ImageDiskCache& Get();
+
+  /**
+   * @brief Constructor.
+   * @param[in] path The directory where the images are stored. The cache is disabled if it is empty.
+   * @param[in] maximumSize The maximum size of the files in bytes.
+   */
+  ImageDiskCache(const std::string& path, uint64_t maximumSize);
+
+  /**
+   * @brief Destructor. The images which are not written yet are dropped.
+   */
+  ~ImageDiskCache();
+
+  /**
+   * @brief Whether the cache is enabled.
+   * @return true if the images are stored.
+   */
+  bool IsEnabled() const
+  {
+    return !mPath.empty();
+  }
+
+  /**
+   * @brief Loads an image stored for the given parameters.
+   *
+   * @param[in] url The url of a local image file.
+   * @param[in] dimensions The size the image was loaded with.
+   * @param[in] fittingMode The fitting mode the image was loaded with.
+   * @param[in] samplingMode The sampling mode the image was loaded with.
+   * @param[in] orientationCorrection Whether the image was rotated by its metadata.
+   *
+   * @return The stored image, or an empty handle if it is not stored or the file has changed.
+   */
+  Devel::PixelBuffer Load(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection);
+
+  /**
+   * @brief Stores a decoded image.
+   * @note The image is copied and written later by the thread of the cache.
+   * @note The least recently used files are removed if the maximum size is exceeded.
+   *
+   * @param[in] url The url of a local image file.
+   * @param[in] dimensions The size the image was loaded with.
+   * @param[in] fittingMode The fitting mode the image was loaded with.
+   * @param[in] samplingMode The sampling mode the image was loaded with.
+   * @param[in] orientationCorrection Whether the image was rotated by its metadata.
+   * @param[in] pixelBuffer The decoded image. Its color must not be pre-multiplied.
+   */
+  void Save(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, Devel::PixelBuffer pixelBuffer);
+
+  /**
+   * @brief Loads an encoded image stored for the given parameters.
+   *
+   * @param[in] url The url of a local image file.
+   * @param[in] dimensions The size the image was loaded with.
+   * @param[in] fittingMode The fitting mode the image was loaded with.
+   * @param[in] samplingMode The sampling mode the image was loaded with.
+   * @param[in] orientationCorrection Whether the image was rotated by its metadata.
+   * @param[in] format The name of the encoding, e.g. "etc2-fast".
+   *
+   * @return The decoded image, e.g. a compressed texture, or an empty handle if it is not stored or the file has changed.
+   */
+  Devel::PixelBuffer LoadEncoded(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, const std::string& format);
+
+  /**
+   * @brief Stores an encoded image.
+   * @note The image is copied and written later by the thread of the cache.
+   * @note The least recently used files are removed if the maximum size is exceeded.
+   *
+   * @param[in] url The url of a local image file.
+   * @param[in] dimensions The size the image was loaded with.
+   * @param[in] fittingMode The fitting mode the image was loaded with.
+   * @param[in] samplingMode The sampling mode the image was loaded with.
+   * @param[in] orientationCorrection Whether the image was rotated by its metadata.
+   * @param[in] format The name of the encoding, e.g. "etc2-fast".
+   * @param[in] pixelFormat The pixel format the encoded image is decoded to.
+   * @param[in] width The width of the image.
+   * @param[in] height The height of the image.
+   * @param[in] encodedData The encoded image, in a format the image loaders decode, e.g. KTX.
+   */
+  void SaveEncoded(const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, const std::string& format, Pixel::Format pixelFormat, uint32_t width, uint32_t height, const Dali::Vector<uint8_t>& encodedData);
+
+  /**
+   * @brief Waits until the images queued before are written.
+   */
+  void Flush();
+
+  /**
+   * @brief Removes all the stored images, and drops the ones which are not written yet.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the size of the stored files.
+   * @return The size in bytes.
+   */
+  uint64_t GetSize();
+
+private:
+  /**
+   * @brief A stored file.
+   */
+  struct Entry
+  {
+    uint64_t size;     ///< The size of the file in bytes.
+    uint64_t lastUsed; ///< When the file was used. The bigger, the more recent.
+  };
+
+  /**
+   * @brief An image waiting to be written.
+   */
+  struct PendingFile
+  {
+    std::string           url;         ///< The url of the image, for the logs.
+    std::string           key;         ///< The key of the image.
+    Pixel::Format         pixelFormat; ///< The pixel format of the image.
+    uint32_t              width;       ///< The width of the image.
+    uint32_t              height;      ///< The height of the image.
+    Dali::Vector<uint8_t> data;        ///< The pixels or the encoded image.
+  };
+
+  /**
+   * @brief The thread which writes the queued images.
+   */
+  class SaveThread : public Thread
+  {
+  public:
+    /**
+     * @brief Constructor.
+     * @param[in] diskCache The cache whose images are written.
+     */
+    SaveThread(ImageDiskCache& diskCache);
+
+  protected:
+    /**
+     * @brief The entry function of the thread.
+     */
+    void Run() override;
+
+  private:
+    ImageDiskCache& mDiskCache;
+  };
+
+  /**
+   * @brief Loads a stored file.
+   * @param[in] key The key of the image.
+   * @param[in] encoded Whether the data of the file is an encoded image.
+   * @return The image, or an empty handle if it is not stored or the file is broken.
+   */
+  Devel::PixelBuffer LoadFile(const std::string& key, bool encoded);
+
+  /**
+   * @brief Copies an image and queues it to be written by the thread.
+   * @param[in] url The url of the image, for the logs.
+   * @param[in] key The key of the image.
+   * @param[in] pixelFormat The pixel format of the image.
+   * @param[in] width The width of the image.
+   * @param[in] height The height of the image.
+   * @param[in] data The pixels or the encoded image.
+   * @param[in] dataSize The size of the data in bytes.
+   */
+  void QueueFile(const VisualUrl& url, const std::string& key, Pixel::Format pixelFormat, uint32_t width, uint32_t height, const uint8_t* data, uint32_t dataSize);
+
+  /**
+   * @brief Writes the queued images until the cache is destroyed. Called by the thread.
+   */
+  void SavePendingFiles();
+
+  /**
+   * @brief Writes a file and adds it to the index.
+   * @param[in] pendingFile The image to write.
+   */
+  void SaveFile(const PendingFile& pendingFile);
+
+  /**
+   * @brief Builds the index of the stored files from the directory, the first time it is needed.
+   * @note The mutex must be locked.
+   */
+  void LoadIndex();
+
+  /**
+   * @brief Removes the least recently used files until they fit in the maximum size.
+   * @note The mutex must be locked.
+   */
+  void Trim();
+
+  /**
+   * @brief Removes a stored file.
+   * @note The mutex must be locked.
+   * @param[in] fileName The name of the file.
+   */
+  void RemoveEntry(const std::string& fileName);
+
+  // Undefined
+  ImageDiskCache(const ImageDiskCache&) = delete;
+  ImageDiskCache& operator=(const ImageDiskCache&) = delete;
+
+private:
+  std::string                            mPath;        ///< The directory where the images are stored.
+  uint64_t                               mMaximumSize; ///< The maximum size of the files.
+  uint64_t                               mSize;        ///< The size of the files.
+  uint64_t                               mUseCounter;  ///< Increased every time a file is used.
+  std::unordered_map<std::string, Entry> mEntries;     ///< The stored files by name.
+  Dali::Mutex                            mMutex;       ///< Protects the index.
+  bool                                   mIndexLoaded; ///< Whether the index has been built from the directory.
+
+  std::deque<PendingFile>     mPendingFiles; ///< The images waiting to be written.
+  uint64_t                    mPendingSize;  ///< The size of the pending images in bytes.
+  ConditionalWait             mSaveWait;     ///< Protects the pending images, and wakes the thread and Flush() up.
+  std::unique_ptr<SaveThread> mSaveThread;   ///< Created when the first image is queued.
+  bool                        mSaving;       ///< Whether the thread is writing an image.
+  bool                        mDestroying;   ///< Whether the thread should stop.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_IMAGE_DISK_CACHE_H
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/image-loader/image-transcoder.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/etc2-encoder.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_IMAGE_TRANSCODER");
+#endif
+
+constexpr auto COMPRESSION_QUALITY_ENV      = "DALI_TEXTURE_COMPRESSION_QUALITY";
+constexpr auto COMPRESSION_MINIMUM_SIZE_ENV = "DALI_TEXTURE_COMPRESSION_MINIMUM_SIZE";
+
+constexpr uint32_t DEFAULT_MINIMUM_SIZE = 64u;
+
+constexpr uint8_t  KTX_IDENTIFIER[12]            = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr uint32_t KTX_ENDIANNESS                = 0x04030201;
+constexpr uint32_t KTX_COMPRESSED_RGB8_ETC2      = 0x9274;
+constexpr uint32_t KTX_COMPRESSED_RGBA8_ETC2_EAC = 0x9278;
+constexpr uint32_t KTX_RGB                       = 0x1907;
+constexpr uint32_t KTX_RGBA                      = 0x1908;
+
+/**
+ * @brief The header of a KTX 1.1 file.
+ */
+struct KtxHeader
+{
+  uint8_t  identifier[12];
+  uint32_t endianness;
+  uint32_t glType;
+  uint32_t glTypeSize;
+  uint32_t glFormat;
+  uint32_t glInternalFormat;
+  uint32_t glBaseInternalFormat;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t numberOfArrayElements;
+  uint32_t numberOfFaces;
+  uint32_t numberOfMipmapLevels;
+  uint32_t bytesOfKeyValueData;
+};
+
+bool HasTranslucentPixel(const Devel::PixelBuffer& pixelBuffer)
+{
+  if(pixelBuffer.GetPixelFormat() != Pixel::RGBA8888)
+  {
+    return false;
+  }
+
+  const uint8_t* pixels     = pixelBuffer.GetBuffer();
+  const uint32_t pixelCount = pixelBuffer.GetWidth() * pixelBuffer.GetHeight();
+  for(uint32_t i = 0u; i < pixelCount; ++i)
+  {
+    if(pixels[i * 4u + 3u] != 255u)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+ImageTranscoder& ImageTranscoder::Get()
+{
+  static ImageTranscoder transcoder(
+    []() {
+      auto quality = Dali::EnvironmentVariable::GetEnvironmentVariable(COMPRESSION_QUALITY_ENV);
+      return quality ? static_cast<Quality>(std::min(std::max(std::atoi(quality), 0), static_cast<int>(Quality::HIGH))) : Quality::NONE;
+    }(),
+    []() {
+      auto size = Dali::EnvironmentVariable::GetEnvironmentVariable(COMPRESSION_MINIMUM_SIZE_ENV);
+      return size ? static_cast<uint32_t>(std::atoi(size)) : DEFAULT_MINIMUM_SIZE;
+    }());
+  return transcoder;
+}
+
+ImageTranscoder::ImageTranscoder(Quality quality, uint32_t minimumSize)
+: mQuality(quality),
+  mMinimumSize(minimumSize),
+  mImageCount(0u),
+  mDecodedSize(0u),
+  mCompressedSize(0u)
+{
+}
+
+void ImageTranscoder::SetQuality(Quality quality)
+{
+  mQuality = quality;
+}
+
+ImageTranscoder::Quality ImageTranscoder::GetQuality() const
+{
+  return static_cast<Quality>(mQuality.load());
+}
+
+void ImageTranscoder::SetMinimumSize(uint32_t minimumSize)
+{
+  mMinimumSize = minimumSize;
+}
+
+bool ImageTranscoder::IsEligible(const Devel::PixelBuffer& pixelBuffer) const
+{
+  if(!IsEnabled() || !pixelBuffer)
+  {
+    return false;
+  }
+
+  const Pixel::Format pixelFormat = pixelBuffer.GetPixelFormat();
+  const uint32_t      minimumSize = mMinimumSize;
+  return (pixelFormat == Pixel::RGB888 || pixelFormat == Pixel::RGBA8888) &&
+         !pixelBuffer.IsAlphaPreMultiplied() &&
+         pixelBuffer.GetWidth() >= minimumSize &&
+         pixelBuffer.GetHeight() >= minimumSize;
+}
+
+std::string ImageTranscoder::GetFormatName() const
+{
+  return GetQuality() == Quality::HIGH ? "etc2-high" : "etc2-fast";
+}
+
+Devel::PixelBuffer ImageTranscoder::Transcode(const Devel::PixelBuffer& pixelBuffer, Dali::Vector<uint8_t>& encodedData)
+{
+  const uint32_t width         = pixelBuffer.GetWidth();
+  const uint32_t height        = pixelBuffer.GetHeight();
+  const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel(pixelBuffer.GetPixelFormat());
+
+  // The opaque RGBA images don't need the alpha blocks.
+  const bool     hasAlpha  = HasTranslucentPixel(pixelBuffer);
+  const uint32_t imageSize = Etc2Encoder::GetEncodedSize(width, height, hasAlpha);
+
+  KtxHeader header;
+  memcpy(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER));
+  header.endianness            = KTX_ENDIANNESS;
+  header.glType                = 0u;
+  header.glTypeSize            = 1u;
+  header.glFormat              = 0u;
+  header.glInternalFormat      = hasAlpha ? KTX_COMPRESSED_RGBA8_ETC2_EAC : KTX_COMPRESSED_RGB8_ETC2;
+  header.glBaseInternalFormat  = hasAlpha ? KTX_RGBA : KTX_RGB;
+  header.pixelWidth            = width;
+  header.pixelHeight           = height;
+  header.pixelDepth            = 0u;
+  header.numberOfArrayElements = 0u;
+  header.numberOfFaces         = 1u;
+  header.numberOfMipmapLevels  = 1u;
+  header.bytesOfKeyValueData   = 0u;
+
+  encodedData.ResizeUninitialized(sizeof(KtxHeader) + sizeof(uint32_t) + imageSize);
+  uint8_t* data = encodedData.Begin();
+  memcpy(data, &header, sizeof(KtxHeader));
+  memcpy(data + sizeof(KtxHeader), &imageSize, sizeof(uint32_t));
+
+  const Etc2Encoder::Quality quality = (GetQuality() == Quality::HIGH) ? Etc2Encoder::Quality::HIGH : Etc2Encoder::Quality::FAST;
+  Etc2Encoder::EncodeImage(pixelBuffer.GetBuffer(), width, height, bytesPerPixel, hasAlpha, quality, data + sizeof(KtxHeader) + sizeof(uint32_t));
+
+  Devel::PixelBuffer compressed = Dali::LoadImageFromBuffer(encodedData);
+  if(!compressed)
+  {
+    DALI_LOG_ERROR("Fail to load the transcoded image [%u x %u]\n", width, height);
+    encodedData.Clear();
+    return Devel::PixelBuffer();
+  }
+
+  AddToStatistics(compressed);
+  return compressed;
+}
+
+void ImageTranscoder::AddToStatistics(const Devel::PixelBuffer& pixelBuffer)
+{
+  const bool     hasAlpha    = (pixelBuffer.GetPixelFormat() == Pixel::COMPRESSED_RGBA8_ETC2_EAC);
+  const uint64_t pixelCount  = static_cast<uint64_t>(pixelBuffer.GetWidth()) * pixelBuffer.GetHeight();
+  const uint64_t decodedSize = pixelCount * (hasAlpha ? 4u : 3u);
+  const uint64_t encodedSize = Etc2Encoder::GetEncodedSize(pixelBuffer.GetWidth(), pixelBuffer.GetHeight(), hasAlpha);
+
+  ++mImageCount;
+  mDecodedSize += decodedSize;
+  mCompressedSize += encodedSize;
+
+  DALI_LOG_INFO(gLogFilter, Debug::General, "ImageTranscoder: [%u x %u] %llu -> %llu bytes, %llu bytes saved by %u images\n", pixelBuffer.GetWidth(), pixelBuffer.GetHeight(), static_cast<unsigned long long>(decodedSize), static_cast<unsigned long long>(encodedSize), static_cast<unsigned long long>(mDecodedSize - mCompressedSize), mImageCount.load());
+}
+
+ImageTranscoder::Statistics ImageTranscoder::GetStatistics() const
+{
+  Statistics statistics;
+  statistics.imageCount     = mImageCount;
+  statistics.decodedSize    = mDecodedSize;
+  statistics.compressedSize = mCompressedSize;
+  return statistics;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
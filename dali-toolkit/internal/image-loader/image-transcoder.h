@@ -0,0 +1,143 @@
+#ifndef DALI_TOOLKIT_INTERNAL_IMAGE_TRANSCODER_H
+#define DALI_TOOLKIT_INTERNAL_IMAGE_TRANSCODER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <atomic>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Transcodes the decoded images to ETC2 compressed textures, which take a quarter to a sixth of the memory.
+ *
+ * The compressed textures are wrapped in KTX files, which the image loaders decode to compressed pixel buffers.
+ * The KTX files can be stored in the ImageDiskCache, so the images are not decoded again.
+ *
+ * All the methods can be called from any thread.
+ */
+class ImageTranscoder
+{
+public:
+  using Quality    = Toolkit::TextureManager::TextureCompressionQuality::Type;
+  using Statistics = Toolkit::TextureManager::TextureCompressionStatistics;
+
+  /**
+   * @brief Retrieves the transcoder. It is created the first time this is called, with the settings of the
+   * DALI_TEXTURE_COMPRESSION_QUALITY and DALI_TEXTURE_COMPRESSION_MINIMUM_SIZE environment variables.
+   * @return The transcoder.
+   */
+  static ImageTranscoder& Get();
+
+  /**
+   * @brief Constructor.
+   * @param[in] quality The quality of the compression, or NONE not to transcode the images.
+   * @param[in] minimumSize The images narrower or shorter than this are not transcoded.
+   */
+  ImageTranscoder(Quality quality, uint32_t minimumSize);
+
+  /**
+   * @brief Sets the quality of the compression.
+   * @param[in] quality The quality, or NONE not to transcode the images.
+   */
+  void SetQuality(Quality quality);
+
+  /**
+   * @brief Retrieves the quality of the compression.
+   * @return The quality.
+   */
+  Quality GetQuality() const;
+
+  /**
+   * @brief Sets the size of the smallest images which are transcoded.
+   * @param[in] minimumSize The images narrower or shorter than this, in pixels, are not transcoded.
+   */
+  void SetMinimumSize(uint32_t minimumSize);
+
+  /**
+   * @brief Whether the images are transcoded.
+   * @return true if the quality is not NONE.
+   */
+  bool IsEnabled() const
+  {
+    return GetQuality() != Quality::NONE;
+  }
+
+  /**
+   * @brief Whether a decoded image can be transcoded.
+   * @param[in] pixelBuffer The decoded image. Its color must not be pre-multiplied.
+   * @return true if it is an RGB or RGBA image which is big enough, and the transcoder is enabled.
+   */
+  bool IsEligible(const Devel::PixelBuffer& pixelBuffer) const;
+
+  /**
+   * @brief Retrieves the name of the current encoding, to key the transcoded images in the disk cache.
+   * @return The name of the encoding.
+   */
+  std::string GetFormatName() const;
+
+  /**
+   * @brief Transcodes a decoded image.
+   * @param[in] pixelBuffer The decoded image, which must be eligible.
+   * @param[out] encodedData The KTX file of the compressed texture, to store it.
+   * @return The compressed pixel buffer, or an empty handle if it fails.
+   */
+  Devel::PixelBuffer Transcode(const Devel::PixelBuffer& pixelBuffer, Dali::Vector<uint8_t>& encodedData);
+
+  /**
+   * @brief Adds a compressed texture to the statistics, e.g. one loaded from the disk cache.
+   * @param[in] pixelBuffer The compressed pixel buffer.
+   */
+  void AddToStatistics(const Devel::PixelBuffer& pixelBuffer);
+
+  /**
+   * @brief Retrieves the memory the compressed textures have saved.
+   * @return The statistics.
+   */
+  Statistics GetStatistics() const;
+
+private:
+  // Undefined
+  ImageTranscoder(const ImageTranscoder&) = delete;
+  ImageTranscoder& operator=(const ImageTranscoder&) = delete;
+
+private:
+  std::atomic<int>      mQuality;        ///< The Quality.
+  std::atomic<uint32_t> mMinimumSize;    ///< The size of the smallest images which are transcoded.
+  std::atomic<uint32_t> mImageCount;     ///< The number of the compressed textures.
+  std::atomic<uint64_t> mDecodedSize;    ///< The size of the images as they were decoded.
+  std::atomic<uint64_t> mCompressedSize; ///< The size of the compressed textures.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_IMAGE_TRANSCODER_H
@@ -25,6 +25,12 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/trace.h>
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
+#include <algorithm>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/image-disk-cache.h>
+#include <dali-toolkit/internal/image-loader/image-transcoder.h>
 
 #ifdef TRACE_ENABLED
 #include <chrono>
@@ -52,6 +58,29 @@ uint64_t GetNanoseconds()
   return static_cast<uint64_t>(duration.count());
 }
 #endif
+
+/**
+ * @brief Copies a rectangle of the pixels to a new pixel buffer.
+ */
+Devel::PixelBuffer CopyPixelBuffer(Devel::PixelBuffer pixelBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+  const Pixel::Format pixelFormat   = pixelBuffer.GetPixelFormat();
+  const uint32_t      bytesPerPixel = Pixel::GetBytesPerPixel(pixelFormat);
+  const uint32_t      sourceStride  = pixelBuffer.GetWidth() * bytesPerPixel;
+  const uint32_t      rowSize       = width * bytesPerPixel;
+
+  Devel::PixelBuffer copy = Devel::PixelBuffer::New(width, height, pixelFormat);
+
+  const uint8_t* source      = pixelBuffer.GetBuffer() + y * sourceStride + x * bytesPerPixel;
+  uint8_t*       destination = copy.GetBuffer();
+  for(uint32_t row = 0u; row < height; ++row)
+  {
+    memcpy(destination, source, rowSize);
+    source += sourceStride;
+    destination += rowSize;
+  }
+  return copy;
+}
 } // namespace
 
 LoadingTask::LoadingTask(uint32_t id, Dali::AnimatedImageLoading animatedImageLoading, uint32_t frameIndex, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, CallbackBase* callback)
@@ -68,11 +97,16 @@ LoadingTask::LoadingTask(uint32_t id, Dali::AnimatedImageLoading animatedImageLo
   contentScale(1.0f),
   animatedImageLoading(animatedImageLoading),
   frameIndex(frameIndex),
+  decodedImage(),
+  isStarted(false),
   orientationCorrection(),
   isMaskTask(false),
   cropToMask(false),
   loadPlanes(false),
-  isReady(true)
+  isReady(true),
+  keepDecodedImage(false),
+  isDerived(false),
+  compressTexture(false)
 {
 }
 
@@ -90,16 +124,21 @@ LoadingTask::LoadingTask(uint32_t id, Dali::AnimatedImageLoading animatedImageLo
   contentScale(1.0f),
   animatedImageLoading(animatedImageLoading),
   frameIndex(frameIndex),
+  decodedImage(),
+  isStarted(false),
   orientationCorrection(),
   isMaskTask(false),
   cropToMask(false),
   loadPlanes(false),
-  isReady(true)
+  isReady(true),
+  keepDecodedImage(false),
+  isDerived(false),
+  compressTexture(false)
 {
 }
 
-LoadingTask::LoadingTask(uint32_t id, const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, bool loadPlanes, CallbackBase* callback)
-: AsyncTask(callback, url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH),
+LoadingTask::LoadingTask(uint32_t id, const VisualUrl& url, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, bool loadPlanes, CallbackBase* callback, AsyncTask::PriorityType priority)
+: AsyncTask(callback, url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ? AsyncTask::PriorityType::LOW : priority),
   url(url),
   encodedImageBuffer(),
   id(id),
@@ -112,11 +151,16 @@ LoadingTask::LoadingTask(uint32_t id, const VisualUrl& url, ImageDimensions dime
   contentScale(1.0f),
   animatedImageLoading(),
   frameIndex(0u),
+  decodedImage(),
+  isStarted(false),
   orientationCorrection(orientationCorrection),
   isMaskTask(false),
   cropToMask(false),
   loadPlanes(loadPlanes),
-  isReady(true)
+  isReady(true),
+  keepDecodedImage(false),
+  isDerived(false),
+  compressTexture(false)
 {
 }
 
@@ -134,11 +178,16 @@ LoadingTask::LoadingTask(uint32_t id, const EncodedImageBuffer& encodedImageBuff
   contentScale(1.0f),
   animatedImageLoading(),
   frameIndex(0u),
+  decodedImage(),
+  isStarted(false),
   orientationCorrection(orientationCorrection),
   isMaskTask(false),
   cropToMask(false),
   loadPlanes(false),
-  isReady(true)
+  isReady(true),
+  keepDecodedImage(false),
+  isDerived(false),
+  compressTexture(false)
 {
 }
 
@@ -156,11 +205,16 @@ LoadingTask::LoadingTask(uint32_t id, Devel::PixelBuffer pixelBuffer, Devel::Pix
   contentScale(contentScale),
   animatedImageLoading(),
   frameIndex(0u),
+  decodedImage(),
+  isStarted(false),
   orientationCorrection(),
   isMaskTask(true),
   cropToMask(cropToMask),
   loadPlanes(false),
-  isReady(true)
+  isReady(true),
+  keepDecodedImage(false),
+  isDerived(false),
+  compressTexture(false)
 {
   pixelBuffers.push_back(pixelBuffer);
 }
@@ -184,10 +238,12 @@ void LoadingTask::Process()
   }
 #endif
 
-  isReady = false;
+  isStarted = true;
+  isReady   = false;
   if(!isMaskTask)
   {
     Load();
+    CompressTexture();
   }
   else
   {
@@ -226,6 +282,15 @@ bool LoadingTask::IsReady()
 
 void LoadingTask::Load()
 {
+  if(decodedImage && url.IsValid() && url.IsLocalResource() && !loadPlanes && !animatedImageLoading)
+  {
+    isDerived = Derive();
+    if(isDerived)
+    {
+      return;
+    }
+  }
+
   Devel::PixelBuffer pixelBuffer;
   if(animatedImageLoading)
   {
@@ -246,7 +311,31 @@ void LoadingTask::Load()
     }
     else
     {
-      pixelBuffer = Dali::LoadImageFromFile(url.GetUrl(), dimensions, fittingMode, samplingMode, orientationCorrection);
+      ImageDiskCache&  diskCache  = ImageDiskCache::Get();
+      ImageTranscoder& transcoder = ImageTranscoder::Get();
+      if(compressTexture && transcoder.IsEnabled())
+      {
+        // Upload the compressed texture transcoded before, without decoding the image.
+        pixelBuffer = diskCache.LoadEncoded(url, dimensions, fittingMode, samplingMode, orientationCorrection, transcoder.GetFormatName());
+        if(pixelBuffer)
+        {
+          transcoder.AddToStatistics(pixelBuffer);
+        }
+      }
+      if(!pixelBuffer)
+      {
+        pixelBuffer = diskCache.Load(url, dimensions, fittingMode, samplingMode, orientationCorrection);
+      }
+      if(!pixelBuffer)
+      {
+        pixelBuffer = Dali::LoadImageFromFile(url.GetUrl(), dimensions, fittingMode, samplingMode, orientationCorrection);
+
+        // The transcoded image is stored instead, if it will be transcoded.
+        if(!compressTexture || !transcoder.IsEligible(pixelBuffer))
+        {
+          diskCache.Save(url, dimensions, fittingMode, samplingMode, orientationCorrection, pixelBuffer);
+        }
+      }
     }
   }
   else if(url.IsValid())
@@ -263,6 +352,83 @@ void LoadingTask::Load()
   {
     DALI_LOG_ERROR("LoadingTask::Load: Loading is failed: %s\n", url.GetUrl().c_str());
   }
+
+  if(keepDecodedImage && pixelBuffers.size() == 1u && !Pixel::IsCompressed(pixelBuffers[0].GetPixelFormat()))
+  {
+    // Copy it, as the pixel buffer will be pre-multiplied and released when it is uploaded.
+    decodedImage = CopyPixelBuffer(pixelBuffers[0], 0u, 0u, pixelBuffers[0].GetWidth(), pixelBuffers[0].GetHeight());
+  }
+  else
+  {
+    decodedImage.Reset();
+  }
+}
+
+bool LoadingTask::Derive()
+{
+  // PixelBuffer::Resize filters with Lanczos, as the loader does for SamplingMode::LANCZOS.
+  // The other modes halve the image with a box filter or sample it without filtering, so their pixels would differ from a direct decode.
+  if(samplingMode != SamplingMode::LANCZOS || Pixel::IsCompressed(decodedImage.GetPixelFormat()))
+  {
+    return false;
+  }
+
+  // Get the size the image loader would give, and check the decoded image is big enough.
+  const ImageDimensions size         = Dali::GetClosestImageSize(url.GetUrl(), dimensions, fittingMode, samplingMode, orientationCorrection);
+  const uint32_t        width        = size.GetWidth();
+  const uint32_t        height       = size.GetHeight();
+  const uint32_t        sourceWidth  = decodedImage.GetWidth();
+  const uint32_t        sourceHeight = decodedImage.GetHeight();
+  if(width == 0u || height == 0u || width > sourceWidth || height > sourceHeight)
+  {
+    return false;
+  }
+
+  // Like the loader, scale the whole image first. SCALE_TO_FILL scales it to cover the loaded size, then crops the center of it.
+  uint32_t scaledWidth  = width;
+  uint32_t scaledHeight = height;
+  if(fittingMode == FittingMode::SCALE_TO_FILL)
+  {
+    const float scale = std::max(static_cast<float>(width) / sourceWidth, static_cast<float>(height) / sourceHeight);
+    scaledWidth       = std::min(sourceWidth, std::max(width, static_cast<uint32_t>(sourceWidth * scale + 0.5f)));
+    scaledHeight      = std::min(sourceHeight, std::max(height, static_cast<uint32_t>(sourceHeight * scale + 0.5f)));
+  }
+
+  // The decoded image is shared with the cache, so it is copied before it is resized.
+  Devel::PixelBuffer pixelBuffer = CopyPixelBuffer(decodedImage, 0u, 0u, sourceWidth, sourceHeight);
+  if(scaledWidth != sourceWidth || scaledHeight != sourceHeight)
+  {
+    pixelBuffer.Resize(scaledWidth, scaledHeight);
+  }
+  if(scaledWidth != width || scaledHeight != height)
+  {
+    pixelBuffer = CopyPixelBuffer(pixelBuffer, (scaledWidth - width) / 2u, (scaledHeight - height) / 2u, width, height);
+  }
+  pixelBuffers.push_back(pixelBuffer);
+
+  return true;
+}
+
+void LoadingTask::CompressTexture()
+{
+  if(!compressTexture || pixelBuffers.size() != 1u)
+  {
+    return;
+  }
+
+  ImageTranscoder& transcoder = ImageTranscoder::Get();
+  if(!transcoder.IsEligible(pixelBuffers[0]))
+  {
+    return;
+  }
+
+  Dali::Vector<uint8_t> encodedData;
+  Devel::PixelBuffer    pixelBuffer = transcoder.Transcode(pixelBuffers[0], encodedData);
+  if(pixelBuffer)
+  {
+    ImageDiskCache::Get().SaveEncoded(url, dimensions, fittingMode, samplingMode, orientationCorrection, transcoder.GetFormatName(), pixelBuffer.GetPixelFormat(), pixelBuffer.GetWidth(), pixelBuffer.GetHeight(), encodedData);
+    pixelBuffers[0] = pixelBuffer;
+  }
 }
 
 void LoadingTask::ApplyMask()
@@ -275,7 +441,8 @@ void LoadingTask::ApplyMask()
 
 void LoadingTask::MultiplyAlpha()
 {
-  if(!pixelBuffers.empty() && Pixel::HasAlpha(pixelBuffers[0].GetPixelFormat()))
+  // The compressed textures are not pre-multiplied.
+  if(!pixelBuffers.empty() && Pixel::HasAlpha(pixelBuffers[0].GetPixelFormat()) && !Pixel::IsCompressed(pixelBuffers[0].GetPixelFormat()))
   {
     if(preMultiplyOnLoad == DevelAsyncImageLoader::PreMultiplyOnLoad::ON)
     {
@@ -289,6 +456,21 @@ void LoadingTask::SetTextureId(TextureManagerType::TextureId id)
   textureId = id;
 }
 
+void LoadingTask::SetDecodedImage(Devel::PixelBuffer image)
+{
+  decodedImage = image;
+}
+
+void LoadingTask::SetKeepDecodedImage(bool keep)
+{
+  keepDecodedImage = keep;
+}
+
+void LoadingTask::SetCompressTexture(bool compress)
+{
+  compressTexture = compress;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_IMAGE_LOADING_TASK_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -32,6 +32,7 @@
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/public-api/object/ref-object.h>
+#include <atomic>
 
 namespace Dali
 {
@@ -93,6 +94,7 @@ public:
    * @param [in] preMultiplyOnLoad ON if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
    * @param [in] loadPlanes true to load image planes or false to load bitmap image.
    * @param [in] callback The callback that is called when the operation is completed.
+   * @param [in] priority The priority of the task. Remote images are always loaded with low priority.
    */
   LoadingTask(uint32_t                                 id,
               const VisualUrl&                         url,
@@ -102,7 +104,8 @@ public:
               bool                                     orientationCorrection,
               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
               bool                                     loadPlanes,
-              CallbackBase*                            callback);
+              CallbackBase*                            callback,
+              AsyncTask::PriorityType                  priority = AsyncTask::PriorityType::HIGH);
 
   /**
    * Constructor.
@@ -152,6 +155,33 @@ public:
    */
   void SetTextureId(TextureManagerType::TextureId id);
 
+  /**
+   * @brief Set the decoded image to derive the image from, instead of decoding the file.
+   * @param [in] image A decoded image of the url, larger than the image to load. Its color must not be pre-multiplied.
+   */
+  void SetDecodedImage(Devel::PixelBuffer image);
+
+  /**
+   * @brief Set whether a copy of the decoded image should be kept, before its color is pre-multiplied.
+   * @param [in] keep Whether to keep the decoded image.
+   */
+  void SetKeepDecodedImage(bool keep);
+
+  /**
+   * @brief Set whether the image may be transcoded to a compressed texture, if the ImageTranscoder is enabled.
+   * @param [in] compress Whether to compress the image. It must be false if the image is masked or its pixels are used.
+   */
+  void SetCompressTexture(bool compress);
+
+  /**
+   * @brief Whether a worker thread has started to process the task.
+   * @return true if the task has started, so removing it would waste the work done.
+   */
+  bool IsStarted() const
+  {
+    return isStarted;
+  }
+
 public: // Implementation of AsyncTask
   /**
    * @copydoc Dali::AsyncTask::Process()
@@ -183,6 +213,18 @@ private:
    */
   void Load();
 
+  /**
+   * Derive the image from the decoded one.
+   * @note Only SamplingMode::LANCZOS is derived, as it is the filter of PixelBuffer::Resize.
+   * @return true if the image has been derived, false if it needs to be decoded.
+   */
+  bool Derive();
+
+  /**
+   * Transcode the image to a compressed texture, and store it in the disk cache.
+   */
+  void CompressTexture();
+
   /**
    * Apply mask
    */
@@ -209,12 +251,17 @@ public:
   float                      contentScale;    ///< The factor to scale the content
   Dali::AnimatedImageLoading animatedImageLoading;
   uint32_t                   frameIndex;
+  Devel::PixelBuffer         decodedImage; ///< decoded image to derive from, or the copy of the image decoded to keep
+  std::atomic<bool>          isStarted;    ///< Whether a worker thread has started to process this task
 
   bool orientationCorrection : 1; ///< if orientation correction is needed
   bool isMaskTask : 1;            ///< whether this task is for mask or not
   bool cropToMask : 1;            ///< Whether to crop the content to the mask size
   bool loadPlanes : 1;            ///< Whether to load image planes
   bool isReady : 1;               ///< Whether this task ready to run
+  bool keepDecodedImage : 1;      ///< Whether to keep a copy of the decoded image
+  bool isDerived : 1;             ///< Whether the image has been derived from the decoded image
+  bool compressTexture : 1;       ///< Whether the image may be transcoded to a compressed texture
 };
 
 } // namespace Internal
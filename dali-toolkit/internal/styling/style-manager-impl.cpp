@@ -18,15 +18,19 @@
 #include "style-manager-impl.h"
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/devel-api/common/singleton-service.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/adaptor-framework/application.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <dali/public-api/object/type-registry.h>
+#include <sys/stat.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/asset-manager/asset-manager.h>
+#include <dali-toolkit/devel-api/builder/tree-node.h>
 #include <dali-toolkit/internal/builder/builder-impl.h>
+#include <dali-toolkit/internal/builder/compiled-json.h>
 #include <dali-toolkit/internal/feedback/feedback-style.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/control.h>
@@ -177,7 +181,19 @@ void StyleManager::ApplyThemeStyle(Toolkit::Control control)
 
   if(mThemeBuilder)
   {
-    ApplyStyle(mThemeBuilder, control);
+    ResolvedStyle& resolvedStyle = ResolveStyle(control);
+    Builder&       builder       = GetImpl(mThemeBuilder);
+
+    if(resolvedStyle.style)
+    {
+      builder.ApplyStyle(*resolvedStyle.style, resolvedStyle.recordedStyle, control);
+    }
+
+    if(resolvedStyle.fontSizeStyle)
+    {
+      // Apply the style for logical font size
+      builder.ApplyStyle(*resolvedStyle.fontSizeStyle, resolvedStyle.recordedFontSizeStyle, control);
+    }
   }
 }
 
@@ -264,6 +280,7 @@ void StyleManager::SetTheme(const std::string& themeFile)
   if(loading)
   {
     mThemeFile = themeFile;
+    ClearResolvedStyles();
 
     if(themeLoaded)
     {
@@ -293,6 +310,7 @@ const Property::Map& StyleManager::GetConfigurations()
     DALI_LOG_STREAM(gLogFilter, Debug::Concise, "GetConfigurations()  Loading default theme");
 
     mThemeBuilder = CreateBuilder(mThemeBuilderConstants);
+    ClearResolvedStyles();
 
     // Load default theme because this is first try to load stylesheet.
 #if defined(DEBUG_ENABLED)
@@ -361,13 +379,23 @@ Toolkit::Builder StyleManager::CreateBuilder(const Property::Map& constants)
   Toolkit::Builder builder = Toolkit::Builder::New();
   builder.AddConstants(constants);
 
+  // A theme has the styles of every control, of which an application uses a few
+  builder.SetLazyParsing(true);
+
   return builder;
 }
 
 bool StyleManager::LoadJSON(Toolkit::Builder builder, const std::string& jsonFilePath)
 {
   std::string fileString;
-  if(LoadFile(jsonFilePath, fileString))
+  const bool  fileLoaded = LoadFile(jsonFilePath, fileString);
+
+  if(LoadCompiledJSON(builder, jsonFilePath, fileString))
+  {
+    return true;
+  }
+
+  if(fileLoaded)
   {
     builder.LoadFromString(fileString);
     return true;
@@ -379,6 +407,37 @@ bool StyleManager::LoadJSON(Toolkit::Builder builder, const std::string& jsonFil
   }
 }
 
+bool StyleManager::LoadCompiledJSON(Toolkit::Builder builder, const std::string& jsonFilePath, const std::string& jsonString)
+{
+  const std::string compiledFilePath = jsonFilePath + CompiledJson::FILE_EXTENSION;
+
+  struct stat compiledFileStat;
+  if(stat(compiledFilePath.c_str(), &compiledFileStat) != 0)
+  {
+    return false;
+  }
+
+  std::streampos     fileSize = 0;
+  Dali::Vector<char> fileContent;
+  if(!FileLoader::ReadFile(compiledFilePath, fileSize, fileContent, FileLoader::BINARY))
+  {
+    return false;
+  }
+
+  // Fall back to the JSON if it has been changed since it was compiled
+  const CompiledJson::Header* header = CompiledJson::GetHeader(fileContent.Begin(), fileContent.Count());
+  if(!header ||
+     (!jsonString.empty() &&
+      (jsonString.size() != header->sourceSize || CompiledJson::CalculateSourceHash(jsonString.data(), jsonString.size()) != header->sourceHash)))
+  {
+    DALI_LOG_WARNING("Compiled file '%s' is not valid or not compiled from the JSON\n", compiledFilePath.c_str());
+    return false;
+  }
+
+  DALI_LOG_INFO(gLogFilter, Debug::Concise, "Loading compiled file '%s'\n", compiledFilePath.c_str());
+  return GetImpl(builder).LoadFromCompiled(fileContent.Begin(), fileContent.Count());
+}
+
 static void CollectQualifiers(std::vector<std::string>& qualifiersOut)
 {
   // Append the relevant qualifier for orientation
@@ -421,80 +480,83 @@ static void BuildQualifiedStyleName(
   }
 }
 
-static bool GetStyleNameForControl(Toolkit::Builder builder, Toolkit::Control control, std::string& styleName)
+StyleManager::ResolvedStyle& StyleManager::ResolveStyle(Toolkit::Control control)
 {
-  styleName = control.GetStyleName();
-
+  std::string styleName = control.GetStyleName();
   if(styleName.empty())
   {
     styleName = control.GetTypeName();
   }
 
-  // Apply the style after choosing the correct actual style (e.g. landscape or portrait)
+  if(mDefaultFontSize == -1 && mStyleMonitor.EnsureFontClientCreated())
+  {
+    mDefaultFontSize = mStyleMonitor.GetDefaultFontSize();
+
+    // The styles resolved before the default font size was known have no style for the font size.
+    ClearResolvedStyles();
+  }
+
+  ResolvedStyleMap::iterator iter = mResolvedStyles.find(styleName);
+  if(iter != mResolvedStyles.end())
+  {
+    return iter->second;
+  }
+
+  Builder& builder = GetImpl(mThemeBuilder);
+
+  ResolvedStyle resolvedStyle;
+  resolvedStyle.style         = NULL;
+  resolvedStyle.fontSizeStyle = NULL;
+
+  // Choose the correct actual style (e.g. landscape or portrait)
   std::vector<std::string> qualifiers;
   CollectQualifiers(qualifiers);
 
-  bool        found = 0;
   std::string qualifiedStyleName;
-  do
+  while(true)
   {
     qualifiedStyleName.clear();
     BuildQualifiedStyleName(styleName, qualifiers, qualifiedStyleName);
 
     // Break if style found or we have tried the root style name (qualifiers is empty)
-    if(GetImpl(builder).LookupStyleName(qualifiedStyleName))
-    {
-      found = true;
-      break;
-    }
-    if(qualifiers.size() == 0)
+    resolvedStyle.style = builder.FindStyle(qualifiedStyleName);
+    if(resolvedStyle.style || qualifiers.empty())
     {
       break;
     }
     // Remove the last qualifier in an attempt to find a style that is valid
     qualifiers.pop_back();
-  } while(!found);
-
-  if(found)
-  {
-    styleName = qualifiedStyleName;
-  }
-  return found;
-}
-
-void StyleManager::ApplyStyle(Toolkit::Builder builder, Toolkit::Control control)
-{
-  std::string styleName = control.GetStyleName();
-  if(GetStyleNameForControl(builder, control, styleName))
-  {
-    builder.ApplyStyle(styleName, control);
-  }
-
-  if(mDefaultFontSize == -1 && mStyleMonitor.EnsureFontClientCreated())
-  {
-    mDefaultFontSize = mStyleMonitor.GetDefaultFontSize();
   }
+  resolvedStyle.styleName = resolvedStyle.style ? qualifiedStyleName : styleName;
 
   if(mDefaultFontSize >= 0)
   {
-    // Apply the style for logical font size
     std::stringstream fontSizeQualifier;
-    fontSizeQualifier << styleName << FONT_SIZE_QUALIFIER << mDefaultFontSize;
-    builder.ApplyStyle(fontSizeQualifier.str(), control);
+    fontSizeQualifier << resolvedStyle.styleName << FONT_SIZE_QUALIFIER << mDefaultFontSize;
+    resolvedStyle.fontSizeStyle = builder.FindStyle(fontSizeQualifier.str());
   }
+
+  DALI_LOG_INFO(gLogFilter, Debug::Verbose, "ResolveStyle(%s) style:%s fontSizeStyle:%s\n", styleName.c_str(), resolvedStyle.style ? resolvedStyle.styleName.c_str() : "none", resolvedStyle.fontSizeStyle ? "found" : "none");
+
+  return mResolvedStyles.emplace(std::move(styleName), std::move(resolvedStyle)).first->second;
+}
+
+void StyleManager::ClearResolvedStyles()
+{
+  mResolvedStyles.clear();
 }
 
 const StylePtr StyleManager::GetRecordedStyle(Toolkit::Control control)
 {
   if(mThemeBuilder)
   {
-    std::string styleName = control.GetStyleName();
+    ResolvedStyle& resolvedStyle = ResolveStyle(control);
 
-    if(GetStyleNameForControl(mThemeBuilder, control, styleName))
+    if(resolvedStyle.style && !resolvedStyle.recordedStyle)
     {
-      const StylePtr style = GetImpl(mThemeBuilder).GetStyle(styleName);
-      return style;
+      resolvedStyle.recordedStyle = GetImpl(mThemeBuilder).GetStyle(resolvedStyle.style->GetName());
     }
+    return resolvedStyle.recordedStyle;
   }
   return StylePtr(NULL);
 }
@@ -528,6 +590,7 @@ void StyleManager::StyleMonitorChange(StyleMonitor styleMonitor, StyleChange::Ty
     case StyleChange::DEFAULT_FONT_SIZE_CHANGE:
     {
       mDefaultFontSize = styleMonitor.GetDefaultFontSize();
+      ClearResolvedStyles();
       break;
     }
 
@@ -25,6 +25,7 @@
 #include <dali/public-api/object/property-map.h>
 #include <dali/public-api/signals/connection-tracker.h>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/builder/builder.h>
@@ -36,6 +37,8 @@ namespace Dali
 {
 namespace Toolkit
 {
+class TreeNode;
+
 namespace Internal
 {
 class FeedbackStyle;
@@ -195,12 +198,45 @@ private:
   bool LoadJSON(Toolkit::Builder builder, const std::string& jsonFileName);
 
   /**
-   * @brief Apply a style to the control using the given builder
+   * @brief Load the compiled file of a JSON file into given builder, if it has been compiled
+   *
+   * The file is compiled by dali-theme-compiler. It is not used if it was not compiled from the content of the JSON file.
    *
-   * @param[in] builder The builder to apply the style from
-   * @param[in] control The control to apply the style to
+   * @param[in] builder The builder object to load the theme file
+   * @param[in] jsonFileName The name of the JSON file
+   * @param[in] jsonString The content of the JSON file, or empty if it could not be loaded
+   * @return Return true if the compiled file was loaded
+   */
+  bool LoadCompiledJSON(Toolkit::Builder builder, const std::string& jsonFileName, const std::string& jsonString);
+
+  /**
+   * @brief The styles of the theme for a style name, resolved with the current qualifiers and font size.
    */
-  void ApplyStyle(Toolkit::Builder builder, Toolkit::Control control);
+  struct ResolvedStyle
+  {
+    std::string     styleName;     ///< The qualified name of the style found, or the style name if none is found
+    const TreeNode* style;         ///< The node of the style in the theme, or NULL
+    StylePtr        recordedStyle; ///< The style recorded from the node, once it has been applied
+    const TreeNode* fontSizeStyle; ///< The node of the style for the default font size, or NULL
+    StylePtr        recordedFontSizeStyle;
+  };
+
+  /**
+   * @brief Resolves the theme styles of a control.
+   *
+   * The result is cached per style name (or type name if the control has no style name),
+   * until the theme, the qualifiers or the default font size change. The styles resolved before the default font size
+   * is known are resolved again once it is.
+   *
+   * @param[in] control The control to resolve the styles of
+   * @return The resolved styles. The theme builder must exist.
+   */
+  ResolvedStyle& ResolveStyle(Toolkit::Control control);
+
+  /**
+   * @brief Drops the resolved styles, e.g. when the theme builder is replaced.
+   */
+  void ClearResolvedStyles();
 
   /**
    * Search for a builder in the cache
@@ -240,6 +276,9 @@ private:
   // Map to store builders keyed by JSON file name
   typedef std::map<std::string, Toolkit::Builder> BuilderMap;
 
+  // Map to store resolved styles keyed by style name
+  typedef std::unordered_map<std::string, ResolvedStyle> ResolvedStyleMap;
+
   Toolkit::Builder mThemeBuilder; ///< Builder for all default theme properties
   StyleMonitor     mStyleMonitor; ///< Style monitor handle
 
@@ -251,7 +290,8 @@ private:
   Property::Map mThemeBuilderConstants; ///< Contants to give the theme builder
   Property::Map mStyleBuilderConstants; ///< Constants specific to building styles
 
-  BuilderMap mBuilderCache; ///< Cache of builders keyed by JSON file name
+  BuilderMap       mBuilderCache;   ///< Cache of builders keyed by JSON file name
+  ResolvedStyleMap mResolvedStyles; ///< Cache of the theme styles resolved for the controls
 
   Toolkit::Internal::FeedbackStyle* mFeedbackStyle; ///< Feedback style
 
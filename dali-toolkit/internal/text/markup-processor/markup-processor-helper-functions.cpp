@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -64,7 +64,7 @@ const char* END_HORIZONTAL_ALIGNMENT("end");
 
 } // namespace
 
-bool TokenComparison(const std::string& string1, const char* const stringBuffer2, Length length)
+bool TokenComparison(std::string_view string1, const char* const stringBuffer2, Length length)
 {
   const Length stringSize = string1.size();
   if(stringSize != length)
@@ -73,7 +73,7 @@ bool TokenComparison(const std::string& string1, const char* const stringBuffer2
     return false;
   }
 
-  const char* const stringBuffer1 = string1.c_str();
+  const char* const stringBuffer1 = string1.data();
 
   for(std::size_t index = 0; index < stringSize; ++index)
   {
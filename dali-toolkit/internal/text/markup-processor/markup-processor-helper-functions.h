@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_HELPER_FUNCTIONS_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <string>
+#include <string_view>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/text-definitions.h>
@@ -72,7 +73,7 @@ struct Tag
  *
  * @return @e true if both strings are equal.
  */
-bool TokenComparison(const std::string& string1, const char* const stringBuffer2, Length length);
+bool TokenComparison(std::string_view string1, const char* const stringBuffer2, Length length);
 
 /**
  * @brief Skips any unnecessary white space.
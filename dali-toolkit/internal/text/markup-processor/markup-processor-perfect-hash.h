@@ -0,0 +1,261 @@
+#ifndef DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_PERFECT_HASH_H
+#define DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_PERFECT_HASH_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Compile-time perfect hash tables for the html-ish tokens of the mark-up processor.
+ *
+ * The tables use the 'hash and displace' scheme: the hash of a key selects a bucket and the seed stored
+ * for that bucket displaces the hash into a slot. The seeds are searched at compile time so no two keys
+ * share a slot, therefore a lookup costs one hash and a single token comparison.
+ *
+ * @code
+ * constexpr std::array<std::string_view, 2u> KEYS = {"color", "font"};
+ * constexpr auto TABLE = PerfectHash::Build<2u, 8u, true>(KEYS);
+ * static_assert(TABLE.valid, "Perfect hash not found");
+ *
+ * const int index = TABLE.Find(buffer, length); // -1 if the token is not a key
+ * @endcode
+ */
+namespace PerfectHash
+{
+constexpr char FIRST_UPPER_CASE = 0x41; // ASCII value of the first upper case character (A).
+constexpr char LAST_UPPER_CASE  = 0x5b; // ASCII value of the one after the last upper case character (Z).
+constexpr char TO_LOWER_CASE    = 32;   // Value to add to a upper case character to transform it into a lower case.
+
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME        = 16777619u;
+constexpr uint32_t MAX_SEED         = 0xffffu;
+
+constexpr char ToLower(char character)
+{
+  return ((character < LAST_UPPER_CASE) && (character >= FIRST_UPPER_CASE)) ? static_cast<char>(character + TO_LOWER_CASE) : character;
+}
+
+/**
+ * @brief FNV-1a hash of the token.
+ *
+ * @tparam CASE_INSENSITIVE Whether the characters are transformed to lower case before hashing them.
+ * @param[in] buffer Pointer to the token.
+ * @param[in] length The length of the token.
+ *
+ * @return The hash of the token.
+ */
+template<bool CASE_INSENSITIVE>
+constexpr uint32_t Hash(const char* const buffer, std::size_t length)
+{
+  uint32_t hash = FNV_OFFSET_BASIS;
+  for(std::size_t index = 0u; index < length; ++index)
+  {
+    const char character = CASE_INSENSITIVE ? ToLower(buffer[index]) : buffer[index];
+    hash                 = (hash ^ static_cast<uint8_t>(character)) * FNV_PRIME;
+  }
+  return hash;
+}
+
+/**
+ * @brief Mixes the hash of a token with the seed of its bucket.
+ */
+constexpr uint32_t Displace(uint32_t hash, uint32_t seed)
+{
+  uint32_t value = hash ^ (seed * 0x9e3779b9u);
+  value ^= value >> 16;
+  value *= 0x85ebca6bu;
+  value ^= value >> 13;
+  value *= 0xc2b2ae35u;
+  value ^= value >> 16;
+  return value;
+}
+
+/**
+ * @brief Compares the key with the token.
+ *
+ * @pre @p key must be lower case if @p CASE_INSENSITIVE is true.
+ */
+template<bool CASE_INSENSITIVE>
+constexpr bool IsEqual(std::string_view key, const char* const buffer, std::size_t length)
+{
+  if(key.size() != length)
+  {
+    // Early return. Strings have different sizes.
+    return false;
+  }
+
+  for(std::size_t index = 0u; index < length; ++index)
+  {
+    if(key[index] != (CASE_INSENSITIVE ? ToLower(buffer[index]) : buffer[index]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief A perfect hash table mapping tokens to the index of the key in the array it was built from.
+ */
+template<std::size_t KEY_COUNT, std::size_t BUCKET_COUNT, std::size_t SLOT_COUNT, bool CASE_INSENSITIVE>
+struct Table
+{
+  static_assert(KEY_COUNT < SLOT_COUNT, "The number of slots must be bigger than the number of keys");
+  static_assert(KEY_COUNT < 0x7fffu, "Too many keys");
+
+  /**
+   * @brief Retrieves the index of the token.
+   *
+   * @param[in] buffer Pointer to the token.
+   * @param[in] length The length of the token.
+   *
+   * @return The index of the key equal to the token, -1 if there isn't any.
+   */
+  constexpr int Find(const char* const buffer, std::size_t length) const
+  {
+    const uint32_t hash  = Hash<CASE_INSENSITIVE>(buffer, length);
+    const int      index = slots[Displace(hash, seeds[hash % BUCKET_COUNT]) % SLOT_COUNT];
+    return ((index >= 0) && IsEqual<CASE_INSENSITIVE>(keys[index], buffer, length)) ? index : -1;
+  }
+
+  std::array<std::string_view, KEY_COUNT> keys{};  ///< The keys, in the order given to Build().
+  std::array<uint16_t, BUCKET_COUNT>      seeds{}; ///< The seed of each bucket.
+  std::array<int16_t, SLOT_COUNT>         slots{}; ///< The index of the key stored in each slot, -1 if empty.
+  bool                                    valid{false}; ///< Whether a perfect hash was found for all the keys.
+};
+
+/**
+ * @brief Builds a perfect hash table for the given keys.
+ *
+ * Meant to be evaluated at compile time. The result must be checked with a static_assert on Table::valid.
+ *
+ * @tparam BUCKET_COUNT The number of buckets. Around a half or a quarter of the number of keys.
+ * @tparam SLOT_COUNT The number of slots. Around twice the number of keys keeps the seed search short.
+ * @tparam CASE_INSENSITIVE Whether the tokens are compared ignoring the case. The keys must be lower case.
+ * @param[in] keys The keys. They must be unique.
+ *
+ * @return The perfect hash table.
+ */
+template<std::size_t BUCKET_COUNT, std::size_t SLOT_COUNT, bool CASE_INSENSITIVE, std::size_t KEY_COUNT>
+constexpr Table<KEY_COUNT, BUCKET_COUNT, SLOT_COUNT, CASE_INSENSITIVE> Build(const std::array<std::string_view, KEY_COUNT>& keys)
+{
+  Table<KEY_COUNT, BUCKET_COUNT, SLOT_COUNT, CASE_INSENSITIVE> table{};
+  table.keys = keys;
+  for(std::size_t slot = 0u; slot < SLOT_COUNT; ++slot)
+  {
+    table.slots[slot] = -1;
+  }
+
+  // Sort the keys by bucket.
+  std::array<uint32_t, KEY_COUNT>        hashes{};
+  std::array<std::size_t, BUCKET_COUNT + 1u> bucketBegin{};
+  for(std::size_t index = 0u; index < KEY_COUNT; ++index)
+  {
+    hashes[index] = Hash<CASE_INSENSITIVE>(keys[index].data(), keys[index].size());
+    ++bucketBegin[hashes[index] % BUCKET_COUNT + 1u];
+  }
+
+  std::size_t maxBucketSize = 0u;
+  for(std::size_t bucket = 0u; bucket < BUCKET_COUNT; ++bucket)
+  {
+    maxBucketSize = (bucketBegin[bucket + 1u] > maxBucketSize) ? bucketBegin[bucket + 1u] : maxBucketSize;
+    bucketBegin[bucket + 1u] += bucketBegin[bucket];
+  }
+
+  std::array<std::size_t, KEY_COUNT>    sortedKeys{};
+  std::array<std::size_t, BUCKET_COUNT> bucketEnd{};
+  for(std::size_t bucket = 0u; bucket < BUCKET_COUNT; ++bucket)
+  {
+    bucketEnd[bucket] = bucketBegin[bucket];
+  }
+  for(std::size_t index = 0u; index < KEY_COUNT; ++index)
+  {
+    sortedKeys[bucketEnd[hashes[index] % BUCKET_COUNT]++] = index;
+  }
+
+  // Place the biggest buckets first, they are the hardest to fit.
+  for(std::size_t size = maxBucketSize; size > 0u; --size)
+  {
+    for(std::size_t bucket = 0u; bucket < BUCKET_COUNT; ++bucket)
+    {
+      if(bucketEnd[bucket] - bucketBegin[bucket] != size)
+      {
+        continue;
+      }
+
+      bool placed = false;
+      for(uint32_t seed = 0u; !placed && (seed <= MAX_SEED); ++seed)
+      {
+        placed               = true;
+        std::size_t position = bucketBegin[bucket];
+        for(; position < bucketEnd[bucket]; ++position)
+        {
+          const std::size_t index = sortedKeys[position];
+          const std::size_t slot  = Displace(hashes[index], seed) % SLOT_COUNT;
+          if(table.slots[slot] >= 0)
+          {
+            placed = false;
+            break;
+          }
+          table.slots[slot] = static_cast<int16_t>(index);
+        }
+
+        if(placed)
+        {
+          table.seeds[bucket] = static_cast<uint16_t>(seed);
+        }
+        else
+        {
+          // Roll back the keys of this bucket already placed with this seed.
+          for(std::size_t rollback = bucketBegin[bucket]; rollback < position; ++rollback)
+          {
+            table.slots[Displace(hashes[sortedKeys[rollback]], seed) % SLOT_COUNT] = -1;
+          }
+        }
+      }
+
+      if(!placed)
+      {
+        return table;
+      }
+    }
+  }
+
+  table.valid = true;
+  return table;
+}
+
+} // namespace PerfectHash
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_PERFECT_HASH_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
+#include <array>
+#include <string_view>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/color-run.h>
@@ -27,6 +29,7 @@
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-character-spacing.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-font.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-helper-functions.h>
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-perfect-hash.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-strikethrough.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-underline.h>
 #include <dali-toolkit/internal/text/markup-tags-and-attributes.h>
@@ -37,6 +40,57 @@ namespace Toolkit
 {
 namespace Text
 {
+namespace
+{
+/**
+ * @brief The attributes of the span tag.
+ *
+ * @note The order must match the SPAN_ATTRIBUTES array.
+ */
+enum class SpanAttribute
+{
+  TEXT_COLOR,
+  BACKGROUND_COLOR,
+  FONT_FAMILY,
+  FONT_SIZE,
+  FONT_WEIGHT,
+  FONT_WIDTH,
+  FONT_SLANT,
+  UNDERLINE_COLOR,
+  UNDERLINE_HEIGHT,
+  UNDERLINE_TYPE,
+  UNDERLINE_DASH_GAP,
+  UNDERLINE_DASH_WIDTH,
+  STRIKETHROUGH_COLOR,
+  STRIKETHROUGH_HEIGHT,
+  CHARACTER_SPACING_VALUE,
+  COUNT
+};
+
+constexpr std::array<std::string_view, static_cast<std::size_t>(SpanAttribute::COUNT)> SPAN_ATTRIBUTES =
+  {
+    MARKUP::SPAN_ATTRIBUTES::TEXT_COLOR,
+    MARKUP::SPAN_ATTRIBUTES::BACKGROUND_COLOR,
+    MARKUP::SPAN_ATTRIBUTES::FONT_FAMILY,
+    MARKUP::SPAN_ATTRIBUTES::FONT_SIZE,
+    MARKUP::SPAN_ATTRIBUTES::FONT_WEIGHT,
+    MARKUP::SPAN_ATTRIBUTES::FONT_WIDTH,
+    MARKUP::SPAN_ATTRIBUTES::FONT_SLANT,
+    MARKUP::SPAN_ATTRIBUTES::UNDERLINE_COLOR,
+    MARKUP::SPAN_ATTRIBUTES::UNDERLINE_HEIGHT,
+    MARKUP::SPAN_ATTRIBUTES::UNDERLINE_TYPE,
+    MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_GAP,
+    MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_WIDTH,
+    MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_COLOR,
+    MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_HEIGHT,
+    MARKUP::SPAN_ATTRIBUTES::CHARACTER_SPACING_VALUE};
+
+// Attribute names are case insensitive.
+constexpr auto SPAN_ATTRIBUTE_HASH_TABLE = PerfectHash::Build<8u, 32u, true>(SPAN_ATTRIBUTES);
+static_assert(SPAN_ATTRIBUTE_HASH_TABLE.valid, "Perfect hash not found for the span attributes");
+
+} // namespace
+
 void ProcessSpanTag(const Tag&                    tag,
                     ColorRun&                     colorRun,
                     FontDescriptionRun&           fontRun,
@@ -58,80 +112,102 @@ void ProcessSpanTag(const Tag&                    tag,
   {
     const Attribute& attribute(*it);
 
-    if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::TEXT_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isColorDefined = true;
-      ProcessColor(attribute, colorRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::BACKGROUND_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isBackgroundColorDefined = true;
-      ProcessColor(attribute, backgroundColorRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_FAMILY, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontFamily(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_SIZE, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontSize(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_WEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontWeight(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_WIDTH, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontWidth(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_SLANT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontSlant(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessColorAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_HEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessHeightAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_TYPE, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessTypeAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_GAP, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessDashGapAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_WIDTH, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessDashWidthAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isStrikethroughDefined = true;
-      ProcessColorAttribute(attribute, strikethroughRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_HEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isStrikethroughDefined = true;
-      ProcessHeightAttribute(attribute, strikethroughRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::CHARACTER_SPACING_VALUE, attribute.nameBuffer, attribute.nameLength))
+    switch(static_cast<SpanAttribute>(SPAN_ATTRIBUTE_HASH_TABLE.Find(attribute.nameBuffer, attribute.nameLength)))
     {
-      isCharacterSpacingDefined = true;
-      ProcessValueAttribute(attribute, characterSpacingCharacterRun);
+      case SpanAttribute::TEXT_COLOR:
+      {
+        isColorDefined = true;
+        ProcessColor(attribute, colorRun);
+        break;
+      }
+      case SpanAttribute::BACKGROUND_COLOR:
+      {
+        isBackgroundColorDefined = true;
+        ProcessColor(attribute, backgroundColorRun);
+        break;
+      }
+      case SpanAttribute::FONT_FAMILY:
+      {
+        isFontDefined = true;
+        ProcessFontFamily(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_SIZE:
+      {
+        isFontDefined = true;
+        ProcessFontSize(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_WEIGHT:
+      {
+        isFontDefined = true;
+        ProcessFontWeight(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_WIDTH:
+      {
+        isFontDefined = true;
+        ProcessFontWidth(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_SLANT:
+      {
+        isFontDefined = true;
+        ProcessFontSlant(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_COLOR:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessColorAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_HEIGHT:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessHeightAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_TYPE:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessTypeAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_DASH_GAP:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessDashGapAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_DASH_WIDTH:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessDashWidthAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::STRIKETHROUGH_COLOR:
+      {
+        isStrikethroughDefined = true;
+        ProcessColorAttribute(attribute, strikethroughRun);
+        break;
+      }
+      case SpanAttribute::STRIKETHROUGH_HEIGHT:
+      {
+        isStrikethroughDefined = true;
+        ProcessHeightAttribute(attribute, strikethroughRun);
+        break;
+      }
+      case SpanAttribute::CHARACTER_SPACING_VALUE:
+      {
+        isCharacterSpacingDefined = true;
+        ProcessValueAttribute(attribute, characterSpacingCharacterRun);
+        break;
+      }
+      default:
+      {
+        break;
+      }
     }
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,8 +20,10 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
+#include <array>
 #include <climits> // for ULONG_MAX
 #include <functional>
+#include <string_view>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/character-set-conversion.h>
@@ -33,6 +35,7 @@
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-font.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-helper-functions.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-paragraph.h>
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-perfect-hash.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-span.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-strikethrough.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-underline.h>
@@ -75,6 +78,53 @@ const unsigned int DEFAULT_VECTOR_SIZE   = 16u; ///< Default size of run vectors
 Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_MARKUP_PROCESSOR");
 #endif
 
+/**
+ * @brief The tags supported by the mark-up processor.
+ *
+ * @note The order must match the MARKUP_TAGS array.
+ */
+enum class MarkupTag
+{
+  COLOR,
+  ITALIC,
+  UNDERLINE,
+  BOLD,
+  FONT,
+  ANCHOR,
+  SHADOW,
+  GLOW,
+  OUTLINE,
+  EMBEDDED_ITEM,
+  BACKGROUND,
+  SPAN,
+  STRIKETHROUGH,
+  PARAGRAPH,
+  CHARACTER_SPACING,
+  COUNT
+};
+
+constexpr std::array<std::string_view, static_cast<std::size_t>(MarkupTag::COUNT)> MARKUP_TAGS =
+  {
+    MARKUP::TAG::COLOR,
+    MARKUP::TAG::ITALIC,
+    MARKUP::TAG::UNDERLINE,
+    MARKUP::TAG::BOLD,
+    MARKUP::TAG::FONT,
+    MARKUP::TAG::ANCHOR,
+    MARKUP::TAG::SHADOW,
+    MARKUP::TAG::GLOW,
+    MARKUP::TAG::OUTLINE,
+    MARKUP::TAG::EMBEDDED_ITEM,
+    MARKUP::TAG::BACKGROUND,
+    MARKUP::TAG::SPAN,
+    MARKUP::TAG::STRIKETHROUGH,
+    MARKUP::TAG::PARAGRAPH,
+    MARKUP::TAG::CHARACTER_SPACING};
+
+// Tags are case insensitive.
+constexpr auto MARKUP_TAG_HASH_TABLE = PerfectHash::Build<8u, 32u, true>(MARKUP_TAGS);
+static_assert(MARKUP_TAG_HASH_TABLE.valid, "Perfect hash not found for the mark-up tags");
+
 typedef VectorBase::SizeType RunIndex;
 
 /**
@@ -1202,109 +1252,132 @@ void ProcessMarkupString(const std::string& markupString, MarkupPropertyData& ma
              markupStringEndBuffer,
              tag))
     {
-      if(TokenComparison(MARKUP::TAG::COLOR, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<ColorRun>(
-          markupProcessData.colorRuns, styleStack, tag, characterIndex, colorRunIndex, colorTagReference, [](const Tag& tag, ColorRun& run) { ProcessColorTag(tag, run); });
-      } // <color></color>
-      else if(TokenComparison(MARKUP::TAG::ITALIC, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<FontDescriptionRun>(
-          markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, iTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
-            fontRun.slant        = TextAbstraction::FontSlant::ITALIC;
-            fontRun.slantDefined = true;
-          });
-      } // <i></i>
-      else if(TokenComparison(MARKUP::TAG::UNDERLINE, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<UnderlinedCharacterRun>(
-          markupProcessData.underlinedCharacterRuns, styleStack, tag, characterIndex, underlinedCharacterRunIndex, uTagReference, [](const Tag& tag, UnderlinedCharacterRun& run) { ProcessUnderlineTag(tag, run); });
-      } // <u></u>
-      else if(TokenComparison(MARKUP::TAG::BOLD, tag.buffer, tag.length))
+      switch(static_cast<MarkupTag>(MARKUP_TAG_HASH_TABLE.Find(tag.buffer, tag.length)))
       {
-        ProcessTagForRun<FontDescriptionRun>(
-          markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, bTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
-            fontRun.weight        = TextAbstraction::FontWeight::BOLD;
-            fontRun.weightDefined = true;
-          });
-      } // <b></b>
-      else if(TokenComparison(MARKUP::TAG::FONT, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<FontDescriptionRun>(
-          markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, fontTagReference, [](const Tag& tag, FontDescriptionRun& fontRun) { ProcessFontTag(tag, fontRun); });
-      } // <font></font>
-      else if(TokenComparison(MARKUP::TAG::ANCHOR, tag.buffer, tag.length))
-      {
-        ProcessAnchorForRun(markupProcessData,
-                            markupPropertyData,
-                            tag,
-                            anchorStack,
+        case MarkupTag::COLOR: // <color></color>
+        {
+          ProcessTagForRun<ColorRun>(
+            markupProcessData.colorRuns, styleStack, tag, characterIndex, colorRunIndex, colorTagReference, [](const Tag& tag, ColorRun& run) { ProcessColorTag(tag, run); });
+          break;
+        }
+        case MarkupTag::ITALIC: // <i></i>
+        {
+          ProcessTagForRun<FontDescriptionRun>(
+            markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, iTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
+              fontRun.slant        = TextAbstraction::FontSlant::ITALIC;
+              fontRun.slantDefined = true;
+            });
+          break;
+        }
+        case MarkupTag::UNDERLINE: // <u></u>
+        {
+          ProcessTagForRun<UnderlinedCharacterRun>(
+            markupProcessData.underlinedCharacterRuns, styleStack, tag, characterIndex, underlinedCharacterRunIndex, uTagReference, [](const Tag& tag, UnderlinedCharacterRun& run) { ProcessUnderlineTag(tag, run); });
+          break;
+        }
+        case MarkupTag::BOLD: // <b></b>
+        {
+          ProcessTagForRun<FontDescriptionRun>(
+            markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, bTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
+              fontRun.weight        = TextAbstraction::FontWeight::BOLD;
+              fontRun.weightDefined = true;
+            });
+          break;
+        }
+        case MarkupTag::FONT: // <font></font>
+        {
+          ProcessTagForRun<FontDescriptionRun>(
+            markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, fontTagReference, [](const Tag& tag, FontDescriptionRun& fontRun) { ProcessFontTag(tag, fontRun); });
+          break;
+        }
+        case MarkupTag::ANCHOR: // <a href=https://www.tizen.org>tizen</a>
+        {
+          ProcessAnchorForRun(markupProcessData,
+                              markupPropertyData,
+                              tag,
+                              anchorStack,
+                              markupProcessData.colorRuns,
+                              markupProcessData.underlinedCharacterRuns,
+                              colorRunIndex,
+                              underlinedCharacterRunIndex,
+                              characterIndex,
+                              aTagReference);
+          break;
+        }
+        case MarkupTag::SHADOW: // <shadow></shadow>
+        {
+          // TODO: If !tag.isEndTag, then create a new shadow run.
+          //       else Pop the top of the stack and set the number of characters of the run.
+          break;
+        }
+        case MarkupTag::GLOW: // <glow></glow>
+        {
+          // TODO: If !tag.isEndTag, then create a new glow run.
+          //       else Pop the top of the stack and set the number of characters of the run.
+          break;
+        }
+        case MarkupTag::OUTLINE: // <outline></outline>
+        {
+          // TODO: If !tag.isEndTag, then create a new outline run.
+          //       else Pop the top of the stack and set the number of characters of the run.
+          break;
+        }
+        case MarkupTag::EMBEDDED_ITEM: // <item/>
+        {
+          ProcessItemTag(markupProcessData, tag, characterIndex);
+          break;
+        }
+        case MarkupTag::BACKGROUND: // <background></background>
+        {
+          ProcessTagForRun<ColorRun>(
+            markupProcessData.backgroundColorRuns, styleStack, tag, characterIndex, backgroundRunIndex, backgroundTagReference, [](const Tag& tag, ColorRun& run) { ProcessBackground(tag, run); });
+          break;
+        }
+        case MarkupTag::SPAN: // <span></span>
+        {
+          ProcessSpanForRun(tag,
+                            spanStack,
                             markupProcessData.colorRuns,
+                            markupProcessData.fontRuns,
                             markupProcessData.underlinedCharacterRuns,
+                            markupProcessData.backgroundColorRuns,
+                            markupProcessData.strikethroughCharacterRuns,
+                            markupProcessData.characterSpacingCharacterRuns,
                             colorRunIndex,
+                            fontRunIndex,
                             underlinedCharacterRunIndex,
+                            backgroundRunIndex,
+                            strikethroughCharacterRunIndex,
+                            characterSpacingCharacterRunIndex,
                             characterIndex,
-                            aTagReference);
-      } // <a href=https://www.tizen.org>tizen</a>
-      else if(TokenComparison(MARKUP::TAG::SHADOW, tag.buffer, tag.length))
-      {
-        // TODO: If !tag.isEndTag, then create a new shadow run.
-        //       else Pop the top of the stack and set the number of characters of the run.
-      } // <shadow></shadow>
-      else if(TokenComparison(MARKUP::TAG::GLOW, tag.buffer, tag.length))
-      {
-        // TODO: If !tag.isEndTag, then create a new glow run.
-        //       else Pop the top of the stack and set the number of characters of the run.
-      } // <glow></glow>
-      else if(TokenComparison(MARKUP::TAG::OUTLINE, tag.buffer, tag.length))
-      {
-        // TODO: If !tag.isEndTag, then create a new outline run.
-        //       else Pop the top of the stack and set the number of characters of the run.
-      } // <outline></outline>
-      else if(TokenComparison(MARKUP::TAG::EMBEDDED_ITEM, tag.buffer, tag.length))
-      {
-        ProcessItemTag(markupProcessData, tag, characterIndex);
-      }
-      else if(TokenComparison(MARKUP::TAG::BACKGROUND, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<ColorRun>(
-          markupProcessData.backgroundColorRuns, styleStack, tag, characterIndex, backgroundRunIndex, backgroundTagReference, [](const Tag& tag, ColorRun& run) { ProcessBackground(tag, run); });
-      }
-      else if(TokenComparison(MARKUP::TAG::SPAN, tag.buffer, tag.length))
-      {
-        ProcessSpanForRun(tag,
-                          spanStack,
-                          markupProcessData.colorRuns,
-                          markupProcessData.fontRuns,
-                          markupProcessData.underlinedCharacterRuns,
-                          markupProcessData.backgroundColorRuns,
-                          markupProcessData.strikethroughCharacterRuns,
-                          markupProcessData.characterSpacingCharacterRuns,
-                          colorRunIndex,
-                          fontRunIndex,
-                          underlinedCharacterRunIndex,
-                          backgroundRunIndex,
-                          strikethroughCharacterRunIndex,
-                          characterSpacingCharacterRunIndex,
-                          characterIndex,
-                          spanTagReference);
+                            spanTagReference);
+          break;
+        }
+        case MarkupTag::STRIKETHROUGH: // <s></s>
+        {
+          ProcessTagForRun<StrikethroughCharacterRun>(
+            markupProcessData.strikethroughCharacterRuns, styleStack, tag, characterIndex, strikethroughCharacterRunIndex, sTagReference, [](const Tag& tag, StrikethroughCharacterRun& run) { ProcessStrikethroughTag(tag, run); });
+          break;
+        }
+        case MarkupTag::PARAGRAPH: // <p></p>
+        {
+          ProcessParagraphTag(markupProcessData, tag, (markupStringBuffer == markupStringEndBuffer), characterIndex);
+          ProcessTagForRun<BoundedParagraphRun>(
+            markupProcessData.boundedParagraphRuns, styleStack, tag, characterIndex, boundedParagraphRunIndex, pTagReference, [](const Tag& tag, BoundedParagraphRun& run) { ProcessAttributesOfParagraphTag(tag, run); });
+          break;
+        }
+        case MarkupTag::CHARACTER_SPACING: // <char-spacing></char-spacing>
+        {
+          ProcessTagForRun<CharacterSpacingCharacterRun>(
+            markupProcessData.characterSpacingCharacterRuns, styleStack, tag, characterIndex, characterSpacingCharacterRunIndex, characterSpacingTagReference, [](const Tag& tag, CharacterSpacingCharacterRun& run) { ProcessCharacterSpacingTag(tag, run); });
+          break;
+        }
+        default:
+        {
+          // Unknown tag, ignore it.
+          break;
+        }
       }
-      else if(TokenComparison(MARKUP::TAG::STRIKETHROUGH, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<StrikethroughCharacterRun>(
-          markupProcessData.strikethroughCharacterRuns, styleStack, tag, characterIndex, strikethroughCharacterRunIndex, sTagReference, [](const Tag& tag, StrikethroughCharacterRun& run) { ProcessStrikethroughTag(tag, run); });
-      } // <s></s>
-      else if(TokenComparison(MARKUP::TAG::PARAGRAPH, tag.buffer, tag.length))
-      {
-        ProcessParagraphTag(markupProcessData, tag, (markupStringBuffer == markupStringEndBuffer), characterIndex);
-        ProcessTagForRun<BoundedParagraphRun>(
-          markupProcessData.boundedParagraphRuns, styleStack, tag, characterIndex, boundedParagraphRunIndex, pTagReference, [](const Tag& tag, BoundedParagraphRun& run) { ProcessAttributesOfParagraphTag(tag, run); });
-      } // <p></p>
-      else if(TokenComparison(MARKUP::TAG::CHARACTER_SPACING, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<CharacterSpacingCharacterRun>(
-          markupProcessData.characterSpacingCharacterRuns, styleStack, tag, characterIndex, characterSpacingCharacterRunIndex, characterSpacingTagReference, [](const Tag& tag, CharacterSpacingCharacterRun& run) { ProcessCharacterSpacingTag(tag, run); });
-      } // <char-spacing></char-spacing>
     }   // end if( IsTag() )
     else if(markupStringBuffer < markupStringEndBuffer)
     {
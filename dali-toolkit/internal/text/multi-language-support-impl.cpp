@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,11 +19,14 @@
 #include <dali-toolkit/internal/text/multi-language-support-impl.h>
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/devel-api/common/singleton-service.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/trace.h>
+#include <cstdlib>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/emoji-helper.h>
@@ -42,6 +45,48 @@ Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_MULT
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_FONT_PERFORMANCE_MARKER, false);
 
 const Dali::Toolkit::Text::Character UTF32_A = 0x0041;
+
+constexpr uint32_t MAX_NUMBER_OF_FALLBACK_FONT_BLOCKS = 512u;    ///< 128 code points each.
+constexpr uint32_t MAX_NUMBER_OF_FALLBACK_FONTS       = 0xffffu; ///< The font index of a block is 16 bits.
+
+constexpr auto DALI_TEXT_FALLBACK_FONT_CACHE_ENV = "DALI_TEXT_FALLBACK_FONT_CACHE"; ///< The file where the fall-back fonts are saved.
+constexpr auto LANG_ENV                          = "LANG";
+
+constexpr auto     FALLBACK_FONT_CACHE_SIGNATURE = "DALI_TEXT_FALLBACK_FONTS";
+constexpr uint32_t FALLBACK_FONT_CACHE_VERSION   = 2u;
+constexpr char     FALLBACK_FONT_CACHE_FONT      = 'F';
+constexpr char     FALLBACK_FONT_CACHE_BLOCK     = 'B';
+constexpr char     FIELD_SEPARATOR               = '\t';
+
+/**
+ * @brief Splits a line of the fall-back font cache file in fields.
+ */
+std::vector<std::string> SplitFields(const std::string& line)
+{
+  std::vector<std::string> fields;
+
+  std::size_t begin = 0u;
+  for(std::size_t end = line.find(FIELD_SEPARATOR); end != std::string::npos; end = line.find(FIELD_SEPARATOR, begin))
+  {
+    fields.push_back(line.substr(begin, end - begin));
+    begin = end + 1u;
+  }
+  fields.push_back(line.substr(begin));
+
+  return fields;
+}
+
+/**
+ * @brief Converts a field of the fall-back font cache file to a number.
+ *
+ * @return @e false if the field is not a number.
+ */
+bool ToNumber(const std::string& field, uint32_t& number)
+{
+  char* end = nullptr;
+  number    = static_cast<uint32_t>(std::strtoul(field.c_str(), &end, 10));
+  return !field.empty() && (*end == '\0');
+}
 } // namespace
 
 namespace Text
@@ -63,7 +108,8 @@ void CheckFontSupportsCharacter(
   const FontId& cachedDefaultFontId,
   const TextAbstraction::FontDescription& currentFontDescription,
   const TextAbstraction::PointSize26Dot6& currentFontPointSize,
-  DefaultFonts**& defaultFontPerScriptCacheBuffer)
+  DefaultFonts**& defaultFontPerScriptCacheBuffer,
+  FallbackFonts& fallbackFonts)
 {
   // Need to check if the given font supports the current character.
   if(!isValidFont) // (1)
@@ -142,11 +188,24 @@ void CheckFontSupportsCharacter(
 
           DefaultFonts* defaultFontsPerScript = NULL;
 
-          // Find a fallback-font.
-          fontId = fontClient.FindFallbackFont(character,
-                                               currentFontDescription,
-                                               currentFontPointSize,
-                                               false);
+          // Find a fallback-font. Check first the fallback-fonts found for previous characters.
+          fontId = fallbackFonts.FindFont(fontClient,
+                                          character,
+                                          currentFontDescription,
+                                          currentFontPointSize);
+
+          if(0u == fontId)
+          {
+            fontId = fontClient.FindFallbackFont(character,
+                                                 currentFontDescription,
+                                                 currentFontPointSize,
+                                                 false);
+
+            if(0u != fontId)
+            {
+              fallbackFonts.Cache(fontClient, character, script, currentFontDescription, currentFontPointSize, fontId);
+            }
+          }
 
           if(0u == fontId)
           {
@@ -240,9 +299,338 @@ void DefaultFonts::Cache(const TextAbstraction::FontDescription& description, Fo
   return;
 }
 
+namespace
+{
+FallbackFonts::BlockKey MakeBlockKey(const TextAbstraction::FontDescription& description, PointSize26Dot6 size, Character character)
+{
+  return FallbackFonts::BlockKey{description.family, description.width, description.weight, description.slant, size, character / FallbackFonts::BLOCK_SIZE};
+}
+
+/**
+ * @brief Retrieves the locale the fall-back fonts are saved with.
+ *
+ * @param[in] locale The locale set by the locale changed signal. Empty if it hasn't changed since the application started.
+ */
+bool IsLocaleDependentScript(Script script)
+{
+  // The fall-back font of the CJK ideographs depends on the language.
+  return TextAbstraction::CJK == script;
+}
+
+std::string GetFallbackFontCacheLocale(const std::string& locale)
+{
+  if(locale.empty())
+  {
+    const char* const systemLocale = EnvironmentVariable::GetEnvironmentVariable(LANG_ENV);
+    return systemLocale ? std::string(systemLocale) : std::string();
+  }
+  return locale;
+}
+} // unnamed namespace
+
+bool FallbackFonts::BlockKey::operator==(const BlockKey& rhs) const
+{
+  return (blockIndex == rhs.blockIndex) &&
+         (pointSize == rhs.pointSize) &&
+         (weight == rhs.weight) &&
+         (width == rhs.width) &&
+         (slant == rhs.slant) &&
+         (family == rhs.family);
+}
+
+std::size_t FallbackFonts::BlockKeyHash::operator()(const BlockKey& key) const
+{
+  std::size_t hash = std::hash<std::string>()(key.family);
+  for(const std::size_t value : {static_cast<std::size_t>(key.width),
+                                 static_cast<std::size_t>(key.weight),
+                                 static_cast<std::size_t>(key.slant),
+                                 static_cast<std::size_t>(key.pointSize),
+                                 static_cast<std::size_t>(key.blockIndex)})
+  {
+    hash ^= value + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+FontId FallbackFonts::FindFont(TextAbstraction::FontClient&            fontClient,
+                               Character                               character,
+                               const TextAbstraction::FontDescription& description,
+                               PointSize26Dot6                         size)
+{
+  const auto blockIt = mBlocks.find(MakeBlockKey(description, size, character));
+  if(blockIt == mBlocks.end())
+  {
+    ++mNumberOfMisses;
+    return 0u;
+  }
+
+  // Keep the block as the most recently used one.
+  Block& block = blockIt->second;
+  mLruBlocks.splice(mLruBlocks.begin(), mLruBlocks, block.lruIterator);
+
+  const uint16_t fontIndex = block.fonts[character % BLOCK_SIZE];
+  if(0u == fontIndex)
+  {
+    ++mNumberOfMisses;
+    return 0u;
+  }
+
+  FontItem& item = mFonts[fontIndex - 1u];
+  if(0u == item.fontId)
+  {
+    // The font has been loaded from a file. Create it now.
+    item.fontId = fontClient.GetFontId(item.description, item.pointSize);
+  }
+
+  // Check the font still supports the character. i.e. the system fonts may have changed since the font was cached.
+  if((0u != item.fontId) && fontClient.IsCharacterSupportedByFont(item.fontId, character))
+  {
+    ++mNumberOfHits;
+    return item.fontId;
+  }
+
+  ++mNumberOfMisses;
+  return 0u;
+}
+
+void FallbackFonts::Cache(TextAbstraction::FontClient&            fontClient,
+                          Character                               character,
+                          Script                                  script,
+                          const TextAbstraction::FontDescription& description,
+                          PointSize26Dot6                         size,
+                          FontId                                  fontId)
+{
+  BlockKey key     = MakeBlockKey(description, size, character);
+  auto     blockIt = mBlocks.find(key);
+  Block*   block   = nullptr;
+  if(blockIt == mBlocks.end())
+  {
+    Block newBlock;
+    newBlock.fonts.fill(0u);
+    newBlock.isLocaleDependent = false;
+    block                      = &AddBlock(std::move(key), newBlock);
+  }
+  else
+  {
+    block = &blockIt->second;
+  }
+
+  // The fall-back font is created with the requested point size, so the same font id may be cached for different sizes.
+  std::size_t fontIndex = 0u;
+  for(const std::size_t numberOfFonts = mFonts.size(); fontIndex < numberOfFonts; ++fontIndex)
+  {
+    if((fontId == mFonts[fontIndex].fontId) && (size == mFonts[fontIndex].pointSize))
+    {
+      break;
+    }
+  }
+
+  if(fontIndex == mFonts.size())
+  {
+    if(mFonts.size() >= MAX_NUMBER_OF_FALLBACK_FONTS)
+    {
+      return;
+    }
+
+    FontItem item;
+    fontClient.GetDescription(fontId, item.description);
+    item.description.path.clear(); // The font is created again from its description.
+    item.pointSize = size;
+    item.fontId    = fontId;
+    mFonts.push_back(item);
+  }
+
+  block->fonts[character % BLOCK_SIZE] = static_cast<uint16_t>(fontIndex + 1u);
+  block->isLocaleDependent             = block->isLocaleDependent || IsLocaleDependentScript(script);
+  mModified                            = true;
+}
+
+FallbackFonts::Block& FallbackFonts::AddBlock(BlockKey key, Block block)
+{
+  if(mBlocks.size() >= MAX_NUMBER_OF_FALLBACK_FONT_BLOCKS)
+  {
+    // Remove the least recently used block.
+    auto blockIt = mBlocks.find(mLruBlocks.back());
+    if(blockIt != mBlocks.end())
+    {
+      mBlocks.erase(blockIt);
+    }
+    mLruBlocks.pop_back();
+  }
+
+  mLruBlocks.push_front(key);
+  block.lruIterator = mLruBlocks.begin();
+
+  auto inserted = mBlocks.emplace(std::move(key), block);
+  if(!inserted.second)
+  {
+    // The block was already added, i.e. a file lists it twice. Keep the first one.
+    mLruBlocks.pop_front();
+  }
+  return inserted.first->second;
+}
+
+void FallbackFonts::ClearLocaleDependentFonts()
+{
+  for(auto it = mBlocks.begin(); it != mBlocks.end();)
+  {
+    if(it->second.isLocaleDependent)
+    {
+      mLruBlocks.erase(it->second.lruIterator);
+      it        = mBlocks.erase(it);
+      mModified = true;
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void FallbackFonts::Clear()
+{
+  mBlocks.clear();
+  mLruBlocks.clear();
+  mFonts.clear();
+  mModified = true;
+}
+
+bool FallbackFonts::Load(const std::string& path, const std::string& locale)
+{
+  Clear();
+
+  Dali::FileStream fileStream(path, FileStream::READ | FileStream::TEXT);
+  std::iostream&   stream = fileStream.GetStream();
+
+  std::string line;
+  if(!std::getline(stream, line))
+  {
+    return false;
+  }
+
+  // Signature, version and locale.
+  std::vector<std::string> fields  = SplitFields(line);
+  uint32_t                 version = 0u;
+  if((fields.size() != 3u) || (fields[0u] != FALLBACK_FONT_CACHE_SIGNATURE) || !ToNumber(fields[1u], version) || (version != FALLBACK_FONT_CACHE_VERSION))
+  {
+    DALI_LOG_ERROR("Invalid fall-back font cache file : %s\n", path.c_str());
+    return false;
+  }
+  const bool isSameLocale = (fields[2u] == locale);
+
+  while(std::getline(stream, line))
+  {
+    fields = SplitFields(line);
+
+    // Both the font and the block start with a font description and a size.
+    uint32_t width = 0u, weight = 0u, slant = 0u, pointSize = 0u;
+    bool     isValid = (fields.size() >= 6u) && (fields[0u].size() == 1u) &&
+                   ToNumber(fields[2u], width) && ToNumber(fields[3u], weight) && ToNumber(fields[4u], slant) && ToNumber(fields[5u], pointSize);
+
+    if(isValid && (FALLBACK_FONT_CACHE_FONT == fields[0u][0u]) && (fields.size() == 6u) && (mFonts.size() < MAX_NUMBER_OF_FALLBACK_FONTS))
+    {
+      FontItem item;
+      item.description.family = fields[1u];
+      item.description.width  = static_cast<TextAbstraction::FontWidth::Type>(width);
+      item.description.weight = static_cast<TextAbstraction::FontWeight::Type>(weight);
+      item.description.slant  = static_cast<TextAbstraction::FontSlant::Type>(slant);
+      item.pointSize          = pointSize;
+      item.fontId             = 0u;
+      mFonts.push_back(item);
+    }
+    else if(isValid && (FALLBACK_FONT_CACHE_BLOCK == fields[0u][0u]) && (fields.size() == 8u + BLOCK_SIZE))
+    {
+      uint32_t blockIndex = 0u, isLocaleDependent = 0u;
+      isValid = ToNumber(fields[6u], blockIndex) && ToNumber(fields[7u], isLocaleDependent) && (isLocaleDependent <= 1u);
+
+      Block block;
+      block.isLocaleDependent = (1u == isLocaleDependent);
+      for(uint32_t index = 0u; isValid && (index < BLOCK_SIZE); ++index)
+      {
+        uint32_t fontIndex = 0u;
+        isValid            = ToNumber(fields[8u + index], fontIndex) && (fontIndex <= mFonts.size());
+        block.fonts[index] = static_cast<uint16_t>(fontIndex);
+      }
+
+      if(isValid && (isSameLocale || !block.isLocaleDependent))
+      {
+        BlockKey key{fields[1u],
+                     static_cast<TextAbstraction::FontWidth::Type>(width),
+                     static_cast<TextAbstraction::FontWeight::Type>(weight),
+                     static_cast<TextAbstraction::FontSlant::Type>(slant),
+                     pointSize,
+                     blockIndex};
+        AddBlock(std::move(key), block);
+      }
+    }
+    else
+    {
+      isValid = false;
+    }
+
+    if(!isValid)
+    {
+      DALI_LOG_ERROR("Invalid fall-back font cache file : %s\n", path.c_str());
+      Clear();
+      return false;
+    }
+  }
+
+  mModified = false;
+  return true;
+}
+
+bool FallbackFonts::Save(const std::string& path, const std::string& locale)
+{
+  Dali::FileStream fileStream(path, FileStream::WRITE | FileStream::TEXT);
+  std::iostream&   stream = fileStream.GetStream();
+
+  stream << FALLBACK_FONT_CACHE_SIGNATURE << FIELD_SEPARATOR << FALLBACK_FONT_CACHE_VERSION << FIELD_SEPARATOR << locale << '\n';
+
+  for(const FontItem& item : mFonts)
+  {
+    stream << FALLBACK_FONT_CACHE_FONT << FIELD_SEPARATOR << item.description.family << FIELD_SEPARATOR
+           << static_cast<uint32_t>(item.description.width) << FIELD_SEPARATOR
+           << static_cast<uint32_t>(item.description.weight) << FIELD_SEPARATOR
+           << static_cast<uint32_t>(item.description.slant) << FIELD_SEPARATOR
+           << item.pointSize << '\n';
+  }
+
+  // The least recently used block first, so the order is the same once loaded.
+  for(auto keyIt = mLruBlocks.rbegin(); keyIt != mLruBlocks.rend(); ++keyIt)
+  {
+    const BlockKey& key   = *keyIt;
+    const Block&    block = mBlocks.at(key);
+    stream << FALLBACK_FONT_CACHE_BLOCK << FIELD_SEPARATOR << key.family << FIELD_SEPARATOR
+           << static_cast<uint32_t>(key.width) << FIELD_SEPARATOR
+           << static_cast<uint32_t>(key.weight) << FIELD_SEPARATOR
+           << static_cast<uint32_t>(key.slant) << FIELD_SEPARATOR
+           << key.pointSize << FIELD_SEPARATOR
+           << key.blockIndex << FIELD_SEPARATOR
+           << (block.isLocaleDependent ? 1u : 0u);
+    for(const uint16_t fontIndex : block.fonts)
+    {
+      stream << FIELD_SEPARATOR << fontIndex;
+    }
+    stream << '\n';
+  }
+
+  stream.flush();
+  if(!stream.good())
+  {
+    DALI_LOG_ERROR("Failed to save the fall-back font cache file : %s\n", path.c_str());
+    return false;
+  }
+
+  mModified = false;
+  return true;
+}
+
 MultilanguageSupport::MultilanguageSupport()
 : mDefaultFontPerScriptCache(),
   mValidFontsPerScriptCache(),
+  mFallbackFonts(),
+  mFallbackFontCachePath(),
   mLocale(std::string())
 {
   // Initializes the default font cache to zero (invalid font).
@@ -257,10 +645,23 @@ MultilanguageSupport::MultilanguageSupport()
   {
     Dali::Adaptor::Get().LocaleChangedSignal().Connect(this, &MultilanguageSupport::OnLocaleChanged);
   }
+
+  // Load the fall-back fonts found in a previous run, if they are saved.
+  const char* const fallbackFontCachePath = EnvironmentVariable::GetEnvironmentVariable(DALI_TEXT_FALLBACK_FONT_CACHE_ENV);
+  if(fallbackFontCachePath)
+  {
+    mFallbackFontCachePath = fallbackFontCachePath;
+    LoadFallbackFontCache(mFallbackFontCachePath);
+  }
 }
 
 MultilanguageSupport::~MultilanguageSupport()
 {
+  if(!mFallbackFontCachePath.empty() && mFallbackFonts.mModified)
+  {
+    SaveFallbackFontCache(mFallbackFontCachePath);
+  }
+
   // Destroy the default font per script cache.
   for(Vector<DefaultFonts*>::Iterator it    = mDefaultFontPerScriptCache.Begin(),
                                       endIt = mDefaultFontPerScriptCache.End();
@@ -291,11 +692,30 @@ void MultilanguageSupport::OnLocaleChanged(std::string locale)
 
 void MultilanguageSupport::ClearCache()
 {
+  for(Vector<DefaultFonts*>::Iterator it    = mDefaultFontPerScriptCache.Begin(),
+                                      endIt = mDefaultFontPerScriptCache.End();
+      it != endIt;
+      ++it)
+  {
+    delete *it;
+  }
+
+  for(Vector<ValidateFontsPerScript*>::Iterator it    = mValidFontsPerScriptCache.Begin(),
+                                                endIt = mValidFontsPerScriptCache.End();
+      it != endIt;
+      ++it)
+  {
+    delete *it;
+  }
+
   mDefaultFontPerScriptCache.Clear();
   mValidFontsPerScriptCache.Clear();
 
   mDefaultFontPerScriptCache.Resize(TextAbstraction::GetNumberOfScripts(), NULL);
   mValidFontsPerScriptCache.Resize(TextAbstraction::GetNumberOfScripts(), NULL);
+
+  // The fall-back font of a character doesn't depend on the locale, except for some scripts.
+  mFallbackFonts.ClearLocaleDependentFonts();
 }
 
 std::string MultilanguageSupport::GetLocale()
@@ -303,6 +723,16 @@ std::string MultilanguageSupport::GetLocale()
   return mLocale;
 }
 
+bool MultilanguageSupport::LoadFallbackFontCache(const std::string& path)
+{
+  return mFallbackFonts.Load(path, GetFallbackFontCacheLocale(mLocale));
+}
+
+bool MultilanguageSupport::SaveFallbackFontCache(const std::string& path)
+{
+  return mFallbackFonts.Save(path, GetFallbackFontCacheLocale(mLocale));
+}
+
 Text::MultilanguageSupport MultilanguageSupport::Get()
 {
   Text::MultilanguageSupport multilanguageSupportHandle;
@@ -758,7 +1188,7 @@ void MultilanguageSupport::ValidateFonts(const Vector<Character>&
 
     // Need to check if the given font supports the current character.
     CheckFontSupportsCharacter(isValidFont, isCommonScript, character, validFontsPerScriptCacheBuffer, script, fontId, fontClient,
-                               isValidCachedDefaultFont, cachedDefaultFontId, currentFontDescription, currentFontPointSize, defaultFontPerScriptCacheBuffer);
+                               isValidCachedDefaultFont, cachedDefaultFontId, currentFontDescription, currentFontPointSize, defaultFontPerScriptCacheBuffer, mFallbackFonts);
 
     if(isEmojiScript && (previousScript != script))
     {
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_TEXT_MULTI_LANGUAGE_SUPPORT_IMPL_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,11 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/signals/connection-tracker.h>
+#include <array>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/multi-language-support.h>
@@ -131,6 +136,155 @@ struct DefaultFonts
   std::vector<CacheItem> mFonts;
 };
 
+/**
+ * @brief Stores the fall-back fonts found for the characters.
+ *
+ * The characters are grouped in blocks of consecutive code points. For a requested font description and size,
+ * a block stores the fall-back font found for each of its characters, so the font client is not queried again
+ * for a character already resolved.
+ */
+struct FallbackFonts
+{
+  static constexpr uint32_t BLOCK_SIZE = 128u; ///< The number of code points of a block.
+
+  /**
+   * @brief The requested font and the block of code points.
+   */
+  struct BlockKey
+  {
+    std::string                       family;
+    TextAbstraction::FontWidth::Type  width;
+    TextAbstraction::FontWeight::Type weight;
+    TextAbstraction::FontSlant::Type  slant;
+    TextAbstraction::PointSize26Dot6  pointSize;
+    uint32_t                          blockIndex;
+
+    bool operator==(const BlockKey& rhs) const;
+  };
+
+  struct BlockKeyHash
+  {
+    std::size_t operator()(const BlockKey& key) const;
+  };
+
+  using BlockKeys = std::list<BlockKey>;
+
+  /**
+   * @brief The fall-back fonts of the characters of a block.
+   */
+  struct Block
+  {
+    std::array<uint16_t, BLOCK_SIZE> fonts;             ///< The index to the font item plus one for each character, zero if not found yet.
+    BlockKeys::iterator              lruIterator;       ///< The position of the block in the least recently used list.
+    bool                             isLocaleDependent; ///< Whether the fall-back font of any cached character depends on the locale.
+  };
+
+  /**
+   * @brief A fall-back font.
+   */
+  struct FontItem
+  {
+    TextAbstraction::FontDescription description; ///< The description of the fall-back font.
+    TextAbstraction::PointSize26Dot6 pointSize;   ///< The point size.
+    FontId                           fontId;      ///< The font id. Zero if it has not been created yet (i.e. loaded from a file).
+  };
+
+  /**
+   * Default constructor.
+   */
+  FallbackFonts()
+  : mBlocks(),
+    mLruBlocks(),
+    mFonts(),
+    mNumberOfHits(0u),
+    mNumberOfMisses(0u),
+    mModified(false)
+  {
+  }
+
+  /**
+   * @brief Finds the fall-back font cached for the given @p character.
+   *
+   * @param[in] fontClient The font client.
+   * @param[in] character The character.
+   * @param[in] description The requested font's description.
+   * @param[in] size The requested point size.
+   *
+   * @return The font id of the fall-back font. If there isn't any font cached, or it doesn't support the character, it returns 0.
+   */
+  FontId FindFont(TextAbstraction::FontClient&            fontClient,
+                  Character                               character,
+                  const TextAbstraction::FontDescription& description,
+                  PointSize26Dot6                         size);
+
+  /**
+   * @brief Cache the fall-back font found for the given @p character.
+   * @note If the cache is full, the least recently used block is removed.
+   *
+   * @param[in] fontClient The font client.
+   * @param[in] character The character.
+   * @param[in] script The script of the character.
+   * @param[in] description The requested font's description.
+   * @param[in] size The requested point size.
+   * @param[in] fontId The fall-back font found.
+   */
+  void Cache(TextAbstraction::FontClient&            fontClient,
+             Character                               character,
+             Script                                  script,
+             const TextAbstraction::FontDescription& description,
+             PointSize26Dot6                         size,
+             FontId                                  fontId);
+
+  /**
+   * @brief Removes the blocks which fall-back fonts may change with the locale.
+   */
+  void ClearLocaleDependentFonts();
+
+  /**
+   * @brief Removes all the cached fonts.
+   */
+  void Clear();
+
+  /**
+   * @brief Loads the fall-back fonts saved in a file.
+   *
+   * If the file was saved with a different locale, the blocks which fall-back fonts may change with the locale are discarded.
+   *
+   * @param[in] path The path to the file.
+   * @param[in] locale The current locale.
+   *
+   * @return @e true if the file has been loaded.
+   */
+  bool Load(const std::string& path, const std::string& locale);
+
+  /**
+   * @brief Saves the fall-back fonts into a file.
+   *
+   * @param[in] path The path to the file.
+   * @param[in] locale The current locale.
+   *
+   * @return @e true if the file has been saved.
+   */
+  bool Save(const std::string& path, const std::string& locale);
+
+  /**
+   * @brief Adds a block to the cache as the most recently used one, removing the least recently used block if the cache is full.
+   *
+   * @param[in] key The key of the block.
+   * @param[in] block The block.
+   *
+   * @return The added block.
+   */
+  Block& AddBlock(BlockKey key, Block block);
+
+  std::unordered_map<BlockKey, Block, BlockKeyHash> mBlocks;         ///< The blocks of characters.
+  BlockKeys                                         mLruBlocks;      ///< The keys of the blocks, the most recently used first.
+  std::vector<FontItem>                             mFonts;          ///< The fall-back fonts.
+  uint32_t                                          mNumberOfHits;   ///< The number of characters whose fall-back font was found in the cache.
+  uint32_t                                          mNumberOfMisses; ///< The number of characters whose fall-back font was not in the cache.
+  bool                                              mModified;       ///< Whether the cache has changed since it was loaded or saved.
+};
+
 /**
  * @brief Multi-language support implementation. @see Text::MultilanguageSupport.
  */
@@ -191,9 +345,39 @@ public:
    */
   std::string GetLocale();
 
+  /**
+   * @brief Loads the fall-back fonts found in a previous run.
+   *
+   * @param[in] path The path to the file.
+   *
+   * @return @e true if the file has been loaded.
+   */
+  bool LoadFallbackFontCache(const std::string& path);
+
+  /**
+   * @brief Saves the fall-back fonts found so a next run doesn't need to query the font client.
+   *
+   * @param[in] path The path to the file.
+   *
+   * @return @e true if the file has been saved.
+   */
+  bool SaveFallbackFontCache(const std::string& path);
+
+  /**
+   * @brief Retrieves the cache of the fall-back fonts.
+   *
+   * @return The fall-back fonts.
+   */
+  const FallbackFonts& GetFallbackFonts() const
+  {
+    return mFallbackFonts;
+  }
+
 private:
   Vector<DefaultFonts*>           mDefaultFontPerScriptCache; ///< Caches default fonts for a script.
   Vector<ValidateFontsPerScript*> mValidFontsPerScriptCache;  ///< Caches valid fonts for a script.
+  FallbackFonts                   mFallbackFonts;             ///< Caches the fall-back fonts per character. Kept when the locale changes.
+  std::string                     mFallbackFontCachePath;     ///< The file where the fall-back fonts are saved. Empty if they are not saved.
 
   std::string mLocale;
 
@@ -0,0 +1,627 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/rendering/pixel-kernels.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+#if defined(__SSE2__)
+#define DALI_TEXT_PIXEL_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_TEXT_PIXEL_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace
+{
+constexpr uint32_t ALPHA_SHIFT = 24u; ///< The alpha is the most significant byte of a packed RGBA8888 pixel.
+
+/**
+ * @brief Multiplies each component of the packed pixel by the same factor and divides by 255.
+ */
+inline uint32_t MultiplyAndNormalizePixel(const uint32_t pixel, const uint8_t factor) noexcept
+{
+  uint32_t       result       = pixel;
+  uint8_t* const resultBuffer = reinterpret_cast<uint8_t*>(&result);
+
+  resultBuffer[0] = MultiplyAndNormalizeColor(resultBuffer[0], factor);
+  resultBuffer[1] = MultiplyAndNormalizeColor(resultBuffer[1], factor);
+  resultBuffer[2] = MultiplyAndNormalizeColor(resultBuffer[2], factor);
+  resultBuffer[3] = MultiplyAndNormalizeColor(resultBuffer[3], factor);
+
+  return result;
+}
+
+// Scalar kernels. The reference of all the other implementations.
+
+inline uint32_t CombinePixel(const uint32_t topColor, const uint32_t bottomColor) noexcept
+{
+  const uint8_t topAlpha = static_cast<uint8_t>(topColor >> ALPHA_SHIFT);
+  if(topAlpha == 0)
+  {
+    return bottomColor;
+  }
+  if(topAlpha == 255)
+  {
+    return topColor;
+  }
+
+  // "Over" blend the pixel from top with the pixel in bottom.
+  // Note : The components are added as a whole 32 bit value.
+  return topColor + MultiplyAndNormalizePixel(bottomColor, 255 - topAlpha);
+}
+
+inline uint32_t MaskPixel(const uint32_t topColor, const uint32_t bottomColor, const uint8_t originAlpha) noexcept
+{
+  uint32_t       result            = 0u;
+  uint8_t* const resultBuffer      = reinterpret_cast<uint8_t*>(&result);
+  const uint8_t* topColorBuffer    = reinterpret_cast<const uint8_t*>(&topColor);
+  const uint8_t* bottomColorBuffer = reinterpret_cast<const uint8_t*>(&bottomColor);
+
+  const uint8_t bottomAlpha = 255 - topColorBuffer[3];
+
+  resultBuffer[0] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[0], originAlpha, bottomColorBuffer[0], bottomAlpha);
+  resultBuffer[1] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[1], originAlpha, bottomColorBuffer[1], bottomAlpha);
+  resultBuffer[2] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[2], originAlpha, bottomColorBuffer[2], bottomAlpha);
+  resultBuffer[3] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[3], originAlpha, bottomColorBuffer[3], bottomAlpha);
+
+  return result;
+}
+
+inline uint32_t BlitGlyphPixel(const uint8_t glyphAlpha, const uint32_t packedColor, const uint32_t currentColor) noexcept
+{
+  // Copy non-transparent pixels only
+  if(glyphAlpha == 0u)
+  {
+    return currentColor;
+  }
+
+  // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
+  // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
+  // semi-transparent gaps between joint glyphs with overlapped pixels, which could
+  // happen, for example, in the RTL text when we copy glyphs from right to left).
+  const uint8_t currentAlpha = std::max(static_cast<uint8_t>(currentColor >> ALPHA_SHIFT), glyphAlpha);
+  if(currentAlpha == 255)
+  {
+    // Fast-cut to avoid float type operation.
+    return packedColor;
+  }
+
+  // Color is pre-muliplied with its alpha.
+  return MultiplyAndNormalizePixel(packedColor, currentAlpha);
+}
+
+inline uint32_t ExpandAlphaMultipliedPixel(const uint8_t alpha, const float* const color) noexcept
+{
+  const float srcAlpha = static_cast<float>(alpha);
+
+  uint8_t dstColor[4];
+  dstColor[0u] = static_cast<unsigned char>(srcAlpha * color[0u]);
+  dstColor[1u] = static_cast<unsigned char>(srcAlpha * color[1u]);
+  dstColor[2u] = static_cast<unsigned char>(srcAlpha * color[2u]);
+  dstColor[3u] = static_cast<unsigned char>(srcAlpha * color[3u]);
+
+  uint32_t result;
+  memcpy(&result, dstColor, sizeof(uint32_t));
+  return result;
+}
+
+void CombineScalar(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    outputBuffer[index] = CombinePixel(topBuffer[index], bottomBuffer[index]);
+  }
+}
+
+void MaskScalar(const uint32_t* topBuffer, uint32_t* bottomBuffer, uint8_t originAlpha, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    bottomBuffer[index] = MaskPixel(topBuffer[index], bottomBuffer[index], originAlpha);
+  }
+}
+
+void BlitGlyphScalar(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    outputBuffer[index] = BlitGlyphPixel(glyphAlphaBuffer[index * glyphPixelSize], packedColor, outputBuffer[index]);
+  }
+}
+
+void BlitGlyphAlphaScalar(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint8_t* outputBuffer, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    outputBuffer[index] = std::max(outputBuffer[index], glyphAlphaBuffer[index * glyphPixelSize]);
+  }
+}
+
+void ExpandAlphaScalar(const uint8_t* alphaBuffer, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    outputBuffer[index] = packedColor | (static_cast<uint32_t>(alphaBuffer[index]) << ALPHA_SHIFT);
+  }
+}
+
+void ExpandAlphaMultipliedScalar(const uint8_t* alphaBuffer, const float* color, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    outputBuffer[index] = ExpandAlphaMultipliedPixel(alphaBuffer[index], color);
+  }
+}
+
+const PixelKernels SCALAR_KERNELS =
+  {
+    CombineScalar,
+    MaskScalar,
+    BlitGlyphScalar,
+    BlitGlyphAlphaScalar,
+    ExpandAlphaScalar,
+    ExpandAlphaMultipliedScalar,
+    "scalar"};
+
+#if defined(DALI_TEXT_PIXEL_KERNELS_SSE2)
+
+// SSE2 kernels. Four RGBA pixels per register. The remaining pixels are done by the scalar code.
+
+/**
+ * @brief Replicates the lowest byte of each 32 bit lane into the four bytes of the lane.
+ */
+inline __m128i ReplicateByte(const __m128i value)
+{
+  const __m128i shifted = _mm_or_si128(value, _mm_slli_epi32(value, 8));
+  return _mm_or_si128(shifted, _mm_slli_epi32(shifted, 16));
+}
+
+/**
+ * @brief Same as MultiplyAndNormalizeColor() for eight 16 bit components.
+ *
+ * (x * y * 32897) >> 23 is computed as ((x * y * 32897) >> 16) >> 7 as x * y fits in 16 bits.
+ */
+inline __m128i MultiplyAndNormalize16(const __m128i x, const __m128i y)
+{
+  const __m128i xy = _mm_mullo_epi16(x, y);
+  return _mm_srli_epi16(_mm_mulhi_epu16(xy, _mm_set1_epi16(static_cast<short>(0x8081))), 7);
+}
+
+/**
+ * @brief Same as MultiplyAndNormalizePixel() for four pixels. Each byte of @p factors multiplies the same byte of @p pixels.
+ */
+inline __m128i MultiplyAndNormalizePixels(const __m128i pixels, const __m128i factors)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i low  = MultiplyAndNormalize16(_mm_unpacklo_epi8(pixels, zero), _mm_unpacklo_epi8(factors, zero));
+  const __m128i high = MultiplyAndNormalize16(_mm_unpackhi_epi8(pixels, zero), _mm_unpackhi_epi8(factors, zero));
+  return _mm_packus_epi16(low, high);
+}
+
+/**
+ * @brief Selects @p ifTrue where the mask is set, @p ifFalse otherwise.
+ */
+inline __m128i Select(const __m128i mask, const __m128i ifTrue, const __m128i ifFalse)
+{
+  return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+void CombineSse2(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  const __m128i zero   = _mm_setzero_si128();
+  const __m128i opaque = _mm_set1_epi32(255);
+
+  uint32_t index = 0u;
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    const __m128i top    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(topBuffer + index));
+    const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottomBuffer + index));
+
+    const __m128i topAlpha = _mm_srli_epi32(top, ALPHA_SHIFT);
+    const __m128i blended  = _mm_add_epi32(top, MultiplyAndNormalizePixels(bottom, ReplicateByte(_mm_sub_epi32(opaque, topAlpha))));
+
+    __m128i result = Select(_mm_cmpeq_epi32(topAlpha, opaque), top, blended);
+    result         = Select(_mm_cmpeq_epi32(topAlpha, zero), bottom, result);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index), result);
+  }
+
+  CombineScalar(topBuffer + index, bottomBuffer + index, outputBuffer + index, numberOfPixels - index);
+}
+
+void MaskSse2(const uint32_t* topBuffer, uint32_t* bottomBuffer, uint8_t originAlpha, uint32_t numberOfPixels)
+{
+  const __m128i zero      = _mm_setzero_si128();
+  const __m128i opaque    = _mm_set1_epi32(255);
+  const __m128i maxValue  = _mm_set1_epi32(65025); // 65025 is 255 * 255.
+  const __m128i bias      = _mm_set1_epi32(257);
+  const __m128i originLow = _mm_set1_epi32(originAlpha);
+
+  uint32_t index = 0u;
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    const __m128i top    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(topBuffer + index));
+    const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottomBuffer + index));
+
+    // Each 32 bit lane holds the originAlpha in the low half and the bottom alpha of the pixel in the high half.
+    const __m128i factors = _mm_or_si128(originLow, _mm_slli_epi32(_mm_sub_epi32(opaque, _mm_srli_epi32(top, ALPHA_SHIFT)), 16));
+
+    const __m128i topLow     = _mm_unpacklo_epi8(top, zero);
+    const __m128i topHigh    = _mm_unpackhi_epi8(top, zero);
+    const __m128i bottomLow  = _mm_unpacklo_epi8(bottom, zero);
+    const __m128i bottomHigh = _mm_unpackhi_epi8(bottom, zero);
+
+    // Interleaves the components of the top and bottom pixels and multiply-adds them with the factors of the pixel.
+    __m128i sums[4];
+    sums[0] = _mm_madd_epi16(_mm_unpacklo_epi16(topLow, bottomLow), _mm_shuffle_epi32(factors, _MM_SHUFFLE(0, 0, 0, 0)));
+    sums[1] = _mm_madd_epi16(_mm_unpackhi_epi16(topLow, bottomLow), _mm_shuffle_epi32(factors, _MM_SHUFFLE(1, 1, 1, 1)));
+    sums[2] = _mm_madd_epi16(_mm_unpacklo_epi16(topHigh, bottomHigh), _mm_shuffle_epi32(factors, _MM_SHUFFLE(2, 2, 2, 2)));
+    sums[3] = _mm_madd_epi16(_mm_unpackhi_epi16(topHigh, bottomHigh), _mm_shuffle_epi32(factors, _MM_SHUFFLE(3, 3, 3, 3)));
+
+    for(auto& sum : sums)
+    {
+      sum = Select(_mm_cmpgt_epi32(sum, maxValue), maxValue, sum);
+      sum = _mm_srli_epi32(_mm_add_epi32(sum, _mm_srli_epi32(_mm_add_epi32(sum, bias), 8)), 8); // fast divide by 255.
+    }
+
+    const __m128i result = _mm_packus_epi16(_mm_packs_epi32(sums[0], sums[1]), _mm_packs_epi32(sums[2], sums[3]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bottomBuffer + index), result);
+  }
+
+  MaskScalar(topBuffer + index, bottomBuffer + index, originAlpha, numberOfPixels - index);
+}
+
+void BlitGlyphSse2(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+  if(glyphPixelSize == 1u)
+  {
+    const __m128i zero   = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32(255);
+    const __m128i color  = _mm_set1_epi32(static_cast<int>(packedColor));
+
+    for(; index + 4u <= numberOfPixels; index += 4u)
+    {
+      int32_t glyphAlphas;
+      memcpy(&glyphAlphas, glyphAlphaBuffer + index, sizeof(int32_t));
+
+      const __m128i glyphAlpha = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(glyphAlphas), zero), zero);
+      const __m128i current    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(outputBuffer + index));
+
+      // Both alphas are in the lowest byte of the lane, so the byte maximum is the alpha maximum.
+      const __m128i currentAlpha = _mm_max_epu8(_mm_srli_epi32(current, ALPHA_SHIFT), glyphAlpha);
+
+      __m128i result = Select(_mm_cmpeq_epi32(currentAlpha, opaque), color, MultiplyAndNormalizePixels(color, ReplicateByte(currentAlpha)));
+      result         = Select(_mm_cmpeq_epi32(glyphAlpha, zero), current, result);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index), result);
+    }
+  }
+
+  BlitGlyphScalar(glyphAlphaBuffer + index * glyphPixelSize, glyphPixelSize, packedColor, outputBuffer + index, numberOfPixels - index);
+}
+
+void BlitGlyphAlphaSse2(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint8_t* outputBuffer, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+  if(glyphPixelSize == 1u)
+  {
+    for(; index + 16u <= numberOfPixels; index += 16u)
+    {
+      const __m128i glyphAlpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(glyphAlphaBuffer + index));
+      const __m128i current    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(outputBuffer + index));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index), _mm_max_epu8(current, glyphAlpha));
+    }
+  }
+
+  BlitGlyphAlphaScalar(glyphAlphaBuffer + index * glyphPixelSize, glyphPixelSize, outputBuffer + index, numberOfPixels - index);
+}
+
+void ExpandAlphaSse2(const uint8_t* alphaBuffer, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  const __m128i zero  = _mm_setzero_si128();
+  const __m128i color = _mm_set1_epi32(static_cast<int>(packedColor));
+
+  uint32_t index = 0u;
+  for(; index + 16u <= numberOfPixels; index += 16u)
+  {
+    const __m128i alpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphaBuffer + index));
+
+    // Unpacking the alpha in the high bytes moves it to the most significant byte of each lane.
+    const __m128i alphaLow  = _mm_unpacklo_epi8(zero, alpha);
+    const __m128i alphaHigh = _mm_unpackhi_epi8(zero, alpha);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index), _mm_or_si128(color, _mm_unpacklo_epi16(zero, alphaLow)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index + 4u), _mm_or_si128(color, _mm_unpackhi_epi16(zero, alphaLow)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index + 8u), _mm_or_si128(color, _mm_unpacklo_epi16(zero, alphaHigh)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index + 12u), _mm_or_si128(color, _mm_unpackhi_epi16(zero, alphaHigh)));
+  }
+
+  ExpandAlphaScalar(alphaBuffer + index, packedColor, outputBuffer + index, numberOfPixels - index);
+}
+
+void ExpandAlphaMultipliedSse2(const uint8_t* alphaBuffer, const float* color, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  const __m128i zero     = _mm_setzero_si128();
+  const __m128i byteMask = _mm_set1_epi32(0xff);
+  const __m128  red      = _mm_set1_ps(color[0u]);
+  const __m128  green    = _mm_set1_ps(color[1u]);
+  const __m128  blue     = _mm_set1_ps(color[2u]);
+  const __m128  alpha    = _mm_set1_ps(color[3u]);
+
+  uint32_t index = 0u;
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    int32_t srcAlphas;
+    memcpy(&srcAlphas, alphaBuffer + index, sizeof(int32_t));
+
+    const __m128 srcAlpha = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(srcAlphas), zero), zero));
+
+    // Truncates as the static_cast of the scalar code does.
+    const __m128i r = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(srcAlpha, red)), byteMask);
+    const __m128i g = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(srcAlpha, green)), byteMask);
+    const __m128i b = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(srcAlpha, blue)), byteMask);
+    const __m128i a = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(srcAlpha, alpha)), byteMask);
+
+    const __m128i result = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputBuffer + index), result);
+  }
+
+  ExpandAlphaMultipliedScalar(alphaBuffer + index, color, outputBuffer + index, numberOfPixels - index);
+}
+
+const PixelKernels SSE2_KERNELS =
+  {
+    CombineSse2,
+    MaskSse2,
+    BlitGlyphSse2,
+    BlitGlyphAlphaSse2,
+    ExpandAlphaSse2,
+    ExpandAlphaMultipliedSse2,
+    "sse2"};
+
+#endif // DALI_TEXT_PIXEL_KERNELS_SSE2
+
+#if defined(DALI_TEXT_PIXEL_KERNELS_NEON)
+
+// NEON kernels. Four RGBA pixels per register. The remaining pixels are done by the scalar code.
+
+/**
+ * @brief Same as MultiplyAndNormalizeColor() for eight components.
+ */
+inline uint8x8_t MultiplyAndNormalize8(const uint8x8_t x, const uint8x8_t y)
+{
+  const uint16x8_t xy   = vmull_u8(x, y);
+  const uint16x4_t low  = vshrn_n_u32(vmull_n_u16(vget_low_u16(xy), 0x8081), 16);
+  const uint16x4_t high = vshrn_n_u32(vmull_n_u16(vget_high_u16(xy), 0x8081), 16);
+  return vshrn_n_u16(vcombine_u16(low, high), 7);
+}
+
+/**
+ * @brief Same as MultiplyAndNormalizePixel() for four pixels. Each byte of @p factors multiplies the same byte of @p pixels.
+ */
+inline uint32x4_t MultiplyAndNormalizePixels(const uint32x4_t pixels, const uint32x4_t factors)
+{
+  const uint8x16_t pixelBytes  = vreinterpretq_u8_u32(pixels);
+  const uint8x16_t factorBytes = vreinterpretq_u8_u32(factors);
+  const uint8x8_t  low         = MultiplyAndNormalize8(vget_low_u8(pixelBytes), vget_low_u8(factorBytes));
+  const uint8x8_t  high        = MultiplyAndNormalize8(vget_high_u8(pixelBytes), vget_high_u8(factorBytes));
+  return vreinterpretq_u32_u8(vcombine_u8(low, high));
+}
+
+/**
+ * @brief Same as MultiplyAndSummationAndNormalizeColor() for eight components.
+ */
+inline uint8x8_t MultiplyAndSummationAndNormalize8(const uint8x8_t x1, const uint8x8_t y1, const uint8x8_t x2, const uint8x8_t y2)
+{
+  const uint16x8_t xy1      = vmull_u8(x1, y1);
+  const uint16x8_t xy2      = vmull_u8(x2, y2);
+  const uint32x4_t maxValue = vdupq_n_u32(65025u); // 65025 is 255 * 255.
+
+  uint32x4_t low  = vminq_u32(vaddl_u16(vget_low_u16(xy1), vget_low_u16(xy2)), maxValue);
+  uint32x4_t high = vminq_u32(vaddl_u16(vget_high_u16(xy1), vget_high_u16(xy2)), maxValue);
+
+  // fast divide by 255.
+  low  = vshrq_n_u32(vaddq_u32(low, vshrq_n_u32(vaddq_u32(low, vdupq_n_u32(257u)), 8)), 8);
+  high = vshrq_n_u32(vaddq_u32(high, vshrq_n_u32(vaddq_u32(high, vdupq_n_u32(257u)), 8)), 8);
+
+  return vmovn_u16(vcombine_u16(vmovn_u32(low), vmovn_u32(high)));
+}
+
+void CombineNeon(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  const uint32x4_t zero   = vdupq_n_u32(0u);
+  const uint32x4_t opaque = vdupq_n_u32(255u);
+
+  uint32_t index = 0u;
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    const uint32x4_t top    = vld1q_u32(topBuffer + index);
+    const uint32x4_t bottom = vld1q_u32(bottomBuffer + index);
+
+    const uint32x4_t topAlpha = vshrq_n_u32(top, ALPHA_SHIFT);
+    const uint32x4_t blended  = vaddq_u32(top, MultiplyAndNormalizePixels(bottom, vmulq_n_u32(vsubq_u32(opaque, topAlpha), 0x01010101u)));
+
+    uint32x4_t result = vbslq_u32(vceqq_u32(topAlpha, opaque), top, blended);
+    result            = vbslq_u32(vceqq_u32(topAlpha, zero), bottom, result);
+
+    vst1q_u32(outputBuffer + index, result);
+  }
+
+  CombineScalar(topBuffer + index, bottomBuffer + index, outputBuffer + index, numberOfPixels - index);
+}
+
+void MaskNeon(const uint32_t* topBuffer, uint32_t* bottomBuffer, uint8_t originAlpha, uint32_t numberOfPixels)
+{
+  const uint32x4_t opaque = vdupq_n_u32(255u);
+  const uint8x8_t  origin = vdup_n_u8(originAlpha);
+
+  uint32_t index = 0u;
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    const uint32x4_t top    = vld1q_u32(topBuffer + index);
+    const uint32x4_t bottom = vld1q_u32(bottomBuffer + index);
+
+    const uint8x16_t topBytes         = vreinterpretq_u8_u32(top);
+    const uint8x16_t bottomBytes      = vreinterpretq_u8_u32(bottom);
+    const uint8x16_t bottomAlphaBytes = vreinterpretq_u8_u32(vmulq_n_u32(vsubq_u32(opaque, vshrq_n_u32(top, ALPHA_SHIFT)), 0x01010101u));
+
+    const uint8x8_t low  = MultiplyAndSummationAndNormalize8(vget_low_u8(topBytes), origin, vget_low_u8(bottomBytes), vget_low_u8(bottomAlphaBytes));
+    const uint8x8_t high = MultiplyAndSummationAndNormalize8(vget_high_u8(topBytes), origin, vget_high_u8(bottomBytes), vget_high_u8(bottomAlphaBytes));
+
+    vst1q_u32(bottomBuffer + index, vreinterpretq_u32_u8(vcombine_u8(low, high)));
+  }
+
+  MaskScalar(topBuffer + index, bottomBuffer + index, originAlpha, numberOfPixels - index);
+}
+
+inline uint32x4_t BlitGlyphPixels(const uint32x4_t glyphAlpha, const uint32x4_t color, const uint32x4_t current)
+{
+  const uint32x4_t currentAlpha = vmaxq_u32(vshrq_n_u32(current, ALPHA_SHIFT), glyphAlpha);
+
+  uint32x4_t result = vbslq_u32(vceqq_u32(currentAlpha, vdupq_n_u32(255u)), color, MultiplyAndNormalizePixels(color, vmulq_n_u32(currentAlpha, 0x01010101u)));
+  return vbslq_u32(vceqq_u32(glyphAlpha, vdupq_n_u32(0u)), current, result);
+}
+
+void BlitGlyphNeon(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+  if(glyphPixelSize == 1u)
+  {
+    const uint32x4_t color = vdupq_n_u32(packedColor);
+
+    for(; index + 8u <= numberOfPixels; index += 8u)
+    {
+      const uint16x8_t glyphAlpha = vmovl_u8(vld1_u8(glyphAlphaBuffer + index));
+
+      vst1q_u32(outputBuffer + index, BlitGlyphPixels(vmovl_u16(vget_low_u16(glyphAlpha)), color, vld1q_u32(outputBuffer + index)));
+      vst1q_u32(outputBuffer + index + 4u, BlitGlyphPixels(vmovl_u16(vget_high_u16(glyphAlpha)), color, vld1q_u32(outputBuffer + index + 4u)));
+    }
+  }
+
+  BlitGlyphScalar(glyphAlphaBuffer + index * glyphPixelSize, glyphPixelSize, packedColor, outputBuffer + index, numberOfPixels - index);
+}
+
+void BlitGlyphAlphaNeon(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint8_t* outputBuffer, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+  if(glyphPixelSize == 1u)
+  {
+    for(; index + 16u <= numberOfPixels; index += 16u)
+    {
+      vst1q_u8(outputBuffer + index, vmaxq_u8(vld1q_u8(outputBuffer + index), vld1q_u8(glyphAlphaBuffer + index)));
+    }
+  }
+
+  BlitGlyphAlphaScalar(glyphAlphaBuffer + index * glyphPixelSize, glyphPixelSize, outputBuffer + index, numberOfPixels - index);
+}
+
+void ExpandAlphaNeon(const uint8_t* alphaBuffer, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  const uint32x4_t color = vdupq_n_u32(packedColor);
+
+  uint32_t index = 0u;
+  for(; index + 8u <= numberOfPixels; index += 8u)
+  {
+    const uint16x8_t alpha = vmovl_u8(vld1_u8(alphaBuffer + index));
+
+    vst1q_u32(outputBuffer + index, vorrq_u32(color, vshlq_n_u32(vmovl_u16(vget_low_u16(alpha)), ALPHA_SHIFT)));
+    vst1q_u32(outputBuffer + index + 4u, vorrq_u32(color, vshlq_n_u32(vmovl_u16(vget_high_u16(alpha)), ALPHA_SHIFT)));
+  }
+
+  ExpandAlphaScalar(alphaBuffer + index, packedColor, outputBuffer + index, numberOfPixels - index);
+}
+
+inline uint32x4_t ExpandAlphaMultipliedPixels(const uint32x4_t srcAlphas, const float* const color)
+{
+  const float32x4_t srcAlpha = vcvtq_f32_u32(srcAlphas);
+  const uint32x4_t  byteMask = vdupq_n_u32(0xffu);
+
+  // Truncates as the static_cast of the scalar code does.
+  const uint32x4_t r = vandq_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vmulq_n_f32(srcAlpha, color[0u]))), byteMask);
+  const uint32x4_t g = vandq_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vmulq_n_f32(srcAlpha, color[1u]))), byteMask);
+  const uint32x4_t b = vandq_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vmulq_n_f32(srcAlpha, color[2u]))), byteMask);
+  const uint32x4_t a = vandq_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vmulq_n_f32(srcAlpha, color[3u]))), byteMask);
+
+  return vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)), vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(a, 24)));
+}
+
+void ExpandAlphaMultipliedNeon(const uint8_t* alphaBuffer, const float* color, uint32_t* outputBuffer, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+  for(; index + 8u <= numberOfPixels; index += 8u)
+  {
+    const uint16x8_t alpha = vmovl_u8(vld1_u8(alphaBuffer + index));
+
+    vst1q_u32(outputBuffer + index, ExpandAlphaMultipliedPixels(vmovl_u16(vget_low_u16(alpha)), color));
+    vst1q_u32(outputBuffer + index + 4u, ExpandAlphaMultipliedPixels(vmovl_u16(vget_high_u16(alpha)), color));
+  }
+
+  ExpandAlphaMultipliedScalar(alphaBuffer + index, color, outputBuffer + index, numberOfPixels - index);
+}
+
+const PixelKernels NEON_KERNELS =
+  {
+    CombineNeon,
+    MaskNeon,
+    BlitGlyphNeon,
+    BlitGlyphAlphaNeon,
+    ExpandAlphaNeon,
+    ExpandAlphaMultipliedNeon,
+    "neon"};
+
+#endif // DALI_TEXT_PIXEL_KERNELS_NEON
+
+const PixelKernels& SelectPixelKernels()
+{
+#if defined(DALI_TEXT_PIXEL_KERNELS_SSE2)
+  return SSE2_KERNELS;
+#elif defined(DALI_TEXT_PIXEL_KERNELS_NEON)
+  return NEON_KERNELS;
+#else
+  return SCALAR_KERNELS;
+#endif
+}
+
+} // namespace
+
+const PixelKernels& GetPixelKernels()
+{
+  static const PixelKernels& kernels = SelectPixelKernels();
+  return kernels;
+}
+
+const PixelKernels& GetScalarPixelKernels()
+{
+  return SCALAR_KERNELS;
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
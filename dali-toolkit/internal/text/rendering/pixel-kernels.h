@@ -0,0 +1,166 @@
+#ifndef DALI_TOOLKIT_TEXT_PIXEL_KERNELS_H
+#define DALI_TOOLKIT_TEXT_PIXEL_KERNELS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdint>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Fast multiply & divide by 255. It wiil be useful when we applying alpha value in color
+ *
+ * @param x The value between [0..255]
+ * @param y The value between [0..255]
+ * @return (x*y)/255
+ */
+inline uint8_t MultiplyAndNormalizeColor(const uint8_t x, const uint8_t y) noexcept
+{
+  const uint32_t xy = static_cast<uint32_t>(x) * y;
+  return ((xy << 15) + (xy << 7) + xy) >> 23;
+}
+
+/**
+ * @brief Fast multiply & Summation & divide by 255.
+ *
+ * @param x1 The value between [0..255]
+ * @param y1 The value between [0..255]
+ * @param x2 The value between [0..255]
+ * @param y2 The value between [0..255]
+ * @return min(255, (x1*y1)/255 + (x2*y2)/255)
+ */
+inline uint8_t MultiplyAndSummationAndNormalizeColor(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2) noexcept
+{
+  const uint32_t xy1 = static_cast<uint32_t>(x1) * y1;
+  const uint32_t xy2 = static_cast<uint32_t>(x2) * y2;
+  const uint32_t res = std::min(65025u, xy1 + xy2); // 65025 is 255 * 255.
+  return ((res + ((res + 257) >> 8)) >> 8); // fast divide by 255.
+}
+
+/**
+ * @brief The per-pixel loops used to compose the text's bitmaps.
+ *
+ * RGBA8888 pixels are handled as packed 32 bit values with the alpha in the most significant byte and
+ * the colors are pre-multiplied. Every implementation gives exactly the same result as the scalar one.
+ */
+struct PixelKernels
+{
+  /**
+   * @brief Blends the top pixels over the bottom ones.
+   *
+   * The output buffer may be the top or the bottom buffer.
+   *
+   * @param[in] topBuffer The top pixels.
+   * @param[in] bottomBuffer The bottom pixels.
+   * @param[out] outputBuffer The blended pixels.
+   * @param[in] numberOfPixels The number of pixels.
+   */
+  using CombineFunction = void (*)(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* outputBuffer, uint32_t numberOfPixels);
+
+  /**
+   * @brief Makes the bottom pixels transparent where the top pixels are opaque and adds the top pixels multiplied by @p originAlpha.
+   *
+   * @param[in] topBuffer The top pixels.
+   * @param[in, out] bottomBuffer The bottom pixels. It stores the result.
+   * @param[in] originAlpha The alpha the top pixels are multiplied by.
+   * @param[in] numberOfPixels The number of pixels.
+   */
+  using MaskFunction = void (*)(const uint32_t* topBuffer, uint32_t* bottomBuffer, uint8_t originAlpha, uint32_t numberOfPixels);
+
+  /**
+   * @brief Sets a scanline of a glyph's alpha into RGBA pixels filled with the given color.
+   *
+   * Non transparent pixels of the glyph take the maximum of their alpha and the alpha already in the output,
+   * to avoid gaps between overlapping glyphs.
+   *
+   * @param[in] glyphAlphaBuffer Pointer to the alpha of the first pixel of the glyph's scanline.
+   * @param[in] glyphPixelSize The number of bytes between the alpha of two consecutive glyph pixels.
+   * @param[in] packedColor The pre-multiplied color of the glyph.
+   * @param[in, out] outputBuffer The RGBA pixels.
+   * @param[in] numberOfPixels The number of pixels.
+   */
+  using BlitGlyphFunction = void (*)(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels);
+
+  /**
+   * @brief Sets a scanline of a glyph's alpha into an alpha only buffer, keeping the maximum alpha.
+   *
+   * @param[in] glyphAlphaBuffer Pointer to the alpha of the first pixel of the glyph's scanline.
+   * @param[in] glyphPixelSize The number of bytes between the alpha of two consecutive glyph pixels.
+   * @param[in, out] outputBuffer The alpha pixels.
+   * @param[in] numberOfPixels The number of pixels.
+   */
+  using BlitGlyphAlphaFunction = void (*)(const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint8_t* outputBuffer, uint32_t numberOfPixels);
+
+  /**
+   * @brief Expands alpha pixels to RGBA pixels of the given color.
+   *
+   * @param[in] alphaBuffer The alpha pixels.
+   * @param[in] packedColor The color. Its alpha byte must be zero.
+   * @param[out] outputBuffer The RGBA pixels.
+   * @param[in] numberOfPixels The number of pixels.
+   */
+  using ExpandAlphaFunction = void (*)(const uint8_t* alphaBuffer, uint32_t packedColor, uint32_t* outputBuffer, uint32_t numberOfPixels);
+
+  /**
+   * @brief Expands alpha pixels to RGBA pixels, multiplying each component of the color by the alpha.
+   *
+   * @param[in] alphaBuffer The alpha pixels.
+   * @param[in] color The red, green, blue and alpha components of the color.
+   * @param[out] outputBuffer The RGBA pixels.
+   * @param[in] numberOfPixels The number of pixels.
+   */
+  using ExpandAlphaMultipliedFunction = void (*)(const uint8_t* alphaBuffer, const float* color, uint32_t* outputBuffer, uint32_t numberOfPixels);
+
+  CombineFunction               combine;               ///< Blends pixels with the "over" operator.
+  MaskFunction                  mask;                  ///< Cuts out pixels.
+  BlitGlyphFunction             blitGlyph;             ///< Sets a glyph's scanline into RGBA pixels.
+  BlitGlyphAlphaFunction        blitGlyphAlpha;        ///< Sets a glyph's scanline into alpha pixels.
+  ExpandAlphaFunction           expandAlpha;           ///< Expands alpha pixels to a color.
+  ExpandAlphaMultipliedFunction expandAlphaMultiplied; ///< Expands alpha pixels to a color multiplied by the alpha.
+  const char*                   name;                  ///< The name of the implementation, i.e. "scalar", "sse2" or "neon".
+};
+
+/**
+ * @brief Retrieves the fastest kernels supported by the CPU.
+ *
+ * The implementation is selected the first time this is called.
+ *
+ * @return The pixel kernels.
+ */
+const PixelKernels& GetPixelKernels();
+
+/**
+ * @brief Retrieves the scalar kernels, the reference of all the other implementations.
+ *
+ * @return The scalar pixel kernels.
+ */
+const PixelKernels& GetScalarPixelKernels();
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_PIXEL_KERNELS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <cmath>
 #include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/threading/mutex.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/trace.h>
 #include <dali/public-api/common/constants.h>
@@ -31,6 +32,7 @@
 #include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
 #include <dali-toolkit/internal/text/glyph-metrics-helper.h>
 #include <dali-toolkit/internal/text/line-helper-functions.h>
+#include <dali-toolkit/internal/text/rendering/pixel-kernels.h>
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/strikethrough-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/underline-helper-functions.h>
@@ -49,82 +51,89 @@ DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_TEXT_PERFORMANCE_MARKER, false);
 const float HALF(0.5f);
 const float ONE_AND_A_HALF(1.5f);
 
+constexpr uint32_t    MAX_NUMBER_OF_LAYERS             = 4u;               ///< The maximum number of styles rendered in a single pass over the glyphs.
+constexpr std::size_t MAX_SIZE_OF_POOLED_LAYER_BUFFERS = 4u * 1024u * 1024u; ///< The maximum number of bytes of the layer buffers kept for reuse.
+
 /**
- * @brief Fast multiply & divide by 255. It wiil be useful when we applying alpha value in color
+ * @brief The layer buffers kept for reuse by the renders of all the typesetters.
  *
- * @param x The value between [0..255]
- * @param y The value between [0..255]
- * @return (x*y)/255
+ * A text visual keeps its typesetter while idle, so the pool is not owned by a typesetter.
+ * It's bounded by the number of bytes, the least recently released buffers are freed first.
  */
-inline uint8_t MultiplyAndNormalizeColor(const uint8_t x, const uint8_t y) noexcept
+struct LayerBufferPool
 {
-  const uint32_t xy = static_cast<const uint32_t>(x) * y;
-  return ((xy << 15) + (xy << 7) + xy) >> 23;
+  Dali::Mutex                     mutex;
+  std::vector<Devel::PixelBuffer> buffers;   ///< The buffers, from the least to the most recently released.
+  std::size_t                     size = 0u; ///< The number of bytes of the buffers.
+};
+
+LayerBufferPool& GetLayerBufferPool()
+{
+  static LayerBufferPool pool;
+  return pool;
+}
+
+std::size_t GetLayerBufferSize(const Devel::PixelBuffer& layerBuffer)
+{
+  return static_cast<std::size_t>(layerBuffer.GetWidth()) * layerBuffer.GetHeight() * Pixel::GetBytesPerPixel(layerBuffer.GetPixelFormat());
 }
 
 /**
- * @brief Fast multiply & Summation & divide by 255.
- *
- * @param x1 The value between [0..255]
- * @param y1 The value between [0..255]
- * @param x2 The value between [0..255]
- * @param y2 The value between [0..255]
- * @return min(255, (x1*y1)/255 + (x2*y2)/255)
+ * @brief The glyph bitmaps created once per glyph and shared by the layers rendered in the same pass.
  */
-inline uint8_t MultiplyAndSummationAndNormalizeColor(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2) noexcept
+enum GlyphBitmapType
 {
-  const uint32_t xy1 = static_cast<const uint32_t>(x1) * y1;
-  const uint32_t xy2 = static_cast<const uint32_t>(x2) * y2;
-  const uint32_t res = std::min(65025u, xy1 + xy2); // 65025 is 255 * 255.
-  return ((res + ((res + 257) >> 8)) >> 8); // fast divide by 255.
-}
+  GLYPH_BITMAP_PLAIN,    ///< The bitmap of the glyph, used by the text, the mask and the background.
+  GLYPH_BITMAP_OUTLINED, ///< The bitmap of the glyph with the outline width, used by the outline and the shadow.
+  GLYPH_BITMAP_COUNT
+};
 
 /// Helper macro define for glyph typesetter. It will reduce some duplicated code line.
 // clang-format off
 /**
  * @brief Prepare decode glyph bitmap data. It must be call END_GLYPH_BITMAP end of same scope.
  */
-#define BEGIN_GLYPH_BITMAP(data)                                                                                                                \
-{                                                                                                                                               \
-  uint32_t   glyphOffet               = 0u;                                                                                                     \
-  const bool useLocalScanline         = data.glyphBitmap.compressionType != TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;  \
-  uint8_t* __restrict__ glyphScanline = useLocalScanline ? (uint8_t*)malloc(data.glyphBitmap.width * glyphPixelSize) : data.glyphBitmap.buffer; \
+#define BEGIN_GLYPH_BITMAP(glyphBitmap)                                                                                                   \
+{                                                                                                                                         \
+  uint32_t   glyphOffet               = 0u;                                                                                               \
+  const bool useLocalScanline         = glyphBitmap.compressionType != TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION; \
+  uint8_t* __restrict__ glyphScanline = useLocalScanline ? (uint8_t*)malloc(glyphBitmap.width * glyphPixelSize) : glyphBitmap.buffer;     \
   DALI_ASSERT_ALWAYS(glyphScanline && "Glyph scanline for buffer is null!");
 
 /**
  * @brief Macro to skip useless line fast.
  */
-#define SKIP_GLYPH_SCANLINE(skipLine)                                                                  \
-if(useLocalScanline)                                                                                   \
-{                                                                                                      \
-  for(int32_t lineIndex = 0; lineIndex < skipLine; ++lineIndex)                                        \
-  {                                                                                                    \
-    TextAbstraction::GlyphBufferData::DecompressScanline(data.glyphBitmap, glyphScanline, glyphOffet); \
-  }                                                                                                    \
-}                                                                                                      \
-else                                                                                                   \
-{                                                                                                      \
-  glyphScanline += skipLine * static_cast<int32_t>(data.glyphBitmap.width * glyphPixelSize);           \
+#define SKIP_GLYPH_SCANLINE(skipLine)                                                             \
+if(useLocalScanline)                                                                              \
+{                                                                                                 \
+  for(int32_t lineIndex = 0; lineIndex < skipLine; ++lineIndex)                                   \
+  {                                                                                               \
+    TextAbstraction::GlyphBufferData::DecompressScanline(glyphBitmap, glyphScanline, glyphOffet); \
+  }                                                                                               \
+}                                                                                                 \
+else                                                                                              \
+{                                                                                                 \
+  glyphScanline += skipLine * static_cast<int32_t>(glyphBitmap.width * glyphPixelSize);           \
 }
 
 /**
  * @brief Prepare scanline of glyph bitmap data per each lines. It must be call END_GLYPH_SCANLINE_DECODE end of same scope.
  */
-#define BEGIN_GLYPH_SCANLINE_DECODE(data)                                                              \
-{                                                                                                      \
-  if(useLocalScanline)                                                                                 \
-  {                                                                                                    \
-    TextAbstraction::GlyphBufferData::DecompressScanline(data.glyphBitmap, glyphScanline, glyphOffet); \
+#define BEGIN_GLYPH_SCANLINE_DECODE(glyphBitmap)                                                  \
+{                                                                                                 \
+  if(useLocalScanline)                                                                            \
+  {                                                                                               \
+    TextAbstraction::GlyphBufferData::DecompressScanline(glyphBitmap, glyphScanline, glyphOffet); \
   }
 
 /**
  * @brief Finalize scanline of glyph bitmap data per each lines.
  */
-#define END_GLYPH_SCANLINE_DECODE(data)                       \
-  if(!useLocalScanline)                                       \
-  {                                                           \
-    glyphScanline += data.glyphBitmap.width * glyphPixelSize; \
-  }                                                           \
+#define END_GLYPH_SCANLINE_DECODE(glyphBitmap)           \
+  if(!useLocalScanline)                                  \
+  {                                                      \
+    glyphScanline += glyphBitmap.width * glyphPixelSize; \
+  }                                                      \
 } // For ensure that we call BEGIN_GLYPH_SCANLINE_DECODE before
 
 /**
@@ -145,31 +154,31 @@ else
  */
 struct GlyphData
 {
-  Devel::PixelBuffer               bitmapBuffer;     ///< The buffer of the whole bitmap. The format is RGBA8888.
-  Vector2*                         position;         ///< The position of the glyph.
-  TextAbstraction::GlyphBufferData glyphBitmap;      ///< The glyph's bitmap.
-  uint32_t                         width;            ///< The bitmap's width.
-  uint32_t                         height;           ///< The bitmap's height.
-  int32_t                          horizontalOffset; ///< The horizontal offset to be added to the 'x' glyph's position.
-  int32_t                          verticalOffset;   ///< The vertical offset to be added to the 'y' glyph's position.
+  Devel::PixelBuffer bitmapBuffer;     ///< The buffer of the whole bitmap. The format is RGBA8888.
+  uint32_t           width;            ///< The bitmap's width.
+  uint32_t           height;           ///< The bitmap's height.
+  int32_t            horizontalOffset; ///< The horizontal offset to be added to the 'x' glyph's position.
+  int32_t            verticalOffset;   ///< The vertical offset to be added to the 'y' glyph's position.
 };
 
 /**
  * @brief Sets the glyph's buffer into the bitmap's buffer.
  *
- * @param[in, out] data Struct which contains the glyph's data and the bitmap's data.
+ * @param[in, out] data Struct which contains the bitmap's data.
+ * @param[in] glyphBitmap The glyph's bitmap.
  * @param[in] position The position of the glyph.
  * @param[in] color The color of the glyph.
  * @param[in] style The style of the text.
  * @param[in] pixelFormat The format of the pixel in the image that the text is rendered as (i.e. either Pixel::BGRA8888 or Pixel::L8).
  */
 void TypesetGlyph(GlyphData& __restrict__ data,
+                  const TextAbstraction::GlyphBufferData& __restrict__ glyphBitmap,
                   const Vector2* const __restrict__ position,
                   const Vector4* const __restrict__ color,
                   const Typesetter::Style style,
                   const Pixel::Format     pixelFormat)
 {
-  if((0u == data.glyphBitmap.width) || (0u == data.glyphBitmap.height))
+  if((0u == glyphBitmap.width) || (0u == glyphBitmap.height))
   {
     // Nothing to do if the width or height of the buffer is zero.
     return;
@@ -180,15 +189,15 @@ void TypesetGlyph(GlyphData& __restrict__ data,
   const int32_t xOffset = data.horizontalOffset + position->x;
 
   // Whether the given glyph is a color one.
-  const bool     isColorGlyph    = data.glyphBitmap.isColorEmoji || data.glyphBitmap.isColorBitmap;
-  const uint32_t glyphPixelSize  = Pixel::GetBytesPerPixel(data.glyphBitmap.format);
+  const bool     isColorGlyph    = glyphBitmap.isColorEmoji || glyphBitmap.isColorBitmap;
+  const uint32_t glyphPixelSize  = Pixel::GetBytesPerPixel(glyphBitmap.format);
   const uint32_t glyphAlphaIndex = (glyphPixelSize > 0u) ? glyphPixelSize - 1u : 0u;
 
   // Determinate iterator range.
   const int32_t lineIndexRangeMin = std::max(0, -yOffset);
-  const int32_t lineIndexRangeMax = std::min(static_cast<int32_t>(data.glyphBitmap.height), static_cast<int32_t>(data.height) - yOffset);
+  const int32_t lineIndexRangeMax = std::min(static_cast<int32_t>(glyphBitmap.height), static_cast<int32_t>(data.height) - yOffset);
   const int32_t indexRangeMin     = std::max(0, -xOffset);
-  const int32_t indexRangeMax     = std::min(static_cast<int32_t>(data.glyphBitmap.width), static_cast<int32_t>(data.width) - xOffset);
+  const int32_t indexRangeMax     = std::min(static_cast<int32_t>(glyphBitmap.width), static_cast<int32_t>(data.width) - xOffset);
 
   // If current glyph don't need to be rendered, just ignore.
   if(lineIndexRangeMax <= lineIndexRangeMin || indexRangeMax <= indexRangeMin)
@@ -215,7 +224,7 @@ void TypesetGlyph(GlyphData& __restrict__ data,
       return;
     }
 
-    const bool swapChannelsBR = Pixel::BGRA8888 == data.glyphBitmap.format;
+    const bool swapChannelsBR = Pixel::BGRA8888 == glyphBitmap.format;
 
     // Precalculate input color's packed result.
     uint32_t packedInputColor                    = 0u;
@@ -227,7 +236,7 @@ void TypesetGlyph(GlyphData& __restrict__ data,
     *(packedInputColorBuffer)      = static_cast<uint8_t>(color->r * 255);
 
     // Prepare glyph bitmap
-    BEGIN_GLYPH_BITMAP(data);
+    BEGIN_GLYPH_BITMAP(glyphBitmap);
 
     // Skip basic line of glyph.
     SKIP_GLYPH_SCANLINE(lineIndexRangeMin);
@@ -237,7 +246,7 @@ void TypesetGlyph(GlyphData& __restrict__ data,
     {
       for(int32_t lineIndex = lineIndexRangeMin; lineIndex < lineIndexRangeMax; ++lineIndex)
       {
-        BEGIN_GLYPH_SCANLINE_DECODE(data);
+        BEGIN_GLYPH_SCANLINE_DECODE(glyphBitmap);
 
         for(int32_t index = indexRangeMin; index < indexRangeMax; ++index)
         {
@@ -269,7 +278,7 @@ void TypesetGlyph(GlyphData& __restrict__ data,
             *(packedColorGlyphBuffer + 1u) = MultiplyAndNormalizeColor(*(packedColorGlyphBuffer + 1u), colorAlpha);
             *packedColorGlyphBuffer        = MultiplyAndNormalizeColor(*packedColorGlyphBuffer, colorAlpha);
 
-            if(data.glyphBitmap.isColorBitmap)
+            if(glyphBitmap.isColorBitmap)
             {
               *(packedColorGlyphBuffer + 2u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 2u), *(packedColorGlyphBuffer + 2u));
               *(packedColorGlyphBuffer + 1u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 1u), *(packedColorGlyphBuffer + 1u));
@@ -283,62 +292,25 @@ void TypesetGlyph(GlyphData& __restrict__ data,
 
         bitmapBuffer += data.width;
 
-        END_GLYPH_SCANLINE_DECODE(data);
+        END_GLYPH_SCANLINE_DECODE(glyphBitmap);
       }
     }
     else
     {
+      const PixelKernels& kernels = GetPixelKernels();
+
       for(int32_t lineIndex = lineIndexRangeMin; lineIndex < lineIndexRangeMax; ++lineIndex)
       {
-        BEGIN_GLYPH_SCANLINE_DECODE(data);
-
-        for(int32_t index = indexRangeMin; index < indexRangeMax; ++index)
-        {
-          // Update the alpha channel.
-          const uint8_t alpha = *(glyphScanline + index * glyphPixelSize + glyphAlphaIndex);
+        BEGIN_GLYPH_SCANLINE_DECODE(glyphBitmap);
 
-          // Copy non-transparent pixels only
-          if(alpha > 0u)
-          {
-            const int32_t xOffsetIndex = xOffset + index;
-
-            // Check alpha of overlapped pixels
-            uint32_t& currentColor             = *(bitmapBuffer + xOffsetIndex);
-            uint8_t*  packedCurrentColorBuffer = reinterpret_cast<uint8_t*>(&currentColor);
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            uint8_t currentAlpha = *(packedCurrentColorBuffer + 3u);
-            currentAlpha         = std::max(currentAlpha, alpha);
-            if(currentAlpha == 255)
-            {
-              // Fast-cut to avoid float type operation.
-              currentColor = packedInputColor;
-            }
-            else
-            {
-              // Pack the given color into a 32bit buffer. The alpha channel will be updated later for each pixel.
-              // The format is RGBA8888.
-              uint32_t packedColor                    = 0u;
-              uint8_t* __restrict__ packedColorBuffer = reinterpret_cast<uint8_t*>(&packedColor);
-
-              // Color is pre-muliplied with its alpha.
-              *(packedColorBuffer + 3u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 3u), currentAlpha);
-              *(packedColorBuffer + 2u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 2u), currentAlpha);
-              *(packedColorBuffer + 1u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 1u), currentAlpha);
-              *(packedColorBuffer)      = MultiplyAndNormalizeColor(*packedInputColorBuffer, currentAlpha);
-
-              // Set the color into the final pixel buffer.
-              currentColor = packedColor;
-            }
-          }
-        }
+        // Copy non-transparent pixels only, keeping the bigger alpha of overlapped pixels
+        // (in order to avoid semi-transparent gaps between joint glyphs with overlapped pixels, which could
+        // happen, for example, in the RTL text when we copy glyphs from right to left).
+        kernels.blitGlyph(glyphScanline + indexRangeMin * glyphPixelSize + glyphAlphaIndex, glyphPixelSize, packedInputColor, bitmapBuffer + xOffset + indexRangeMin, indexRangeMax - indexRangeMin);
 
         bitmapBuffer += data.width;
 
-        END_GLYPH_SCANLINE_DECODE(data);
+        END_GLYPH_SCANLINE_DECODE(glyphBitmap);
       }
     }
 
@@ -354,40 +326,24 @@ void TypesetGlyph(GlyphData& __restrict__ data,
       bitmapBuffer += (lineIndexRangeMin + yOffset) * static_cast<int32_t>(data.width);
 
       // Prepare glyph bitmap
-      BEGIN_GLYPH_BITMAP(data);
+      BEGIN_GLYPH_BITMAP(glyphBitmap);
 
       // Skip basic line of glyph.
       SKIP_GLYPH_SCANLINE(lineIndexRangeMin);
 
+      const PixelKernels& kernels = GetPixelKernels();
+
       // Traverse the pixels of the glyph line per line.
       for(int32_t lineIndex = lineIndexRangeMin; lineIndex < lineIndexRangeMax; ++lineIndex)
       {
-        BEGIN_GLYPH_SCANLINE_DECODE(data);
+        BEGIN_GLYPH_SCANLINE_DECODE(glyphBitmap);
 
-        for(int32_t index = indexRangeMin; index < indexRangeMax; ++index)
-        {
-          const int32_t xOffsetIndex = xOffset + index;
-
-          // Update the alpha channel.
-          const uint8_t alpha = *(glyphScanline + index * glyphPixelSize + glyphAlphaIndex);
-
-          // Copy non-transparent pixels only
-          if(alpha > 0u)
-          {
-            // Check alpha of overlapped pixels
-            uint8_t& currentAlpha = *(bitmapBuffer + xOffsetIndex);
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            currentAlpha = std::max(currentAlpha, alpha);
-          }
-        }
+        // Keep the bigger alpha of overlapped pixels.
+        kernels.blitGlyphAlpha(glyphScanline + indexRangeMin * glyphPixelSize + glyphAlphaIndex, glyphPixelSize, bitmapBuffer + xOffset + indexRangeMin, indexRangeMax - indexRangeMin);
 
         bitmapBuffer += data.width;
 
-        END_GLYPH_SCANLINE_DECODE(data);
+        END_GLYPH_SCANLINE_DECODE(glyphBitmap);
       }
 
       END_GLYPH_BITMAP();
@@ -873,58 +829,92 @@ void CombineImageBuffer(Devel::PixelBuffer& __restrict__ topPixelBuffer, Devel::
     return;
   }
 
-  const uint32_t bufferSizeInt = bufferWidth * bufferHeight;
+  // Note : The combined buffer is the same as one of the input buffers.
+  uint32_t* combinedBuffer = storeResultIntoTop ? topBuffer : bottomBuffer;
 
-  uint32_t* __restrict__ combinedBuffer       = storeResultIntoTop ? topBuffer : bottomBuffer;
-  uint8_t* __restrict__ topAlphaBufferPointer = reinterpret_cast<uint8_t*>(topBuffer) + 3;
+  GetPixelKernels().combine(topBuffer, bottomBuffer, combinedBuffer, bufferWidth * bufferHeight);
+}
 
-  for(uint32_t pixelIndex = 0; pixelIndex < bufferSizeInt; ++pixelIndex)
+/**
+ * @brief Combine the top RGBA image buffer with several RGBA layers under it.
+ *
+ * Gives the same result as combining the top buffer with each layer in turn with CombineImageBuffer(),
+ * storing the result into the top buffer, but blends each scanline with all the layers at once so the
+ * scanline of the result is read and written only once.
+ *
+ * @param[in, out] topPixelBuffer The top layer buffer. The result is stored into it.
+ * @param[in] layerPixelBuffers The layer buffers under the top one, from the nearest to the farthest.
+ * @param[in] numberOfLayers The number of layer buffers.
+ * @param[in] fillBottom Whether to blend a solid color under all the layers.
+ * @param[in] packedFillColor The pre-multiplied RGBA color of the solid layer.
+ * @param[in] bufferWidth The width of the image buffers.
+ * @param[in] bufferHeight The height of the image buffers.
+ */
+void CombineImageBufferLayers(Devel::PixelBuffer& topPixelBuffer, const Devel::PixelBuffer* const layerPixelBuffers, const uint32_t numberOfLayers, const bool fillBottom, const uint32_t packedFillColor, const uint32_t bufferWidth, const uint32_t bufferHeight)
+{
+  uint32_t* topBuffer = reinterpret_cast<uint32_t*>(topPixelBuffer.GetBuffer());
+  if(topBuffer == NULL)
   {
-    // If the alpha of the pixel in either buffer is not fully opaque, blend the two pixels.
-    // Otherwise, copy pixel from topBuffer to combinedBuffer.
-    // Note : Be careful when we read & write into combinedBuffer. It can be write into same pointer.
+    // Nothing to do if the top buffer is empty.
+    return;
+  }
 
-    uint8_t topAlpha = *topAlphaBufferPointer;
+  const uint32_t* layerBuffers[MAX_NUMBER_OF_LAYERS];
+  for(uint32_t layerIndex = 0u; layerIndex < numberOfLayers; ++layerIndex)
+  {
+    layerBuffers[layerIndex] = reinterpret_cast<const uint32_t*>(layerPixelBuffers[layerIndex].GetBuffer());
+  }
 
-    if(topAlpha == 0)
-    {
-      // Copy the pixel from bottomBuffer to combinedBuffer
-      if(storeResultIntoTop)
-      {
-        *(combinedBuffer) = *(bottomBuffer);
-      }
-    }
-    else if(topAlpha == 255)
+  // The solid layer is blended as a scanline filled with its color.
+  std::vector<uint32_t> fillScanline;
+  if(fillBottom)
+  {
+    fillScanline.resize(bufferWidth, packedFillColor);
+  }
+
+  const PixelKernels& kernels = GetPixelKernels();
+
+  for(uint32_t y = 0u; y < bufferHeight; ++y)
+  {
+    for(uint32_t layerIndex = 0u; layerIndex <= numberOfLayers; ++layerIndex)
     {
-      // Copy the pixel from topBuffer to combinedBuffer
-      if(!storeResultIntoTop)
+      const bool isFillLayer = (layerIndex == numberOfLayers);
+      if(isFillLayer ? !fillBottom : (layerBuffers[layerIndex] == NULL))
       {
-        *(combinedBuffer) = *(topBuffer);
+        continue;
       }
-    }
-    else
-    {
-      // At least one pixel is not fully opaque
-      // "Over" blend the the pixel from topBuffer with the pixel in bottomBuffer
-      uint32_t blendedBottomBufferColor                    = *(bottomBuffer);
-      uint8_t* __restrict__ blendedBottomBufferColorBuffer = reinterpret_cast<uint8_t*>(&blendedBottomBufferColor);
 
-      blendedBottomBufferColorBuffer[0] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[0], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[1] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[1], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[2] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[2], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[3] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[3], 255 - topAlpha);
-
-      *(combinedBuffer) = *(topBuffer) + blendedBottomBufferColor;
+      // Same "over" blend as CombineImageBuffer().
+      const uint32_t* bottomBuffer = isFillLayer ? fillScanline.data() : layerBuffers[layerIndex] + y * bufferWidth;
+      kernels.combine(topBuffer, bottomBuffer, topBuffer, bufferWidth);
     }
 
-    // Increase each buffer's pointer.
-    ++combinedBuffer;
-    ++topBuffer;
-    ++bottomBuffer;
-    topAlphaBufferPointer += sizeof(uint32_t) / sizeof(uint8_t);
+    topBuffer += bufferWidth;
   }
 }
 
+/**
+ * @brief Packs the color into a pre-multiplied RGBA8888 pixel.
+ *
+ * @param[in] color The color.
+ *
+ * @return The packed color.
+ */
+inline uint32_t PackColor(const Vector4& color)
+{
+  const uint8_t colorAlpha = static_cast<uint8_t>(color.a * 255.f);
+
+  uint32_t packedColor       = 0u;
+  uint8_t* packedColorBuffer = reinterpret_cast<uint8_t*>(&packedColor);
+
+  *(packedColorBuffer + 3u) = colorAlpha;
+  *(packedColorBuffer + 2u) = static_cast<uint8_t>(color.b * colorAlpha);
+  *(packedColorBuffer + 1u) = static_cast<uint8_t>(color.g * colorAlpha);
+  *(packedColorBuffer)      = static_cast<uint8_t>(color.r * colorAlpha);
+
+  return packedColor;
+}
+
 } // namespace
 
 TypesetterPtr Typesetter::New(const ModelInterface* const model)
@@ -1019,59 +1009,74 @@ Devel::PixelBuffer Typesetter::RenderWithPixelBuffer(const Vector2& size, Toolki
     penY = offset.y;
   }
 
-  // Generate the image buffers of the text for each different style first,
-  // then combine all of them together as one final image buffer. We try to
-  // do all of these in CPU only, so that once the final texture is generated,
-  // no calculation is needed in GPU during each frame.
+  // Generate the image buffers of the text for each different style in a
+  // single pass over the glyphs, then combine all of them together as one
+  // final image buffer. We try to do all of these in CPU only, so that once
+  // the final texture is generated, no calculation is needed in GPU during
+  // each frame.
 
   const uint32_t bufferWidth  = static_cast<uint32_t>(size.width);
   const uint32_t bufferHeight = static_cast<uint32_t>(size.height);
 
-  const uint32_t bufferSizeInt  = bufferWidth * bufferHeight;
-  const size_t   bufferSizeChar = sizeof(uint32_t) * static_cast<std::size_t>(bufferSizeInt);
-
   //Elided text in ellipsis at START could start on index greater than 0
   auto startIndexOfGlyphs = mModel->GetStartIndexOfElidedGlyphs();
   auto endIndexOfGlyphs   = mModel->GetEndIndexOfElidedGlyphs();
 
-  Devel::PixelBuffer imageBuffer;
-
   if(RENDER_MASK == behaviour)
   {
     // Generate the image buffer as an alpha mask for color glyphs.
-    imageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_MASK, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
+    return CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_MASK, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
   }
-  else if(RENDER_NO_TEXT == behaviour || RENDER_OVERLAY_STYLE == behaviour)
+
+  if(RENDER_NO_STYLES == behaviour)
   {
-    // Generate an empty image buffer so that it can been combined with the image buffers for styles
-    imageBuffer = Devel::PixelBuffer::New(bufferWidth, bufferHeight, Pixel::RGBA8888);
-    memset(imageBuffer.GetBuffer(), 0u, bufferSizeChar);
+    // Generate the image buffer for the text with no style.
+    return CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_NONE, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
+  }
+
+  // The styles rendered in the pass over the glyphs and their buffers.
+  Typesetter::Style  layerStyles[MAX_NUMBER_OF_LAYERS];
+  Devel::PixelBuffer layerBuffers[MAX_NUMBER_OF_LAYERS];
+  uint32_t           numberOfLayers = 0u;
+
+  // The buffers blended under the text, from the nearest to the farthest.
+  Devel::PixelBuffer bottomBuffers[MAX_NUMBER_OF_LAYERS];
+  uint32_t           numberOfBottomBuffers = 0u;
+
+  Devel::PixelBuffer imageBuffer;
+  if(RENDER_TEXT_AND_STYLES == behaviour)
+  {
+    // The image buffer for the text with no style is the top layer.
+    imageBuffer = CreateTransparentImageBuffer(bufferWidth, bufferHeight, pixelFormat);
+
+    layerStyles[numberOfLayers]    = Typesetter::STYLE_NONE;
+    layerBuffers[numberOfLayers++] = imageBuffer;
   }
   else
   {
-    // Generate the image buffer for the text with no style.
-    imageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_NONE, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
+    // Generate an empty image buffer so that it can been combined with the image buffers for styles
+    imageBuffer = CreateTransparentImageBuffer(bufferWidth, bufferHeight, Pixel::RGBA8888);
   }
 
-  if((RENDER_NO_STYLES != behaviour) && (RENDER_MASK != behaviour))
+  Devel::PixelBuffer outlineImageBuffer;
+  Devel::PixelBuffer shadowImageBuffer;
+  Devel::PixelBuffer backgroundImageBuffer;
+
+  const bool backgroundEnabled   = mModel->IsBackgroundEnabled();
+  const bool backgroundMarkupSet = mModel->IsMarkupBackgroundColorSet();
+
+  if(RENDER_OVERLAY_STYLE != behaviour)
   {
     // Generate the outline if enabled
     const uint16_t outlineWidth = mModel->GetOutlineWidth();
     const float    outlineAlpha = mModel->GetOutlineColor().a;
-    if(outlineWidth != 0u && fabsf(outlineAlpha) > Math::MACHINE_EPSILON_1 && RENDER_OVERLAY_STYLE != behaviour)
+    if(outlineWidth != 0u && fabsf(outlineAlpha) > Math::MACHINE_EPSILON_1)
     {
-      // Create the image buffer for outline
-      Devel::PixelBuffer outlineImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_OUTLINE, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
-
-      const float& blurRadius = mModel->GetOutlineBlurRadius();
-
-      if(blurRadius > Math::MACHINE_EPSILON_1)
-      {
-        outlineImageBuffer.ApplyGaussianBlur(blurRadius);
-      }
+      outlineImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
 
-      // Combine the two buffers
-      CombineImageBuffer(imageBuffer, outlineImageBuffer, bufferWidth, bufferHeight, true);
+      layerStyles[numberOfLayers]            = Typesetter::STYLE_OUTLINE;
+      layerBuffers[numberOfLayers++]         = outlineImageBuffer;
+      bottomBuffers[numberOfBottomBuffers++] = outlineImageBuffer;
     }
 
     // @todo. Support shadow for partial text later on.
@@ -1079,93 +1084,103 @@ Devel::PixelBuffer Typesetter::RenderWithPixelBuffer(const Vector2& size, Toolki
     // Generate the shadow if enabled
     const Vector2& shadowOffset = mModel->GetShadowOffset();
     const float    shadowAlpha  = mModel->GetShadowColor().a;
-    if(RENDER_OVERLAY_STYLE != behaviour && fabsf(shadowAlpha) > Math::MACHINE_EPSILON_1 && (fabsf(shadowOffset.x) > Math::MACHINE_EPSILON_1 || fabsf(shadowOffset.y) > Math::MACHINE_EPSILON_1))
+    if(fabsf(shadowAlpha) > Math::MACHINE_EPSILON_1 && (fabsf(shadowOffset.x) > Math::MACHINE_EPSILON_1 || fabsf(shadowOffset.y) > Math::MACHINE_EPSILON_1))
     {
-      // Create the image buffer for shadow
-      Devel::PixelBuffer shadowImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_SHADOW, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
-
-      // Check whether it will be a soft shadow
-      const float& blurRadius = mModel->GetShadowBlurRadius();
-
-      if(blurRadius > Math::MACHINE_EPSILON_1)
-      {
-        shadowImageBuffer.ApplyGaussianBlur(blurRadius);
-      }
+      shadowImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
 
-      // Combine the two buffers
-      CombineImageBuffer(imageBuffer, shadowImageBuffer, bufferWidth, bufferHeight, true);
+      layerStyles[numberOfLayers]            = Typesetter::STYLE_SHADOW;
+      layerBuffers[numberOfLayers++]         = shadowImageBuffer;
+      bottomBuffers[numberOfBottomBuffers++] = shadowImageBuffer;
     }
 
     // Generate the background if enabled
-    const bool backgroundEnabled   = mModel->IsBackgroundEnabled();
-    const bool backgroundMarkupSet = mModel->IsMarkupBackgroundColorSet();
-    if((backgroundEnabled || backgroundMarkupSet) && RENDER_OVERLAY_STYLE != behaviour)
+    if(backgroundEnabled || backgroundMarkupSet)
     {
-      Devel::PixelBuffer backgroundImageBuffer;
+      backgroundImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
 
       if(backgroundEnabled)
       {
-        backgroundImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_BACKGROUND, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
-      }
-      else
-      {
-        backgroundImageBuffer = CreateTransparentImageBuffer(bufferWidth, bufferHeight, pixelFormat);
-      }
-
-      if(backgroundMarkupSet)
-      {
-        DrawGlyphsBackground(mModel, backgroundImageBuffer, bufferWidth, bufferHeight, ignoreHorizontalAlignment, penX, penY);
+        layerStyles[numberOfLayers]    = Typesetter::STYLE_BACKGROUND;
+        layerBuffers[numberOfLayers++] = backgroundImageBuffer;
       }
+      bottomBuffers[numberOfBottomBuffers++] = backgroundImageBuffer;
+    }
+  }
+  else
+  {
+    if(mModel->IsUnderlineEnabled())
+    {
+      // Create the image buffer for underline
+      Devel::PixelBuffer underlineImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
 
-      // Combine the two buffers
-      CombineImageBuffer(imageBuffer, backgroundImageBuffer, bufferWidth, bufferHeight, true);
+      layerStyles[numberOfLayers]            = Typesetter::STYLE_UNDERLINE;
+      layerBuffers[numberOfLayers++]         = underlineImageBuffer;
+      bottomBuffers[numberOfBottomBuffers++] = underlineImageBuffer;
     }
 
-    // Generate the background_with_mask if enabled
-    const bool backgroundWithCutoutEnabled   = mModel->IsBackgroundWithCutoutEnabled();
-    if((backgroundWithCutoutEnabled) && RENDER_OVERLAY_STYLE != behaviour)
+    if(mModel->IsStrikethroughEnabled())
     {
-      Devel::PixelBuffer backgroundImageBuffer;
+      // Create the image buffer for strikethrough
+      Devel::PixelBuffer strikethroughImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
 
-      backgroundImageBuffer = CreateFullBackgroundBuffer(bufferWidth, bufferHeight, mModel->GetBackgroundColorWithCutout());
+      layerStyles[numberOfLayers]            = Typesetter::STYLE_STRIKETHROUGH;
+      layerBuffers[numberOfLayers++]         = strikethroughImageBuffer;
+      bottomBuffers[numberOfBottomBuffers++] = strikethroughImageBuffer;
+    }
+  }
 
-      // Combine the two buffers
-      CombineImageBuffer(imageBuffer, backgroundImageBuffer, bufferWidth, bufferHeight, true);
+  // Render all the layers with a single traversal of the glyphs.
+  CreateImageBuffers(bufferWidth, bufferHeight, layerStyles, layerBuffers, numberOfLayers, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
+
+  if(outlineImageBuffer)
+  {
+    const float& blurRadius = mModel->GetOutlineBlurRadius();
+
+    if(blurRadius > Math::MACHINE_EPSILON_1)
+    {
+      outlineImageBuffer.ApplyGaussianBlur(blurRadius);
     }
+  }
+
+  if(shadowImageBuffer)
+  {
+    // Check whether it will be a soft shadow
+    const float& blurRadius = mModel->GetShadowBlurRadius();
 
-    if(RENDER_OVERLAY_STYLE == behaviour)
+    if(blurRadius > Math::MACHINE_EPSILON_1)
     {
-      if(mModel->IsUnderlineEnabled())
-      {
-        // Create the image buffer for underline
-        Devel::PixelBuffer underlineImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_UNDERLINE, ignoreHorizontalAlignment, pixelFormat, penX, penY, startIndexOfGlyphs, endIndexOfGlyphs);
+      shadowImageBuffer.ApplyGaussianBlur(blurRadius);
+    }
+  }
 
-        // Combine the two buffers
-        CombineImageBuffer(imageBuffer, underlineImageBuffer, bufferWidth, bufferHeight, true);
-      }
+  if(backgroundImageBuffer && backgroundMarkupSet)
+  {
+    DrawGlyphsBackground(mModel, backgroundImageBuffer, bufferWidth, bufferHeight, ignoreHorizontalAlignment, penX, penY);
+  }
 
-      if(mModel->IsStrikethroughEnabled())
-      {
-        // Create the image buffer for strikethrough
-        Devel::PixelBuffer strikethroughImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_STRIKETHROUGH, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, endIndexOfGlyphs);
+  // The background_with_mask is a solid color, there is no need of a buffer for it.
+  const bool backgroundWithCutoutEnabled = mModel->IsBackgroundWithCutoutEnabled() && (RENDER_OVERLAY_STYLE != behaviour);
 
-        // Combine the two buffers
-        CombineImageBuffer(imageBuffer, strikethroughImageBuffer, bufferWidth, bufferHeight, true);
-      }
+  // Combine all the buffers, scanline by scanline.
+  CombineImageBufferLayers(imageBuffer, bottomBuffers, numberOfBottomBuffers, backgroundWithCutoutEnabled, backgroundWithCutoutEnabled ? PackColor(mModel->GetBackgroundColorWithCutout()) : 0u, bufferWidth, bufferHeight);
 
-      // Markup-Processor for overlay styles
-      if(mModel->IsMarkupProcessorEnabled() || mModel->IsSpannedTextPlaced())
-      {
-        if(mModel->IsMarkupUnderlineSet())
-        {
-          imageBuffer = ApplyUnderlineMarkupImageBuffer(imageBuffer, bufferWidth, bufferHeight, ignoreHorizontalAlignment, pixelFormat, penX, penY);
-        }
+  // The layer buffers can be reused by the next render.
+  for(uint32_t index = 0u; index < numberOfBottomBuffers; ++index)
+  {
+    ReleaseLayerBuffer(bottomBuffers[index]);
+  }
 
-        if(mModel->IsMarkupStrikethroughSet())
-        {
-          imageBuffer = ApplyStrikethroughMarkupImageBuffer(imageBuffer, bufferWidth, bufferHeight, ignoreHorizontalAlignment, pixelFormat, penX, penY);
-        }
-      }
+  // Markup-Processor for overlay styles
+  if(RENDER_OVERLAY_STYLE == behaviour && (mModel->IsMarkupProcessorEnabled() || mModel->IsSpannedTextPlaced()))
+  {
+    if(mModel->IsMarkupUnderlineSet())
+    {
+      imageBuffer = ApplyUnderlineMarkupImageBuffer(imageBuffer, bufferWidth, bufferHeight, ignoreHorizontalAlignment, pixelFormat, penX, penY);
+    }
+
+    if(mModel->IsMarkupStrikethroughSet())
+    {
+      imageBuffer = ApplyStrikethroughMarkupImageBuffer(imageBuffer, bufferWidth, bufferHeight, ignoreHorizontalAlignment, pixelFormat, penX, penY);
     }
   }
 
@@ -1175,28 +1190,30 @@ Devel::PixelBuffer Typesetter::RenderWithPixelBuffer(const Vector2& size, Toolki
 Devel::PixelBuffer Typesetter::CreateFullBackgroundBuffer(const uint32_t bufferWidth, const uint32_t bufferHeight, const Vector4& backgroundColor)
 {
   const uint32_t bufferSizeInt = bufferWidth * bufferHeight;
-  uint8_t backgroundColorAlpha = static_cast<uint8_t>(backgroundColor.a * 255.f);
 
   Devel::PixelBuffer buffer = Devel::PixelBuffer::New(bufferWidth, bufferHeight, Pixel::RGBA8888);
 
   uint32_t* bitmapBuffer = reinterpret_cast<uint32_t*>(buffer.GetBuffer());
 
-  uint32_t packedBackgroundColor       = 0u;
-  uint8_t* packedBackgroundColorBuffer = reinterpret_cast<uint8_t*>(&packedBackgroundColor);
-
   // Write the color to the pixel buffer
-  *(packedBackgroundColorBuffer + 3u) = backgroundColorAlpha;
-  *(packedBackgroundColorBuffer + 2u) = static_cast<uint8_t>(backgroundColor.b * backgroundColorAlpha);
-  *(packedBackgroundColorBuffer + 1u) = static_cast<uint8_t>(backgroundColor.g * backgroundColorAlpha);
-  *(packedBackgroundColorBuffer)      = static_cast<uint8_t>(backgroundColor.r * backgroundColorAlpha);
-
-  std::fill(bitmapBuffer, bitmapBuffer + bufferSizeInt, packedBackgroundColor);
+  std::fill(bitmapBuffer, bitmapBuffer + bufferSizeInt, PackColor(backgroundColor));
 
   return buffer;
 }
 
 Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t bufferWidth, const uint32_t bufferHeight, const Typesetter::Style style, const bool ignoreHorizontalAlignment, const Pixel::Format pixelFormat, const int32_t horizontalOffset, const int32_t verticalOffset, const GlyphIndex fromGlyphIndex, const GlyphIndex toGlyphIndex)
 {
+  Devel::PixelBuffer imageBuffer = CreateTransparentImageBuffer(bufferWidth, bufferHeight, pixelFormat);
+
+  CreateImageBuffers(bufferWidth, bufferHeight, &style, &imageBuffer, 1u, ignoreHorizontalAlignment, pixelFormat, horizontalOffset, verticalOffset, fromGlyphIndex, toGlyphIndex);
+
+  return imageBuffer;
+}
+
+void Typesetter::CreateImageBuffers(const uint32_t bufferWidth, const uint32_t bufferHeight, const Typesetter::Style* const styles, Devel::PixelBuffer* const imageBuffers, const uint32_t numberOfLayers, const bool ignoreHorizontalAlignment, const Pixel::Format pixelFormat, const int32_t horizontalOffset, const int32_t verticalOffset, const GlyphIndex fromGlyphIndex, const GlyphIndex toGlyphIndex)
+{
+  DALI_ASSERT_DEBUG(numberOfLayers <= MAX_NUMBER_OF_LAYERS && "Too many layers for a single pass");
+
   // Retrieve lines, glyphs, positions and colors from the view model.
   const Length modelNumberOfLines                       = mModel->GetNumberOfLines();
   const LineRun* const __restrict__ modelLinesBuffer    = mModel->GetLines();
@@ -1221,14 +1238,38 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t bufferWidth, con
   // Whether to use the default color.
   const bool     useDefaultColor = (NULL == colorsBuffer);
   const Vector4& defaultColor    = mModel->GetDefaultColor();
+  const Vector4  shadowColor     = mModel->GetShadowColor();
+  const Vector4  outlineColor    = mModel->GetOutlineColor();
 
-  // Create and initialize the pixel buffer.
-  GlyphData glyphData;
-  glyphData.verticalOffset   = verticalOffset;
-  glyphData.width            = bufferWidth;
-  glyphData.height           = bufferHeight;
-  glyphData.bitmapBuffer     = CreateTransparentImageBuffer(bufferWidth, bufferHeight, pixelFormat);
-  glyphData.horizontalOffset = 0;
+  // Retrieves the glyph's outline width. Without outline, the outline and the shadow share the bitmap of the text.
+  const float           outlineWidth        = static_cast<float>(mModel->GetOutlineWidth());
+  const GlyphBitmapType outlinedGlyphBitmap = (outlineWidth > 0.f) ? GLYPH_BITMAP_OUTLINED : GLYPH_BITMAP_PLAIN;
+
+  // Initialize the data of each layer and find out which glyph bitmaps are needed.
+  GlyphData layers[MAX_NUMBER_OF_LAYERS];
+  bool      isGlyphBitmapNeeded[GLYPH_BITMAP_COUNT] = {false, false};
+  for(uint32_t layerIndex = 0u; layerIndex < numberOfLayers; ++layerIndex)
+  {
+    GlyphData& glyphData       = layers[layerIndex];
+    glyphData.verticalOffset   = verticalOffset;
+    glyphData.width            = bufferWidth;
+    glyphData.height           = bufferHeight;
+    glyphData.bitmapBuffer     = imageBuffers[layerIndex];
+    glyphData.horizontalOffset = 0;
+
+    const Typesetter::Style style = styles[layerIndex];
+    if(style == Typesetter::STYLE_OUTLINE || style == Typesetter::STYLE_SHADOW)
+    {
+      isGlyphBitmapNeeded[outlinedGlyphBitmap] = true;
+    }
+    else if(style != Typesetter::STYLE_UNDERLINE && style != Typesetter::STYLE_STRIKETHROUGH)
+    {
+      isGlyphBitmapNeeded[GLYPH_BITMAP_PLAIN] = true;
+    }
+  }
+
+  // The glyph's bitmaps, created once per glyph for all the layers.
+  TextAbstraction::GlyphBufferData glyphBitmaps[GLYPH_BITMAP_COUNT];
 
   // Get a handle of the font client. Used to retrieve the bitmaps of the glyphs.
   TextAbstraction::FontClient fontClient  = TextAbstraction::FontClient::Get();
@@ -1241,83 +1282,85 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t bufferWidth, con
 
   const DevelText::VerticalLineAlignment::Type verLineAlign = mModel->GetVerticalLineAlignment();
 
+  const bool  underlineEnabled      = mModel->IsUnderlineEnabled();
+  const bool  strikethroughEnabled  = mModel->IsStrikethroughEnabled();
+  const float modelCharacterSpacing = mModel->GetCharacterSpacing();
+
+  // Get the character-spacing runs.
+  const Vector<CharacterSpacingGlyphRun>& __restrict__ characterSpacingGlyphRuns = mModel->GetCharacterSpacingGlyphRuns();
+
+  // Aggregate underline-style-properties from mModel
+  const UnderlineStyleProperties modelUnderlineProperties{mModel->GetUnderlineType(),
+                                                          mModel->GetUnderlineColor(),
+                                                          mModel->GetUnderlineHeight(),
+                                                          mModel->GetDashedUnderlineGap(),
+                                                          mModel->GetDashedUnderlineWidth(),
+                                                          true,
+                                                          true,
+                                                          true,
+                                                          true,
+                                                          true};
+
+  // Aggregate strikethrough-style-properties from mModel
+  const StrikethroughStyleProperties modelStrikethroughProperties{mModel->GetStrikethroughColor(),
+                                                                  mModel->GetStrikethroughHeight(),
+                                                                  true,
+                                                                  true};
+
+  // Get the underline runs.
+  const Length               numberOfUnderlineRuns = mModel->GetNumberOfUnderlineRuns();
+  Vector<UnderlinedGlyphRun> underlineRuns;
+  underlineRuns.Resize(numberOfUnderlineRuns);
+  mModel->GetUnderlineRuns(underlineRuns.Begin(), 0u, numberOfUnderlineRuns);
+
+  // Get the strikethrough runs.
+  const Length                  numberOfStrikethroughRuns = mModel->GetNumberOfStrikethroughRuns();
+  Vector<StrikethroughGlyphRun> strikethroughRuns;
+  strikethroughRuns.Resize(numberOfStrikethroughRuns);
+  mModel->GetStrikethroughRuns(strikethroughRuns.Begin(), 0u, numberOfStrikethroughRuns);
+
   // Traverses the lines of the text.
   for(LineIndex lineIndex = 0u; lineIndex < modelNumberOfLines; ++lineIndex)
   {
     const LineRun& line = *(modelLinesBuffer + lineIndex);
 
-    // Sets the horizontal offset of the line.
-    glyphData.horizontalOffset = ignoreHorizontalAlignment ? 0 : static_cast<int32_t>(line.alignmentOffset);
-    glyphData.horizontalOffset += horizontalOffset;
-
-    // Increases the vertical offset with the line's ascender.
-    glyphData.verticalOffset += static_cast<int32_t>(line.ascender + GetPreOffsetVerticalLineAlignment(line, verLineAlign));
+    for(uint32_t layerIndex = 0u; layerIndex < numberOfLayers; ++layerIndex)
+    {
+      GlyphData& glyphData = layers[layerIndex];
 
-    // Retrieves the glyph's outline width
-    float outlineWidth = static_cast<float>(mModel->GetOutlineWidth());
+      // Sets the horizontal offset of the line.
+      glyphData.horizontalOffset = ignoreHorizontalAlignment ? 0 : static_cast<int32_t>(line.alignmentOffset);
+      glyphData.horizontalOffset += horizontalOffset;
 
-    if(style == Typesetter::STYLE_OUTLINE)
-    {
-      const Vector2& outlineOffset = mModel->GetOutlineOffset();
+      // Increases the vertical offset with the line's ascender.
+      glyphData.verticalOffset += static_cast<int32_t>(line.ascender + GetPreOffsetVerticalLineAlignment(line, verLineAlign));
 
-      glyphData.horizontalOffset -= outlineWidth;
-      glyphData.horizontalOffset += outlineOffset.x;
-      if(lineIndex == 0u)
+      if(styles[layerIndex] == Typesetter::STYLE_OUTLINE)
       {
-        // Only need to add the vertical outline offset for the first line
-        glyphData.verticalOffset -= outlineWidth;
-        glyphData.verticalOffset += outlineOffset.y;
-      }
-    }
-    else if(style == Typesetter::STYLE_SHADOW)
-    {
-      const Vector2& shadowOffset = mModel->GetShadowOffset();
-      glyphData.horizontalOffset += shadowOffset.x - outlineWidth; // if outline enabled then shadow should offset from outline
+        const Vector2& outlineOffset = mModel->GetOutlineOffset();
 
-      if(lineIndex == 0u)
+        glyphData.horizontalOffset -= outlineWidth;
+        glyphData.horizontalOffset += outlineOffset.x;
+        if(lineIndex == 0u)
+        {
+          // Only need to add the vertical outline offset for the first line
+          glyphData.verticalOffset -= outlineWidth;
+          glyphData.verticalOffset += outlineOffset.y;
+        }
+      }
+      else if(styles[layerIndex] == Typesetter::STYLE_SHADOW)
       {
-        // Only need to add the vertical shadow offset for first line
-        glyphData.verticalOffset += shadowOffset.y - outlineWidth;
+        const Vector2& shadowOffset = mModel->GetShadowOffset();
+        glyphData.horizontalOffset += shadowOffset.x - outlineWidth; // if outline enabled then shadow should offset from outline
+
+        if(lineIndex == 0u)
+        {
+          // Only need to add the vertical shadow offset for first line
+          glyphData.verticalOffset += shadowOffset.y - outlineWidth;
+        }
       }
     }
 
-    const bool  underlineEnabled      = mModel->IsUnderlineEnabled();
-    const bool  strikethroughEnabled  = mModel->IsStrikethroughEnabled();
-    const float modelCharacterSpacing = mModel->GetCharacterSpacing();
-
-    // Get the character-spacing runs.
-    const Vector<CharacterSpacingGlyphRun>& __restrict__ characterSpacingGlyphRuns = mModel->GetCharacterSpacingGlyphRuns();
-
-    // Aggregate underline-style-properties from mModel
-    const UnderlineStyleProperties modelUnderlineProperties{mModel->GetUnderlineType(),
-                                                            mModel->GetUnderlineColor(),
-                                                            mModel->GetUnderlineHeight(),
-                                                            mModel->GetDashedUnderlineGap(),
-                                                            mModel->GetDashedUnderlineWidth(),
-                                                            true,
-                                                            true,
-                                                            true,
-                                                            true,
-                                                            true};
-
-    // Aggregate strikethrough-style-properties from mModel
-    const StrikethroughStyleProperties modelStrikethroughProperties{mModel->GetStrikethroughColor(),
-                                                                    mModel->GetStrikethroughHeight(),
-                                                                    true,
-                                                                    true};
-
-    // Get the underline runs.
-    const Length               numberOfUnderlineRuns = mModel->GetNumberOfUnderlineRuns();
-    Vector<UnderlinedGlyphRun> underlineRuns;
-    underlineRuns.Resize(numberOfUnderlineRuns);
-    mModel->GetUnderlineRuns(underlineRuns.Begin(), 0u, numberOfUnderlineRuns);
-
-    // Get the strikethrough runs.
-    const Length                  numberOfStrikethroughRuns = mModel->GetNumberOfStrikethroughRuns();
-    Vector<StrikethroughGlyphRun> strikethroughRuns;
-    strikethroughRuns.Resize(numberOfStrikethroughRuns);
-    mModel->GetStrikethroughRuns(strikethroughRuns.Begin(), 0u, numberOfStrikethroughRuns);
-
     bool thereAreUnderlinedGlyphs    = false;
     bool thereAreStrikethroughGlyphs = false;
 
@@ -1472,65 +1515,81 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t bufferWidth, con
 
       // Retrieves the glyph's color.
       const ColorIndex colorIndex = useDefaultColor ? 0u : *(colorIndexBuffer + glyphIndex);
+      const Vector4&   glyphColor = (useDefaultColor || (0u == colorIndex)) ? defaultColor : *(colorsBuffer + (colorIndex - 1u));
 
-      Vector4 color;
-      if(style == Typesetter::STYLE_SHADOW)
-      {
-        color = mModel->GetShadowColor();
-      }
-      else if(style == Typesetter::STYLE_OUTLINE)
-      {
-        color = mModel->GetOutlineColor();
-      }
-      else
+      // Retrieves the glyph's bitmaps needed by the layers.
+      for(uint32_t bitmapType = 0u; bitmapType < GLYPH_BITMAP_COUNT; ++bitmapType)
       {
-        color = (useDefaultColor || (0u == colorIndex)) ? defaultColor : *(colorsBuffer + (colorIndex - 1u));
+        TextAbstraction::GlyphBufferData& glyphBitmap = glyphBitmaps[bitmapType];
+
+        glyphBitmap.buffer = NULL;
+        glyphBitmap.width  = glyphInfo->width; // Desired width and height.
+        glyphBitmap.height = glyphInfo->height;
+
+        if(isGlyphBitmapNeeded[bitmapType])
+        {
+          fontClient.CreateBitmap(glyphInfo->fontId,
+                                  glyphInfo->index,
+                                  glyphInfo->isItalicRequired,
+                                  glyphInfo->isBoldRequired,
+                                  glyphBitmap,
+                                  (bitmapType == GLYPH_BITMAP_OUTLINED) ? static_cast<int32_t>(outlineWidth) : 0);
+        }
       }
 
-      if(style == Typesetter::STYLE_NONE && cutoutEnabled)
+      for(uint32_t layerIndex = 0u; layerIndex < numberOfLayers; ++layerIndex)
       {
-        // Temporarily adjust the transparency to 1.f
-        color.a = 1.f;
-      }
+        const Typesetter::Style style = styles[layerIndex];
+        if(style == Typesetter::STYLE_UNDERLINE || style == Typesetter::STYLE_STRIKETHROUGH)
+        {
+          // The underline and the strikethrough are drawn per line.
+          continue;
+        }
 
-      // Premultiply alpha
-      color.r *= color.a;
-      color.g *= color.a;
-      color.b *= color.a;
+        const bool                              isOutlineOrShadow = (style == Typesetter::STYLE_OUTLINE || style == Typesetter::STYLE_SHADOW);
+        const TextAbstraction::GlyphBufferData& glyphBitmap       = glyphBitmaps[isOutlineOrShadow ? outlinedGlyphBitmap : GLYPH_BITMAP_PLAIN];
+        if(NULL == glyphBitmap.buffer)
+        {
+          continue;
+        }
 
-      // Retrieves the glyph's bitmap.
-      glyphData.glyphBitmap.buffer = NULL;
-      glyphData.glyphBitmap.width  = glyphInfo->width; // Desired width and height.
-      glyphData.glyphBitmap.height = glyphInfo->height;
+        GlyphData& glyphData = layers[layerIndex];
 
-      if(style != Typesetter::STYLE_OUTLINE && style != Typesetter::STYLE_SHADOW)
-      {
-        // Don't render outline for other styles
-        outlineWidth = 0.0f;
-      }
+        Vector4 color;
+        if(style == Typesetter::STYLE_SHADOW)
+        {
+          color = shadowColor;
+        }
+        else if(style == Typesetter::STYLE_OUTLINE)
+        {
+          color = outlineColor;
+        }
+        else
+        {
+          color = glyphColor;
+        }
 
-      if(style != Typesetter::STYLE_UNDERLINE && style != Typesetter::STYLE_STRIKETHROUGH)
-      {
-        fontClient.CreateBitmap(glyphInfo->fontId,
-                                glyphInfo->index,
-                                glyphInfo->isItalicRequired,
-                                glyphInfo->isBoldRequired,
-                                glyphData.glyphBitmap,
-                                static_cast<int32_t>(outlineWidth));
-      }
+        if(style == Typesetter::STYLE_NONE && cutoutEnabled)
+        {
+          // Temporarily adjust the transparency to 1.f
+          color.a = 1.f;
+        }
+
+        // Premultiply alpha
+        color.r *= color.a;
+        color.g *= color.a;
+        color.b *= color.a;
 
-      // Sets the glyph's bitmap into the bitmap of the whole text.
-      if(NULL != glyphData.glyphBitmap.buffer)
-      {
         if(style == Typesetter::STYLE_OUTLINE)
         {
           // Set the position offset for the current glyph
-          glyphData.horizontalOffset -= glyphData.glyphBitmap.outlineOffsetX;
-          glyphData.verticalOffset -= glyphData.glyphBitmap.outlineOffsetY;
+          glyphData.horizontalOffset -= glyphBitmap.outlineOffsetX;
+          glyphData.verticalOffset -= glyphBitmap.outlineOffsetY;
         }
 
         // Set the buffer of the glyph's bitmap into the final bitmap's buffer
         TypesetGlyph(glyphData,
+                     glyphBitmap,
                      &position,
                      &color,
                      style,
@@ -1539,17 +1598,22 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t bufferWidth, con
         if(style == Typesetter::STYLE_OUTLINE)
         {
           // Reset the position offset for the next glyph
-          glyphData.horizontalOffset += glyphData.glyphBitmap.outlineOffsetX;
-          glyphData.verticalOffset += glyphData.glyphBitmap.outlineOffsetY;
+          glyphData.horizontalOffset += glyphBitmap.outlineOffsetX;
+          glyphData.verticalOffset += glyphBitmap.outlineOffsetY;
         }
+      }
+
+      for(uint32_t bitmapType = 0u; bitmapType < GLYPH_BITMAP_COUNT; ++bitmapType)
+      {
+        TextAbstraction::GlyphBufferData& glyphBitmap = glyphBitmaps[bitmapType];
 
         // free the glyphBitmap.buffer if it is owner of buffer
-        if(glyphData.glyphBitmap.isBufferOwned)
+        if(glyphBitmap.isBufferOwned)
         {
-          free(glyphData.glyphBitmap.buffer);
-          glyphData.glyphBitmap.isBufferOwned = false;
+          free(glyphBitmap.buffer);
+          glyphBitmap.isBufferOwned = false;
         }
-        glyphData.glyphBitmap.buffer = NULL;
+        glyphBitmap.buffer = NULL;
       }
 
       if(hyphenIndices)
@@ -1567,31 +1631,35 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t bufferWidth, con
       }
     }
 
-    // Draw the underline from the leftmost glyph to the rightmost glyph
-    if(thereAreUnderlinedGlyphs && style == Typesetter::STYLE_UNDERLINE)
+    for(uint32_t layerIndex = 0u; layerIndex < numberOfLayers; ++layerIndex)
     {
-      DrawUnderline(bufferWidth, bufferHeight, glyphData, baseline, currentUnderlinePosition, maxUnderlineHeight, lineExtentLeft, lineExtentRight, modelUnderlineProperties, currentUnderlineProperties, line);
-    }
+      const Typesetter::Style style     = styles[layerIndex];
+      GlyphData&              glyphData = layers[layerIndex];
 
-    // Draw the background color from the leftmost glyph to the rightmost glyph
-    if(style == Typesetter::STYLE_BACKGROUND)
-    {
-      DrawBackgroundColor(mModel->GetBackgroundColor(), bufferWidth, bufferHeight, glyphData, baseline, line, lineExtentLeft, lineExtentRight);
-    }
+      // Draw the underline from the leftmost glyph to the rightmost glyph
+      if(thereAreUnderlinedGlyphs && style == Typesetter::STYLE_UNDERLINE)
+      {
+        DrawUnderline(bufferWidth, bufferHeight, glyphData, baseline, currentUnderlinePosition, maxUnderlineHeight, lineExtentLeft, lineExtentRight, modelUnderlineProperties, currentUnderlineProperties, line);
+      }
 
-    // Draw the strikethrough from the leftmost glyph to the rightmost glyph
-    if(thereAreStrikethroughGlyphs && style == Typesetter::STYLE_STRIKETHROUGH)
-    {
-      //TODO : The currently implemented strikethrough creates a strikethrough on the line level. We need to create different strikethroughs the case of glyphs with different sizes.
-      strikethroughStartingYPosition = (glyphData.verticalOffset + baseline + currentUnderlinePosition) - ((line.ascender) * HALF); // Since Free Type font doesn't contain the strikethrough-position property, strikethrough position will be calculated by moving the underline position upwards by half the value of the line height.
-      DrawStrikethrough(bufferWidth, bufferHeight, glyphData, baseline, strikethroughStartingYPosition, maxStrikethroughHeight, lineExtentLeft, lineExtentRight, modelStrikethroughProperties, currentStrikethroughProperties, line);
-    }
+      // Draw the background color from the leftmost glyph to the rightmost glyph
+      if(style == Typesetter::STYLE_BACKGROUND)
+      {
+        DrawBackgroundColor(mModel->GetBackgroundColor(), bufferWidth, bufferHeight, glyphData, baseline, line, lineExtentLeft, lineExtentRight);
+      }
 
-    // Increases the vertical offset with the line's descender & line spacing.
-    glyphData.verticalOffset += static_cast<int32_t>(-line.descender + GetPostOffsetVerticalLineAlignment(line, verLineAlign));
-  }
+      // Draw the strikethrough from the leftmost glyph to the rightmost glyph
+      if(thereAreStrikethroughGlyphs && style == Typesetter::STYLE_STRIKETHROUGH)
+      {
+        //TODO : The currently implemented strikethrough creates a strikethrough on the line level. We need to create different strikethroughs the case of glyphs with different sizes.
+        strikethroughStartingYPosition = (glyphData.verticalOffset + baseline + currentUnderlinePosition) - ((line.ascender) * HALF); // Since Free Type font doesn't contain the strikethrough-position property, strikethrough position will be calculated by moving the underline position upwards by half the value of the line height.
+        DrawStrikethrough(bufferWidth, bufferHeight, glyphData, baseline, strikethroughStartingYPosition, maxStrikethroughHeight, lineExtentLeft, lineExtentRight, modelStrikethroughProperties, currentStrikethroughProperties, line);
+      }
 
-  return glyphData.bitmapBuffer;
+      // Increases the vertical offset with the line's descender & line spacing.
+      glyphData.verticalOffset += static_cast<int32_t>(-line.descender + GetPostOffsetVerticalLineAlignment(line, verLineAlign));
+    }
+  }
 }
 
 Devel::PixelBuffer Typesetter::ApplyUnderlineMarkupImageBuffer(Devel::PixelBuffer topPixelBuffer, const uint32_t bufferWidth, const uint32_t bufferHeight, const bool ignoreHorizontalAlignment, const Pixel::Format pixelFormat, const int32_t horizontalOffset, const int32_t verticalOffset)
@@ -1615,11 +1683,18 @@ Devel::PixelBuffer Typesetter::ApplyUnderlineMarkupImageBuffer(Devel::PixelBuffe
     endGlyphIndex   = startGlyphIndex + itGlyphRun->glyphRun.numberOfGlyphs - 1;
 
     // Create the image buffer for underline
-    Devel::PixelBuffer underlineImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_UNDERLINE, ignoreHorizontalAlignment, pixelFormat, horizontalOffset, verticalOffset, startGlyphIndex, endGlyphIndex);
+    const Typesetter::Style style                = Typesetter::STYLE_UNDERLINE;
+    Devel::PixelBuffer      underlineImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
+    CreateImageBuffers(bufferWidth, bufferHeight, &style, &underlineImageBuffer, 1u, ignoreHorizontalAlignment, pixelFormat, horizontalOffset, verticalOffset, startGlyphIndex, endGlyphIndex);
     // Combine the two buffers
     // Result pixel buffer will be stored into topPixelBuffer.
     CombineImageBuffer(underlineImageBuffer, topPixelBuffer, bufferWidth, bufferHeight, false);
 
+    if(underlineImageBuffer != topPixelBuffer)
+    {
+      ReleaseLayerBuffer(underlineImageBuffer);
+    }
+
     itGlyphRun++;
   }
 
@@ -1647,11 +1722,18 @@ Devel::PixelBuffer Typesetter::ApplyStrikethroughMarkupImageBuffer(Devel::PixelB
     endGlyphIndex   = startGlyphIndex + itGlyphRun->glyphRun.numberOfGlyphs - 1;
 
     // Create the image buffer for strikethrough
-    Devel::PixelBuffer strikethroughImageBuffer = CreateImageBuffer(bufferWidth, bufferHeight, Typesetter::STYLE_STRIKETHROUGH, ignoreHorizontalAlignment, pixelFormat, horizontalOffset, verticalOffset, startGlyphIndex, endGlyphIndex);
+    const Typesetter::Style style                    = Typesetter::STYLE_STRIKETHROUGH;
+    Devel::PixelBuffer      strikethroughImageBuffer = AcquireLayerBuffer(bufferWidth, bufferHeight, pixelFormat);
+    CreateImageBuffers(bufferWidth, bufferHeight, &style, &strikethroughImageBuffer, 1u, ignoreHorizontalAlignment, pixelFormat, horizontalOffset, verticalOffset, startGlyphIndex, endGlyphIndex);
     // Combine the two buffers
     // Result pixel buffer will be stored into topPixelBuffer.
     CombineImageBuffer(strikethroughImageBuffer, topPixelBuffer, bufferWidth, bufferHeight, false);
 
+    if(strikethroughImageBuffer != topPixelBuffer)
+    {
+      ReleaseLayerBuffer(strikethroughImageBuffer);
+    }
+
     itGlyphRun++;
   }
 
@@ -1671,33 +1753,78 @@ void Typesetter::SetMaskForImageBuffer(Devel::PixelBuffer& __restrict__ topPixel
     return;
   }
 
-  const uint32_t bufferSizeInt = bufferWidth * bufferHeight;
+  // Return the transparency of the text to original.
+  const uint8_t originAlphaInt = originAlpha * 255;
+
+  // Manual blending.
+  GetPixelKernels().mask(topBuffer, bottomBuffer, originAlphaInt, bufferWidth * bufferHeight);
+}
 
-  for(uint32_t pixelIndex = 0; pixelIndex < bufferSizeInt; ++pixelIndex)
+uint32_t Typesetter::GetNumberOfPooledLayerBuffers()
+{
+  LayerBufferPool&        pool = GetLayerBufferPool();
+  Dali::Mutex::ScopedLock lock(pool.mutex);
+  return static_cast<uint32_t>(pool.buffers.size());
+}
+
+std::size_t Typesetter::GetSizeOfPooledLayerBuffers()
+{
+  LayerBufferPool&        pool = GetLayerBufferPool();
+  Dali::Mutex::ScopedLock lock(pool.mutex);
+  return pool.size;
+}
+
+Devel::PixelBuffer Typesetter::AcquireLayerBuffer(const uint32_t bufferWidth, const uint32_t bufferHeight, const Pixel::Format pixelFormat)
+{
+  Devel::PixelBuffer layerBuffer;
   {
-    uint32_t topBufferColor = *(topBuffer);
-    uint32_t bottomBufferColor = *(bottomBuffer);
-    uint8_t* __restrict__ topBufferColorBuffer = reinterpret_cast<uint8_t*>(&topBufferColor);
-    uint8_t* __restrict__ bottomBufferColorBuffer = reinterpret_cast<uint8_t*>(&bottomBufferColor);
+    LayerBufferPool&        pool = GetLayerBufferPool();
+    Dali::Mutex::ScopedLock lock(pool.mutex);
+
+    // The most recently released buffer is the most likely to be of the same text.
+    for(auto iter = pool.buffers.rbegin(); iter != pool.buffers.rend(); ++iter)
+    {
+      if((iter->GetWidth() == bufferWidth) && (iter->GetHeight() == bufferHeight) && (iter->GetPixelFormat() == pixelFormat))
+      {
+        layerBuffer = *iter;
+        pool.size -= GetLayerBufferSize(layerBuffer);
+        pool.buffers.erase(std::next(iter).base());
+        break;
+      }
+    }
+  }
 
-    // Return the transparency of the text to original.
-    uint8_t originAlphaInt = originAlpha * 255;
+  if(!layerBuffer)
+  {
+    return CreateTransparentImageBuffer(bufferWidth, bufferHeight, pixelFormat);
+  }
 
-    uint8_t topAlpha = topBufferColorBuffer[3];
-    uint8_t bottomAlpha = 255 - topAlpha;
+  // Clear the content of the previous render.
+  memset(layerBuffer.GetBuffer(), 0, GetLayerBufferSize(layerBuffer));
+  return layerBuffer;
+}
 
-    // Manual blending.
-    bottomBufferColorBuffer[0] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[0], originAlphaInt, bottomBufferColorBuffer[0], bottomAlpha);
-    bottomBufferColorBuffer[1] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[1], originAlphaInt, bottomBufferColorBuffer[1], bottomAlpha);
-    bottomBufferColorBuffer[2] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[2], originAlphaInt, bottomBufferColorBuffer[2], bottomAlpha);
-    bottomBufferColorBuffer[3] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[3], originAlphaInt, bottomBufferColorBuffer[3], bottomAlpha);
+void Typesetter::ReleaseLayerBuffer(Devel::PixelBuffer& layerBuffer)
+{
+  const std::size_t layerBufferSize = layerBuffer ? GetLayerBufferSize(layerBuffer) : 0u;
+  if(layerBuffer && (layerBufferSize <= MAX_SIZE_OF_POOLED_LAYER_BUFFERS))
+  {
+    LayerBufferPool&        pool = GetLayerBufferPool();
+    Dali::Mutex::ScopedLock lock(pool.mutex);
 
-    *(bottomBuffer) = bottomBufferColor;
+    // Free the least recently released buffers to keep the pool in its bound.
+    auto iter = pool.buffers.begin();
+    while((pool.size + layerBufferSize > MAX_SIZE_OF_POOLED_LAYER_BUFFERS) && (iter != pool.buffers.end()))
+    {
+      pool.size -= GetLayerBufferSize(*iter);
+      ++iter;
+    }
+    pool.buffers.erase(pool.buffers.begin(), iter);
 
-    // Increase each buffer's pointer.
-    ++topBuffer;
-    ++bottomBuffer;
+    pool.buffers.push_back(layerBuffer);
+    pool.size += layerBufferSize;
   }
+  layerBuffer.Reset();
 }
 
 Typesetter::Typesetter(const ModelInterface* const model)
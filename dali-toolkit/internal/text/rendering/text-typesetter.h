@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_TEXT_TYPESETTER_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <dali/public-api/images/pixel-data.h>
 #include <dali/public-api/images/pixel.h>
 #include <dali/public-api/object/ref-object.h>
+#include <vector>
 
 namespace Dali
 {
@@ -165,6 +166,22 @@ public:
    */
   void SetMaskForImageBuffer(Devel::PixelBuffer& __restrict__ topPixelBuffer, Devel::PixelBuffer& __restrict__ bottomPixelBuffer, const uint32_t bufferWidth, const uint32_t bufferHeight, float originAlpha);
 
+  /**
+   * @brief Retrieves the number of layer buffers kept for reuse.
+   *
+   * The layer buffers are kept across renders in a pool shared by all the typesetters.
+   *
+   * @return The number of pooled layer buffers.
+   */
+  static uint32_t GetNumberOfPooledLayerBuffers();
+
+  /**
+   * @brief Retrieves the number of bytes of the layer buffers kept for reuse.
+   *
+   * @return The size of the pooled layer buffers, which is bounded.
+   */
+  static std::size_t GetSizeOfPooledLayerBuffers();
+
 private:
   /**
    * @brief Private constructor.
@@ -201,6 +218,46 @@ private:
    */
   Devel::PixelBuffer CreateImageBuffer(const uint32_t bufferWidth, const uint32_t bufferHeight, const Typesetter::Style style, const bool ignoreHorizontalAlignment, const Pixel::Format pixelFormat, const int32_t horizontalOffset, const int32_t verticalOffset, const TextAbstraction::GlyphIndex fromGlyphIndex, const TextAbstraction::GlyphIndex toGlyphIndex);
 
+  /**
+   * @brief Draw the given range of the glyphs in several styles with a single traversal of the glyphs.
+   *
+   * The bitmap of each glyph is retrieved once and set into the buffer of each style. The outline and the
+   * shadow share the bitmap with the outline width, the other styles share the bitmap without outline.
+   *
+   * @param[in] bufferWidth The width of the image buffers.
+   * @param[in] bufferHeight The height of the image buffers.
+   * @param[in] styles The style of each layer.
+   * @param[in, out] imageBuffers The transparent image buffer of each layer, where the style is drawn.
+   * @param[in] numberOfLayers The number of layers. At most one per style.
+   * @param[in] ignoreHorizontalAlignment Whether to ignore the horizontal alignment, not ignored by default.
+   * @param[in] pixelFormat The format of the pixel in the image that the text is rendered as (i.e. either Pixel::BGRA8888 or Pixel::L8).
+   * @param[in] horizontalOffset The horizontal offset to be added to the glyph's position.
+   * @param[in] verticalOffset The vertical offset to be added to the glyph's position.
+   * @param[in] fromGlyphIndex The index of the first glyph within the text to be drawn
+   * @param[in] toGlyphIndex The index of the last glyph within the text to be drawn
+   */
+  void CreateImageBuffers(const uint32_t bufferWidth, const uint32_t bufferHeight, const Typesetter::Style* const styles, Devel::PixelBuffer* const imageBuffers, const uint32_t numberOfLayers, const bool ignoreHorizontalAlignment, const Pixel::Format pixelFormat, const int32_t horizontalOffset, const int32_t verticalOffset, const TextAbstraction::GlyphIndex fromGlyphIndex, const TextAbstraction::GlyphIndex toGlyphIndex);
+
+  /**
+   * @brief Retrieves a transparent image buffer for a style layer.
+   *
+   * Reuses a buffer released by an earlier render, of any typesetter, if there is one with the same size and format.
+   *
+   * @param[in] bufferWidth The width of the image buffer.
+   * @param[in] bufferHeight The height of the image buffer.
+   * @param[in] pixelFormat The format of the pixel in the image buffer.
+   *
+   * @return A transparent image buffer.
+   */
+  Devel::PixelBuffer AcquireLayerBuffer(const uint32_t bufferWidth, const uint32_t bufferHeight, const Pixel::Format pixelFormat);
+
+  /**
+   * @brief Gives back a layer buffer once it has been combined, so the later renders can reuse it.
+   *
+   * @param[in, out] layerBuffer The layer buffer. It's reset.
+   */
+  void ReleaseLayerBuffer(Devel::PixelBuffer& layerBuffer);
+
   /**
    * @brief Apply markup underline tags.
    *
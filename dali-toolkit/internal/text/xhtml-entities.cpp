@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,12 +15,16 @@
  *
  */
 
-// EXTERNAL INCLUDES
-#include <cstring> // for strlen()
-
 // FILE HEADER
 #include "xhtml-entities.h"
 
+// EXTERNAL INCLUDES
+#include <array>
+#include <string_view>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-perfect-hash.h>
+
 namespace Dali
 {
 namespace Toolkit
@@ -34,8 +38,8 @@ namespace
  */
 struct XHTMLEntityLookup
 {
-  const char* const entityName; // XHTML Named Entity string
-  const char* const entityCode; // Corresponding UTF-8
+  std::string_view entityName; // XHTML Named Entity string
+  const char*      entityCode; // Corresponding UTF-8
 };
 
 /* table of html name entities supported in DALi
@@ -44,7 +48,7 @@ struct XHTMLEntityLookup
  * its utf 8 as value
  */
 // clang-format off
-const XHTMLEntityLookup XHTMLEntityLookupTable[] =
+constexpr XHTMLEntityLookup XHTMLEntityLookupTable[] =
 {
   {"&quot;\0"    ,"\x22\0"         },
   {"&amp;\0"     ,"\x26\0"         },
@@ -302,23 +306,31 @@ const XHTMLEntityLookup XHTMLEntityLookupTable[] =
 };
 // clang-format on
 
-const std::size_t XHTMLENTITY_LOOKUP_COUNT = (sizeof(XHTMLEntityLookupTable)) / (sizeof(XHTMLEntityLookup));
+constexpr std::size_t XHTMLENTITY_LOOKUP_COUNT = (sizeof(XHTMLEntityLookupTable)) / (sizeof(XHTMLEntityLookup));
+
+constexpr std::array<std::string_view, XHTMLENTITY_LOOKUP_COUNT> GetEntityNames()
+{
+  std::array<std::string_view, XHTMLENTITY_LOOKUP_COUNT> names{};
+  for(std::size_t i = 0u; i < XHTMLENTITY_LOOKUP_COUNT; ++i)
+  {
+    names[i] = XHTMLEntityLookupTable[i].entityName;
+  }
+  return names;
+}
+
+// Named entities are case sensitive, i.e. &Dagger; and &dagger; are different entities.
+constexpr auto XHTML_ENTITY_HASH_TABLE = PerfectHash::Build<128u, 512u, false>(GetEntityNames());
+static_assert(XHTML_ENTITY_HASH_TABLE.valid, "Perfect hash not found for the XHTML entities");
 
 } // unnamed namespace
 
 const char* const NamedEntityToUtf8(const char* const markupText, unsigned int len)
 {
   // finding if given XHTML named entity is supported or not
-  for(size_t i = 0; i < XHTMLENTITY_LOOKUP_COUNT; ++i)
+  const int index = XHTML_ENTITY_HASH_TABLE.Find(markupText, len);
+  if(index >= 0)
   {
-    unsigned int entityLen = strlen(XHTMLEntityLookupTable[i].entityName);
-    if(len == entityLen)
-    {
-      if(strncmp(markupText, XHTMLEntityLookupTable[i].entityName, len) == 0) // if named Entity found in table
-      {
-        return XHTMLEntityLookupTable[i].entityCode;
-      }
-    }
+    return XHTMLEntityLookupTable[index].entityCode;
   }
   return NULL;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -51,6 +51,7 @@ void TextureAsyncLoadingHelper::LoadAnimatedImage(const TextureManager::TextureI
 {
   LoadingTaskPtr loadingTask = new LoadingTask(++mLoadTaskId, animatedImageLoading, frameIndex, desiredSize, fittingMode, samplingMode, preMultiplyOnLoad, MakeCallback(this, &TextureAsyncLoadingHelper::AsyncLoadComplete));
   loadingTask->SetTextureId(textureId);
+  mLoadingTasks[textureId] = loadingTask;
   Dali::AsyncTaskManager::Get().AddTask(loadingTask);
 }
 
@@ -61,7 +62,11 @@ void TextureAsyncLoadingHelper::Load(const TextureManager::TextureId
                                      const Dali::SamplingMode::Type                 samplingMode,
                                      const bool                                     orientationCorrection,
                                      const DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
-                                     const bool                                     loadYuvPlanes)
+                                     const bool                                     loadYuvPlanes,
+                                     Devel::PixelBuffer                             decodedImage,
+                                     const bool                                     keepDecodedImage,
+                                     const bool                                     compressTexture,
+                                     const AsyncTask::PriorityType                  priority)
 {
   LoadingTaskPtr loadingTask;
   if(DALI_UNLIKELY(url.IsBufferResource()))
@@ -70,10 +75,14 @@ void TextureAsyncLoadingHelper::Load(const TextureManager::TextureId
   }
   else
   {
-    loadingTask = new LoadingTask(++mLoadTaskId, url, desiredSize, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad, loadYuvPlanes, MakeCallback(this, &TextureAsyncLoadingHelper::AsyncLoadComplete));
+    loadingTask = new LoadingTask(++mLoadTaskId, url, desiredSize, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad, loadYuvPlanes, MakeCallback(this, &TextureAsyncLoadingHelper::AsyncLoadComplete), priority);
+    loadingTask->SetDecodedImage(decodedImage);
+    loadingTask->SetKeepDecodedImage(keepDecodedImage);
   }
 
+  loadingTask->SetCompressTexture(compressTexture);
   loadingTask->SetTextureId(textureId);
+  mLoadingTasks[textureId] = loadingTask;
   Dali::AsyncTaskManager::Get().AddTask(loadingTask);
 }
 
@@ -89,11 +98,60 @@ void TextureAsyncLoadingHelper::ApplyMask(const TextureManager::TextureId
   Dali::AsyncTaskManager::Get().AddTask(loadingTask);
 }
 
+void TextureAsyncLoadingHelper::SetPriority(const TextureManager::TextureId textureId, const AsyncTask::PriorityType priority)
+{
+  auto iter = mLoadingTasks.find(textureId);
+  if(iter == mLoadingTasks.end())
+  {
+    return;
+  }
+
+  // Only the loads of image files can be prioritized. The priority of the remote ones is always low.
+  LoadingTaskPtr task = iter->second;
+  if(task->animatedImageLoading || !task->url.IsValid() || task->url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ||
+     task->GetPriorityType() == priority || task->IsStarted())
+  {
+    return;
+  }
+
+  DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureAsyncLoadingHelper::SetPriority( textureId=%d, priority=%s )\n", textureId, priority == AsyncTask::PriorityType::HIGH ? "HIGH" : "LOW");
+
+  // The priority of a task cannot be changed, so the load is queued again with the new priority.
+  Dali::AsyncTaskManager::Get().RemoveTask(task);
+  Load(textureId, task->url, task->dimensions, task->fittingMode, task->samplingMode, task->orientationCorrection, task->preMultiplyOnLoad, task->loadPlanes, task->decodedImage, task->keepDecodedImage, task->compressTexture, priority);
+}
+
+bool TextureAsyncLoadingHelper::Cancel(const TextureManager::TextureId textureId)
+{
+  auto iter = mLoadingTasks.find(textureId);
+  if(iter == mLoadingTasks.end() || iter->second->IsStarted())
+  {
+    return false;
+  }
+
+  DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureAsyncLoadingHelper::Cancel( textureId=%d )\n", textureId);
+
+  // The completed callback of a removed task is not called, even if a worker thread has just started it.
+  Dali::AsyncTaskManager::Get().RemoveTask(iter->second);
+  mLoadingTasks.erase(iter);
+  return true;
+}
+
 void TextureAsyncLoadingHelper::AsyncLoadComplete(LoadingTaskPtr task)
 {
+  auto iter = mLoadingTasks.find(task->textureId);
+  if(iter != mLoadingTasks.end() && iter->second == task)
+  {
+    mLoadingTasks.erase(iter);
+  }
+
   // Call TextureManager::AsyncLoadComplete
   if(task->textureId != TextureManager::INVALID_TEXTURE_ID)
   {
+    if(task->isDerived || task->decodedImage)
+    {
+      mTextureManager.AsyncDecodeComplete(task->textureId, task->isDerived ? Devel::PixelBuffer() : task->decodedImage, task->isDerived);
+    }
     mTextureManager.AsyncLoadComplete(task->textureId, task->pixelBuffers);
   }
 }
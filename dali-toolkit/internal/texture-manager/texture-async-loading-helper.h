@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_TEXTURE_ASYNC_LOADING_HELPER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/signals/connection-tracker.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/image-loader/loading-task.h>
@@ -73,6 +74,10 @@ public:
    *                                  e.g., from portrait to landscape
    * @param[in] preMultiplyOnLoad     if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
    * @param[in] loadYuvPlanes         True if the image should be loaded as yuv planes
+   * @param[in] decodedImage          A larger decoded image of the url to derive the texture from, or an empty handle
+   * @param[in] keepDecodedImage      True if a copy of the decoded image should be returned to be kept
+   * @param[in] compressTexture       True if the image may be transcoded to a compressed texture
+   * @param[in] priority              The priority of the load
    */
   void Load(const TextureManager::TextureId                textureId,
             const VisualUrl&                               url,
@@ -81,7 +86,11 @@ public:
             const Dali::SamplingMode::Type                 samplingMode,
             const bool                                     orientationCorrection,
             const DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
-            const bool                                     loadYuvPlanes);
+            const bool                                     loadYuvPlanes,
+            Devel::PixelBuffer                             decodedImage,
+            const bool                                     keepDecodedImage,
+            const bool                                     compressTexture,
+            const AsyncTask::PriorityType                  priority);
 
   /**
    * @brief Apply mask
@@ -99,6 +108,21 @@ public:
                  const bool                                     cropToMask,
                  const DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad);
 
+  /**
+   * @brief Changes the priority of the load of a texture, if it has not started yet.
+   * @param[in] textureId The id of the texture
+   * @param[in] priority  The new priority of the load
+   */
+  void SetPriority(const TextureManager::TextureId textureId, const AsyncTask::PriorityType priority);
+
+  /**
+   * @brief Cancels the load of a texture, if it has not started yet.
+   * The texture manager is not notified of the cancelled load.
+   * @param[in] textureId The id of the texture
+   * @return True if the load has been cancelled, false if it has started or there is no load of the texture.
+   */
+  bool Cancel(const TextureManager::TextureId textureId);
+
 public:
   TextureAsyncLoadingHelper(const TextureAsyncLoadingHelper&) = delete;
   TextureAsyncLoadingHelper& operator=(const TextureAsyncLoadingHelper&) = delete;
@@ -111,8 +135,9 @@ private:
   void AsyncLoadComplete(LoadingTaskPtr task);
 
 private: // Member Variables:
-  TextureManager& mTextureManager;
-  uint32_t        mLoadTaskId;
+  TextureManager&                                                mTextureManager;
+  uint32_t                                                       mLoadTaskId;
+  std::unordered_map<TextureManager::TextureId, LoadingTaskPtr> mLoadingTasks; ///< The loads in progress, by texture id.
 };
 
 } // namespace Internal
@@ -21,6 +21,8 @@
 // EXTERNAL HEADERS
 #include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
+#include <algorithm>
 #include <string_view>
 #include <unordered_map>
 
@@ -53,6 +55,8 @@ const std::string_view& GetEncodedImageBufferExtensions(Dali::EncodedImageBuffer
 
   return emptyString;
 }
+
+constexpr uint32_t MAXIMUM_DECODED_IMAGE_SIZE_RATIO = 4u; ///< A decoded image larger than 1/4 of the cache would evict most of the others, so it is not kept.
 } // namespace
 #ifdef DEBUG_ENABLED
 extern Debug::Filter* gTextureManagerLogFilter; ///< Define at texture-manager-impl.cpp
@@ -618,6 +622,12 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::FindCachedTexture(
           if((preMultiplyOnLoad == MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad) || (preMultiplyOnLoad == MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied))
           {
             // The found Texture is a match.
+            if(textureInfo.referenceCount <= 0)
+            {
+              // It is a kept frame of an animated image. It will be used again.
+              RemoveAnimatedImageFrame(textureId);
+            }
+            ++mStatistics.exactHitCount;
             return cacheIndex;
           }
         }
@@ -626,6 +636,7 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::FindCachedTexture(
   }
 
   // Default to an invalid ID, in case we do not find a match.
+  ++mStatistics.missCount;
   return INVALID_CACHE_INDEX;
 }
 
@@ -694,6 +705,12 @@ void TextureCacheManager::RemoveCache(TextureCacheManager::TextureInfo& textureI
       removeTextureInfo = true;
     }
 
+    // Keep the frame of an animated image, so it is not decoded again when it is requested next time.
+    if(removeTextureInfo && KeepAnimatedImageFrame(textureInfo))
+    {
+      removeTextureInfo = false;
+    }
+
     // If the state allows us to remove the TextureInfo data, we do so.
     if(removeTextureInfo)
     {
@@ -718,6 +735,163 @@ void TextureCacheManager::RemoveCache(TextureCacheManager::TextureInfo& textureI
     // Step 3. swap last data of TextureInfoContainer, and pop_back.
     RemoveTextureInfoByIndex(mTextureInfoContainer, textureInfoIndex);
   }
+
+  TrimAnimatedImageFrames();
+}
+
+void TextureCacheManager::SetDecodedImageCacheSize(const uint32_t size)
+{
+  mDecodedImageCacheSize = size;
+  TrimDecodedImages();
+}
+
+Devel::PixelBuffer TextureCacheManager::FindDecodedImage(const VisualUrl& url, const bool orientationCorrection)
+{
+  for(auto iter = mDecodedImages.begin(), endIter = mDecodedImages.end(); iter != endIter; ++iter)
+  {
+    if(iter->orientationCorrection == orientationCorrection && iter->url == url.GetUrl())
+    {
+      // Move it to the back, as the most recently used.
+      std::rotate(iter, iter + 1, endIter);
+      return mDecodedImages.back().pixelBuffer;
+    }
+  }
+  return Devel::PixelBuffer();
+}
+
+void TextureCacheManager::CacheDecodedImage(const VisualUrl& url, const bool orientationCorrection, Devel::PixelBuffer pixelBuffer)
+{
+  if(!pixelBuffer)
+  {
+    return;
+  }
+
+  const uint64_t byteSize = static_cast<uint64_t>(pixelBuffer.GetWidth()) * pixelBuffer.GetHeight() * Pixel::GetBytesPerPixel(pixelBuffer.GetPixelFormat());
+  if(byteSize > mDecodedImageCacheSize / MAXIMUM_DECODED_IMAGE_SIZE_RATIO)
+  {
+    return;
+  }
+
+  for(auto iter = mDecodedImages.begin(), endIter = mDecodedImages.end(); iter != endIter; ++iter)
+  {
+    if(iter->orientationCorrection == orientationCorrection && iter->url == url.GetUrl())
+    {
+      if(iter->pixelBuffer.GetWidth() >= pixelBuffer.GetWidth() && iter->pixelBuffer.GetHeight() >= pixelBuffer.GetHeight())
+      {
+        // Keep the larger image.
+        return;
+      }
+      mDecodedImageBytes -= iter->byteSize;
+      mDecodedImages.erase(iter);
+      break;
+    }
+  }
+
+  mDecodedImages.push_back(DecodedImageInfo{url.GetUrl(), pixelBuffer, static_cast<uint32_t>(byteSize), orientationCorrection});
+  mDecodedImageBytes += static_cast<uint32_t>(byteSize);
+
+  TrimDecodedImages();
+}
+
+void TextureCacheManager::RemoveDecodedImage(const VisualUrl& url)
+{
+  for(auto iter = mDecodedImages.begin(); iter != mDecodedImages.end();)
+  {
+    if(iter->url == url.GetUrl())
+    {
+      mDecodedImageBytes -= iter->byteSize;
+      iter = mDecodedImages.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+void TextureCacheManager::SetAnimatedImageFrameCacheSize(const uint32_t size)
+{
+  mAnimatedImageFrameCacheSize = size;
+  TrimAnimatedImageFrames();
+}
+
+void TextureCacheManager::NotifyDerivedHit()
+{
+  ++mStatistics.derivedHitCount;
+}
+
+void TextureCacheManager::TrimDecodedImages()
+{
+  auto iter = mDecodedImages.begin();
+  while(mDecodedImageBytes > mDecodedImageCacheSize && iter != mDecodedImages.end())
+  {
+    mDecodedImageBytes -= iter->byteSize;
+    ++iter;
+  }
+  mDecodedImages.erase(mDecodedImages.begin(), iter);
+}
+
+bool TextureCacheManager::KeepAnimatedImageFrame(const TextureCacheManager::TextureInfo& textureInfo)
+{
+  if(mAnimatedImageFrameCacheSize == 0u ||
+     !textureInfo.isAnimatedImageFormat ||
+     textureInfo.loadState != LoadState::UPLOADED ||
+     textureInfo.storageType != StorageType::UPLOAD_TO_TEXTURE ||
+     textureInfo.maskTextureId != INVALID_TEXTURE_ID ||
+     textureInfo.url.IsBufferResource() ||
+     textureInfo.textures.empty() || !textureInfo.textures[0])
+  {
+    return false;
+  }
+
+  // The decoded frames are uploaded as 4 bytes per pixel.
+  const uint32_t byteSize = textureInfo.textures[0].GetWidth() * textureInfo.textures[0].GetHeight() * 4u;
+
+  // Keep the frames only if the whole animation fits in the cache. Otherwise, a loop would remove every frame before it is used again.
+  if(static_cast<uint64_t>(byteSize) * std::max(textureInfo.frameCount, 1u) > mAnimatedImageFrameCacheSize)
+  {
+    return false;
+  }
+
+  // The frame may be kept already, if it has been removed more times than it was requested.
+  RemoveAnimatedImageFrame(textureInfo.textureId);
+
+  mAnimatedImageFrames.push_back(AnimatedImageFrameInfo{textureInfo.textureId, byteSize});
+  mAnimatedImageFrameBytes += byteSize;
+  return true;
+}
+
+void TextureCacheManager::RemoveAnimatedImageFrame(const TextureCacheManager::TextureId textureId)
+{
+  for(auto iter = mAnimatedImageFrames.begin(), endIter = mAnimatedImageFrames.end(); iter != endIter; ++iter)
+  {
+    if(iter->textureId == textureId)
+    {
+      mAnimatedImageFrameBytes -= iter->byteSize;
+      mAnimatedImageFrames.erase(iter);
+      break;
+    }
+  }
+}
+
+void TextureCacheManager::TrimAnimatedImageFrames()
+{
+  while(mAnimatedImageFrameBytes > mAnimatedImageFrameCacheSize && !mAnimatedImageFrames.empty())
+  {
+    const AnimatedImageFrameInfo frameInfo = mAnimatedImageFrames.front();
+    mAnimatedImageFrames.erase(mAnimatedImageFrames.begin());
+    mAnimatedImageFrameBytes -= frameInfo.byteSize;
+
+    TextureCacheIndex cacheIndex = GetCacheIndexFromId(frameInfo.textureId);
+    if(cacheIndex != INVALID_CACHE_INDEX)
+    {
+      DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::TrimAnimatedImageFrames(textureId:%d) url:%s frameIndex:%u\n", frameInfo.textureId, mTextureInfoContainer[cacheIndex.GetIndex()].url.GetUrl().c_str(), mTextureInfoContainer[cacheIndex.GetIndex()].frameIndex);
+
+      RemoveHashId(mTextureInfoContainer[cacheIndex.GetIndex()].hash, frameInfo.textureId);
+      mTextureIdConverter.Remove(frameInfo.textureId);
+      RemoveTextureInfoByIndex(mTextureInfoContainer, cacheIndex);
+    }
+  }
 }
 
 void TextureCacheManager::RemoveHashId(const TextureCacheManager::TextureHash textureHash, const TextureCacheManager::TextureId textureId)
@@ -18,6 +18,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/devel-api/common/free-list.h>
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <unordered_map>
@@ -55,6 +56,9 @@ namespace Internal
  *                           This container will use TEXTURE_CACHE_INDEX_TYPE_BUFFER
  *                           The bufferId will be used for VisualUrl. ex) enbuf://1
  *                           Note that this bufferId is not equal with textureId in mTextureInfoContainer.
+ *
+ * It also keeps some decoded images, when the decoded image cache size is set, so a smaller texture of
+ * the same image can be derived from them instead of decoding the image file again.
  */
 class TextureCacheManager
 {
@@ -77,6 +81,17 @@ public:
   using TextureInfo         = TextureManagerType::TextureInfo;
   using ExternalTextureInfo = TextureManagerType::ExternalTextureInfo;
 
+  /**
+   * @brief The statistics of the texture cache.
+   * Only the requests which can be cached are counted, i.e. the ones looked up by FindCachedTexture().
+   */
+  struct Statistics
+  {
+    uint32_t exactHitCount{0u};   ///< The number of requests which found a cached texture.
+    uint32_t derivedHitCount{0u}; ///< The number of missed requests which derived their texture from a larger decoded image.
+    uint32_t missCount{0u};       ///< The number of requests which did not find a cached texture, including the derived ones.
+  };
+
 public:
   /**
    * Constructor.
@@ -272,6 +287,85 @@ public:
    */
   void RemoveCache(TextureCacheManager::TextureInfo& textureInfo);
 
+public:
+  // To keep decoded images, and derive smaller textures from them.
+
+  /**
+   * @brief Sets the maximum number of bytes of the decoded images kept.
+   * Decoded images are not kept if the size is zero, which is the default.
+   * @param[in] size The size in bytes.
+   */
+  void SetDecodedImageCacheSize(const uint32_t size);
+
+  /**
+   * @brief Retrieves the maximum number of bytes of the decoded images kept.
+   * @return The size in bytes.
+   */
+  uint32_t GetDecodedImageCacheSize() const
+  {
+    return mDecodedImageCacheSize;
+  }
+
+  /**
+   * @brief Finds a decoded image of the given url.
+   * @param[in] url                   The URL of the image
+   * @param[in] orientationCorrection Whether the image has been rotated or flipped by its metadata
+   * @return The decoded image, or an empty handle if it is not kept.
+   */
+  Devel::PixelBuffer FindDecodedImage(const VisualUrl& url, const bool orientationCorrection);
+
+  /**
+   * @brief Keeps a decoded image of the given url.
+   * The image must keep the whole content of the file and its color must not be pre-multiplied.
+   * @note If cache size is big enough, we might remove some caches.
+   * @note An image larger than a quarter of the cache size is not kept.
+   * @param[in] url                   The URL of the image
+   * @param[in] orientationCorrection Whether the image has been rotated or flipped by its metadata
+   * @param[in] pixelBuffer           The decoded image
+   */
+  void CacheDecodedImage(const VisualUrl& url, const bool orientationCorrection, Devel::PixelBuffer pixelBuffer);
+
+  /**
+   * @brief Removes the decoded images of the given url. i.e. when it is forced to be reloaded.
+   * @param[in] url The URL of the image
+   */
+  void RemoveDecodedImage(const VisualUrl& url);
+
+public:
+  // To keep the frames of animated images which are not used anymore.
+
+  /**
+   * @brief Sets the maximum number of bytes of the animated image frames kept after they are removed.
+   * The kept frames are shared by the visuals which show the same animated image, and an animation which fits in the size
+   * is decoded only once. Frames are not kept if the size is zero, which is the default.
+   * @param[in] size The size in bytes.
+   */
+  void SetAnimatedImageFrameCacheSize(const uint32_t size);
+
+  /**
+   * @brief Retrieves the maximum number of bytes of the animated image frames kept.
+   * @return The size in bytes.
+   */
+  uint32_t GetAnimatedImageFrameCacheSize() const
+  {
+    return mAnimatedImageFrameCacheSize;
+  }
+
+public:
+  /**
+   * @brief Notifies that a missed texture has been derived from a decoded image.
+   */
+  void NotifyDerivedHit();
+
+  /**
+   * @brief Retrieves the statistics of the cache.
+   * @return The statistics.
+   */
+  const TextureCacheManager::Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
 public:
   /**
    * @brief Get TextureInfo as TextureCacheIndex.
@@ -317,12 +411,34 @@ private:
     int32_t                          referenceCount;
   };
 
+  /**
+   * @brief This struct is used to keep a decoded image.
+   */
+  struct DecodedImageInfo
+  {
+    std::string        url;
+    Devel::PixelBuffer pixelBuffer;
+    uint32_t           byteSize;
+    bool               orientationCorrection;
+  };
+
+  /**
+   * @brief This struct is used to keep an animated image frame which is not used anymore.
+   */
+  struct AnimatedImageFrameInfo
+  {
+    TextureCacheManager::TextureId textureId;
+    uint32_t                       byteSize;
+  };
+
   typedef Dali::FreeList TextureIdConverterType; ///< The converter type from TextureId to index of TextureInfoContainer.
 
   typedef std::unordered_map<TextureCacheManager::TextureHash, std::vector<TextureCacheManager::TextureId>> TextureHashContainerType;            ///< The container type used to fast-find the TextureId by TextureHash.
   typedef std::vector<TextureCacheManager::TextureInfo>                                                     TextureInfoContainerType;            ///< The container type used to manage the life-cycle and caching of Textures
   typedef std::vector<TextureCacheManager::ExternalTextureInfo>                                             ExternalTextureInfoContainerType;    ///< The container type used to manage the life-cycle and caching of ExternalTexture url
   typedef std::vector<TextureCacheManager::EncodedImageBufferInfo>                                          EncodedImageBufferInfoContainerType; ///< The container type used to manage the life-cycle and caching of EncodedImageBuffer url
+  typedef std::vector<TextureCacheManager::DecodedImageInfo>                                                DecodedImageInfoContainerType;       ///< The container type used to keep decoded images, the least recently used first
+  typedef std::vector<TextureCacheManager::AnimatedImageFrameInfo>                                          AnimatedImageFrameInfoContainerType; ///< The container type used to keep animated image frames, the least recently used first
 
 private:
   // Private API: only used internally
@@ -357,6 +473,29 @@ private:
    */
   void RemoveHashId(const TextureCacheManager::TextureHash hash, const TextureCacheManager::TextureId id);
 
+  /**
+   * @brief Removes the least recently used decoded images until they fit in the decoded image cache size.
+   */
+  void TrimDecodedImages();
+
+  /**
+   * @brief Keeps the frame of an animated image which is not used anymore, if the whole animation fits in the cache.
+   * @param[in] textureInfo The uploaded frame whose reference count is zero
+   * @return True if the frame is kept and must not be removed.
+   */
+  bool KeepAnimatedImageFrame(const TextureCacheManager::TextureInfo& textureInfo);
+
+  /**
+   * @brief Stops keeping an animated image frame, i.e. when it is used again.
+   * @param[in] textureId The texture id of the frame
+   */
+  void RemoveAnimatedImageFrame(const TextureCacheManager::TextureId textureId);
+
+  /**
+   * @brief Removes the least recently used animated image frames until they fit in the animated image frame cache size.
+   */
+  void TrimAnimatedImageFrames();
+
   /**
    * @brief Remove data from container by the TextureCacheIndex.
    * It also valiate the TextureIdConverter internally.
@@ -387,6 +526,16 @@ private:                                            // Member Variables:
   TextureInfoContainerType            mTextureInfoContainer{}; ///< Used to manage the life-cycle and caching of Textures
   ExternalTextureInfoContainerType    mExternalTextures{};     ///< Externally provided textures
   EncodedImageBufferInfoContainerType mEncodedImageBuffers{};  ///< Externally encoded image buffer
+
+  DecodedImageInfoContainerType mDecodedImages{};          ///< Decoded images smaller textures can be derived from
+  uint32_t                      mDecodedImageCacheSize{0u}; ///< The maximum number of bytes of the decoded images
+  uint32_t                      mDecodedImageBytes{0u};     ///< The number of bytes of the decoded images
+
+  AnimatedImageFrameInfoContainerType mAnimatedImageFrames{};          ///< Animated image frames kept after they are removed
+  uint32_t                            mAnimatedImageFrameCacheSize{0u}; ///< The maximum number of bytes of the kept animated image frames
+  uint32_t                            mAnimatedImageFrameBytes{0u};     ///< The number of bytes of the kept animated image frames
+
+  TextureCacheManager::Statistics mStatistics{}; ///< The statistics of the cache
 };
 
 } // namespace Internal
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 
 // EXTERNAL HEADERS
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
@@ -39,6 +40,22 @@ constexpr auto INITIAL_HASH_NUMBER = size_t{0u};
 constexpr auto TEXTURE_INDEX      = 0u; ///< The Index for texture
 constexpr auto MASK_TEXTURE_INDEX = 1u; ///< The Index for mask texture
 
+constexpr auto DECODED_IMAGE_CACHE_SIZE_ENV = "DALI_TEXTURE_DECODED_IMAGE_CACHE_SIZE"; ///< The size in kilobytes of the decoded images kept to derive smaller textures
+
+uint32_t GetDecodedImageCacheSize()
+{
+  auto decodedImageCacheSizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(DECODED_IMAGE_CACHE_SIZE_ENV);
+  return decodedImageCacheSizeString ? static_cast<uint32_t>(std::atoi(decodedImageCacheSizeString)) * 1024u : 0u;
+}
+
+constexpr auto ANIMATED_IMAGE_FRAME_CACHE_SIZE_ENV = "DALI_TEXTURE_ANIMATED_IMAGE_FRAME_CACHE_SIZE"; ///< The size in kilobytes of the animated image frames kept to share and loop them
+
+uint32_t GetAnimatedImageFrameCacheSize()
+{
+  auto animatedImageFrameCacheSizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(ANIMATED_IMAGE_FRAME_CACHE_SIZE_ENV);
+  return animatedImageFrameCacheSizeString ? static_cast<uint32_t>(std::atoi(animatedImageFrameCacheSizeString)) * 1024u : 0u;
+}
+
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_IMAGE_PERFORMANCE_MARKER, false);
 } // namespace
 
@@ -108,6 +125,9 @@ TextureManager::TextureManager(bool loadYuvPlanes)
   mLoadYuvPlanes(loadYuvPlanes),
   mRemoveProcessorRegistered(false)
 {
+  mTextureCacheManager.SetDecodedImageCacheSize(GetDecodedImageCacheSize());
+  mTextureCacheManager.SetAnimatedImageFrameCacheSize(GetAnimatedImageFrameCacheSize());
+
   // Initialize the AddOn
   RenderingAddOn::Get();
 }
@@ -594,6 +614,9 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   {
     DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Verbose, "TextureManager::RequestLoad( url=%s observer=%p ) ForcedReload cacheIndex:%d, textureId=%d, maskTextureId=%d, prevTextureId=%d\n", url.GetUrl().c_str(), observer, cacheIndex.GetIndex(), textureId, maskTextureId, previousTextureId);
     textureInfo.loadState = TextureManager::LoadState::NOT_STARTED;
+
+    // The file may have been changed. Don't derive the texture from the image decoded before.
+    mTextureCacheManager.RemoveDecodedImage(url);
   }
 
   if(!synchronousLoading)
@@ -777,6 +800,13 @@ void TextureManager::Remove(const TextureManager::TextureId textureId)
 
       DALI_LOG_INFO(gTextureManagerLogFilter, Debug::General, "TextureManager::Remove( textureId=%d ) cacheIndex:%d removal maskTextureId=%d, loadState=%s\n", textureId, textureCacheIndex.GetIndex(), maskTextureId, GET_LOAD_STATE_STRING(textureInfo.loadState));
 
+      // If this is the last remove of a texture which is loading, cancel the load rather than waiting for it to complete.
+      // The texture is never notified of a cancelled load, so it can be removed now.
+      if(textureInfo.loadState == TextureManager::LoadState::LOADING && textureInfo.referenceCount <= 1 && mAsyncLoader->Cancel(textureId))
+      {
+        textureInfo.loadState = TextureManager::LoadState::NOT_STARTED;
+      }
+
       // Remove textureId in CacheManager. Now, textureInfo is invalidate.
       mTextureCacheManager.RemoveCache(textureInfo);
 
@@ -935,7 +965,26 @@ void TextureManager::LoadTexture(TextureManager::TextureInfo& textureInfo, Textu
     }
     else
     {
-      mAsyncLoader->Load(textureInfo.textureId, textureInfo.url, textureInfo.desiredSize, textureInfo.fittingMode, textureInfo.samplingMode, textureInfo.orientationCorrection, premultiplyOnLoad, textureInfo.loadYuvPlanes);
+      // The texture can be derived from a larger decoded image of a local file, if it is not masked.
+      // Only the images decoded at their full size are kept to derive others, as a downscaled image is already filtered by its sampling mode.
+      Devel::PixelBuffer decodedImage;
+      bool               keepDecodedImage = false;
+      if(mTextureCacheManager.GetDecodedImageCacheSize() > 0u &&
+         textureInfo.maskTextureId == INVALID_TEXTURE_ID &&
+         textureInfo.storageType == TextureManager::StorageType::UPLOAD_TO_TEXTURE &&
+         !textureInfo.loadYuvPlanes &&
+         textureInfo.url.IsLocalResource())
+      {
+        decodedImage     = mTextureCacheManager.FindDecodedImage(textureInfo.url, textureInfo.orientationCorrection);
+        keepDecodedImage = textureInfo.desiredSize.GetWidth() == 0 && textureInfo.desiredSize.GetHeight() == 0;
+      }
+      // The image may be uploaded as a compressed texture, unless its pixels are masked or returned.
+      const bool compressTexture = textureInfo.maskTextureId == INVALID_TEXTURE_ID &&
+                                   textureInfo.storageType == TextureManager::StorageType::UPLOAD_TO_TEXTURE &&
+                                   !textureInfo.loadYuvPlanes;
+
+      const auto priority = IsLoadPrioritized(textureInfo, observer) ? AsyncTask::PriorityType::HIGH : AsyncTask::PriorityType::LOW;
+      mAsyncLoader->Load(textureInfo.textureId, textureInfo.url, textureInfo.desiredSize, textureInfo.fittingMode, textureInfo.samplingMode, textureInfo.orientationCorrection, premultiplyOnLoad, textureInfo.loadYuvPlanes, decodedImage, keepDecodedImage, compressTexture, priority);
     }
   }
   ObserveTexture(textureInfo, observer);
@@ -985,6 +1034,43 @@ void TextureManager::ProcessLoadQueue()
   mLoadQueue.Clear();
 }
 
+bool TextureManager::IsLoadPrioritized(const TextureManager::TextureInfo& textureInfo, TextureUploadObserver* observer) const
+{
+  if(observer)
+  {
+    if(observer->IsLoadPrioritized())
+    {
+      return true;
+    }
+  }
+  else if(textureInfo.observerList.Count() == 0u)
+  {
+    return true;
+  }
+
+  for(auto&& textureObserver : textureInfo.observerList)
+  {
+    if(textureObserver->IsLoadPrioritized())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void TextureManager::UpdateLoadPriority(const TextureManager::TextureId textureId)
+{
+  TextureCacheIndex cacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
+  if(cacheIndex != INVALID_CACHE_INDEX)
+  {
+    TextureInfo& textureInfo(mTextureCacheManager[cacheIndex]);
+    if(textureInfo.loadState == TextureManager::LoadState::LOADING && !textureInfo.loadSynchronously)
+    {
+      mAsyncLoader->SetPriority(textureId, IsLoadPrioritized(textureInfo, nullptr) ? AsyncTask::PriorityType::HIGH : AsyncTask::PriorityType::LOW);
+    }
+  }
+}
+
 void TextureManager::ObserveTexture(TextureManager::TextureInfo& textureInfo,
                                     TextureUploadObserver*       observer)
 {
@@ -1020,6 +1106,25 @@ void TextureManager::AsyncLoadComplete(const TextureManager::TextureId textureId
   }
 }
 
+void TextureManager::AsyncDecodeComplete(const TextureManager::TextureId textureId, Devel::PixelBuffer decodedImage, const bool derived)
+{
+  TextureCacheIndex cacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
+  if(cacheIndex != INVALID_CACHE_INDEX)
+  {
+    TextureInfo& textureInfo(mTextureCacheManager[cacheIndex]);
+    DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureManager::AsyncDecodeComplete( textureId:%d Url:%s derived:%d )\n", textureId, textureInfo.url.GetUrl().c_str(), derived);
+
+    if(derived)
+    {
+      mTextureCacheManager.NotifyDerivedHit();
+    }
+    else if(decodedImage && textureInfo.loadState != TextureManager::LoadState::CANCELLED)
+    {
+      mTextureCacheManager.CacheDecodedImage(textureInfo.url, textureInfo.orientationCorrection, decodedImage);
+    }
+  }
+}
+
 void TextureManager::PostLoad(TextureManager::TextureInfo& textureInfo, std::vector<Devel::PixelBuffer>& pixelBuffers)
 {
   if(!pixelBuffers.empty()) ///< Load success
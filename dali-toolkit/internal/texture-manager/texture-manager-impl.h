@@ -306,6 +306,30 @@ public:
     return mTextureCacheManager.AddEncodedImageBuffer(encodedImageBuffer);
   }
 
+  /**
+   * @copydoc TextureCacheManager::SetDecodedImageCacheSize
+   */
+  inline void SetDecodedImageCacheSize(const uint32_t size)
+  {
+    mTextureCacheManager.SetDecodedImageCacheSize(size);
+  }
+
+  /**
+   * @copydoc TextureCacheManager::SetAnimatedImageFrameCacheSize
+   */
+  inline void SetAnimatedImageFrameCacheSize(const uint32_t size)
+  {
+    mTextureCacheManager.SetAnimatedImageFrameCacheSize(size);
+  }
+
+  /**
+   * @copydoc TextureCacheManager::GetStatistics
+   */
+  inline const TextureCacheManager::Statistics& GetCacheStatistics() const
+  {
+    return mTextureCacheManager.GetStatistics();
+  }
+
 public: // Load Request API
   /**
    * @brief Requests an image load of the given URL.
@@ -339,6 +363,16 @@ public: // Load Request API
     TextureManager::MultiplyOnLoad&    preMultiplyOnLoad,
     const bool                         synchronousLoading = false);
 
+  /**
+   * @brief Updates the priority of a texture which is loading, e.g. when its observers go on or off the scene.
+   *
+   * The load is prioritized if any of the observers of the texture is prioritized, @see TextureUploadObserver::IsLoadPrioritized.
+   * The priority of a load which has already started is not changed.
+   *
+   * @param[in] textureId The ID of the texture.
+   */
+  void UpdateLoadPriority(const TextureManager::TextureId textureId);
+
 private: // Internal Load Request API
   /**
    * @brief Requests an image load of the given URL, when the texture has
@@ -547,6 +581,14 @@ private:
    */
   void ProcessLoadQueue();
 
+  /**
+   * @brief Checks whether the load of a texture should be prioritized.
+   * @param[in] textureInfo The TextureInfo struct associated with the Texture
+   * @param[in] observer The observer wishing to observe the texture upload, which is not added to the observer list yet. It can be null.
+   * @return True if the texture has no observer, or any of its observers is prioritized.
+   */
+  bool IsLoadPrioritized(const TextureManager::TextureInfo& textureInfo, TextureUploadObserver* observer) const;
+
   /**
    * Add the observer to the observer list
    * @param[in] textureInfo The TextureInfo struct associated with the texture
@@ -616,6 +658,15 @@ public:
    */
   void AsyncLoadComplete(const TextureManager::TextureId textureId, std::vector<Devel::PixelBuffer>& pixelBuffers);
 
+  /**
+   * @brief Handles the decoded image of a completed load.
+   * TextureAsyncLoadingHelper will call this API before AsyncLoadComplete, if the texture could be derived from a decoded image.
+   * @param[in] textureId    The ID of the texture load complete.
+   * @param[in] decodedImage The copy of the decoded image to keep, or an empty handle
+   * @param[in] derived      Whether the texture has been derived from a kept decoded image
+   */
+  void AsyncDecodeComplete(const TextureManager::TextureId textureId, Devel::PixelBuffer decodedImage, const bool derived);
+
 protected: // Implementation of Processor
   /**
    * @copydoc Dali::Integration::Processor::Process()
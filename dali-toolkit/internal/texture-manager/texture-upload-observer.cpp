@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -79,6 +79,11 @@ TextureUploadObserver::~TextureUploadObserver()
   }
 }
 
+bool TextureUploadObserver::IsLoadPrioritized() const
+{
+  return true;
+}
+
 TextureUploadObserver::DestructionSignalType& TextureUploadObserver::DestructionSignal()
 {
   return mDestructionSignal;
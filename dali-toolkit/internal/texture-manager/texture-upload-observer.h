@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_INTERNAL_TEXTURE_UPLOAD_OBSERVER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -89,6 +89,13 @@ public:
    */
   virtual void LoadComplete(bool loadSuccess, TextureInformation textureInformation) = 0;
 
+  /**
+   * @brief Whether the loads of this observer should be prioritized, e.g. because the texture is shown on the scene.
+   * The loads requested only by observers which are not prioritized wait for the others.
+   * @return True by default.
+   */
+  virtual bool IsLoadPrioritized() const;
+
   /**
    * @brief Returns the destruction signal.
    * This is emitted when the observer is destroyed.
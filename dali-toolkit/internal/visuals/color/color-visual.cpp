@@ -101,6 +101,36 @@ ColorVisual::~ColorVisual()
 {
 }
 
+void ColorVisual::NormalizeProperty(Property::Key& key, Property::Value& value)
+{
+  // The mix color of the color visual overrides Toolkit::Visual::Property::MIX_COLOR, so it is converted to its own index
+  if(key == MIX_COLOR)
+  {
+    key = Property::Key(Toolkit::ColorVisual::Property::MIX_COLOR);
+  }
+  else if(key == BLUR_RADIUS_NAME)
+  {
+    key = Property::Key(Toolkit::DevelColorVisual::Property::BLUR_RADIUS);
+  }
+  else if(key == CUTOUT_POLICY_NAME)
+  {
+    key = Property::Key(Toolkit::DevelColorVisual::Property::CUTOUT_POLICY);
+  }
+
+  if(key == Toolkit::DevelColorVisual::Property::CUTOUT_POLICY)
+  {
+    int cutoutPolicy = 0;
+    if(value.GetType() == Property::STRING && Scripting::GetEnumerationProperty(value, CUTOUT_POLICY_TABLE, CUTOUT_POLICY_TABLE_COUNT, cutoutPolicy))
+    {
+      value = cutoutPolicy;
+    }
+  }
+  else
+  {
+    Visual::Base::NormalizeProperty(key, value);
+  }
+}
+
 void ColorVisual::DoSetProperties(const Property::Map& propertyMap)
 {
   // By virtue of DoSetProperties being called last, this will override
@@ -55,6 +55,13 @@ public:
    */
   static ColorVisualPtr New(VisualFactoryCache& factoryCache, const Property::Map& properties);
 
+  /**
+   * @brief Converts a property to the index and value the color visual reads without a look up, for the VisualPrototype.
+   * @param[in,out] key The key, converted to the index if it is the name of a property
+   * @param[in,out] value The value, converted to the enumeration value if it is the name of one
+   */
+  static void NormalizeProperty(Property::Key& key, Property::Value& value);
+
 public: // from Visual
   /**
    * @copydoc Visual::Base::CreatePropertyMap
@@ -19,7 +19,10 @@
 #include <dali-toolkit/internal/visuals/image/image-atlas-manager.h>
 
 // EXTERNAL HEADER
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <cstdlib>
+#include <cstring>
 
 // INTERNAL HEADERS
 #include <dali-toolkit/internal/image-loader/image-atlas-impl.h>
@@ -35,10 +38,27 @@ namespace
 const uint32_t DEFAULT_ATLAS_SIZE(1024u); // this size can fit 8 by 8 images of average size 128*128
 const uint32_t MAX_ITEM_SIZE(512u);
 const uint32_t MAX_ITEM_AREA(MAX_ITEM_SIZE* MAX_ITEM_SIZE);
+
+constexpr auto PACKING_ALGORITHM_ENV         = "DALI_IMAGE_ATLAS_PACKING_ALGORITHM";         ///< "MAX_RECTS" to pack the images into the maximal free rectangles
+constexpr auto DEFRAGMENTATION_THRESHOLD_ENV = "DALI_IMAGE_ATLAS_DEFRAGMENTATION_THRESHOLD"; ///< The occupancy rate in percent below which an atlas is defragmented
+
+AtlasPacker::Algorithm GetPackingAlgorithm()
+{
+  auto packingAlgorithmString = Dali::EnvironmentVariable::GetEnvironmentVariable(PACKING_ALGORITHM_ENV);
+  return (packingAlgorithmString && std::strcmp(packingAlgorithmString, "MAX_RECTS") == 0) ? AtlasPacker::Algorithm::MAX_RECTS : AtlasPacker::Algorithm::BINARY_TREE;
+}
+
+float GetDefragmentationThreshold()
+{
+  auto defragmentationThresholdString = Dali::EnvironmentVariable::GetEnvironmentVariable(DEFRAGMENTATION_THRESHOLD_ENV);
+  return defragmentationThresholdString ? static_cast<float>(std::atoi(defragmentationThresholdString)) / 100.0f : 0.0f;
+}
 } // namespace
 
 ImageAtlasManager::ImageAtlasManager()
-: mBrokenImageUrl("")
+: mBrokenImageUrl(""),
+  mPackingAlgorithm(GetPackingAlgorithm()),
+  mDefragmentationThreshold(GetDefragmentationThreshold())
 {
 }
 
@@ -94,6 +114,13 @@ TextureSet ImageAtlasManager::Add(Vector4&             textureRect,
     i++;
   }
 
+  // Join the empty space of an atlas, rather than creating a new one.
+  i = DefragmentAtlas(size);
+  if(i < mAtlasList.size() && GetImplementation(mAtlasList[i]).Upload(textureRect, url, size, fittingMode, orientationCorrection, atlasUploadObserver))
+  {
+    return mTextureSetList[i];
+  }
+
   CreateNewAtlas();
   GetImplementation(mAtlasList.back()).Upload(textureRect, url, size, fittingMode, orientationCorrection, atlasUploadObserver);
   return mTextureSetList.back();
@@ -122,6 +149,13 @@ TextureSet ImageAtlasManager::Add(Vector4&                  textureRect,
     i++;
   }
 
+  // Join the empty space of an atlas, rather than creating a new one.
+  i = DefragmentAtlas(size);
+  if(i < mAtlasList.size() && GetImplementation(mAtlasList[i]).Upload(textureRect, encodedImageBuffer, size, fittingMode, orientationCorrection, atlasUploadObserver))
+  {
+    return mTextureSetList[i];
+  }
+
   CreateNewAtlas();
   GetImplementation(mAtlasList.back()).Upload(textureRect, encodedImageBuffer, size, fittingMode, orientationCorrection, atlasUploadObserver);
   return mTextureSetList.back();
@@ -173,17 +207,71 @@ void ImageAtlasManager::SetBrokenImage(const std::string& brokenImageUrl)
   }
 }
 
+void ImageAtlasManager::SetPackingAlgorithm(AtlasPacker::Algorithm algorithm)
+{
+  mPackingAlgorithm = algorithm;
+}
+
+void ImageAtlasManager::SetDefragmentationThreshold(float occupancyRate)
+{
+  mDefragmentationThreshold = occupancyRate;
+}
+
+ImageAtlasManager::Statistics ImageAtlasManager::GetStatistics() const
+{
+  Statistics statistics;
+  statistics.atlasCount = static_cast<uint32_t>(mAtlasList.size());
+
+  float occupancyRateSum = 0.0f;
+  for(auto&& atlas : mAtlasList)
+  {
+    // All the atlases have the same size.
+    occupancyRateSum += GetImplementation(atlas).GetOccupancyRate();
+    statistics.defragmentationCount += GetImplementation(atlas).GetDefragmentationCount();
+  }
+  if(statistics.atlasCount > 0u)
+  {
+    statistics.occupancyRate = occupancyRateSum / static_cast<float>(statistics.atlasCount);
+  }
+
+  return statistics;
+}
+
 void ImageAtlasManager::CreateNewAtlas()
 {
-  Toolkit::ImageAtlas newAtlas = Toolkit::ImageAtlas::New(DEFAULT_ATLAS_SIZE, DEFAULT_ATLAS_SIZE);
+  IntrusivePtr<Internal::ImageAtlas> newAtlasImpl = Internal::ImageAtlas::New(DEFAULT_ATLAS_SIZE, DEFAULT_ATLAS_SIZE, Pixel::RGBA8888, mPackingAlgorithm);
+  newAtlasImpl->SetDefragmentationEnabled(mDefragmentationThreshold > 0.0f);
+
+  Toolkit::ImageAtlas newAtlas(newAtlasImpl.Get());
   if(!mBrokenImageUrl.empty())
   {
     newAtlas.SetBrokenImage(mBrokenImageUrl);
   }
   mAtlasList.push_back(newAtlas);
-  TextureSet textureSet = TextureSet::New();
-  textureSet.SetTexture(0u, newAtlas.GetAtlas());
-  mTextureSetList.push_back(textureSet);
+
+  // The texture of the texture set is replaced when the atlas is defragmented.
+  mTextureSetList.push_back(newAtlasImpl->GetTextureSet());
+}
+
+uint32_t ImageAtlasManager::DefragmentAtlas(const ImageDimensions& size)
+{
+  uint32_t i = 0;
+  if(mDefragmentationThreshold > 0.0f)
+  {
+    for(; i < mAtlasList.size(); ++i)
+    {
+      Internal::ImageAtlas& atlas = GetImplementation(mAtlasList[i]);
+      if(atlas.GetOccupancyRate() < mDefragmentationThreshold && atlas.Defragment(size))
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    i = static_cast<uint32_t>(mAtlasList.size());
+  }
+  return i;
 }
 
 } // namespace Internal
@@ -26,6 +26,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/image-atlas.h>
+#include <dali-toolkit/internal/image-loader/atlas-packer.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 
 namespace Dali
@@ -45,6 +46,16 @@ public:
   typedef std::vector<Toolkit::ImageAtlas> AtlasContainer;
   typedef std::vector<TextureSet>          TextureSetContainer;
 
+  /**
+   * @brief The utilization of the atlases.
+   */
+  struct Statistics
+  {
+    uint32_t atlasCount{0u};           ///< The number of the atlases.
+    float    occupancyRate{0.0f};      ///< The rate of the area of all the atlases used by the images.
+    uint32_t defragmentationCount{0u}; ///< The number of the defragmentations completed.
+  };
+
 public:
   /**
    * Construtor
@@ -131,6 +142,25 @@ public:
    */
   void SetBrokenImage(const std::string& brokenImageUrl);
 
+  /**
+   * @brief Sets the algorithm to find the position of an image in the atlases created afterwards.
+   * @param[in] algorithm The algorithm.
+   */
+  void SetPackingAlgorithm(AtlasPacker::Algorithm algorithm);
+
+  /**
+   * @brief Sets the occupancy rate below which an atlas is defragmented, instead of creating a new atlas, when an image doesn't fit.
+   * The atlases created afterwards keep the images to defragment them. The defragmentation is disabled if the rate is zero, which is the default.
+   * @param[in] occupancyRate The occupancy rate, from 0 to 1.
+   */
+  void SetDefragmentationThreshold(float occupancyRate);
+
+  /**
+   * @brief Retrieves the utilization of the atlases.
+   * @return The statistics.
+   */
+  Statistics GetStatistics() const;
+
   /**
    * @brief Get shader
    */
@@ -144,6 +174,14 @@ private:
    */
   void CreateNewAtlas();
 
+  /**
+   * @brief Defragments an atlas which occupancy rate is below the threshold, so the image of the given size fits.
+   *
+   * @param[in] size The size of the image which doesn't fit in any atlas.
+   * @return The index of the atlas being defragmented, or the number of the atlases if none is.
+   */
+  uint32_t DefragmentAtlas(const ImageDimensions& size);
+
 protected:
   /**
    * Destructor
@@ -161,9 +199,11 @@ protected:
   ImageAtlasManager& operator=(const ImageAtlasManager& rhs);
 
 private:
-  AtlasContainer      mAtlasList;
-  TextureSetContainer mTextureSetList;
-  std::string         mBrokenImageUrl;
+  AtlasContainer         mAtlasList;
+  TextureSetContainer    mTextureSetList;
+  std::string            mBrokenImageUrl;
+  AtlasPacker::Algorithm mPackingAlgorithm;        ///< The algorithm to find the position of an image
+  float                  mDefragmentationThreshold; ///< The occupancy rate below which an atlas is defragmented. Zero if disabled
 };
 
 } // namespace Internal
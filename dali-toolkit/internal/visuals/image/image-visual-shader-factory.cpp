@@ -40,32 +40,23 @@ constexpr int              NATIVE_SHADER_TYPE_OFFSET = VisualFactoryCache::Shade
 constexpr std::string_view Y_FLIP_MASK_TEXTURE       = "uYFlipMaskTexture";
 constexpr float            NOT_FLIP_MASK_TEXTURE     = 0.0f;
 
-constexpr auto SHADER_TYPE_COUNT = 6u;
-
-constexpr std::string_view VertexPredefines[SHADER_TYPE_COUNT]{
-  "",                                     // VisualFactoryCache::IMAGE_SHADER,
-  "#define IS_REQUIRED_ROUNDED_CORNER\n", // VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER,
-  "",                                     // VisualFactoryCache::IMAGE_SHADER_YUV_TO_RGB,
-  "#define IS_REQUIRED_ROUNDED_CORNER\n", // VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER_YUV_TO_RGB,
-  "",                                     // VisualFactoryCache::IMAGE_SHADER_YUV_AND_RGB,
-  "#define IS_REQUIRED_ROUNDED_CORNER\n", // VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER_YUV_AND_RGB,
-};
-constexpr std::string_view FragmentPredefines[SHADER_TYPE_COUNT]{
-  "",                                                                              // VisualFactoryCache::IMAGE_SHADER,
-  "#define IS_REQUIRED_ROUNDED_CORNER\n",                                          // VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER,
-  "#define IS_REQUIRED_YUV_TO_RGB\n",                                              // VisualFactoryCache::IMAGE_SHADER_YUV_TO_RGB,
-  "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_YUV_TO_RGB\n",          // VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER_YUV_TO_RGB,
-  "#define IS_REQUIRED_UNIFIED_YUV_AND_RGB\n",                                     // VisualFactoryCache::IMAGE_SHADER_YUV_AND_RGB,
-  "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_UNIFIED_YUV_AND_RGB\n", // VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER_YUV_AND_RGB,
-};
-constexpr VisualFactoryCache::ShaderType ShaderTypePredefines[SHADER_TYPE_COUNT]{
-  VisualFactoryCache::ShaderType::IMAGE_SHADER,
-  VisualFactoryCache::ShaderType::IMAGE_SHADER_ROUNDED_CORNER,
-  VisualFactoryCache::ShaderType::IMAGE_SHADER_YUV_TO_RGB,
-  VisualFactoryCache::ShaderType::IMAGE_SHADER_ROUNDED_CORNER_YUV_TO_RGB,
-  VisualFactoryCache::ShaderType::IMAGE_SHADER_YUV_AND_RGB,
-  VisualFactoryCache::ShaderType::IMAGE_SHADER_ROUNDED_CORNER_YUV_AND_RGB,
-};
+constexpr auto IMAGE_SHADER_VARIANT_COUNT = sizeof(SHADER_IMAGE_VISUAL_SHADER_VARIANTS) / sizeof(SHADER_IMAGE_VISUAL_SHADER_VARIANTS[0]);
+static_assert(IMAGE_SHADER_VARIANT_COUNT == VisualFactoryCache::NATIVE_IMAGE_SHADER - VisualFactoryCache::IMAGE_SHADER, "image-visual-shader.variants must list every image shader type");
+
+/**
+ * @brief Retrieves the variant of the image shader generated from image-visual-shader.variants.
+ * @param[in] shaderType The type of the image shader, which is not a native image shader
+ * @return The variant, whose sources have the defines of the shader type expanded
+ */
+const BuiltInShaderVariant& GetShaderVariant(VisualFactoryCache::ShaderType shaderType)
+{
+  const uint32_t variantIndex = static_cast<uint32_t>(shaderType) - static_cast<uint32_t>(VisualFactoryCache::IMAGE_SHADER);
+  DALI_ASSERT_DEBUG(variantIndex < IMAGE_SHADER_VARIANT_COUNT && "Image shader type doesn't have a variant!!");
+
+  const BuiltInShaderVariant& variant = SHADER_IMAGE_VISUAL_SHADER_VARIANTS[variantIndex];
+  DALI_ASSERT_DEBUG(variant.name == Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(shaderType, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT) && "image-visual-shader.variants is not in the order of the shader types!!");
+  return variant;
+}
 } // unnamed namespace
 
 ImageVisualShaderFactory::ImageVisualShaderFactory()
@@ -98,19 +89,21 @@ Shader ImageVisualShaderFactory::GetShader(VisualFactoryCache& factoryCache, Ima
     return shader;
   }
 
-  std::string vertexShaderPrefixList;
-  std::string fragmentShaderPrefixList;
-  featureBuilder.GetVertexShaderPrefixList(vertexShaderPrefixList);
-  featureBuilder.GetFragmentShaderPrefixList(fragmentShaderPrefixList);
+  // The defines of the variant are expanded at build time, only the prefix of the graphics backend is added here.
+  // The native image shaders use the variants of the image shaders, of which the fragment shader is changed below.
+  const BuiltInShaderVariant& variant = GetShaderVariant(featureBuilder.GetShaderType());
+
+  std::string vertexShader   = Dali::Shader::GetVertexShaderPrefix();
+  std::string fragmentShader = Dali::Shader::GetFragmentShaderPrefix();
 
   if(Dali::Toolkit::Internal::ImageVisualShaderDebug::DebugImageVisualShaderEnabled())
   {
-    vertexShaderPrefixList += "#define IS_REQUIRED_DEBUG_VISUAL_SHADER\n";
-    fragmentShaderPrefixList += "#define IS_REQUIRED_DEBUG_VISUAL_SHADER\n";
+    vertexShader += "#define IS_REQUIRED_DEBUG_VISUAL_SHADER\n";
+    fragmentShader += "#define IS_REQUIRED_DEBUG_VISUAL_SHADER\n";
   }
 
-  std::string vertexShader   = std::string(Dali::Shader::GetVertexShaderPrefix() + vertexShaderPrefixList + SHADER_IMAGE_VISUAL_SHADER_VERT.data());
-  std::string fragmentShader = std::string(Dali::Shader::GetFragmentShaderPrefix() + fragmentShaderPrefixList + SHADER_IMAGE_VISUAL_SHADER_FRAG.data());
+  vertexShader.append(variant.vertexShader);
+  fragmentShader.append(variant.fragmentShader);
 
   if(Dali::Toolkit::Internal::ImageVisualShaderDebug::DebugImageVisualShaderEnabled())
   {
@@ -181,12 +174,15 @@ void ImageVisualShaderFactory::GetPreCompiledShader(RawShaderData& shaders)
   std::vector<std::string_view> shaderName;
   shaders.shaderCount = 0;
   int shaderCount     = 0;
-  for(uint32_t i = 0; i < SHADER_TYPE_COUNT; ++i)
+  for(const auto& variant : SHADER_IMAGE_VISUAL_SHADER_VARIANTS)
   {
-    vertexPrefix.push_back(VertexPredefines[i]);
-    fragmentPrefix.push_back(FragmentPredefines[i]);
-    shaderName.push_back(Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(ShaderTypePredefines[i], VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
-    shaderCount++;
+    if(variant.precompile)
+    {
+      vertexPrefix.push_back(variant.vertexPrefix);
+      fragmentPrefix.push_back(variant.fragmentPrefix);
+      shaderName.push_back(variant.name);
+      shaderCount++;
+    }
   }
 
   shaders.vertexPrefix   = vertexPrefix;
@@ -197,6 +193,19 @@ void ImageVisualShaderFactory::GetPreCompiledShader(RawShaderData& shaders)
   shaders.shaderCount    = shaderCount;
 }
 
+bool ImageVisualShaderFactory::AddPreCompiledShader(VisualFactoryCache::ShaderType shaderType, std::vector<RawShaderData>& shaderList)
+{
+  // The native image shaders are not precompiled, as their fragment shader depends on the texture.
+  if(shaderType < VisualFactoryCache::IMAGE_SHADER || shaderType >= VisualFactoryCache::NATIVE_IMAGE_SHADER)
+  {
+    return false;
+  }
+
+  const BuiltInShaderVariant& variant = GetShaderVariant(shaderType);
+  VisualFactoryCache::AddPreCompiledShader(shaderList, shaderType, variant.vertexPrefix, variant.fragmentPrefix, SHADER_IMAGE_VISUAL_SHADER_VERT, SHADER_IMAGE_VISUAL_SHADER_FRAG);
+  return true;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
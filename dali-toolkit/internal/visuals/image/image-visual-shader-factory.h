@@ -73,6 +73,14 @@ public:
    */
   void GetPreCompiledShader(RawShaderData& shaders);
 
+  /**
+   * @brief Adds the image shader of the given type to the list of the shaders to precompile.
+   * @param[in] shaderType The type of the shader
+   * @param[in,out] shaderList The list of the shaders to precompile
+   * @return false if the shader type is not an image shader which can be precompiled
+   */
+  bool AddPreCompiledShader(VisualFactoryCache::ShaderType shaderType, std::vector<RawShaderData>& shaderList);
+
 protected:
   /**
    * Undefined copy constructor.
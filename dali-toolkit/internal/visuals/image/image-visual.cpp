@@ -239,6 +239,72 @@ ImageVisual::~ImageVisual()
   }
 }
 
+void ImageVisual::NormalizeProperty(Property::Key& key, Property::Value& value)
+{
+  if(key.type == Property::Key::STRING)
+  {
+    for(int i = 0; i < NAME_INDEX_MATCH_TABLE_SIZE; ++i)
+    {
+      if(key == NAME_INDEX_MATCH_TABLE[i].name)
+      {
+        key = Property::Key(NAME_INDEX_MATCH_TABLE[i].index);
+        break;
+      }
+    }
+  }
+
+  if(key.type == Property::Key::STRING)
+  {
+    Visual::Base::NormalizeProperty(key, value);
+    return;
+  }
+
+  if(value.GetType() == Property::STRING)
+  {
+    int  enumeration = 0;
+    bool converted   = false;
+    switch(key.indexKey)
+    {
+      case Toolkit::ImageVisual::Property::FITTING_MODE:
+      {
+        converted = Scripting::GetEnumerationProperty(value, FITTING_MODE_TABLE, FITTING_MODE_TABLE_COUNT, enumeration);
+        break;
+      }
+      case Toolkit::ImageVisual::Property::SAMPLING_MODE:
+      {
+        converted = Scripting::GetEnumerationProperty(value, SAMPLING_MODE_TABLE, SAMPLING_MODE_TABLE_COUNT, enumeration);
+        break;
+      }
+      case Toolkit::ImageVisual::Property::WRAP_MODE_U:
+      case Toolkit::ImageVisual::Property::WRAP_MODE_V:
+      {
+        converted = Scripting::GetEnumerationProperty(value, WRAP_MODE_TABLE, WRAP_MODE_TABLE_COUNT, enumeration);
+        break;
+      }
+      case Toolkit::ImageVisual::Property::RELEASE_POLICY:
+      {
+        converted = Scripting::GetEnumerationProperty(value, RELEASE_POLICY_TABLE, RELEASE_POLICY_TABLE_COUNT, enumeration);
+        break;
+      }
+      case Toolkit::ImageVisual::Property::LOAD_POLICY:
+      {
+        converted = Scripting::GetEnumerationProperty(value, LOAD_POLICY_TABLE, LOAD_POLICY_TABLE_COUNT, enumeration);
+        break;
+      }
+      default:
+      {
+        Visual::Base::NormalizeProperty(key, value);
+        break;
+      }
+    }
+
+    if(converted)
+    {
+      value = enumeration;
+    }
+  }
+}
+
 void ImageVisual::DoSetProperties(const Property::Map& propertyMap)
 {
   // Url is already received in constructor
@@ -866,11 +932,19 @@ void ImageVisual::InitializeRenderer()
 
 void ImageVisual::DoSetOnScene(Actor& actor)
 {
+  mLoadPrioritized = true;
+
   if(mImageUrl.IsValid())
   {
     InitializeRenderer();
   }
 
+  if(mLoadState == TextureManager::LoadState::LOADING && mTextureId != TextureManager::INVALID_TEXTURE_ID)
+  {
+    // The image may have been requested before the visual was on the scene.
+    mFactoryCache.GetTextureManager().UpdateLoadPriority(mTextureId);
+  }
+
   if(!mImpl->mRenderer)
   {
     return;
@@ -913,12 +987,19 @@ void ImageVisual::DoSetOffScene(Actor& actor)
 
   // Image release is dependent on the ReleasePolicy, renderer is removed.
   actor.RemoveRenderer(mImpl->mRenderer);
-  mRendererAdded = false;
+  mRendererAdded   = false;
+  mLoadPrioritized = false;
 
   if(mReleasePolicy == Toolkit::ImageVisual::ReleasePolicy::DETACHED)
   {
+    // The load is cancelled if it has not started yet and no other visual uses the texture.
     ResetRenderer();
   }
+  else if(mLoadState == TextureManager::LoadState::LOADING && mTextureId != TextureManager::INVALID_TEXTURE_ID)
+  {
+    // Let the visuals on the scene be loaded first.
+    mFactoryCache.GetTextureManager().UpdateLoadPriority(mTextureId);
+  }
 
   mPlacementActor.Reset();
 }
@@ -1066,6 +1147,22 @@ void ImageVisual::UploadCompleted()
   mLoadState = TextureManager::LoadState::LOAD_FINISHED;
 }
 
+// From existing atlas manager
+void ImageVisual::TextureRectChanged(const Vector4& textureRect)
+{
+  // The atlas is defragmented, and its texture is replaced at the same time.
+  mAtlasRect = textureRect;
+  if(mImpl->mRenderer && mImpl->mRenderer.GetPropertyIndex(ATLAS_RECT_UNIFORM_NAME) != Property::INVALID_INDEX)
+  {
+    mImpl->mRenderer.RegisterProperty(ATLAS_RECT_UNIFORM_NAME, mAtlasRect);
+  }
+}
+
+bool ImageVisual::IsLoadPrioritized() const
+{
+  return mLoadPrioritized;
+}
+
 // From FastTrackLoadingTask
 void ImageVisual::FastLoadComplete(FastTrackLoadingTaskPtr task)
 {
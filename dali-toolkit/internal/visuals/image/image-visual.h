@@ -154,6 +154,13 @@ public:
                             FittingMode::Type         fittingMode  = FittingMode::VISUAL_FITTING,
                             Dali::SamplingMode::Type  samplingMode = SamplingMode::BOX_THEN_LINEAR);
 
+  /**
+   * @brief Converts a property to the index and value the image visual reads without a look up, for the VisualPrototype.
+   * @param[in,out] key The key, converted to the index if it is the name of a property
+   * @param[in,out] value The value, converted to the enumeration value if it is the name of one
+   */
+  static void NormalizeProperty(Property::Key& key, Property::Value& value);
+
 public: // from Visual
   /**
    * @copydoc Visual::Base::GetNaturalSize
@@ -249,6 +256,11 @@ public:
    */
   void UploadCompleted() override;
 
+  /**
+   * @copydoc AtlasUploadObserver::TextureRectChanged
+   */
+  void TextureRectChanged(const Vector4& textureRect) override;
+
   /**
    * @copydoc TextureUploadObserver::LoadCompleted
    *
@@ -257,6 +269,13 @@ public:
    */
   void LoadComplete(bool success, TextureInformation textureInformation) override;
 
+  /**
+   * @copydoc TextureUploadObserver::IsLoadPrioritized
+   *
+   * The images of the visuals on the scene are loaded before the ones loaded in advance or kept off the scene.
+   */
+  bool IsLoadPrioritized() const override;
+
   /**
    * @brief Test callback for FastTrackLoadingTask
    *
@@ -397,6 +416,7 @@ private:
   bool                                            mRendererAdded{false};          ///< True if renderer added into actor.
   bool                                            mUseBrokenImageRenderer{false}; ///< True if renderer changed as broken image.
   bool                                            mUseSynchronousSizing{false};   ///< True if we need to synchronize image texture size to visual size, otherwise use mDesiredSize.
+  bool                                            mLoadPrioritized{false};        ///< True if the image load is prioritized, i.e. the visual is on the scene.
 };
 
 } // namespace Internal
@@ -209,20 +209,11 @@ void* NPatchData::GetRenderingMap() const
   return mRenderingMap;
 }
 
-void NPatchData::SetLoadedNPatchData(Devel::PixelBuffer& pixelBuffer, bool preMultiplied)
+void NPatchData::SetLoadedNPatchData(Devel::PixelBuffer& pixelBuffer, const NPatchUtility::StretchRanges& stretchPixelsX, const NPatchUtility::StretchRanges& stretchPixelsY, bool preMultiplied)
 {
-  if(mBorder == Rect<int>(0, 0, 0, 0))
-  {
-    NPatchUtility::ParseBorders(pixelBuffer, mStretchPixelsX, mStretchPixelsY);
-
-    // Crop the image
-    pixelBuffer.Crop(1, 1, pixelBuffer.GetWidth() - 2, pixelBuffer.GetHeight() - 2);
-  }
-  else
-  {
-    mStretchPixelsX.PushBack(Uint16Pair(mBorder.left, ((pixelBuffer.GetWidth() >= static_cast<unsigned int>(mBorder.right)) ? pixelBuffer.GetWidth() - mBorder.right : 0)));
-    mStretchPixelsY.PushBack(Uint16Pair(mBorder.top, ((pixelBuffer.GetHeight() >= static_cast<unsigned int>(mBorder.bottom)) ? pixelBuffer.GetHeight() - mBorder.bottom : 0)));
-  }
+  // The stretch regions are parsed and the border pixels are cropped off by the loading task, in the worker thread.
+  mStretchPixelsX = stretchPixelsX;
+  mStretchPixelsY = stretchPixelsY;
 
   mCroppedWidth  = pixelBuffer.GetWidth();
   mCroppedHeight = pixelBuffer.GetHeight();
@@ -255,7 +246,7 @@ void NPatchData::NotifyObserver(TextureUploadObserver* observer, const bool& loa
       mPreMultiplyOnLoad));
 }
 
-void NPatchData::LoadComplete(bool loadSuccess, TextureInformation textureInformation)
+void NPatchData::LoadComplete(bool loadSuccess, Devel::PixelBuffer pixelBuffer, const NPatchUtility::StretchRanges& stretchPixelsX, const NPatchUtility::StretchRanges& stretchPixelsY, bool preMultiplied)
 {
   NPatchDataPtr self = this; // Keep reference until this API finished
 
@@ -264,7 +255,7 @@ void NPatchData::LoadComplete(bool loadSuccess, TextureInformation textureInform
     if(mLoadingState != LoadingState::LOAD_COMPLETE)
     {
       // If mLoadingState is LOAD_FAILED, just re-set (It can be happened when sync loading is failed, but async loading is succeeded).
-      SetLoadedNPatchData(textureInformation.pixelBuffer, textureInformation.preMultiplied);
+      SetLoadedNPatchData(pixelBuffer, stretchPixelsX, stretchPixelsY, preMultiplied);
     }
   }
   else
@@ -37,7 +37,7 @@ namespace Internal
 class NPatchData;
 typedef IntrusivePtr<NPatchData> NPatchDataPtr;
 
-class NPatchData : public ConnectionTracker, public Dali::Toolkit::TextureUploadObserver, public Dali::RefObject
+class NPatchData : public ConnectionTracker, public Dali::RefObject
 {
 public:
   typedef int32_t           NPatchDataId;                ///< The NPatchDataId type. This is used as a handle to refer to a particular Npatch Data.
@@ -251,28 +251,36 @@ public:
   /**
    * @brief Set loaded pixel buffer for the cache data.
    *
-   * @param [in] pixelBuffer loaded pixel buffer.
+   * @param [in] pixelBuffer loaded pixel buffer, whose border pixels are cropped off already.
+   * @param [in] stretchPixelsX The horizontal stretch regions of the cropped image.
+   * @param [in] stretchPixelsY The vertical stretch regions of the cropped image.
    * @param [in] preMultiplied whether the loaded image is premultiplied or not
    */
-  void SetLoadedNPatchData(Devel::PixelBuffer& pixelBuffer, bool preMultiplied);
+  void SetLoadedNPatchData(Devel::PixelBuffer& pixelBuffer, const NPatchUtility::StretchRanges& stretchPixelsX, const NPatchUtility::StretchRanges& stretchPixelsY, bool preMultiplied);
 
   /**
-   * @brief Send LoadComplete notify with current setuped NPatchData
+   * @brief Called when the image has been loaded, to set the data and to notify the observers.
+   *
+   * To avoid rendering garbage pixels, renderer should be added to actor after the resources are ready.
+   * This callback is the place to add the renderer as it would be called once the loading is finished.
    *
-   * @param [in] observer observer who will be got LoadComplete notify
    * @param [in] loadSuccess whether the image load success or not.
+   * @param [in] pixelBuffer loaded pixel buffer, whose border pixels are cropped off already.
+   * @param [in] stretchPixelsX The horizontal stretch regions of the cropped image.
+   * @param [in] stretchPixelsY The vertical stretch regions of the cropped image.
+   * @param [in] preMultiplied whether the loaded image is premultiplied or not
    */
-  void NotifyObserver(TextureUploadObserver* observer, const bool& loadSuccess);
+  void LoadComplete(bool loadSuccess, Devel::PixelBuffer pixelBuffer, const NPatchUtility::StretchRanges& stretchPixelsX, const NPatchUtility::StretchRanges& stretchPixelsY, bool preMultiplied);
 
-private:
   /**
-   * @copydoc TextureUploadObserver::LoadComplete
+   * @brief Send LoadComplete notify with current setuped NPatchData
    *
-   * To avoid rendering garbage pixels, renderer should be added to actor after the resources are ready.
-   * This callback is the place to add the renderer as it would be called once the loading is finished.
+   * @param [in] observer observer who will be got LoadComplete notify
+   * @param [in] loadSuccess whether the image load success or not.
    */
-  void LoadComplete(bool loadSuccess, TextureInformation textureInformation) override;
+  void NotifyObserver(TextureUploadObserver* observer, const bool& loadSuccess);
 
+private:
   /**
    * This is called by the TextureUploadObserver when an observer is destroyed.
    * We use the callback to know when to remove an observer from our notify list.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/trace.h>
+#include <filesystem>
 
 namespace Dali
 {
@@ -38,7 +39,34 @@ namespace
 constexpr auto INVALID_CACHE_INDEX = int32_t{-1}; ///< Invalid Cache index
 constexpr auto UNINITIALIZED_ID    = int32_t{0};  ///< uninitialised id, use to initialize ids
 
+constexpr uint32_t MAXIMUM_STRETCH_PIXELS_CACHE_COUNT = 64u; ///< The number of the urls whose stretch regions are kept
+
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_IMAGE_PERFORMANCE_MARKER, false);
+
+/**
+ * @brief Gets the modification time and the size of a local file, to find out whether it has been changed.
+ * They are 0 for the other urls, and if the file is not found.
+ */
+std::pair<int64_t, uint64_t> GetFileStamp(const VisualUrl& url)
+{
+  if(!url.IsLocalResource())
+  {
+    return std::make_pair(0, 0u);
+  }
+
+  std::error_code errorCode;
+  const auto      fileSize = std::filesystem::file_size(url.GetUrl(), errorCode);
+  if(errorCode)
+  {
+    return std::make_pair(0, 0u);
+  }
+  const auto modificationTime = std::filesystem::last_write_time(url.GetUrl(), errorCode);
+  if(errorCode)
+  {
+    return std::make_pair(0, 0u);
+  }
+  return std::make_pair(static_cast<int64_t>(modificationTime.time_since_epoch().count()), static_cast<uint64_t>(fileSize));
+}
 } // Anonymous namespace
 
 NPatchLoader::NPatchLoader()
@@ -49,11 +77,21 @@ NPatchLoader::NPatchLoader()
 
 NPatchLoader::~NPatchLoader()
 {
-  if(mRemoveProcessorRegistered && Adaptor::IsAvailable())
+  if(Adaptor::IsAvailable())
   {
-    Adaptor::Get().UnregisterProcessorOnce(*this, true);
-    mRemoveProcessorRegistered = false;
+    if(mRemoveProcessorRegistered)
+    {
+      Adaptor::Get().UnregisterProcessorOnce(*this, true);
+      mRemoveProcessorRegistered = false;
+    }
+
+    // The completed callbacks of the tasks would be called on this loader.
+    for(auto&& iter : mLoadingTasks)
+    {
+      Dali::AsyncTaskManager::Get().RemoveTask(iter.second);
+    }
   }
+  mLoadingTasks.clear();
 }
 
 NPatchData::NPatchDataId NPatchLoader::GenerateUniqueNPatchDataId()
@@ -96,24 +134,138 @@ NPatchData::NPatchDataId NPatchLoader::Load(TextureManager& textureManager, Text
 
     data->SetLoadingState(NPatchData::LoadingState::LOADING);
 
-    auto preMultiplyOnLoading = preMultiplyOnLoad ? TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD
-                                                  : TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+    EncodedImageBuffer encodedImageBuffer;
+    if(url.IsBufferResource())
+    {
+      encodedImageBuffer = textureManager.GetEncodedImageBuffer(url.GetUrl());
+    }
 
-    Devel::PixelBuffer pixelBuffer = textureManager.LoadPixelBuffer(url, Dali::ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, synchronousLoading, data.Get(), true, preMultiplyOnLoading);
+    auto preMultiplyOnLoading = preMultiplyOnLoad ? DevelAsyncImageLoader::PreMultiplyOnLoad::ON
+                                                  : DevelAsyncImageLoader::PreMultiplyOnLoad::OFF;
 
-    if(pixelBuffer)
+    // The stretch regions are parsed, and the border pixels cropped off, by the task in the worker thread.
+    NPatchLoadingTaskPtr task = new NPatchLoadingTask(data->GetId(), url, encodedImageBuffer, border, preMultiplyOnLoading, synchronousLoading ? nullptr : MakeCallback(this, &NPatchLoader::AsyncLoadComplete));
+    if(border == Rect<int>(0, 0, 0, 0))
     {
-      preMultiplyOnLoad = (preMultiplyOnLoading == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD) ? true : false;
-      data->SetLoadedNPatchData(pixelBuffer, preMultiplyOnLoad);
+      NPatchUtility::StretchRanges stretchPixelsX;
+      NPatchUtility::StretchRanges stretchPixelsY;
+      if(FindStretchPixels(url, stretchPixelsX, stretchPixelsY))
+      {
+        // Parsed by a previous load of the url. The border pixels need not be scanned again.
+        task->SetStretchPixels(stretchPixelsX, stretchPixelsY);
+      }
+    }
+
+    if(synchronousLoading)
+    {
+      // Note, we will not store this task after this API called.
+      task->Process();
+
+      Devel::PixelBuffer pixelBuffer = task->GetPixelBuffer();
+      if(pixelBuffer)
+      {
+        CacheStretchPixels(url, *task);
+
+        preMultiplyOnLoad = task->IsPreMultiplied();
+        data->SetLoadedNPatchData(pixelBuffer, task->GetStretchPixelsX(), task->GetStretchPixelsY(), preMultiplyOnLoad);
+      }
+      else
+      {
+        RemoveStretchPixels(url.GetUrl());
+        data->SetLoadingState(NPatchData::LoadingState::LOAD_FAILED);
+      }
     }
-    else if(synchronousLoading)
+    else
     {
-      data->SetLoadingState(NPatchData::LoadingState::LOAD_FAILED);
+      mLoadingTasks[data->GetId()] = task;
+      Dali::AsyncTaskManager::Get().AddTask(task);
     }
   }
   return data->GetId();
 }
 
+void NPatchLoader::AsyncLoadComplete(NPatchLoadingTaskPtr task)
+{
+  const NPatchData::NPatchDataId id = static_cast<NPatchData::NPatchDataId>(task->id);
+
+  auto iter = mLoadingTasks.find(id);
+  if(iter == mLoadingTasks.end() || iter->second != task)
+  {
+    return;
+  }
+  mLoadingTasks.erase(iter);
+
+  NPatchDataPtr data;
+  if(!GetNPatchData(id, data))
+  {
+    return;
+  }
+
+  Devel::PixelBuffer pixelBuffer = task->GetPixelBuffer();
+  if(pixelBuffer)
+  {
+    CacheStretchPixels(data->GetUrl(), *task);
+  }
+  else
+  {
+    RemoveStretchPixels(data->GetUrl().GetUrl());
+  }
+  data->LoadComplete(!!pixelBuffer, pixelBuffer, task->GetStretchPixelsX(), task->GetStretchPixelsY(), task->IsPreMultiplied());
+}
+
+void NPatchLoader::CacheStretchPixels(const VisualUrl& url, const NPatchLoadingTask& task)
+{
+  if(!task.HasParsedBorders())
+  {
+    return;
+  }
+
+  RemoveStretchPixels(url.GetUrl());
+
+  const auto fileStamp = GetFileStamp(url);
+  mStretchPixelsList.push_front(StretchPixelsInfo{url.GetUrl(), fileStamp.first, fileStamp.second, task.GetStretchPixelsX(), task.GetStretchPixelsY()});
+  mStretchPixelsCache[url.GetUrl()] = mStretchPixelsList.begin();
+
+  if(mStretchPixelsList.size() > MAXIMUM_STRETCH_PIXELS_CACHE_COUNT)
+  {
+    mStretchPixelsCache.erase(mStretchPixelsList.back().url);
+    mStretchPixelsList.pop_back();
+  }
+}
+
+bool NPatchLoader::FindStretchPixels(const VisualUrl& url, NPatchUtility::StretchRanges& stretchPixelsX, NPatchUtility::StretchRanges& stretchPixelsY)
+{
+  auto iter = mStretchPixelsCache.find(url.GetUrl());
+  if(iter == mStretchPixelsCache.end())
+  {
+    return false;
+  }
+
+  const auto fileStamp = GetFileStamp(url);
+  if(iter->second->modificationTime != fileStamp.first || iter->second->fileSize != fileStamp.second)
+  {
+    // The file has been changed. Its border pixels are parsed again.
+    mStretchPixelsList.erase(iter->second);
+    mStretchPixelsCache.erase(iter);
+    return false;
+  }
+
+  mStretchPixelsList.splice(mStretchPixelsList.begin(), mStretchPixelsList, iter->second);
+  stretchPixelsX = iter->second->stretchPixelsX;
+  stretchPixelsY = iter->second->stretchPixelsY;
+  return true;
+}
+
+void NPatchLoader::RemoveStretchPixels(const std::string& url)
+{
+  auto iter = mStretchPixelsCache.find(url);
+  if(iter != mStretchPixelsCache.end())
+  {
+    mStretchPixelsList.erase(iter->second);
+    mStretchPixelsCache.erase(iter);
+  }
+}
+
 int32_t NPatchLoader::GetCacheIndexFromId(const NPatchData::NPatchDataId id)
 {
   const unsigned int size = mCache.size();
@@ -178,6 +330,20 @@ void NPatchLoader::Remove(NPatchData::NPatchDataId id, TextureUploadObserver* te
 
   if(--info.mReferenceCount <= 0)
   {
+    auto iter = mLoadingTasks.find(id);
+    if(iter != mLoadingTasks.end())
+    {
+      // Nobody waits for the image any more.
+      Dali::AsyncTaskManager::Get().RemoveTask(iter->second);
+      mLoadingTasks.erase(iter);
+    }
+
+    // The encoded image buffer of the url may be released with its data.
+    if(info.mData->GetUrl().IsBufferResource())
+    {
+      RemoveStretchPixels(info.mData->GetUrl().GetUrl());
+    }
+
     mCache.erase(mCache.begin() + cacheIndex);
   }
 }
@@ -276,10 +442,10 @@ NPatchDataPtr NPatchLoader::GetNPatchData(const VisualUrl& url, const Rect<int>&
     info.mData->SetTextures(infoPtr->mData->GetTextures());
 
     NPatchUtility::StretchRanges stretchRangesX;
-    stretchRangesX.PushBack(Uint16Pair(border.left, ((info.mData->GetCroppedWidth() >= static_cast<unsigned int>(border.right)) ? info.mData->GetCroppedHeight() - border.right : 0)));
+    stretchRangesX.PushBack(Uint16Pair(border.left, ((info.mData->GetCroppedWidth() >= static_cast<unsigned int>(border.right)) ? info.mData->GetCroppedWidth() - border.right : 0)));
 
     NPatchUtility::StretchRanges stretchRangesY;
-    stretchRangesY.PushBack(Uint16Pair(border.top, ((info.mData->GetCroppedWidth() >= static_cast<unsigned int>(border.bottom)) ? info.mData->GetCroppedHeight() - border.bottom : 0)));
+    stretchRangesY.PushBack(Uint16Pair(border.top, ((info.mData->GetCroppedHeight() >= static_cast<unsigned int>(border.bottom)) ? info.mData->GetCroppedHeight() - border.bottom : 0)));
 
     info.mData->SetStretchPixelsX(stretchRangesX);
     info.mData->SetStretchPixelsY(stretchRangesY);
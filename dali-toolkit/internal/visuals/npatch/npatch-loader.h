@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_NPATCH_LOADER_H
 
 /*
- * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,13 +21,16 @@
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/processor-interface.h>
 #include <dali/public-api/rendering/texture-set.h>
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <utility> // for std::pair
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/utility/npatch-utilities.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 #include <dali-toolkit/internal/visuals/npatch/npatch-data.h>
+#include <dali-toolkit/internal/visuals/npatch/npatch-loading-task.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 
 namespace Dali
@@ -44,6 +47,11 @@ namespace Internal
  * Cache is not cleaned during app lifecycle as N patches take considerably
  * small space and there's not usually a lot of them. Usually N patches are specified in
  * toolkit default style and there is 1-2 per control that are shared across the whole application.
+ *
+ * The images are loaded by NPatchLoadingTask, which parses the stretch regions in the worker thread. The stretch regions
+ * parsed from the border pixels of the most recently loaded urls are kept after the data of the url is removed, so they
+ * are not parsed again. They are dropped when the load of the url fails, when the data of a buffer url is removed, or
+ * when the local file has been changed.
  */
 class NPatchLoader : public Integration::Processor
 {
@@ -89,6 +97,15 @@ public:
    */
   void RequestRemove(NPatchData::NPatchDataId id, TextureUploadObserver* textureObserver);
 
+  /**
+   * @brief Retrieves the number of the urls whose stretch regions are kept.
+   * @return The number of the urls.
+   */
+  uint32_t GetStretchPixelsCacheCount() const
+  {
+    return static_cast<uint32_t>(mStretchPixelsCache.size());
+  }
+
 protected: // Implementation of Processor
   /**
    * @copydoc Dali::Integration::Processor::Process()
@@ -108,6 +125,35 @@ private:
 
   int32_t GetCacheIndexFromId(const NPatchData::NPatchDataId id);
 
+  /**
+   * @brief Called when the task of an asynchronous load has been completed.
+   * @param [in] task The loading task.
+   */
+  void AsyncLoadComplete(NPatchLoadingTaskPtr task);
+
+  /**
+   * @brief Keep the stretch regions the task has parsed from the border pixels of the url.
+   * The least recently used ones are dropped if too many urls are kept.
+   * @param [in] url The url of the image.
+   * @param [in] task The completed loading task.
+   */
+  void CacheStretchPixels(const VisualUrl& url, const NPatchLoadingTask& task);
+
+  /**
+   * @brief Find the stretch regions kept for the url.
+   * @param [in] url The url of the image.
+   * @param [out] stretchPixelsX The stretch regions in the horizontal direction.
+   * @param [out] stretchPixelsY The stretch regions in the vertical direction.
+   * @return true if they are kept, and the file has not been changed since.
+   */
+  bool FindStretchPixels(const VisualUrl& url, NPatchUtility::StretchRanges& stretchPixelsX, NPatchUtility::StretchRanges& stretchPixelsY);
+
+  /**
+   * @brief Drop the stretch regions kept for the url.
+   * @param [in] url The url of the image.
+   */
+  void RemoveStretchPixels(const std::string& url);
+
   /**
    * @brief Remove a texture matching id.
    * Erase the observer from the observer list of cache if we need.
@@ -179,10 +225,28 @@ protected:
    */
   NPatchLoader& operator=(const NPatchLoader& rhs);
 
+  /**
+   * @brief The stretch regions parsed from the border pixels of a url.
+   */
+  struct StretchPixelsInfo
+  {
+    std::string                  url;
+    int64_t                      modificationTime; ///< The modification time of the local file. 0 for the other urls.
+    uint64_t                     fileSize;         ///< The size of the local file. 0 for the other urls.
+    NPatchUtility::StretchRanges stretchPixelsX;
+    NPatchUtility::StretchRanges stretchPixelsY;
+  };
+
+  using StretchPixelsList = std::list<StretchPixelsInfo>;
+
 private:
   NPatchData::NPatchDataId mCurrentNPatchDataId;
   std::vector<NPatchInfo>  mCache;
 
+  std::unordered_map<NPatchData::NPatchDataId, NPatchLoadingTaskPtr> mLoadingTasks;       ///< The asynchronous loads by the id of the data
+  StretchPixelsList                                                  mStretchPixelsList;  ///< The kept stretch regions. The most recently used first.
+  std::unordered_map<std::string, StretchPixelsList::iterator>       mStretchPixelsCache; ///< The kept stretch regions by the url
+
   std::vector<std::pair<NPatchData::NPatchDataId, TextureUploadObserver*>> mRemoveQueue; ///< Queue of textures to remove at PostProcess. It will be cleared after PostProcess.
 
   bool mRemoveProcessorRegistered : 1; ///< Flag if remove processor registered or not.
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/npatch/npatch-loading-task.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+NPatchLoadingTask::NPatchLoadingTask(int32_t id, const VisualUrl& url, const EncodedImageBuffer& encodedImageBuffer, const Rect<int>& border, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, CallbackBase* callback)
+: LoadingTask(static_cast<uint32_t>(id), url, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true, preMultiplyOnLoad, false, callback),
+  mBorder(border),
+  mStretchPixelsX(),
+  mStretchPixelsY(),
+  mHasStretchPixels(false),
+  mHasParsedBorders(false)
+{
+  // LoadingTask decodes the encoded buffer prior to the url.
+  this->encodedImageBuffer = encodedImageBuffer;
+}
+
+NPatchLoadingTask::~NPatchLoadingTask()
+{
+}
+
+void NPatchLoadingTask::SetStretchPixels(const NPatchUtility::StretchRanges& stretchPixelsX, const NPatchUtility::StretchRanges& stretchPixelsY)
+{
+  mStretchPixelsX   = stretchPixelsX;
+  mStretchPixelsY   = stretchPixelsY;
+  mHasStretchPixels = true;
+}
+
+Devel::PixelBuffer NPatchLoadingTask::GetPixelBuffer() const
+{
+  return pixelBuffers.empty() ? Devel::PixelBuffer() : pixelBuffers[0];
+}
+
+bool NPatchLoadingTask::IsPreMultiplied() const
+{
+  return !pixelBuffers.empty() && preMultiplyOnLoad == DevelAsyncImageLoader::PreMultiplyOnLoad::ON && Pixel::HasAlpha(pixelBuffers[0].GetPixelFormat());
+}
+
+void NPatchLoadingTask::Process()
+{
+  LoadingTask::Process();
+
+  if(pixelBuffers.empty())
+  {
+    return;
+  }
+
+  Devel::PixelBuffer& pixelBuffer = pixelBuffers[0];
+  const uint32_t      width       = pixelBuffer.GetWidth();
+  const uint32_t      height      = pixelBuffer.GetHeight();
+
+  if(mBorder == Rect<int>(0, 0, 0, 0))
+  {
+    if(!mHasStretchPixels)
+    {
+      NPatchUtility::ParseBorders(pixelBuffer, mStretchPixelsX, mStretchPixelsY);
+      mHasParsedBorders = true;
+    }
+
+    // Crop the image
+    pixelBuffer.Crop(1, 1, width - 2, height - 2);
+  }
+  else
+  {
+    mStretchPixelsX.Clear();
+    mStretchPixelsY.Clear();
+    mStretchPixelsX.PushBack(Uint16Pair(mBorder.left, ((width >= static_cast<unsigned int>(mBorder.right)) ? width - mBorder.right : 0)));
+    mStretchPixelsY.PushBack(Uint16Pair(mBorder.top, ((height >= static_cast<unsigned int>(mBorder.bottom)) ? height - mBorder.bottom : 0)));
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,146 @@
+#ifndef DALI_TOOLKIT_NPATCH_LOADING_TASK_H
+#define DALI_TOOLKIT_NPATCH_LOADING_TASK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/utility/npatch-utilities.h>
+#include <dali-toolkit/internal/image-loader/loading-task.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class NPatchLoadingTask;
+using NPatchLoadingTaskPtr = IntrusivePtr<NPatchLoadingTask>;
+
+/**
+ * The task of loading an n-patch image. The stretch regions are parsed from the border pixels, which are cropped off,
+ * in the worker thread as well, so the event thread only uploads the texture.
+ */
+class NPatchLoadingTask : public LoadingTask
+{
+public:
+  /**
+   * Constructor.
+   * @param [in] id The id of the NPatchData to load.
+   * @param [in] url The URL of the image file to load.
+   * @param [in] encodedImageBuffer The encoded buffer of the image if the url is a buffer resource, or an empty handle.
+   * @param [in] border The border of the image. If it is empty, the stretch regions are given by the border pixels of the image.
+   * @param [in] preMultiplyOnLoad ON if the image's color should be multiplied by it's alpha.
+   * @param [in] callback The callback that is called when the operation is completed, or nullptr when it is processed synchronously.
+   */
+  NPatchLoadingTask(int32_t                                  id,
+                    const VisualUrl&                         url,
+                    const EncodedImageBuffer&                encodedImageBuffer,
+                    const Rect<int>&                         border,
+                    DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                    CallbackBase*                            callback);
+
+  /**
+   * Destructor.
+   */
+  ~NPatchLoadingTask() override;
+
+  /**
+   * @brief Set the stretch regions parsed by a previous load of the url, so the border pixels are cropped without scanning them.
+   * @param [in] stretchPixelsX The horizontal stretch regions.
+   * @param [in] stretchPixelsY The vertical stretch regions.
+   */
+  void SetStretchPixels(const NPatchUtility::StretchRanges& stretchPixelsX, const NPatchUtility::StretchRanges& stretchPixelsY);
+
+  /**
+   * @brief Retrieve the loaded image, cropped.
+   * @return The pixel buffer, or an empty handle if the loading failed.
+   */
+  Devel::PixelBuffer GetPixelBuffer() const;
+
+  /**
+   * @brief Retrieve the horizontal stretch regions in the cropped image.
+   * @return The stretch regions.
+   */
+  const NPatchUtility::StretchRanges& GetStretchPixelsX() const
+  {
+    return mStretchPixelsX;
+  }
+
+  /**
+   * @brief Retrieve the vertical stretch regions in the cropped image.
+   * @return The stretch regions.
+   */
+  const NPatchUtility::StretchRanges& GetStretchPixelsY() const
+  {
+    return mStretchPixelsY;
+  }
+
+  /**
+   * @brief Whether the stretch regions have been parsed from the border pixels.
+   * @return true if the border pixels have been scanned by this task.
+   */
+  bool HasParsedBorders() const
+  {
+    return mHasParsedBorders;
+  }
+
+  /**
+   * @brief Whether the color of the loaded image has been multiplied by its alpha.
+   * @return true if the image is pre-multiplied.
+   */
+  bool IsPreMultiplied() const;
+
+public: // Implementation of AsyncTask
+  /**
+   * @copydoc Dali::AsyncTask::Process()
+   */
+  void Process() override;
+
+  /**
+   * @copydoc Dali::AsyncTask::GetTaskName()
+   */
+  std::string_view GetTaskName() const override
+  {
+    return "NPatchLoadingTask";
+  }
+
+private:
+  // Undefined
+  NPatchLoadingTask(const NPatchLoadingTask& task);
+
+  // Undefined
+  NPatchLoadingTask& operator=(const NPatchLoadingTask& task);
+
+private:
+  Rect<int>                    mBorder;
+  NPatchUtility::StretchRanges mStretchPixelsX;
+  NPatchUtility::StretchRanges mStretchPixelsY;
+
+  bool mHasStretchPixels : 1; ///< Whether the stretch regions are known before the image is loaded
+  bool mHasParsedBorders : 1; ///< Whether the stretch regions have been parsed from the border pixels
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_NPATCH_LOADING_TASK_H
@@ -56,16 +56,8 @@ const VisualFactoryCache::ShaderType SHADER_TYPE_TABLE[] =
     VisualFactoryCache::TEXT_SHADER_MULTI_COLOR_TEXT_WITH_STYLE_AND_OVERLAY,
 };
 
-static constexpr auto      SHADER_TYPE_COUNT = 1u;
-constexpr std::string_view VertexPredefines[SHADER_TYPE_COUNT]{
-  "", // VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT
-};
-constexpr std::string_view FragmentPredefines[SHADER_TYPE_COUNT]{
-  "", // VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT
-};
-constexpr VisualFactoryCache::ShaderType ShaderTypePredefines[SHADER_TYPE_COUNT]{
-  VisualFactoryCache::ShaderType::TEXT_SHADER_SINGLE_COLOR_TEXT,
-};
+constexpr auto TEXT_SHADER_VARIANT_COUNT = sizeof(SHADER_TEXT_VISUAL_SHADER_VARIANTS) / sizeof(SHADER_TEXT_VISUAL_SHADER_VARIANTS[0]);
+static_assert(TEXT_SHADER_VARIANT_COUNT == sizeof(SHADER_TYPE_TABLE) / sizeof(SHADER_TYPE_TABLE[0]), "text-visual-shader.variants must list every text shader type");
 
 } // unnamed namespace
 
@@ -135,29 +127,12 @@ Shader TextVisualShaderFactory::GetShader(VisualFactoryCache& factoryCache, cons
 
   if(!shader)
   {
-    std::string vertexShaderPrefixList;
-    std::string fragmentShaderPrefixList;
-
-    if(style == TextVisualShaderFeature::TextStyle::HAS_STYLES)
-    {
-      fragmentShaderPrefixList += "#define IS_REQUIRED_STYLE\n";
-    }
-    if(overlay == TextVisualShaderFeature::TextOverlay::HAS_OVERLAY)
-    {
-      fragmentShaderPrefixList += "#define IS_REQUIRED_OVERLAY\n";
-    }
-    // multi color can also render emoji. If multi color text, dont consider emoji
-    if(multiColor != TextVisualShaderFeature::TextMultiColor::MULTI_COLOR_TEXT && emoji == TextVisualShaderFeature::TextEmoji::HAS_EMOJI)
-    {
-      fragmentShaderPrefixList += "#define IS_REQUIRED_EMOJI\n";
-    }
-    if(multiColor == TextVisualShaderFeature::TextMultiColor::MULTI_COLOR_TEXT)
-    {
-      fragmentShaderPrefixList += "#define IS_REQUIRED_MULTI_COLOR\n";
-    }
+    // The defines of the variant are expanded at build time, only the prefix of the graphics backend is added here.
+    const BuiltInShaderVariant& variant = SHADER_TEXT_VISUAL_SHADER_VARIANTS[shaderTypeFlag];
+    DALI_ASSERT_DEBUG(variant.name == Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(shaderType, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT) && "text-visual-shader.variants is not in the order of the shader types!!");
 
-    std::string vertexShader   = std::string(Dali::Shader::GetVertexShaderPrefix() + vertexShaderPrefixList + SHADER_TEXT_VISUAL_SHADER_VERT.data());
-    std::string fragmentShader = std::string(Dali::Shader::GetFragmentShaderPrefix() + fragmentShaderPrefixList + SHADER_TEXT_VISUAL_SHADER_FRAG.data());
+    std::string vertexShader   = Dali::Shader::GetVertexShaderPrefix().append(variant.vertexShader);
+    std::string fragmentShader = Dali::Shader::GetFragmentShaderPrefix().append(variant.fragmentShader);
 
     shader = factoryCache.GenerateAndSaveShader(shaderType, vertexShader, fragmentShader);
   }
@@ -170,12 +145,15 @@ void TextVisualShaderFactory::GetPreCompiledShader(RawShaderData& shaders)
   std::vector<std::string_view> fragmentPrefix;
   std::vector<std::string_view> shaderName;
   int                           shaderCount = 0;
-  for(uint32_t i = 0; i < SHADER_TYPE_COUNT; ++i)
+  for(const auto& variant : SHADER_TEXT_VISUAL_SHADER_VARIANTS)
   {
-    vertexPrefix.push_back(VertexPredefines[i]);
-    fragmentPrefix.push_back(FragmentPredefines[i]);
-    shaderName.push_back(Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(ShaderTypePredefines[i], VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
-    shaderCount++;
+    if(variant.precompile)
+    {
+      vertexPrefix.push_back(variant.vertexPrefix);
+      fragmentPrefix.push_back(variant.fragmentPrefix);
+      shaderName.push_back(variant.name);
+      shaderCount++;
+    }
   }
 
   shaders.vertexPrefix   = vertexPrefix;
@@ -186,6 +164,19 @@ void TextVisualShaderFactory::GetPreCompiledShader(RawShaderData& shaders)
   shaders.shaderCount    = shaderCount;
 }
 
+bool TextVisualShaderFactory::AddPreCompiledShader(VisualFactoryCache::ShaderType shaderType, std::vector<RawShaderData>& shaderList)
+{
+  const uint32_t variantIndex = static_cast<uint32_t>(shaderType) - static_cast<uint32_t>(VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT);
+  if(shaderType < VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT || variantIndex >= TEXT_SHADER_VARIANT_COUNT)
+  {
+    return false;
+  }
+
+  const BuiltInShaderVariant& variant = SHADER_TEXT_VISUAL_SHADER_VARIANTS[variantIndex];
+  VisualFactoryCache::AddPreCompiledShader(shaderList, shaderType, variant.vertexPrefix, variant.fragmentPrefix, SHADER_TEXT_VISUAL_SHADER_VERT, SHADER_TEXT_VISUAL_SHADER_FRAG);
+  return true;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -453,6 +453,30 @@ void Visual::Base::SetProperties(const Property::Map& propertyMap)
   }
 }
 
+void Visual::Base::NormalizeProperty(Property::Key& key, Property::Value& value)
+{
+  if(key.type == Property::Key::STRING)
+  {
+    for(auto tableId = 0u; tableId < PROPERTY_NAME_INDEX_TABLE_COUNT; ++tableId)
+    {
+      if(key == PROPERTY_NAME_INDEX_TABLE[tableId].name)
+      {
+        key = Property::Key(PROPERTY_NAME_INDEX_TABLE[tableId].index);
+        break;
+      }
+    }
+  }
+
+  if(key == Toolkit::DevelVisual::Property::VISUAL_FITTING_MODE && value.GetType() == Property::STRING)
+  {
+    Visual::FittingMode fittingMode;
+    if(Scripting::GetEnumerationProperty<Visual::FittingMode>(value, VISUAL_FITTING_MODE_TABLE, VISUAL_FITTING_MODE_TABLE_COUNT, fittingMode))
+    {
+      value = static_cast<int>(fittingMode);
+    }
+  }
+}
+
 void Visual::Base::SetTransformAndSize(const Property::Map& transform, Size controlSize)
 {
   mImpl->mControlSize = controlSize;
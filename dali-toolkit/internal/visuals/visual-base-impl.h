@@ -76,6 +76,13 @@ public:
    */
   void SetProperties(const Property::Map& propertyMap);
 
+  /**
+   * Converts a property to the index and value SetProperties() reads without a look up, for the VisualPrototype.
+   * @param[in,out] key The key, converted to the index if it is the name of a property
+   * @param[in,out] value The value, converted to the enumeration value if it is the name of one
+   */
+  static void NormalizeProperty(Property::Key& key, Property::Value& value);
+
   /**
    * @copydoc Toolkit::Visual::Base::SetName
    */
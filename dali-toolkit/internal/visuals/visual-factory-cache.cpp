@@ -25,6 +25,7 @@
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/math/math-utils.h>
+#include <algorithm>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/utility/npatch-helper.h>
@@ -46,6 +47,7 @@ namespace
 const Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 
 constexpr auto LOAD_IMAGE_YUV_PLANES_ENV = "DALI_LOAD_IMAGE_YUV_PLANES";
+constexpr auto SHADER_USAGE_LOG_ENV      = "DALI_SHADER_USAGE_LOG";
 
 bool NeedToLoadYuvPlanes()
 {
@@ -54,10 +56,19 @@ bool NeedToLoadYuvPlanes()
   return loadYuvPlanes;
 }
 
+bool NeedToLogShaderUsage()
+{
+  auto shaderUsageLogString = Dali::EnvironmentVariable::GetEnvironmentVariable(SHADER_USAGE_LOG_ENV);
+  bool shaderUsageLog       = shaderUsageLogString ? std::atoi(shaderUsageLogString) : false;
+  return shaderUsageLog;
+}
+
 } // namespace
 
 VisualFactoryCache::VisualFactoryCache(bool preMultiplyOnLoad)
-: mLoadYuvPlanes(NeedToLoadYuvPlanes()),
+: mShaderUsageLog(),
+  mShaderUsageLogEnabled(NeedToLogShaderUsage()),
+  mLoadYuvPlanes(NeedToLoadYuvPlanes()),
   mTextureManager(mLoadYuvPlanes),
   mVectorAnimationManager(nullptr),
   mPreMultiplyOnLoad(preMultiplyOnLoad),
@@ -94,8 +105,70 @@ Shader VisualFactoryCache::GetShader(ShaderType type)
 
 Shader VisualFactoryCache::GenerateAndSaveShader(ShaderType type, std::string_view vertexShader, std::string_view fragmentShader)
 {
-  Shader shader = Shader::New(vertexShader, fragmentShader, Shader::Hint::NONE, Scripting::GetLinearEnumerationName<ShaderType>(type, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
-  mShader[type] = shader;
+  const char* shaderName = Scripting::GetLinearEnumerationName<ShaderType>(type, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT);
+  Shader      shader     = Shader::New(vertexShader, fragmentShader, Shader::Hint::NONE, shaderName);
+  mShader[type]          = shader;
+
+  if(mShaderUsageLogEnabled && std::find(mShaderUsageLog.begin(), mShaderUsageLog.end(), type) == mShaderUsageLog.end())
+  {
+    DALI_LOG_RELEASE_INFO("Shader used : %s\n", shaderName);
+    mShaderUsageLog.push_back(type);
+  }
+  return shader;
+}
+
+void VisualFactoryCache::EnableShaderUsageLog(bool enable)
+{
+  mShaderUsageLogEnabled = enable;
+}
+
+void VisualFactoryCache::AddPreCompiledShader(std::vector<RawShaderData>& shaderList, ShaderType type, std::string_view vertexPrefix, std::string_view fragmentPrefix, std::string_view vertexShader, std::string_view fragmentShader)
+{
+  // The variants of the same shader are compiled as a batch
+  if(shaderList.empty() || shaderList.back().vertexShader.data() != vertexShader.data() || shaderList.back().fragmentShader.data() != fragmentShader.data())
+  {
+    RawShaderData shaderData;
+    shaderData.shaderCount    = 0;
+    shaderData.vertexShader   = vertexShader;
+    shaderData.fragmentShader = fragmentShader;
+    shaderList.push_back(shaderData);
+  }
+
+  RawShaderData& shaderData = shaderList.back();
+  shaderData.vertexPrefix.push_back(vertexPrefix);
+  shaderData.fragmentPrefix.push_back(fragmentPrefix);
+  shaderData.shaderName.push_back(Scripting::GetLinearEnumerationName<ShaderType>(type, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
+  shaderData.shaderCount++;
+}
+
+Shader VisualFactoryCache::GetBlurShader(uint32_t numberOfSamples)
+{
+  auto iter = mBlurShaders.find(numberOfSamples);
+  if(iter != mBlurShaders.end())
+  {
+    return iter->second;
+  }
+
+  std::stringstream shaderName;
+  shaderName << "BLUR_EFFECT_" << numberOfSamples;
+
+  std::stringstream fragmentShader;
+  fragmentShader << "#define NUM_SAMPLES " << numberOfSamples << "\n"
+                 << SHADER_BLUR_EFFECT_FRAG;
+
+  Shader shader = Shader::New(SHADER_CONTROL_RENDERERS_VERT, fragmentShader.str(), Dali::Shader::Hint::NONE, shaderName.str());
+  mBlurShaders.emplace(numberOfSamples, shader);
+  return shader;
+}
+
+Shader VisualFactoryCache::GetDualKawaseBlurShader(bool upsample)
+{
+  Shader& shader = mDualKawaseBlurShaders[upsample ? 1 : 0];
+  if(!shader)
+  {
+    shader = upsample ? Shader::New(SHADER_CONTROL_RENDERERS_VERT, SHADER_DUAL_KAWASE_UPSAMPLE_FRAG, Dali::Shader::Hint::NONE, "DUAL_KAWASE_UPSAMPLE")
+                      : Shader::New(SHADER_CONTROL_RENDERERS_VERT, SHADER_DUAL_KAWASE_DOWNSAMPLE_FRAG, Dali::Shader::Hint::NONE, "DUAL_KAWASE_DOWNSAMPLE");
+  }
   return shader;
 }
 
@@ -283,35 +356,45 @@ VisualUrl::Type VisualFactoryCache::GetBrokenImageVisualType(int index)
 
 Geometry VisualFactoryCache::GetNPatchGeometry(int index)
 {
-  Geometry      geometry;
   NPatchDataPtr data;
   if(mNPatchLoader.GetNPatchData(mBrokenImageInfoContainer[index].npatchId, data) && data->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE)
   {
-    if(data->GetStretchPixelsX().Size() == 1 && data->GetStretchPixelsY().Size() == 1)
-    {
-      geometry = GetGeometry(VisualFactoryCache::NINE_PATCH_GEOMETRY);
-      if(!geometry)
-      {
-        geometry = NPatchHelper::CreateGridGeometry(Uint16Pair(3, 3));
-        SaveGeometry(VisualFactoryCache::NINE_PATCH_GEOMETRY, geometry);
-      }
-    }
-    else if(data->GetStretchPixelsX().Size() > 0 || data->GetStretchPixelsY().Size() > 0)
+    if(data->GetStretchPixelsX().Size() > 0 || data->GetStretchPixelsY().Size() > 0)
     {
       Uint16Pair gridSize(2 * data->GetStretchPixelsX().Size() + 1, 2 * data->GetStretchPixelsY().Size() + 1);
-      geometry = NPatchHelper::CreateGridGeometry(gridSize);
+      return GetNPatchGeometry(gridSize, false);
     }
+    return Geometry();
   }
-  else
+
+  // no N patch data so use default geometry
+  return GetNPatchGeometry(Uint16Pair(3, 3), false);
+}
+
+Geometry VisualFactoryCache::GetNPatchGeometry(Uint16Pair gridSize, bool borderOnly)
+{
+  // The nine patch geometries are kept with the other geometries.
+  if(gridSize == Uint16Pair(3, 3))
   {
-    // no N patch data so use default geometry
-    geometry = GetGeometry(VisualFactoryCache::NINE_PATCH_GEOMETRY);
+    const GeometryType type     = borderOnly ? NINE_PATCH_BORDER_GEOMETRY : NINE_PATCH_GEOMETRY;
+    Geometry           geometry = GetGeometry(type);
     if(!geometry)
     {
-      geometry = NPatchHelper::CreateGridGeometry(Uint16Pair(3, 3));
-      SaveGeometry(VisualFactoryCache::NINE_PATCH_GEOMETRY, geometry);
+      geometry = borderOnly ? NPatchHelper::CreateBorderGeometry(gridSize) : NPatchHelper::CreateGridGeometry(gridSize);
+      SaveGeometry(type, geometry);
     }
+    return geometry;
   }
+
+  const uint64_t key  = (static_cast<uint64_t>(borderOnly) << 32) | (static_cast<uint64_t>(gridSize.GetWidth()) << 16) | gridSize.GetHeight();
+  auto           iter = mNPatchGeometries.find(key);
+  if(iter != mNPatchGeometries.end())
+  {
+    return iter->second;
+  }
+
+  Geometry geometry = borderOnly ? NPatchHelper::CreateBorderGeometry(gridSize) : NPatchHelper::CreateGridGeometry(gridSize);
+  mNPatchGeometries.emplace(key, geometry);
   return geometry;
 }
 
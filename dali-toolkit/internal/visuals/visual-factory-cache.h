@@ -18,10 +18,12 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/integration-api/adaptor-framework/shader-precompiler.h>
 #include <dali/public-api/math/uint-16-pair.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/shader.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
@@ -200,6 +202,59 @@ public:
    */
   Shader GenerateAndSaveShader(ShaderType type, std::string_view vertexShader, std::string_view fragmentShader);
 
+  /**
+   * @brief Enables or disables the log of the shaders generated.
+   * While enabled, the type of each shader generated is logged in the order of their first use.
+   * The log is enabled from the start if the DALI_SHADER_USAGE_LOG environment variable is set to 1.
+   * @param[in] enable True to enable the log
+   */
+  void EnableShaderUsageLog(bool enable);
+
+  /**
+   * @brief Retrieves the types of the shaders generated while the log is enabled, in the order of their first use.
+   * @return The types of the shaders
+   */
+  const std::vector<ShaderType>& GetShaderUsageLog() const
+  {
+    return mShaderUsageLog;
+  }
+
+  /**
+   * @brief Adds a variant of a shader to the list of the shaders to precompile.
+   * The variant is added to the last shader data if it has the same sources, so that the variants of a shader are precompiled together.
+   * @param[in,out] shaderList The list of the shaders to precompile
+   * @param[in] type The type of the shader
+   * @param[in] vertexPrefix The defines of the vertex shader
+   * @param[in] fragmentPrefix The defines of the fragment shader
+   * @param[in] vertexShader The vertex shader code, without the defines
+   * @param[in] fragmentShader The fragment shader code, without the defines
+   */
+  static void AddPreCompiledShader(std::vector<RawShaderData>& shaderList, ShaderType type, std::string_view vertexPrefix, std::string_view fragmentPrefix, std::string_view vertexShader, std::string_view fragmentShader);
+
+  /**
+   * Request the shader of the blur effect which takes the given number of samples, generating and caching it if necessary.
+   * @param[in] numberOfSamples The number of the sample pairs taken for each pixel.
+   * @return The blur shader.
+   */
+  Shader GetBlurShader(uint32_t numberOfSamples);
+
+  /**
+   * Request the shader of a pass of the dual Kawase blur, generating and caching it if necessary.
+   * @param[in] upsample Whether the pass upsamples a level, or downsamples it.
+   * @return The dual Kawase blur shader.
+   */
+  Shader GetDualKawaseBlurShader(bool upsample);
+
+  /**
+   * @brief Gets the geometry of the n-patches with the given layout of the stretch regions, creating and caching it if necessary.
+   * The geometry depends on the number of the stretch regions only, so it is shared by all the n-patches with the same layout.
+   *
+   * @param[in] gridSize The number of the patches in each direction, i.e. twice the number of the stretch regions plus one.
+   * @param[in] borderOnly True if the center patch is not drawn.
+   * @return The Geometry for NPatch
+   */
+  Geometry GetNPatchGeometry(Uint16Pair gridSize, bool borderOnly);
+
   /*
    * Greate the quad geometry.
    * Quad geometry is shared by multiple kind of Renderer, so implement it in the factory-cache.
@@ -365,6 +420,13 @@ private:
   Geometry mGeometry[GEOMETRY_TYPE_MAX + 1];
   Shader   mShader[SHADER_TYPE_MAX + 1];
 
+  std::vector<ShaderType> mShaderUsageLog;        ///< The types of the shaders generated while the log is enabled
+  bool                    mShaderUsageLogEnabled; ///< Whether the shaders generated are logged
+
+  std::unordered_map<uint32_t, Shader>   mBlurShaders;              ///< The blur shaders by the number of samples
+  Shader                                 mDualKawaseBlurShaders[2]; ///< The downsample and upsample shaders of the dual Kawase blur
+  std::unordered_map<uint64_t, Geometry> mNPatchGeometries;         ///< The n-patch geometries by the grid size, except the 3x3 ones
+
   bool mLoadYuvPlanes; ///< A global flag to specify if the image should be loaded as yuv planes
 
   ImageAtlasManagerPtr mAtlasManager;
@@ -46,6 +46,7 @@
 #include <dali-toolkit/internal/visuals/text/text-visual-shader-factory.h>
 #include <dali-toolkit/internal/visuals/text/text-visual.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit/internal/visuals/visual-prototype-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/internal/visuals/wireframe/wireframe-visual.h>
@@ -76,21 +77,49 @@ DALI_TYPE_REGISTRATION_BEGIN_CREATE(Toolkit::VisualFactory, Dali::BaseHandle, Cr
 DALI_TYPE_REGISTRATION_END()
 const char* const BROKEN_IMAGE_FILE_NAME = "broken.png"; ///< The file name of the broken image.
 
-static constexpr auto SHADER_TYPE_COUNT = 2u;
-
-constexpr std::string_view VertexPredefines[SHADER_TYPE_COUNT]{
-  "",                                     //VisualFactoryCache::COLOR_SHADER
-  "#define IS_REQUIRED_ROUNDED_CORNER\n", //VisualFactoryCache::COLOR_SHADER_ROUNDED_CORNER
-};
-constexpr std::string_view FragmentPredefines[SHADER_TYPE_COUNT]{
-  "",                                     //VisualFactoryCache::COLOR_SHADER
-  "#define IS_REQUIRED_ROUNDED_CORNER\n", //VisualFactoryCache::COLOR_SHADER_ROUNDED_CORNER
+/**
+ * @brief A variant of the color shader which can be precompiled.
+ * The defines are in the order ColorVisual adds them, for the precompiled shader to match the one it creates.
+ */
+struct ColorShaderVariant
+{
+  VisualFactoryCache::ShaderType shaderType;
+  std::string_view               vertexPrefix;
+  std::string_view               fragmentPrefix;
+  bool                           precompile; ///< Whether the variant is precompiled by UsePreCompiledShader()
 };
-constexpr VisualFactoryCache::ShaderType ShaderTypePredefines[SHADER_TYPE_COUNT]{
-  VisualFactoryCache::ShaderType::COLOR_SHADER,
-  VisualFactoryCache::ShaderType::COLOR_SHADER_ROUNDED_CORNER,
+
+// The blur variants are not listed, as their defines depend on the shader language version.
+constexpr ColorShaderVariant COLOR_SHADER_VARIANTS[]{
+  {VisualFactoryCache::COLOR_SHADER, "", "", true},
+  {VisualFactoryCache::COLOR_SHADER_ROUNDED_CORNER, "#define IS_REQUIRED_ROUNDED_CORNER\n", "#define IS_REQUIRED_ROUNDED_CORNER\n", true},
+  {VisualFactoryCache::COLOR_SHADER_BORDERLINE, "#define IS_REQUIRED_BORDERLINE\n", "#define IS_REQUIRED_BORDERLINE\n", false},
+  {VisualFactoryCache::COLOR_SHADER_ROUNDED_BORDERLINE, "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_BORDERLINE\n", "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_BORDERLINE\n", false},
+  {VisualFactoryCache::COLOR_SHADER_CUTOUT, "#define IS_REQUIRED_CUTOUT\n", "#define IS_REQUIRED_CUTOUT\n", false},
+  {VisualFactoryCache::COLOR_SHADER_CUTOUT_ROUNDED_CORNER, "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_CUTOUT\n", "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_CUTOUT\n", false},
+  {VisualFactoryCache::COLOR_SHADER_CUTOUT_BORDERLINE, "#define IS_REQUIRED_BORDERLINE\n#define IS_REQUIRED_CUTOUT\n", "#define IS_REQUIRED_BORDERLINE\n#define IS_REQUIRED_CUTOUT\n", false},
+  {VisualFactoryCache::COLOR_SHADER_CUTOUT_ROUNDED_BORDERLINE, "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_BORDERLINE\n#define IS_REQUIRED_CUTOUT\n", "#define IS_REQUIRED_ROUNDED_CORNER\n#define IS_REQUIRED_BORDERLINE\n#define IS_REQUIRED_CUTOUT\n", false},
 };
 
+/**
+ * @brief Adds the color shader of the given type to the list of the shaders to precompile.
+ * @param[in] shaderType The type of the shader
+ * @param[in,out] shaderList The list of the shaders to precompile
+ * @return false if the shader type is not a color shader which can be precompiled
+ */
+bool AddPreCompiledColorShader(VisualFactoryCache::ShaderType shaderType, std::vector<RawShaderData>& shaderList)
+{
+  for(const auto& variant : COLOR_SHADER_VARIANTS)
+  {
+    if(variant.shaderType == shaderType)
+    {
+      VisualFactoryCache::AddPreCompiledShader(shaderList, shaderType, variant.vertexPrefix, variant.fragmentPrefix, SHADER_COLOR_VISUAL_SHADER_VERT, SHADER_COLOR_VISUAL_SHADER_FRAG);
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace
 
 VisualFactory::VisualFactory(bool debugEnabled)
@@ -326,6 +355,49 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
   return Toolkit::Visual::Base(visualPtr.Get());
 }
 
+Toolkit::Visual::Base VisualFactory::CreateVisual(const Toolkit::VisualPrototype& prototype, const Property::Map& overrides)
+{
+  const VisualPrototype& prototypeImpl = GetImplementation(prototype);
+
+  const Property::Map* propertyMap = &prototypeImpl.GetProperties();
+  const VisualUrl*     visualUrl   = &prototypeImpl.GetUrl();
+
+  Property::Map mergedMap;
+  VisualUrl     mergedUrl;
+  if(!overrides.Empty())
+  {
+    if(!prototypeImpl.Merge(overrides, mergedMap, mergedUrl))
+    {
+      return CreateVisual(mergedMap, mDefaultCreationOptions);
+    }
+    propertyMap = &mergedMap;
+    visualUrl   = mergedUrl.IsValid() ? &mergedUrl : visualUrl;
+  }
+  else if(!prototypeImpl.IsParsed())
+  {
+    return CreateVisual(prototypeImpl.GetSourceProperties(), mDefaultCreationOptions);
+  }
+
+  // The prototype has resolved the type and the url, and converted the names of the properties
+  Visual::BasePtr visualPtr;
+  if(prototypeImpl.GetType() == Toolkit::Visual::COLOR)
+  {
+    visualPtr = ColorVisual::New(GetFactoryCache(), *propertyMap);
+  }
+  else
+  {
+    visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), *visualUrl, *propertyMap);
+  }
+
+  if(mDebugEnabled)
+  {
+    //Create a WireframeVisual if we have debug enabled
+    visualPtr = WireframeVisual::New(GetFactoryCache(), visualPtr, *propertyMap);
+  }
+
+  return Toolkit::Visual::Base(visualPtr.Get());
+}
+
 Toolkit::Visual::Base VisualFactory::CreateVisual(const std::string& url, ImageDimensions size)
 {
   return CreateVisual(url, size, mDefaultCreationOptions);
@@ -445,6 +517,70 @@ void VisualFactory::UsePreCompiledShader()
   ShaderPreCompiler::Get().SavePreCompileShaderList(rawShaderList);
 }
 
+void VisualFactory::UsePreCompiledShader(const std::vector<std::string>& shaderNames)
+{
+  if(mPrecompiledShaderRequested)
+  {
+    return;
+  }
+
+  // Add the shaders in the given order. The variants of the same shader given in a row are compiled as a batch.
+  std::vector<RawShaderData> rawShaderList;
+  std::vector<bool>          shaderAdded(VisualFactoryCache::SHADER_TYPE_MAX + 1, false);
+  for(const auto& shaderName : shaderNames)
+  {
+    VisualFactoryCache::ShaderType shaderType;
+    if(!Scripting::GetEnumeration<VisualFactoryCache::ShaderType>(shaderName.c_str(), VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT, shaderType))
+    {
+      DALI_LOG_ERROR("Unknown shader [%s] is not precompiled\n", shaderName.c_str());
+      continue;
+    }
+
+    if(shaderAdded[shaderType])
+    {
+      continue;
+    }
+
+    if(GetImageVisualShaderFactory().AddPreCompiledShader(shaderType, rawShaderList) ||
+       GetTextVisualShaderFactory().AddPreCompiledShader(shaderType, rawShaderList) ||
+       AddPreCompiledColorShader(shaderType, rawShaderList))
+    {
+      shaderAdded[shaderType] = true;
+    }
+    else
+    {
+      DALI_LOG_RELEASE_INFO("Shader [%s] cannot be precompiled\n", shaderName.c_str());
+    }
+  }
+
+  if(rawShaderList.empty())
+  {
+    return;
+  }
+  mPrecompiledShaderRequested = true;
+
+  ShaderPreCompiler::Get().Enable();
+  ShaderPreCompiler::Get().SavePreCompileShaderList(rawShaderList);
+}
+
+void VisualFactory::EnableShaderUsageLog(bool enable)
+{
+  GetFactoryCache().EnableShaderUsageLog(enable);
+}
+
+std::vector<std::string> VisualFactory::GetShaderUsageLog() const
+{
+  std::vector<std::string> shaderNames;
+  if(mFactoryCache)
+  {
+    for(const auto shaderType : mFactoryCache->GetShaderUsageLog())
+    {
+      shaderNames.emplace_back(Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(shaderType, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
+    }
+  }
+  return shaderNames;
+}
+
 Internal::TextureManager& VisualFactory::GetTextureManager()
 {
   return GetFactoryCache().GetTextureManager();
@@ -455,6 +591,16 @@ Internal::SvgLoader& VisualFactory::GetSvgLoader()
   return GetFactoryCache().GetSvgLoader();
 }
 
+Shader VisualFactory::GetBlurShader(uint32_t numberOfSamples)
+{
+  return GetFactoryCache().GetBlurShader(numberOfSamples);
+}
+
+Shader VisualFactory::GetDualKawaseBlurShader(bool upsample)
+{
+  return GetFactoryCache().GetDualKawaseBlurShader(upsample);
+}
+
 void VisualFactory::SetBrokenImageUrl(Toolkit::StyleManager& styleManager)
 {
   const std::string        imageDirPath   = AssetManager::GetDaliImagePath();
@@ -482,12 +628,15 @@ void VisualFactory::GetPreCompiledShader(RawShaderData& shaders)
   std::vector<std::string_view> shaderName;
   int                           shaderCount = 0;
   shaders.shaderCount                       = 0;
-  for(uint32_t i = 0u; i < SHADER_TYPE_COUNT; ++i)
+  for(const auto& variant : COLOR_SHADER_VARIANTS)
   {
-    vertexPrefix.push_back(VertexPredefines[i]);
-    fragmentPrefix.push_back(FragmentPredefines[i]);
-    shaderName.push_back(Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(ShaderTypePredefines[i], VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
-    shaderCount++;
+    if(variant.precompile)
+    {
+      vertexPrefix.push_back(variant.vertexPrefix);
+      fragmentPrefix.push_back(variant.fragmentPrefix);
+      shaderName.push_back(Scripting::GetLinearEnumerationName<VisualFactoryCache::ShaderType>(variant.shaderType, VISUAL_SHADER_TYPE_TABLE, VISUAL_SHADER_TYPE_TABLE_COUNT));
+      shaderCount++;
+    }
   }
 
   shaders.vertexPrefix   = vertexPrefix;
@@ -35,6 +35,7 @@ namespace Toolkit
 namespace Internal
 {
 class VisualFactoryCache;
+class BackgroundBlurService;
 class ImageVisualShaderFactory;
 class TextVisualShaderFactory;
 
@@ -86,6 +87,11 @@ public:
    */
   Toolkit::Visual::Base CreateVisual(const std::string& image, ImageDimensions size, Toolkit::VisualFactory::CreationOptions creationOptions);
 
+  /**
+   * @copydoc Toolkit::VisualFactory::CreateVisual( const VisualPrototype&, const Property::Map& )
+   */
+  Toolkit::Visual::Base CreateVisual(const Toolkit::VisualPrototype& prototype, const Property::Map& overrides);
+
   /**
    * @copydoc Toolkit::VisualFactory::SetPreMultiplyOnLoad()
    */
@@ -116,6 +122,21 @@ public:
    */
   void UsePreCompiledShader();
 
+  /**
+   * @copydoc Toolkit::VisualFactory::UsePreCompiledShader(const std::vector<std::string>&)
+   */
+  void UsePreCompiledShader(const std::vector<std::string>& shaderNames);
+
+  /**
+   * @copydoc Toolkit::VisualFactory::EnableShaderUsageLog()
+   */
+  void EnableShaderUsageLog(bool enable);
+
+  /**
+   * @copydoc Toolkit::VisualFactory::GetShaderUsageLog()
+   */
+  std::vector<std::string> GetShaderUsageLog() const;
+
   /**
    * @return the reference to texture manager
    */
@@ -126,6 +147,26 @@ public:
    */
   Internal::SvgLoader& GetSvgLoader();
 
+  /**
+   * @copydoc Internal::VisualFactoryCache::GetBlurShader()
+   */
+  Shader GetBlurShader(uint32_t numberOfSamples);
+
+  /**
+   * @copydoc Internal::VisualFactoryCache::GetDualKawaseBlurShader()
+   */
+  Shader GetDualKawaseBlurShader(bool upsample);
+
+  /**
+   * @brief Retrieves the background blur services of the windows.
+   * @note The services add themselves when they are created, and remove themselves when they are destroyed.
+   * @return The services.
+   */
+  std::vector<BackgroundBlurService*>& GetBackgroundBlurServices()
+  {
+    return mBackgroundBlurServices;
+  }
+
 protected:
   /**
    * A reference counted object may only be deleted by calling Unreference()
@@ -183,6 +224,8 @@ private:
   using DiscardedVisualContainer = std::vector<Toolkit::Visual::Base>;
   DiscardedVisualContainer mDiscardedVisuals{};
 
+  std::vector<BackgroundBlurService*> mBackgroundBlurServices{}; ///< Not owned. The services of the windows.
+
   Toolkit::VisualFactory::CreationOptions mDefaultCreationOptions : 2;
 
   bool mDebugEnabled : 1;
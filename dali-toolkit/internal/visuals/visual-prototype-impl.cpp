@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/visual-prototype-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/scripting/scripting.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/color/color-visual.h>
+#include <dali-toolkit/internal/visuals/image/image-visual.h>
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali-toolkit/public-api/visuals/image-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+VisualPrototypePtr VisualPrototype::New(const Property::Map& propertyMap)
+{
+  return VisualPrototypePtr(new VisualPrototype(propertyMap));
+}
+
+VisualPrototype::VisualPrototype(const Property::Map& propertyMap)
+: mSourceProperties(propertyMap),
+  mProperties(),
+  mUrl(),
+  mType(Toolkit::DevelVisual::IMAGE), // Default to IMAGE type, as the factory does.
+  mParsed(false)
+{
+  Property::Value* typeValue = propertyMap.Find(Toolkit::Visual::Property::TYPE, VISUAL_TYPE);
+  if(typeValue)
+  {
+    Scripting::GetEnumerationProperty(*typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, mType);
+  }
+
+  if(mType == Toolkit::Visual::IMAGE || mType == Toolkit::Visual::ANIMATED_IMAGE)
+  {
+    Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
+    std::string      imageUrl;
+    if(imageURLValue && imageURLValue->Get(imageUrl) && !imageUrl.empty())
+    {
+      mUrl = VisualUrl(imageUrl);
+
+      // The other kinds of url are loaded by the visuals which read their own property names
+      mParsed = (mUrl.GetType() == VisualUrl::REGULAR_IMAGE);
+    }
+  }
+  else
+  {
+    mParsed = (mType == Toolkit::Visual::COLOR);
+  }
+
+  if(mParsed)
+  {
+    Normalize(propertyMap, mProperties);
+  }
+}
+
+VisualPrototype::~VisualPrototype()
+{
+}
+
+bool VisualPrototype::Merge(const Property::Map& overrides, Property::Map& properties, VisualUrl& url) const
+{
+  Property::Map normalizedOverrides;
+  Normalize(overrides, normalizedOverrides);
+
+  bool sameKind = mParsed && !normalizedOverrides.Find(Toolkit::Visual::Property::TYPE);
+  if(sameKind && mType != Toolkit::Visual::COLOR)
+  {
+    Property::Value* imageURLValue = normalizedOverrides.Find(Toolkit::ImageVisual::Property::URL);
+    if(imageURLValue)
+    {
+      std::string imageUrl;
+      if(imageURLValue->Get(imageUrl) && !imageUrl.empty())
+      {
+        url      = VisualUrl(imageUrl);
+        sameKind = (url.GetType() == mUrl.GetType());
+      }
+      else
+      {
+        sameKind = false;
+      }
+    }
+  }
+
+  if(sameKind)
+  {
+    properties = mProperties;
+    properties.Merge(normalizedOverrides);
+    return true;
+  }
+
+  // Leave out the source properties which are overridden by either of their keys, e.g. the type of the visual
+  properties.Clear();
+  for(Property::Map::SizeType i = 0; i < mSourceProperties.Count(); ++i)
+  {
+    KeyValuePair    pair  = mSourceProperties.GetKeyValue(i);
+    Property::Key   key   = pair.first;
+    Property::Value value = pair.second;
+    NormalizeProperty(key, value);
+
+    if(!(key.type == Property::Key::INDEX ? normalizedOverrides.Find(key.indexKey) : normalizedOverrides.Find(key.stringKey)))
+    {
+      if(pair.first.type == Property::Key::INDEX)
+      {
+        properties.Insert(pair.first.indexKey, pair.second);
+      }
+      else
+      {
+        properties.Insert(pair.first.stringKey, pair.second);
+      }
+    }
+  }
+  properties.Merge(overrides);
+  return false;
+}
+
+void VisualPrototype::Normalize(const Property::Map& source, Property::Map& properties) const
+{
+  for(Property::Map::SizeType i = 0; i < source.Count(); ++i)
+  {
+    KeyValuePair    pair  = source.GetKeyValue(i);
+    Property::Key   key   = pair.first;
+    Property::Value value = pair.second;
+    NormalizeProperty(key, value);
+
+    if(pair.first.type == Property::Key::STRING && key.type == Property::Key::INDEX && source.Find(key.indexKey))
+    {
+      // Keep the name, as the visual may read either of them
+      key   = pair.first;
+      value = pair.second;
+    }
+
+    if(key.type == Property::Key::INDEX)
+    {
+      properties.Insert(key.indexKey, value);
+    }
+    else
+    {
+      properties.Insert(key.stringKey, value);
+    }
+  }
+}
+
+void VisualPrototype::NormalizeProperty(Property::Key& key, Property::Value& value) const
+{
+  if(key == VISUAL_TYPE)
+  {
+    key = Property::Key(Toolkit::Visual::Property::TYPE);
+  }
+  else if(mType == Toolkit::Visual::COLOR)
+  {
+    ColorVisual::NormalizeProperty(key, value);
+  }
+  else if(key == IMAGE_URL_NAME)
+  {
+    key = Property::Key(Toolkit::ImageVisual::Property::URL);
+  }
+  else
+  {
+    ImageVisual::NormalizeProperty(key, value);
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
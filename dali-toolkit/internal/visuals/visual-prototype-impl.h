@@ -0,0 +1,164 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VISUAL_PROTOTYPE_H
+#define DALI_TOOLKIT_INTERNAL_VISUAL_PROTOTYPE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visual-factory/visual-prototype.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class VisualPrototype;
+typedef IntrusivePtr<VisualPrototype> VisualPrototypePtr;
+
+/**
+ * @copydoc Toolkit::VisualPrototype
+ */
+class VisualPrototype : public BaseObject
+{
+public:
+  /**
+   * @brief Creates a prototype, parsing the property map.
+   * @param[in] propertyMap The properties of the visual
+   * @return A pointer to the prototype
+   */
+  static VisualPrototypePtr New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Whether the properties are parsed, i.e. the prototype creates a color visual or an image visual of a regular image.
+   * The prototypes of the other visuals are created from their property maps.
+   */
+  bool IsParsed() const
+  {
+    return mParsed;
+  }
+
+  /**
+   * @brief Retrieves the type of the visual.
+   */
+  Toolkit::DevelVisual::Type GetType() const
+  {
+    return mType;
+  }
+
+  /**
+   * @brief Retrieves the url of the image, if the prototype creates an image visual.
+   */
+  const VisualUrl& GetUrl() const
+  {
+    return mUrl;
+  }
+
+  /**
+   * @brief Retrieves the parsed properties, whose keys are indices where the visual has them.
+   */
+  const Property::Map& GetProperties() const
+  {
+    return mProperties;
+  }
+
+  /**
+   * @brief Retrieves the properties the prototype was created with.
+   */
+  const Property::Map& GetSourceProperties() const
+  {
+    return mSourceProperties;
+  }
+
+  /**
+   * @brief Merges the properties of a visual to the properties of the prototype.
+   *
+   * @param[in] overrides The properties which differ from the prototype
+   * @param[out] properties The merged properties
+   * @param[out] url The url of the image, if the overrides change it
+   * @return false if the prototype is not parsed, or the overrides change the type of the visual or the kind of the url,
+   * in which case properties are the source properties overridden, for the visual to be created from them
+   */
+  bool Merge(const Property::Map& overrides, Property::Map& properties, VisualUrl& url) const;
+
+protected:
+  /**
+   * @brief Constructor.
+   * @param[in] propertyMap The properties of the visual
+   */
+  VisualPrototype(const Property::Map& propertyMap);
+
+  /**
+   * A ref counted object may only be deleted by calling Unreference
+   */
+  ~VisualPrototype() override;
+
+private:
+  /**
+   * @brief Converts the string keys and enumeration strings to the indices and values the visual reads.
+   * A string key is kept where the map has its index as well, as the visuals differ in which of them is used.
+   * @param[in] source The properties to convert
+   * @param[out] properties The converted properties
+   */
+  void Normalize(const Property::Map& source, Property::Map& properties) const;
+
+  /**
+   * @brief Converts a property to the index and value the visual reads.
+   * @param[in,out] key The key of the property
+   * @param[in,out] value The value of the property
+   */
+  void NormalizeProperty(Property::Key& key, Property::Value& value) const;
+
+private: // Unimplemented methods
+  VisualPrototype(const VisualPrototype&);
+  VisualPrototype& operator=(const VisualPrototype&);
+
+private:
+  Property::Map              mSourceProperties; ///< The properties given
+  Property::Map              mProperties;       ///< The parsed properties
+  VisualUrl                  mUrl;
+  Toolkit::DevelVisual::Type mType;
+  bool                       mParsed;
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Internal::VisualPrototype& GetImplementation(Dali::Toolkit::VisualPrototype& handle)
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualPrototype handle is empty");
+  BaseObject& object = handle.GetBaseObject();
+  return static_cast<Internal::VisualPrototype&>(object);
+}
+
+inline const Internal::VisualPrototype& GetImplementation(const Dali::Toolkit::VisualPrototype& handle)
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualPrototype handle is empty");
+  const BaseObject& object = handle.GetBaseObject();
+  return static_cast<const Internal::VisualPrototype&>(object);
+}
+
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VISUAL_PROTOTYPE_H
@@ -210,81 +210,90 @@ std::shared_ptr<Toolkit::DevelControl::ControlAccessible> Control::GetAccessible
 
 void Control::EnableGestureDetection(GestureType::Value type)
 {
-  if((type & GestureType::PINCH) && !mImpl->mPinchGestureDetector)
+  Impl::GestureData& gestureData = mImpl->EnsureGestureData();
+
+  if((type & GestureType::PINCH) && !gestureData.mPinchGestureDetector)
   {
-    mImpl->mPinchGestureDetector = PinchGestureDetector::New();
-    mImpl->mPinchGestureDetector.DetectedSignal().Connect(mImpl, &Impl::PinchDetected);
-    mImpl->mPinchGestureDetector.Attach(Self());
+    gestureData.mPinchGestureDetector = PinchGestureDetector::New();
+    gestureData.mPinchGestureDetector.DetectedSignal().Connect(mImpl, &Impl::PinchDetected);
+    gestureData.mPinchGestureDetector.Attach(Self());
   }
 
-  if((type & GestureType::PAN) && !mImpl->mPanGestureDetector)
+  if((type & GestureType::PAN) && !gestureData.mPanGestureDetector)
   {
-    mImpl->mPanGestureDetector = PanGestureDetector::New();
-    mImpl->mPanGestureDetector.SetMaximumTouchesRequired(2);
-    mImpl->mPanGestureDetector.DetectedSignal().Connect(mImpl, &Impl::PanDetected);
-    mImpl->mPanGestureDetector.Attach(Self());
+    gestureData.mPanGestureDetector = PanGestureDetector::New();
+    gestureData.mPanGestureDetector.SetMaximumTouchesRequired(2);
+    gestureData.mPanGestureDetector.DetectedSignal().Connect(mImpl, &Impl::PanDetected);
+    gestureData.mPanGestureDetector.Attach(Self());
   }
 
-  if((type & GestureType::TAP) && !mImpl->mTapGestureDetector)
+  if((type & GestureType::TAP) && !gestureData.mTapGestureDetector)
   {
-    mImpl->mTapGestureDetector = TapGestureDetector::New();
-    mImpl->mTapGestureDetector.DetectedSignal().Connect(mImpl, &Impl::TapDetected);
-    mImpl->mTapGestureDetector.Attach(Self());
+    gestureData.mTapGestureDetector = TapGestureDetector::New();
+    gestureData.mTapGestureDetector.DetectedSignal().Connect(mImpl, &Impl::TapDetected);
+    gestureData.mTapGestureDetector.Attach(Self());
   }
 
-  if((type & GestureType::LONG_PRESS) && !mImpl->mLongPressGestureDetector)
+  if((type & GestureType::LONG_PRESS) && !gestureData.mLongPressGestureDetector)
   {
-    mImpl->mLongPressGestureDetector = LongPressGestureDetector::New();
-    mImpl->mLongPressGestureDetector.DetectedSignal().Connect(mImpl, &Impl::LongPressDetected);
-    mImpl->mLongPressGestureDetector.Attach(Self());
+    gestureData.mLongPressGestureDetector = LongPressGestureDetector::New();
+    gestureData.mLongPressGestureDetector.DetectedSignal().Connect(mImpl, &Impl::LongPressDetected);
+    gestureData.mLongPressGestureDetector.Attach(Self());
   }
 }
 
 void Control::DisableGestureDetection(GestureType::Value type)
 {
-  if((type & GestureType::PINCH) && mImpl->mPinchGestureDetector)
+  if(!mImpl->mGestureData)
+  {
+    return;
+  }
+
+  Impl::GestureData& gestureData = *mImpl->mGestureData;
+
+  if((type & GestureType::PINCH) && gestureData.mPinchGestureDetector)
   {
-    mImpl->mPinchGestureDetector.Detach(Self());
-    mImpl->mPinchGestureDetector.Reset();
+    gestureData.mPinchGestureDetector.Detach(Self());
+    gestureData.mPinchGestureDetector.Reset();
   }
 
-  if((type & GestureType::PAN) && mImpl->mPanGestureDetector)
+  if((type & GestureType::PAN) && gestureData.mPanGestureDetector)
   {
-    mImpl->mPanGestureDetector.Detach(Self());
-    mImpl->mPanGestureDetector.Reset();
+    gestureData.mPanGestureDetector.Detach(Self());
+    gestureData.mPanGestureDetector.Reset();
   }
 
-  if((type & GestureType::TAP) && mImpl->mTapGestureDetector)
+  if((type & GestureType::TAP) && gestureData.mTapGestureDetector)
   {
-    mImpl->mTapGestureDetector.Detach(Self());
-    mImpl->mTapGestureDetector.Reset();
+    gestureData.mTapGestureDetector.Detach(Self());
+    gestureData.mTapGestureDetector.Reset();
   }
 
-  if((type & GestureType::LONG_PRESS) && mImpl->mLongPressGestureDetector)
+  if((type & GestureType::LONG_PRESS) && gestureData.mLongPressGestureDetector)
   {
-    mImpl->mLongPressGestureDetector.Detach(Self());
-    mImpl->mLongPressGestureDetector.Reset();
+    gestureData.mLongPressGestureDetector.Detach(Self());
+    gestureData.mLongPressGestureDetector.Reset();
   }
 }
 
 PinchGestureDetector Control::GetPinchGestureDetector() const
 {
-  return mImpl->mPinchGestureDetector;
+  return mImpl->mGestureData ? mImpl->mGestureData->mPinchGestureDetector : PinchGestureDetector();
 }
 
 PanGestureDetector Control::GetPanGestureDetector() const
 {
-  return mImpl->mPanGestureDetector;
+  return mImpl->mGestureData ? mImpl->mGestureData->mPanGestureDetector : PanGestureDetector();
 }
 
 TapGestureDetector Control::GetTapGestureDetector() const
 {
-  return mImpl->mTapGestureDetector;
+  return mImpl->mGestureData ? mImpl->mGestureData->mTapGestureDetector : TapGestureDetector();
 }
 
 LongPressGestureDetector Control::GetLongPressGestureDetector() const
 {
-  return mImpl->mLongPressGestureDetector;
+  return mImpl->mGestureData ? mImpl->mGestureData->mLongPressGestureDetector : LongPressGestureDetector();
 }
 
 void Control::SetKeyboardNavigationSupport(bool isSupported)
@@ -490,18 +499,14 @@ void Control::OnStyleChange(Toolkit::StyleManager styleManager, StyleChange::Typ
 
 void Control::OnPinch(const PinchGesture& pinch)
 {
-  if(!(mImpl->mStartingPinchScale))
-  {
-    // lazy allocate
-    mImpl->mStartingPinchScale = new Vector3;
-  }
+  Vector3& startingPinchScale = mImpl->EnsureGestureData().mStartingPinchScale;
 
   if(pinch.GetState() == GestureState::STARTED)
   {
-    *(mImpl->mStartingPinchScale) = Self().GetCurrentProperty<Vector3>(Actor::Property::SCALE);
+    startingPinchScale = Self().GetCurrentProperty<Vector3>(Actor::Property::SCALE);
   }
 
-  Self().SetProperty(Actor::Property::SCALE, *(mImpl->mStartingPinchScale) * pinch.GetScale());
+  Self().SetProperty(Actor::Property::SCALE, startingPinchScale * pinch.GetScale());
 }
 
 void Control::OnPan(const PanGesture& pan)
@@ -19,6 +19,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -39,10 +40,24 @@ constexpr string_view SHADER_EXTENSIONS[] =
 {
   ".vert",
   ".frag",
-  ".def"
+  ".def",
+  ".variants"
 };
 // clang-format on
 
+/// The extension of the files which list the variants of the shader with the same name.
+constexpr string_view VARIANTS_EXTENSION = ".variants";
+
+/// The extensions of the vertex & fragment shaders the variants are expanded from.
+constexpr string_view VERTEX_SHADER_EXTENSION   = ".vert";
+constexpr string_view FRAGMENT_SHADER_EXTENSION = ".frag";
+
+/// The prefix of the defines of a variant.
+constexpr string_view DEFINE_PREFIX = "#define ";
+
+/// The prefix of the lines DALi parses from the shaders, which are not stripped as the other comments are.
+constexpr string_view DALI_DIRECTIVE_PREFIX = "//@";
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// Function & variable to retrieve the size of the extension with the largest string size.
 constexpr auto GetShaderExtensionMaxSize()
@@ -81,6 +96,9 @@ void Usage()
   cout << "     -v|--version  Prints out the version" << endl;
   cout << "     -h|--help     Help" << endl;
   cout << "  NOTE: The options can be placed after the IN_DIR & OUT_DIR as well" << endl;
+  cout << "  A \"" << VARIANTS_EXTENSION << "\" file lists the variants of the \"" << VERTEX_SHADER_EXTENSION << "\" & \"" << FRAGMENT_SHADER_EXTENSION << "\" files with the same name," << endl;
+  cout << "  one per line as \"NAME [precompile] : VERTEX_DEFINES : FRAGMENT_DEFINES\"." << endl;
+  cout << "  Each variant is generated with its defines expanded into the shader source, of which the comments & white space are stripped." << endl;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -126,15 +144,118 @@ fs::path GetShaderOutputFilePath(fs::path& outDir, const string& filename)
   return outFilename;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Reads the source of a shader.
+/// Note : we should skip empty headline to guarantee that "#version ~~~" as top of shader code.
+/// @param[in]  shaderFile  The input shader file
+/// @return The source of the shader, each line ending with a new line
+string ReadShaderSource(ifstream& shaderFile)
+{
+  string source;
+  string line;
+  bool   firstLinePrinted = false;
+  while(getline(shaderFile, line))
+  {
+    if(!firstLinePrinted && line.find_first_not_of(" \t\r\n") == std::string::npos)
+    {
+      // Empty string occured!
+      continue;
+    }
+    firstLinePrinted = true;
+    source += line + "\n";
+  }
+  return source;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Strips the comments & the white space which the shader compiler does not need from the source of a shader.
+/// The lines are kept, as the preprocessor directives end with them. The "//@" lines are kept for DALi to parse.
+/// @param[in]  source  The source of the shader, each line ending with a new line
+/// @return The stripped source, each line ending with a new line
+string StripShaderSource(const string& source)
+{
+  istringstream stream(source);
+  string        stripped;
+  string        line;
+  bool          inBlockComment = false;
+  while(getline(stream, line))
+  {
+    const auto start = line.find_first_not_of(" \t\r");
+    if(start == string::npos)
+    {
+      continue;
+    }
+    if(!inBlockComment && line.compare(start, DALI_DIRECTIVE_PREFIX.size(), DALI_DIRECTIVE_PREFIX) == 0)
+    {
+      stripped += line.substr(start) + "\n";
+      continue;
+    }
+
+    string strippedLine;
+    for(size_t i = start; i < line.size(); ++i)
+    {
+      if(inBlockComment)
+      {
+        if(line.compare(i, 2, "*/") == 0)
+        {
+          inBlockComment = false;
+          ++i;
+        }
+      }
+      else if(line.compare(i, 2, "//") == 0)
+      {
+        break;
+      }
+      else if(line.compare(i, 2, "/*") == 0)
+      {
+        // A comment separates the tokens as white space does.
+        inBlockComment = true;
+        strippedLine += ' ';
+        ++i;
+      }
+      else if(line[i] == ' ' || line[i] == '\t' || line[i] == '\r')
+      {
+        strippedLine += ' ';
+      }
+      else
+      {
+        strippedLine += line[i];
+      }
+    }
+
+    // Collapse the white space to a space, which keeps the tokens apart.
+    string collapsedLine;
+    for(const auto character : strippedLine)
+    {
+      if(character != ' ' || (!collapsedLine.empty() && collapsedLine.back() != ' '))
+      {
+        collapsedLine += character;
+      }
+    }
+    while(!collapsedLine.empty() && collapsedLine.back() == ' ')
+    {
+      collapsedLine.pop_back();
+    }
+
+    if(!collapsedLine.empty())
+    {
+      stripped += collapsedLine + "\n";
+    }
+  }
+  return stripped;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// Generates the header file from the input shader file.
 /// @param[in]  shaderFile          The full path of the input shader file
 /// @param[in]  shaderVariableName  The variable name to use for the string_view
 /// @param[in]  outFilePath         The full path to the output file
+/// @param[in]  strip               Whether to strip the comments & white space from the shader
 void GenerateHeaderFile(
   ifstream&       shaderFile,
   const string&   shaderVariableName,
-  const fs::path& outFilePath)
+  const fs::path& outFilePath,
+  bool            strip)
 {
   cout << "  Generating \"" << shaderVariableName << "\" in " << outFilePath.filename();
   ofstream outFile(outFilePath);
@@ -147,21 +268,150 @@ void GenerateHeaderFile(
 
     // Using Raw String Literal to generate shader files as this will simplify the file layout.
     // And it will fix some compilation warnings about missing terminating strings.
-    // Note : we should skip empty headline to guarantee that "#version ~~~" as top of shader code.
-    outFile << "R\"(";
-    string line;
-    bool   firstLinePrinted = false;
-    while(getline(shaderFile, line))
+    const string source(ReadShaderSource(shaderFile));
+    outFile << "R\"(" << (strip ? StripShaderSource(source) : source) << ")\"" << endl;
+    outFile << "};" << endl;
+    cout << " [OK]" << endl;
+  }
+  else
+  {
+    cout << " [FAIL]" << endl;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// A variant of a shader, as listed in the variants file.
+struct Variant
+{
+  string name;           ///< The name of the variant
+  bool   precompile;     ///< Whether the variant is precompiled
+  string vertexPrefix;   ///< The defines of the vertex shader
+  string fragmentPrefix; ///< The defines of the fragment shader
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Converts the names of the defines to the lines which define them.
+/// @param[in]  names  The names of the defines, separated by white space
+/// @return The defines, each line ending with a new line
+string GetDefines(const string& names)
+{
+  istringstream stream(names);
+  string        name;
+  string        defines;
+  while(stream >> name)
+  {
+    defines += string(DEFINE_PREFIX) + name + "\n";
+  }
+  return defines;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Converts the defines to a string literal.
+/// @param[in]  defines  The defines, each line ending with a new line
+/// @return The string literal, with the new lines escaped
+string GetDefinesLiteral(const string& defines)
+{
+  string literal("\"");
+  for(const auto character : defines)
+  {
+    if(character == '\n')
     {
-      if(!firstLinePrinted && line.find_first_not_of(" \t\r\n") == std::string::npos)
+      literal += "\\n";
+    }
+    else
+    {
+      literal += character;
+    }
+  }
+  return literal + "\"";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Reads the variants from the variants file.
+/// Each line is "NAME [precompile] : VERTEX_DEFINES : FRAGMENT_DEFINES", where the defines are separated by white space.
+/// Anything after a '#' is a comment.
+/// @param[in]   variantsFile  The input variants file
+/// @param[out]  variants      The variants read
+/// @return true if all the lines are valid
+bool ReadVariants(ifstream& variantsFile, vector<Variant>& variants)
+{
+  string line;
+  while(getline(variantsFile, line))
+  {
+    const auto commentPosition = line.find('#');
+    if(commentPosition != string::npos)
+    {
+      line.erase(commentPosition);
+    }
+    if(line.find_first_not_of(" \t\r\n") == string::npos)
+    {
+      continue;
+    }
+
+    const auto vertexPosition   = line.find(':');
+    const auto fragmentPosition = (vertexPosition == string::npos) ? string::npos : line.find(':', vertexPosition + 1);
+    if(fragmentPosition == string::npos)
+    {
+      cerr << "ERROR: Invalid variant \"" << line << "\"" << endl;
+      return false;
+    }
+
+    Variant       variant{"", false, GetDefines(line.substr(vertexPosition + 1, fragmentPosition - vertexPosition - 1)), GetDefines(line.substr(fragmentPosition + 1))};
+    istringstream nameStream(line.substr(0, vertexPosition));
+    string        option;
+    nameStream >> variant.name;
+    while(nameStream >> option)
+    {
+      if(option == "precompile")
+      {
+        variant.precompile = true;
+      }
+      else
       {
-        // Empty string occured!
-        continue;
+        cerr << "ERROR: Invalid option \"" << option << "\" of variant " << variant.name << endl;
+        return false;
       }
-      firstLinePrinted = true;
-      outFile << line << endl;
     }
-    outFile << ")\"" << endl;
+    variants.emplace_back(std::move(variant));
+  }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Generates the header file with the variants of a shader, expanding their defines into the shader source.
+/// @param[in]  variants            The variants of the shader
+/// @param[in]  vertexShader        The source of the vertex shader
+/// @param[in]  fragmentShader      The source of the fragment shader
+/// @param[in]  shaderVariableName  The variable name to use for the array of the variants
+/// @param[in]  outFilePath         The full path to the output file
+void GenerateVariantsHeaderFile(
+  const vector<Variant>& variants,
+  const string&          vertexShader,
+  const string&          fragmentShader,
+  const string&          shaderVariableName,
+  const fs::path&        outFilePath)
+{
+  cout << "  Generating \"" << shaderVariableName << "\" in " << outFilePath.filename();
+  ofstream outFile(outFilePath);
+  if(outFile.is_open())
+  {
+    outFile << "#pragma once" << endl
+            << endl;
+    outFile << "const BuiltInShaderVariant " << shaderVariableName << "[" << variants.size() << "]" << endl;
+    outFile << "{" << endl;
+    for(const auto& variant : variants)
+    {
+      const string vertexPrefix(GetDefinesLiteral(variant.vertexPrefix));
+      const string fragmentPrefix(GetDefinesLiteral(variant.fragmentPrefix));
+      outFile << "  {" << endl;
+      outFile << "    \"" << variant.name << "\"," << endl;
+      outFile << "    " << (variant.precompile ? "true" : "false") << "," << endl;
+      outFile << "    " << vertexPrefix << "," << endl;
+      outFile << "    " << fragmentPrefix << "," << endl;
+      outFile << "    " << vertexPrefix << " R\"(" << vertexShader << ")\"," << endl;
+      outFile << "    " << fragmentPrefix << " R\"(" << fragmentShader << ")\"" << endl;
+      outFile << "  }," << endl;
+    }
     outFile << "};" << endl;
     cout << " [OK]" << endl;
   }
@@ -192,7 +442,17 @@ public:
   /// @param[in]  headerFileName  The name of the header used
   void Add(string&& variableName, const std::string& headerFilename)
   {
-    mVariableNames.emplace_back(variableName);
+    mVariableDeclarations.emplace_back("std::string_view " + variableName);
+    mHeaderFileNames.emplace_back(headerFilename);
+  }
+
+  /// Adds the array of the variants and the header file name to the appropriate vectors.
+  /// @param[in]  variableName    The variable name of the array of the variants
+  /// @param[in]  variantCount    The number of the variants
+  /// @param[in]  headerFileName  The name of the header used
+  void AddVariants(string&& variableName, size_t variantCount, const std::string& headerFilename)
+  {
+    mVariableDeclarations.emplace_back("BuiltInShaderVariant " + variableName + "[" + to_string(variantCount) + "]");
     mHeaderFileNames.emplace_back(headerFilename);
   }
 
@@ -200,10 +460,10 @@ public:
   void Generate()
   {
     GenerateFile(
-      mVariableNames,
+      mVariableDeclarations,
       mHeaderFilePath,
-      "#pragma once\n\n#include <string_view>\n\n",
-      "extern const std::string_view ",
+      string("#pragma once\n\n#include <string_view>\n\n") + string(VARIANT_STRUCT),
+      "extern const ",
       ";");
 
     GenerateFile(
@@ -249,12 +509,72 @@ private:
   constexpr static string_view HEADER_FILE_NAME = "builtin-shader-extern-gen.h";
   constexpr static string_view SOURCE_FILE_NAME = "builtin-shader-gen.cpp";
 
-  const string   mHeaderFilePath;  ///< Path to the header file to generate
-  const string   mSourceFilePath;  ///< Path to the source file to generate
-  vector<string> mVariableNames;   ///< Holds all the variable names added through Add
-  vector<string> mHeaderFileNames; ///< Holds all the header file names added through Add
+  // clang-format off
+  constexpr static string_view VARIANT_STRUCT =
+    "struct BuiltInShaderVariant\n"
+    "{\n"
+    "  std::string_view name;           ///< The name of the variant\n"
+    "  bool             precompile;     ///< Whether the variant is precompiled\n"
+    "  std::string_view vertexPrefix;   ///< The defines of the vertex shader\n"
+    "  std::string_view fragmentPrefix; ///< The defines of the fragment shader\n"
+    "  std::string_view vertexShader;   ///< The vertex shader, with the defines expanded\n"
+    "  std::string_view fragmentShader; ///< The fragment shader, with the defines expanded\n"
+    "};\n\n";
+  // clang-format on
+
+  const string   mHeaderFilePath;       ///< Path to the header file to generate
+  const string   mSourceFilePath;       ///< Path to the source file to generate
+  vector<string> mVariableDeclarations; ///< Holds all the variable declarations added through Add & AddVariants
+  vector<string> mHeaderFileNames;      ///< Holds all the header file names added through Add & AddVariants
 };
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Generates the header file with the variants listed in the variants file, if it is out of date.
+///
+/// @param[in]  path                The full path of the variants file
+/// @param[in]  outDir              The directory where the readable shaders will be outputted to
+/// @param[in]  generator           Accumulates the data for the built-in files
+/// @param[out] shaderGenerated     Set to true if the header file is generated
+/// @return 0 if successful, 1 if failure
+int GenerateVariants(const fs::path& path, fs::path& outDir, BuiltInFilesGenerator& generator, bool& shaderGenerated)
+{
+  const string filename(path.filename().string());
+  fs::path     vertexShaderPath(path);
+  fs::path     fragmentShaderPath(path);
+  vertexShaderPath.replace_extension(VERTEX_SHADER_EXTENSION);
+  fragmentShaderPath.replace_extension(FRAGMENT_SHADER_EXTENSION);
+
+  ifstream        variantsFile(path);
+  ifstream        vertexShaderFile(vertexShaderPath);
+  ifstream        fragmentShaderFile(fragmentShaderPath);
+  vector<Variant> variants;
+  if(!variantsFile.is_open() || !vertexShaderFile.is_open() || !fragmentShaderFile.is_open())
+  {
+    cerr << "ERROR: " << filename << " requires both " << vertexShaderPath.filename() << " & " << fragmentShaderPath.filename() << endl;
+    return 1;
+  }
+  if(!ReadVariants(variantsFile, variants))
+  {
+    cerr << "ERROR: Unable to read the variants in " << filename << endl;
+    return 1;
+  }
+
+  string   shaderVariableName(GetShaderVariableName(filename));
+  fs::path outFilePath(GetShaderOutputFilePath(outDir, filename));
+  // If output file already exists, then only overwrite if any of the input files is newer than output file
+  if(!fs::exists(outFilePath) ||
+     (fs::last_write_time(path) > fs::last_write_time(outFilePath)) ||
+     (fs::last_write_time(vertexShaderPath) > fs::last_write_time(outFilePath)) ||
+     (fs::last_write_time(fragmentShaderPath) > fs::last_write_time(outFilePath)))
+  {
+    // The variants share the stripped source of the shader, which is generated from the same file.
+    GenerateVariantsHeaderFile(variants, StripShaderSource(ReadShaderSource(vertexShaderFile)), StripShaderSource(ReadShaderSource(fragmentShaderFile)), shaderVariableName, outFilePath);
+    shaderGenerated = true;
+  }
+  generator.AddVariants(std::move(shaderVariableName), variants.size(), outFilePath.filename().string());
+  return 0;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// Generates the header files from the shaders in the input directory & built-in files if reqruied.
 ///
@@ -295,7 +615,15 @@ int GenerateShaderSources(fs::path inDir, fs::path outDir, const bool generateBu
     {
       for(const auto& extension : SHADER_EXTENSIONS)
       {
-        if(file.path().extension() == extension)
+        if(file.path().extension() == extension && extension == VARIANTS_EXTENSION)
+        {
+          if(GenerateVariants(file.path(), outDir, generator, shaderGenerated) != 0)
+          {
+            return 1;
+          }
+          break;
+        }
+        else if(file.path().extension() == extension)
         {
           const fs::path& path(file.path());
           const string    filename(path.filename().string());
@@ -307,7 +635,10 @@ int GenerateShaderSources(fs::path inDir, fs::path outDir, const bool generateBu
             // If output file already exists, then only overwrite if input file is newer than output file
             if(!fs::exists(outFilePath) || (fs::last_write_time(path) > fs::last_write_time(outFilePath)))
             {
-              GenerateHeaderFile(shaderFile, shaderVariableName, outFilePath);
+              // The source of a shader with variants is stripped as the variants are, so they are the prefixes & the source precompiled
+              const bool hasVariants = (extension == VERTEX_SHADER_EXTENSION || extension == FRAGMENT_SHADER_EXTENSION) &&
+                                       fs::exists(fs::path(path).replace_extension(VARIANTS_EXTENSION));
+              GenerateHeaderFile(shaderFile, shaderVariableName, outFilePath, hasVariants);
               shaderGenerated = true;
             }
             generator.Add(std::move(shaderVariableName), outFilePath.filename().string());
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <dali-toolkit/internal/builder/compiled-json.h>
+#include <dali-toolkit/internal/builder/json-parser-state.h>
+
+using namespace std;
+using namespace Dali::Toolkit;
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////
+string      PROGRAM_NAME; ///< We set the program name on this global early on for use in Usage.
+string_view VERSION = "1.0.0";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Prints out the Usage to standard output.
+void Usage()
+{
+  cout << "Usage: " << PROGRAM_NAME << " [OPTIONS] [IN_FILE] [OUT_FILE]" << endl;
+  cout << "  IN_FILE:  The JSON theme or style sheet to compile." << endl;
+  cout << "  OUT_FILE: The compiled file. The style manager loads IN_FILE" << Internal::CompiledJson::FILE_EXTENSION << " instead of IN_FILE." << endl;
+  cout << "            Any existing file of the same name will be overwritten." << endl;
+  cout << "  Options: " << endl;
+  cout << "     -h|--help     Help" << endl;
+  cout << "     -v|--version  Version" << endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Compiles the JSON file to the output file.
+int CompileTheme(const string& inFile, const string& outFile)
+{
+  ifstream in(inFile, ios::binary);
+  if(!in.is_open())
+  {
+    cerr << "ERROR: Unable to open " << inFile << endl;
+    return 1;
+  }
+
+  Internal::VectorChar source((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+  const uint32_t       sourceSize = static_cast<uint32_t>(source.size());
+  const uint64_t       sourceHash = Internal::CompiledJson::CalculateSourceHash(source.data(), source.size());
+
+  // The parser modifies the source, so the tree must be compiled before it is released
+  Internal::JsonParserState parserState(nullptr);
+  if(!parserState.ParseJson(source))
+  {
+    cerr << "ERROR: " << inFile << ":" << parserState.GetErrorLineNumber() << ":" << parserState.GetErrorColumn() << ": "
+         << parserState.GetErrorDescription() << endl;
+    return 1;
+  }
+
+  TreeNode* root = parserState.GetRoot();
+
+  vector<char> compiled;
+  Internal::CompiledJson::Compile(*root, sourceSize, sourceHash, compiled);
+
+  Internal::TreeNodeManipulator modify(root);
+  modify.RemoveChildren();
+  delete root;
+
+  ofstream out(outFile, ios::binary | ios::trunc);
+  if(!out.is_open() || !out.write(compiled.data(), compiled.size()))
+  {
+    cerr << "ERROR: Unable to write " << outFile << endl;
+    return 1;
+  }
+
+  cout << inFile << ": " << sourceSize << " -> " << compiled.size() << " bytes" << endl;
+  return 0;
+}
+
+} // unnamed namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  PROGRAM_NAME = argv[0];
+
+  string inFile;
+  string outFile;
+
+  for(auto i = 1; i < argc; ++i)
+  {
+    string option(argv[i]);
+    if(option == "--help" || option == "-h")
+    {
+      cout << "DALi Theme Compiler v" << VERSION << endl
+           << endl;
+      Usage();
+      return 0;
+    }
+    else if(option == "--version" || option == "-v")
+    {
+      cout << VERSION << endl;
+      return 0;
+    }
+    else if(*option.begin() == '-')
+    {
+      cerr << "ERROR: " << option << " is not a supported option" << endl;
+      Usage();
+      return 1;
+    }
+    else if(inFile.empty())
+    {
+      inFile = option;
+    }
+    else if(outFile.empty())
+    {
+      outFile = option;
+    }
+    else
+    {
+      cerr << "ERROR: Too many options" << endl;
+      Usage();
+      return 1;
+    }
+  }
+
+  if(inFile.empty() || outFile.empty())
+  {
+    cerr << "ERROR: Both IN_FILE & OUT_FILE not provided" << endl;
+    Usage();
+    return 1;
+  }
+
+  return CompileTheme(inFile, outFile);
+}
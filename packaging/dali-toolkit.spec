@@ -260,6 +260,13 @@ cp -r dali-toolkit/styles/1920x1080/* %{buildroot}%{dali_toolkit_style_files}/19
 mkdir -p %{buildroot}%{dali_toolkit_style_files}/1920x1080_rpi
 cp -r dali-toolkit/styles/1920x1080_rpi/* %{buildroot}%{dali_toolkit_style_files}/1920x1080_rpi
 
+# Compile the theme of each resolution next to its JSON, so the style manager loads it without parsing the JSON
+for RESOLUTION in 360x360 480x800 720x1280 1920x1080 1920x1080_rpi
+do
+  build/tizen/dali-theme-compiler %{buildroot}%{dali_toolkit_style_files}/${RESOLUTION}/dali-toolkit-default-theme.json \
+                                  %{buildroot}%{dali_toolkit_style_files}/${RESOLUTION}/dali-toolkit-default-theme.json.bin
+done
+
 # Copy default feedback theme
 cp dali-toolkit/styles/default-feedback-theme.json %{buildroot}%{dali_toolkit_style_files}
 
@@ -477,6 +484,7 @@ esac
 %{dev_include_path}/dali-toolkit/*
 %{_libdir}/pkgconfig/dali2-toolkit.pc
 %{_bindir}/dali-shader-generator
+%{_bindir}/dali-theme-compiler
 
 %files resources_360x360
 %manifest dali-toolkit-resources.manifest